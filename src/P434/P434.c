@@ -69,6 +69,19 @@ const uint64_t Montgomery_R2[NWORDS64_FIELD]     = { 0x28E55B65DCD69B30, 0xACEC7
 // Value one in Montgomery representation 
 const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x000000000000742C, 0x0000000000000000, 0x0000000000000000, 0xB90FF404FC000000, 
                                                      0xD801A4FB559FACD4, 0xE93254545F77410C, 0x0000ECEEA7BD2EDA };
+#if defined(AVX2_X4_IMPLEMENTATION)
+// Values 2*p434 and p434+1 in radix 2^28, used by the 4-way AVX2 implementation
+const uint64_t p434x2_x4[VNWORDS_FIELD]          = { 0xFFFFFFE, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xC5FFFFF,
+                                                     0xB82ECF5, 0xB15D47F, 0xCB8F062, 0x40ACF78, 0xFAD038A, 0x88D9F8B, 0xE4E2EE6, 0x0004683 };
+const uint64_t p434p1_x4[VNWORDS_FIELD]          = { 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0xE300000,
+                                                     0xDC1767A, 0x58AEA3F, 0x65C7831, 0x20567BC, 0xFD681C5, 0x446CFC5, 0xF271773, 0x0002341 };
+// Montgomery constant Montgomery_Rv = 2^448 mod p434, used for the conversion to the 4-way representation
+const uint64_t Montgomery_Rv[NWORDS64_FIELD]     = { 0x000000000000742C, 0x0000000000000000, 0x0000000000000000, 0xB90FF404FC000000,
+                                                     0xD801A4FB559FACD4, 0xE93254545F77410C, 0x0000ECEEA7BD2EDA };
+// Montgomery constant Montgomery_RRv = (2^448)^2/2^448 mod p434, used for the conversion from the 4-way representation
+const uint64_t Montgomery_RRv[NWORDS64_FIELD]    = { 0x000000000000742C, 0x0000000000000000, 0x0000000000000000, 0xB90FF404FC000000,
+                                                     0xD801A4FB559FACD4, 0xE93254545F77410C, 0x0000ECEEA7BD2EDA };
+#endif
 
 
 // Fixed parameters for isogeny tree computation
@@ -113,9 +126,29 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define mp_add_asm                    mp_add434_asm
 #define mp_subaddx2_asm               mp_subadd434x2_asm
 #define mp_dblsubx2_asm               mp_dblsub434x2_asm
+#if defined(X64_CURVE_ASM)
+    #define xDBLADD_asm               xDBLADD434_asm
+    #define xDBL_asm                  xDBL434_asm
+    #define xTPL_asm                  xTPL434_asm
+    #define eval_4_isog_asm           eval_4_isog434_asm
+    #define eval_3_isog_asm           eval_3_isog434_asm
+#endif
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp434
 #define crypto_kem_enc                crypto_kem_enc_SIKEp434
+#define crypto_kem_enc_parallel       crypto_kem_enc_parallel_SIKEp434
+#define crypto_kem_pk_prepare         crypto_kem_pk_prepare_SIKEp434
+#define crypto_kem_enc_prepared       crypto_kem_enc_prepared_SIKEp434
+#define crypto_kem_prepared_pk        crypto_kem_prepared_pk_SIKEp434
 #define crypto_kem_dec                crypto_kem_dec_SIKEp434
+#define crypto_kem_dec_init           crypto_kem_dec_init_SIKEp434
+#define crypto_kem_dec_step           crypto_kem_dec_step_SIKEp434
+#define crypto_kem_dec_finish         crypto_kem_dec_finish_SIKEp434
+#define crypto_kem_dec_state          crypto_kem_dec_state_SIKEp434
+#define crypto_kem_enc_batch4         crypto_kem_enc_batch4_SIKEp434
+#define crypto_kem_dec_batch4         crypto_kem_dec_batch4_SIKEp434
+#define crypto_kem_keypair_batch      crypto_kem_keypair_batch_SIKEp434
+#define crypto_kem_enc_batch          crypto_kem_enc_batch_SIKEp434
+#define crypto_kem_dec_batch          crypto_kem_dec_batch_SIKEp434
 #define random_mod_order_A            random_mod_order_A_SIDHp434
 #define random_mod_order_B            random_mod_order_B_SIDHp434
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp434
@@ -123,7 +156,18 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp434
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp434
 
+#if defined(FIXED_BASIS_LADDER)
+    #include "P434_ladder_tables.c"
+#endif
+#include "../safegcd.c"
 #include "../fpx.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"    
-#include "../sike.c"
\ No newline at end of file
+#include "../sike.c"
+#if defined(AVX2_X4_IMPLEMENTATION)
+    #include "../batch/fpx_x4.c"
+    #include "../batch/ec_isogeny_x4.c"
+    #include "../batch/sidh_x4.c"
+#endif
+#include "../batch/sike_x4.c"
+#include "../batch/sike_batch.c"
\ No newline at end of file
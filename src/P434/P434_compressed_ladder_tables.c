@@ -0,0 +1,765 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: precomputed tables for the fixed-basis three-point ladder for P434 when using compression
+*********************************************************************************************/ 
+
+// Alice's table {x([2^i]QA)}, i = 0,...,215, of affine x-coordinates in GF(p434^2) on the starting curve E: y^2 = x^3 + 6x^2 + x,
+// expressed in Montgomery representation. Each entry is stored as {x0, x1} (112 bytes per entry, 24192 bytes in total)
+const uint64_t A_ladder_table[OALICE_BITS*2*NWORDS64_FIELD] = {
+0x257DBD53095FD263, 0xBBB3C7A7B4EDB1D4, 0xA817B7FDDD5BB8DA, 0xF5DE963B242B7AB3,
+0x7F51B5362FC94CB6, 0xE7D2496B526DFF16, 0x0001E962CF69118C, 0xED9DC89467FB039D,
+0x17C71E114B5803D0, 0x816C3379BE9647BF, 0xB07F441A15434B64, 0xCC65C1804AF4CBD1,
+0xF06BF5F074032C77, 0x0001A251F94CF02C, 0x6448CB5BD976250E, 0x3092CF8C8803D8B4,
+0x2542331C81C2C2F8, 0x0C086E30DB24AA32, 0xD1B7F3E5532EE315, 0x226067DA42CD56DB,
+0x0001DEA86EB48D8A, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x750FCD24D96E6134, 0xE74B7652658B6360, 0x54FB85D2945C71AD, 0x30D1B20C44D34B1A,
+0x2A35B036AAA1FA7F, 0xA386CC5DD2A35670, 0x000129DCEEF6B91E, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x78B9C0B9A3BC410F, 0x71CB2BC7320553C6,
+0x316F5C32407BD0A7, 0x733D32E9D67A86A1, 0xFD9F746F110596E2, 0x9B9A25DD20DBBA4C,
+0x00002230D40AD4AB, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x976CCC8431FA83DB, 0x8C8284AF61466CBB, 0xB0AF134D7B823472, 0xA5A602EF7617FAF1,
+0x29E753580C00C5E3, 0xD872BD9B7C8ABF06, 0x0000BCA14BDEC1A5, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xFF1D65CA3CEB87C9, 0xB42F77A4ECD38FDD,
+0x10D4A99EF3C7A955, 0xA6C492479BFD913E, 0x7135F0CA6099CF42, 0xEAC7519C0110D625,
+0x0000920E4E66E088, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEBECB7300253C988, 0xD0BA966A73B96166, 0x6A80F889DA560535, 0x46012924EA24BF95,
+0x4FB083E882F0AE5E, 0x58444A6E206E406F, 0x000132A39E565E88, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x5BC1E231775CCA04, 0xBD14AAB4EF0F7D0E,
+0xB16B666A646CDD6D, 0x3053C9A1007407A5, 0x97DC803191C823AB, 0x1CD3D7F61B67586F,
+0x0001C116A5F6587A, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3F0D55442DEF9BFC, 0xC6FCFD68C4543DF4, 0xE8FDDA0B8B397428, 0xE0D2912D313B8655,
+0xB1BEBB6161EA4375, 0xBCF18ECF58B009AC, 0x000108B815AB2C7F, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x9BB49112E1983F2D, 0xFF567E8A6A208CC3,
+0xE82B79721517C379, 0xC8C745522498867B, 0xF6DA6C6DFC2A9BDF, 0x9B1C429A0F3723C7,
+0x0001B25FF8D8FB99, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD3696E6951E9DBFA, 0x8D3A301B3D438D24, 0xC92AE0676C6F85F6, 0x7C2EE6E9CF1056CB,
+0x2AC4E74DC535BE8C, 0x14DE822E315D9B36, 0x000206F8392EC6FF, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xD6D341AA9C6511B1, 0x269CE4DA19787A0F,
+0x5C40364FBEDB730D, 0xA9FD6C613FC72EDA, 0xA6A7317C25ED335A, 0x5479FD47A64209F7,
+0x0001B0A47E0C6EA3, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x99766C73104EF4DB, 0xA0EC15986B4E96BF, 0x56FD2630B8FE894D, 0xC3986F147A687DE4,
+0x3D190B7AB1F32434, 0xAB528BD73CF0675A, 0x00008754CC93430A, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x982B36BB77C7603A, 0x21351AB71BB1755B,
+0xD170325D69937E8E, 0x55A151E213F13C3C, 0xF774FCDA39FD0A26, 0xE41778F59E3B1455,
+0x00021A36CD3419A7, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9E8B6D6ED4F118E3, 0x26B43C36DA612DD9, 0x15B847B36354D5D3, 0x37535A22CEC26BBC,
+0xE08D7967E1133238, 0xDA0457688E35A4D5, 0x000049079BA027A7, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xAE7AE0E86C750DA6, 0x05F731A8E705CDE2,
+0x58D769F2E36FF7DE, 0xF4FDED1A228A6292, 0x03C40BD10006E7D1, 0x2FEED6B9F3D362EF,
+0x0001539A085557E3, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8839927AF53E2B19, 0xDB5E77050B6270A8, 0xDF500C79F8D3E234, 0xFF3973200C489137,
+0xC6CA61D5930F0852, 0xBF2B34B92C6914E1, 0x00013D008D2B34D1, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x4ED3669DF210E5D6, 0xA947F59FB6D56130,
+0x5638C08919F3E836, 0x52F4894F87C53F0C, 0x6CBC77B70937DB13, 0x96C26C62D65A65DE,
+0x0000B36F6A53A60F, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x112166B515B964C0, 0x086EC702AF6897D6, 0x15A1E4A44D712A9B, 0x053487294AD31C2A,
+0x6CD6196C6A0154E9, 0x531EAC00171E1C5E, 0x0000E3CBBE4770B4, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xAE520B158A1F0814, 0x0080A75BF1A049CF,
+0xCB34F7C15C6EF9D2, 0xC59D3AFA8D704A36, 0x8719F621D0D03AA4, 0x09621E4DC6A68FA8,
+0x000052E4C0D09D8C, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEEAE7E7259BBCAFF, 0x18AF927D1101692E, 0x78987E28398D7C06, 0xC697FACFF4A98CCB,
+0xAAE86857F94693B2, 0x072A98ED2248143D, 0x00019328568FB9D7, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xC010B9E5FD0A65C9, 0x1B87860533FF8C1D,
+0x3F8520CB51C8A321, 0xA222D91E665281CA, 0xF2D0F892EB979D17, 0x69D496BEE6CABDDD,
+0x000069A8028BD725, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD1A661450725CC3F, 0xB58BFB5D1193F955, 0x6FF51B55704C4C9D, 0xE18555563A0199D7,
+0xACDF894AAD85E68C, 0x41FDE40A4A40A8D3, 0x000134225A3CA472, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x9D63610F7D3C46DA, 0xA247B8A729F6045E,
+0xA6F3A4CC7D418900, 0x23DF1ADF57E8688F, 0x442FAE9224EA6935, 0xEB0BF523FFE348CD,
+0x0001268C7C20460A, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE38BB4C3F4F5386E, 0x2E79F60B32D74EAB, 0x21DDEDD47725439E, 0x717B852FF4DC77F9,
+0xABB976A20D703210, 0x9EC06402FEA3B047, 0x00017CAD92C2436D, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xE345A5D1C0258B38, 0x5F95A27369ECEFF1,
+0xFC36026BC8DFCD56, 0x7011F902E45D3911, 0x06C97D239FB4D90C, 0x89959C90F35F36A2,
+0x0001B582919DB55D, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2DAB6D0820CB1DBC, 0xB2ED03D5539FFD3D, 0x85ED74D694B9BB65, 0x0498439A05412D2B,
+0xB5C62C94E3E89000, 0xAD0B01C27B8FF685, 0x0001C91D0F3CAD26, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xF43CEEF41C8A73FD, 0xC5F2F562A4FB10EA,
+0xA9AFB7F8CC902821, 0xDFBBACBCDC45B6FA, 0x0B7417BCC53BD710, 0x6EBC75AF63DF9EC4,
+0x0000590B4232CBCE, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA5DA43BDB0FB2116, 0xDDAA16CEAE940CAC, 0xAE3FBC8C349279AB, 0x99CA528763FD348F,
+0xF37C823D41BCD1DA, 0xF0AD28B0CA6FBC93, 0x00009605A1285E4C, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xD9889D6D127FE4BE, 0x529FC0B8E1862BD2,
+0xA22D3F7306E4469E, 0x2168E97542A53C4C, 0xC96C975C4D63A3F0, 0x6CD2DDEB642F60A5,
+0x000009A524698A2D, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA6D0DF501958EA24, 0xCD58A2C210A6D2DF, 0xBAFAB657C1023509, 0x85CBDD01CA61459A,
+0xE7503FA4044387A0, 0xEC24054482D4A93D, 0x00013DF5C809E73C, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x606B0E043702F35F, 0x3EF82DA8F543BDF6,
+0x1280E417AAB7A9C4, 0x246A22C8330D612F, 0x2168B368C3B6D890, 0xB994047109BE4862,
+0x0001DEFA5250AE34, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2FCC4A773832D324, 0xD04BDD554C99F904, 0x2B2ED3A903D304D5, 0xF246CDA2CA18DED3,
+0x265FC41999918C9D, 0x30F852880B5FE2A5, 0x000136A6BE5D78C8, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x78BE5E202621E815, 0x84D3DC1081AA2BED,
+0x8575A16213B45A7E, 0xA4CB786F8A259C83, 0x451F9FD537E7C408, 0x5B5B56700E4D1CBB,
+0x00012EFF081E9CEF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x57E72683298AA9D0, 0xAFA5DA8CAE3F8629, 0xF9DF3595F07CAB62, 0x3782C77347397B58,
+0x0EE33E94DAD834F4, 0xD228D052C0973336, 0x00007B49A9666C5F, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xF4B10D80C76D3DE0, 0x430A75E3CBD13271,
+0xC2FA5F3D889B8341, 0xFCAB1364A7C0EE81, 0x79AB8F1D12267A1E, 0x8A4A2CBC6483AB5C,
+0x0001440744F9C6FF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1D8DFCCB16B1185C, 0x14FB2EBB54D331D2, 0x28DFF699CE5B1D74, 0xCFB414C8DF12F55B,
+0x0BE884ACF73B2FDA, 0xC02E4AADC198E869, 0x0000928938851404, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xF765528E4B4AC169, 0x1063C4A2F0146747,
+0xF047DD7B8E5B387C, 0x6924C3B19E4FA5FE, 0x34F9DAF9D409655A, 0xDEE1251FFE5A0833,
+0x0001FD263EC10B1C, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x34FBD138C0A20000, 0xCCDFC33C65E43639, 0xFA4B682B2D07F38E, 0xD81E610585B02B1A,
+0xBE07376A03BACAF0, 0x6E5BED8E3AD4CCC3, 0x00010B8EF77F8840, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xE794362522F3BED5, 0x9CDB852DB9738D95,
+0x62181633E73B1018, 0xA36C184C718372F1, 0x9A03D3536C5E3922, 0x321E142937245051,
+0x00002EB3EA72E7A1, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF2CDD9CAD4742B52, 0x9592381B1962D2CB, 0x6F1DD8D81345DFBE, 0x83AC6C8A8E4CCCCC,
+0xC9267C1ECAA6D37B, 0x7DBE63AA128D5DEB, 0x00014E8379C731FF, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x3E653BD6A2BB9D61, 0x9EA04F24D3B02703,
+0x786DEFDFC5D4F6A2, 0x0BE63ADE7AD4CC91, 0x8D9CCEEEC0DEBB10, 0x091163DC2312C19C,
+0x00006E1609ADD5E8, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF0B68D0EF0D60FEB, 0x0681B2CB7F791727, 0xFF6D547AD5C6BBC0, 0x5C6F2B56414B90DB,
+0x42861F3A9F22BD20, 0x35D9C61189C28783, 0x0001A745B05C083C, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xE3F9CA11C34709C6, 0x9C5F0B053126BE4D,
+0xEE90BA59DD4080C5, 0x6D8DE580011B2457, 0x8FBFFF8277EBD9F1, 0x8D6E376336A541EF,
+0x000149A27798824D, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3400570EBF4E26BC, 0x37C8C495C85D56CA, 0x996647EE855DA493, 0x9CDAA0E0F5CA9DD3,
+0x34CA95BAED6E8699, 0xD58B6E08612C2729, 0x00002A20B17AD2B7, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x77930D5B0D142D91, 0x5E88B99ABDFFA177,
+0xCDC1E94905CF2EC1, 0x6F39DFB7A53E895B, 0x179503BA3F02E26E, 0xCD5EB8B5C1A95FFD,
+0x00011B8E752E9B14, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE6FF85813CC40574, 0xC05225DDC53D3FF9, 0xA4C8D4D0A2B651E1, 0x2384099AB192161E,
+0x321F8C240AF60485, 0xFA657EC2CBF7307D, 0x00000C60331E5868, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xA2DB08A51BCF8B95, 0x2432380F66E2808E,
+0x8464CEAE12A4965D, 0x944A07EC60B31CB5, 0x5F57557F32BAD4C0, 0xEB9F555923BF84B7,
+0x00011575B4C28E73, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7A234F6350FFA552, 0x0650F112609094CF, 0x8CE7E713C145A0CA, 0xB7F8773D5F36C663,
+0x7DDF96828B0945D1, 0x775F2E777E1EF403, 0x00001C951221667D, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x301C04CD96DDEC51, 0xF17335688CDEFEC3,
+0x02E4F7610B347863, 0xDB0299639E9FAC5A, 0x9C246610B0F7505C, 0xECF4FAC8A207DD84,
+0x0001E281A6A5EF6E, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x02EB58A6D48912CE, 0xFFF1FEAA7B2294B1, 0x8E5F8BB82F22E0E4, 0xCDFDDDB489D226FD,
+0x530A3AB5AF645E18, 0xAF5E7C7BC07307DE, 0x0001CF6CFA164B06, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0587DAD752B9E447, 0x7E2C0C487E90BBF4,
+0xCBC6FF5829AA4ABC, 0x058474A7A0E3E93F, 0x685D028848D060AE, 0x3CFA853DB6BE2021,
+0x0002088CF1E53F1A, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB684605EB60E7478, 0xF37776387F490518, 0xFA39E744B6DE8D92, 0x811B85D7ED9C1CBF,
+0xB506FBCF7F357F96, 0x465858D1B7CBFA01, 0x00007FCD56FB9E91, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xDDBFD5974FD3765F, 0xD2F7C511D6B5AE6C,
+0x17B7D41E1437F95A, 0x6C3E506224088AC1, 0xDBF71D1F8D767181, 0x02CC3BD3A4D1B92C,
+0x0001B65115F3D7C0, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC56FB8C8650AD57E, 0xB64C9DC5A984B2FE, 0x11F5553BDC0F0184, 0x1DCF7D833657747E,
+0x01A74746DF4263DE, 0x14D20C8AE86A156B, 0x000075C0E4299BB2, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x3C138763CF98621A, 0xB53ED28A746AABBB,
+0x22080277B9D6D8EF, 0xA0A708667D5F0953, 0x1A1724DC0D5DA5C2, 0x4506084E47E0B66B,
+0x000003218283AB3F, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9375DC2C7A3C2031, 0xDD9A8F8052949DEC, 0xCCFC13B4DF856898, 0x746D0F420273FA85,
+0x3F463F991FD77682, 0xAA45490D10762B8D, 0x00006D40D52B9D6F, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xADD3A0079D74F51A, 0x2D6B210894ADDA68,
+0xAC543D1C7B7E8292, 0xC601C2583CD57E42, 0xF364E12854275CDF, 0xCE256C23B76A4970,
+0x00022F80BEEA0AD1, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x38AC52A8D13B25E3, 0xE24DB7122E13E0AC, 0x1E3311A924D40B6C, 0xF1A79C1D2ADD74A7,
+0xC4D20C372C40FB87, 0xFF8294063D9229B5, 0x0000443BEE029CC2, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x3EC47527F44E96D1, 0x054FEAE18D9AA940,
+0x27D744AFF4E7FBEB, 0xD575B7354BC49881, 0x9B570D977893C5E8, 0x9255D9D2919793C4,
+0x00016718CF9783D9, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x76D8B5A17744112B, 0xEC64485FD9175E9C, 0x931D80DC85FA78F1, 0xE00CE088C4EAD70C,
+0x546FA244D0B8B291, 0x8AC924AEE1584213, 0x0000A10B0B37C27F, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xFC28A4FBFA64F232, 0xB1474B0DC0BFA92A,
+0x2C8EF2C7622C97B2, 0xF4629A60290C95C6, 0x55DABDD3D3F26CE0, 0xB4100EE69F99FF2E,
+0x0001BE53289AFFBB, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1800B8FBB8FB9131, 0xB03A02285B53AC05, 0xB01A2CB5FFB7CECF, 0x9828150A142F52BE,
+0xA7A76B88FCC7173A, 0xBB4BB14E6E5542A2, 0x000134C291F88CCF, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x08B7F2D718EDFB30, 0xF568B2597D5DBB4C,
+0xF7BEB892EC39F50D, 0x05BB1FE50593FE7D, 0xB939025DAC56048C, 0xF724AD9CB03E14A4,
+0x0000BAF74294ECBD, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x23C7CDD6D0FFE792, 0xC9F19C20ED1184EC, 0x9C8D90A57EB0098E, 0x70C073B8E930FEE9,
+0x90B2627B4DF2229B, 0xDAE8320411D61B0B, 0x00001CD84124DEBF, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x7391227E2F385879, 0x16546E147F1085E2,
+0xFF0004AF6F2B0CF5, 0x42F06C8D9AF1CD05, 0x944C6B76667357D3, 0x03B848DEE70EDB7A,
+0x00021FE020B9B34E, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2866BC18CB45D4BE, 0x1C58D567E13DB996, 0x72C4A57B5D5A7541, 0xABBF6E0AB76B3BD6,
+0x093D3CCC46F37955, 0x64E9940983527071, 0x0000AB529240E618, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x8BDB47FE78C4A20A, 0xC8AF96E36154ED6B,
+0x48CA77B0CDC0D9FD, 0xD6187FC4EDB4E6AB, 0x910B33F7D14FC568, 0xD6C8C2F18DBA1051,
+0x0001B0F209D7246A, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCDE41A4D8A7A46DF, 0x0A17198B6471E015, 0xA6892808FD52E49C, 0x7332341AA51F0E6C,
+0x383536ECCFBED0BA, 0xE7166B0A090F70AF, 0x00010273F5CC49C8, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x644172A1EA9D582F, 0x0206FF42A4F4A348,
+0xA93C783264D738A9, 0xEEBE9EEE44F640C8, 0xC9CEB88EE11E0AC9, 0x6365DB77C10558B3,
+0x0001B0BA9F5ABF74, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x07A9147565FBA069, 0x38F9DA45BCFAA755, 0xB45C3C0BC75BAFA4, 0xAF9F5E23AA1F4AA3,
+0xA07377A80B489C23, 0x2F4B6BFC059F20AC, 0x00014123099C89C0, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x8C9E2F1E345CB875, 0x8EAB7800406DEAED,
+0x2A9F68A067B46DDB, 0x9211F879D84937B2, 0xAEB68AC254F536CB, 0xD43C8D1492E183BF,
+0x0001DE495B1B7EB6, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1D573E6738D41F8C, 0x6EC3CCF804604CCE, 0x68C2B5B032402C80, 0xCED4805AB1EE3925,
+0xA71D6293332B9728, 0x74F8D2ABC7EB56D1, 0x000123D9BC4D8BA3, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x014164E4BA3FDE16, 0x89919DD73E4FFD73,
+0xB7D9D85605DE8EED, 0x20DFBF8B09984E8D, 0x2573EDD3C024C5D2, 0x036187DA9B2ECA93,
+0x00006710689AF0E8, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x81C7F31D821FD02B, 0x3A412B3001EA5CB5, 0x873E7140CBFEFEC6, 0x3E545ADC73AC84C5,
+0x5668C26E6173B341, 0x59635A7ED9280D64, 0x0001FFF5ED104C06, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x030F5D8DD9BB219A, 0xB8F7DEEC7D0D26A4,
+0x567A5FB5D33C194C, 0xE0CECCEEBE67353B, 0x5DEB66ED5939D75D, 0x96C0CC7C121BFBA1,
+0x0002287E0D6A9F20, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x639E0FEDBA8E6AE1, 0xD3EF707DD977E1D8, 0x8B5100CEE274AF72, 0x550639C47B57A84C,
+0x01549504F06A649C, 0x83BD852C87C1F19B, 0x0001B02CBCA9C8D7, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xF66C2DF73CA97776, 0xDD89D0517F62CE0F,
+0xB1213FBC864106AE, 0x1E7B6BA20E4FC3ED, 0xBA02C42029EB762E, 0xDF613813C34D206C,
+0x000042E9283EE835, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA004A03F20E4CDE4, 0xDF759DA453A906F8, 0x30A9BF93340A9DDD, 0x9ED6A988E0CBBA8C,
+0xC9628348D2064473, 0x2AB3A132A6D51CC6, 0x00013871E1180D2C, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xC7BB4489212C0E32, 0xCB68CA2E20D5E89F,
+0x07FCC4E073EB8E73, 0xA45F40B525650526, 0x50C79AB6E8CA4A92, 0xBA8DDA0BE733A322,
+0x000001F3D62A9476, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x73C91411808CDFB1, 0x03491A42ECA0AA62, 0xCE26632F66FF18F9, 0x3FE44B08D601697A,
+0x9E049F2F9DB055CA, 0x5CD2E3E5027B7FC0, 0x00019B5981DA29AC, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xE6E31F32FD34C8CF, 0x2ED431C2BC798747,
+0x7D0C00DC95049B3A, 0x08989567C545D73A, 0x2EDAA309E239EB3B, 0xFDE601FAAFCC1053,
+0x00007698A695C1FD, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x17E336E3EACC1C0A, 0x415A523E3531AF63, 0x3BF3ED186532EDB2, 0x2428DC454A942BDD,
+0x75CBBADE9CECD271, 0x774EA463B76D7843, 0x00004D0B7B4D8CCF, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x2DE0E7095F9D5AD2, 0x402279E6DCAAA087,
+0xC122885CEBE1D192, 0xD0D1C4DB1D9BAD29, 0x939B24FD7E238776, 0xDA320941ED29E023,
+0x00006D20E5245D59, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBED38F08994CD0CA, 0xE5EE785B8870239A, 0xB53CB4FE55087EAA, 0x6CAC85BE46CFA7BE,
+0x4DAEEF228243FB3A, 0x8C08F81B4F78FAF0, 0x00015FE365CCFFE1, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x9315E5EB6F76D40B, 0x2AB9F7EB2A078B60,
+0x7F06A91034A56907, 0xE8346BD0C180A401, 0xAB078FA3E8D93D3C, 0x2E77485138DCF2D9,
+0x0000400E270A0C5F, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x74CA9A8DF081991A, 0xC017D95337986AFE, 0x0908D0976502F47F, 0x06AFEFECFBF3A719,
+0xD61B22E212BA0B16, 0xC43BA4E0FDCB4357, 0x0001C5EC4BBA591B, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x030FE8DB8EB8D0FC, 0x7E18F1E2E26F58F1,
+0x07163E9AC574AF5C, 0xB51357F2E5F3D808, 0x2AC2F96FB490F8F6, 0xEEC3E1E7FAA17A7E,
+0x00017C6557FCF9BA, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8D006F420F8376A9, 0x0930B66D7FC41C35, 0x81E51DDE184629CC, 0x9009DD9B341CCEEA,
+0xA9D5BB5F2E109A1D, 0x80A614ECA6E4693C, 0x0001349D4EEE1789, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xEFB429D56856E00F, 0x53E85CA24277AF3B,
+0x562636995BA13223, 0xA4F8B7693EABF266, 0x5403BAB0CA470AEE, 0x3E027B18BC804DE7,
+0x0001B57750207D68, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCD27C68D2597B6A0, 0x4B165542E7756B28, 0x081029A70176C7C0, 0x577D031130A870CD,
+0x69C59CBB38A78384, 0x0DBE0B33E8BFED6D, 0x00015D414519D932, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x2DFD159A84E2F0DC, 0x9DD7EA4765E130C2,
+0x08CDBE4D7EB2B8CF, 0xA9D756952B020B28, 0x24A38B59261F5A7D, 0xB0DD3FDFE680CE39,
+0x000134DCE7F97A0A, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1EE272F0CC543480, 0xA91E6DDAF322DBB4, 0x6C625B9B52FA453B, 0xD752CF16031776D5,
+0xD8ABE080D1A9CF45, 0x21FFE0ACC6275C35, 0x0002046EFBE5C791, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xD770E5DD00F2971A, 0xEA42B8D69FD89D27,
+0xE49AC4EEF38B9323, 0x370DA12A76029DB7, 0x948308A9E99A7915, 0xB7D5074D36FD37E3,
+0x00008D1709989E45, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x32EEB6F7BEF91027, 0xED80D3265F64AB1A, 0x5D90898C7417EA03, 0x4ED3843DFD1121D8,
+0x568DC9CAE98F2F16, 0x1862FEA6831C81C7, 0x0000CF4027AB270C, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0E219C920EB4731C, 0x37158299E4315B61,
+0xDD2A64132BFEF70E, 0xCDAAF2C01C987E7E, 0x75760C2B3D6BA0B3, 0xEC5A5FF8AB9E4AE7,
+0x00022F9DEF5EBEB7, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAE7CCFBC2D957E14, 0xB4F8E23B0F24FBFF, 0x7BAEBDBCA765B5CE, 0x9CD2E9E6733502B0,
+0x0029418EEDAAC8D3, 0x02BAB3CC9E41C3D9, 0x00008B581E2ADAEE, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x28E3A8A7097F43BA, 0x996BD8D647AECF0E,
+0xA6B09BC15DA60AFE, 0xE2EF3CF23D00D49B, 0xDCB8CBDE793AA7C2, 0xB9101E4C3D4F136F,
+0x00009EC43AC5702D, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBFB518424FADC442, 0xC42E8214A6769335, 0x65DA3932E38F7D05, 0x6DCE6F45E0270EFB,
+0x55F8D84E342155A9, 0xF6E440096933BA72, 0x00012C79E7ADB123, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xD9BAF5EDBEDDEB8D, 0xEC7698BC30B530A8,
+0x3558B586DBC33C03, 0x831714A1A79250F6, 0x9BFFB343DA5742BE, 0x8BC63243E60E66C4,
+0x0001F439A6A02BDD, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3363301E79E6EC80, 0xA88A7B32CD8AC315, 0xAC440E8E744F0600, 0xD97EA60BBC0DC4A0,
+0xC5E7EF943BEFBE8D, 0x94910F860444A11D, 0x000201A786FB3F04, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x2AA757DD1E040126, 0x2FF7938521154260,
+0x1E58BD78E525C765, 0xAEEB108C858472FD, 0xE58C728B8FA168D8, 0x060B8D7E8B912DF3,
+0x0001BA50A1427048, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x26B5A9BD516D074C, 0x7267F8818A0D0F96, 0x5C6451B8F6D8B82E, 0xF03E337E8AA12FFE,
+0xEA0D9E0315F7EA67, 0x4F743DE90247CEA7, 0x000032E867D03B21, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x5AE07D5D42B672E1, 0x1107872250A2C8A0,
+0x5566EF3AA4E6F788, 0x8E7724D9741D8E0F, 0x0D33E0971CA891DB, 0xD0FCC045EE7A1123,
+0x0000B64683BF535D, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x14511CC10D4CC16E, 0x28E8B70FD2BCC827, 0xED96440AE7EBB121, 0x44AF0B00178BBB8D,
+0xD91B31A89EDB77E3, 0xE31C5636D4611DBF, 0x0000D9DFDE126AD5, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xD965C5B012CBF2C0, 0xBB2A1606B739B3CA,
+0xE1408FE2BCAEEE21, 0x2701A910669C01EB, 0x38B1E33340E85CFC, 0xD4F14E76A6D87690,
+0x0001196F81CB5796, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0ED7E3520268064B, 0xD21F55F57489D267, 0x670722E419F27606, 0xFB529B35AB54B2F2,
+0x16C1AD9FABA21862, 0xA1CB15F7B42F7E38, 0x0001F7199636EEAD, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x34CEE389A3FE2930, 0x1C18720BEA83FE77,
+0x6933E9BA3F4CCC61, 0xFB3BA6442402D61B, 0xB29DEFB7558FC044, 0xFD226CD4543A6723,
+0x0002116B818DD836, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAF23BB44C2F136A1, 0x685DEE8243356D69, 0x4E0CA280CD0B59BA, 0xA19AFD8CDEE98872,
+0xD6D7756E04B9DEAD, 0x73B6AE5C53F0209B, 0x000091C65D7B2FA8, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xB3DA4468CFB65C6C, 0xC06ED6B0F282B7FF,
+0x6CD133B00BEF6819, 0x3F5AF6102E1E86CD, 0xA55880A79B99B1EB, 0xA54CB7AF0BE38D3A,
+0x000182BE63F9E221, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0CC66248117AB36D, 0xD611BC7A2C15ECDD, 0x885B0E2B341172EA, 0x6E273E2472AC9423,
+0xCFB9A828C1088A2E, 0x9A23B119689831D4, 0x0000E27F8DFCA8B1, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0808DDEA0BCB3121, 0x4B0B1BA1D71A4938,
+0x111ACB3737EAFA21, 0x4CC73AB85F4F1EF2, 0xDD497FE6DC25BFBC, 0xEC04C6F0C8048AC3,
+0x0000645B72C40B7C, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDAEFFC6EA5BAB701, 0xFDE45C25C374289A, 0xEE5AB37598DDDB5E, 0x9C3D8A98151CD58D,
+0xA5EC800F2B5668A7, 0x1049C0FF1BEABB85, 0x00002A29C521F4CD, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x1A4AA13096A29E25, 0xAB9628CD6A9674B3,
+0x96462E186B11C39A, 0x145AF0112CFF966B, 0x76A562D70C00C0A2, 0xB800B38D349EE84B,
+0x000097D6502B7F4A, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x194BA597B127E0BC, 0x3317A88DFC365523, 0xE4C9FDD8F2B12A3E, 0x1408B9EA157A0176,
+0x204AEFF3F07F2A25, 0x0FB9FB551E21D5C3, 0x00013575F8D2469A, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xD5D952255F081A6A, 0xE8256B302163E940,
+0xDF91E368C7344D46, 0x0D7AEEEEB36FD3DF, 0x68DBB21E3D3D5D94, 0x427EEE2DEB0F3516,
+0x000132C61360B26D, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAC788A680C3FC223, 0xF98CE4A9992E4470, 0x39C1E5531B28BE9A, 0x95BFF6297AB1DF13,
+0x447DAEF6A7ADF9EB, 0x7A48053539E760FD, 0x00009F77763392D3, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x30692C9E738784EE, 0xF9C084D7B71D2E4D,
+0x325C0FF91A405724, 0xF0006616FB574714, 0xFA0A2144C432FFC7, 0xE4702F90FAE064B1,
+0x0001479F88920B26, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x21B4E08A6021BABD, 0x0271680FCC438591, 0x418C4AAFC5DB3527, 0x923DCEE9F08E0D25,
+0xDAD7BD407E8C3284, 0xE1BC7D04B0E2B67A, 0x00019720D44B4C7F, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xE2A060510577B654, 0x4B8C1459203C3F5A,
+0xE846AC0EA896634E, 0x59E7D27A969CB5ED, 0x0782BDE76A317A6B, 0x20B7C5839AAB1372,
+0x00008A7BA9AE877E, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE6315A9AE12F953C, 0xF2282B5D50B97075, 0x55463FE020DFD65D, 0x3110EC69A626CEA1,
+0x82C396F465177134, 0xF68B8EC509DEBBB3, 0x0001D1CA3C2C9BCB, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xC62AF1CCABF79499, 0x355F94384D1B28F1,
+0x4804DC218BA761D1, 0x364BF1B50B483C89, 0x99FCA79742C7817F, 0x615F4BCB05797626,
+0x00003435E6488FD7, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x48F5A212A01E2B0B, 0x52B413564743080B, 0x0F295086BF6E1381, 0xF9BBB67545258481,
+0x4FFC3321389B60A1, 0x8DB14595F2CCCDB6, 0x00004AB97B4F70C3, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xBC9ECA01F6AC289E, 0xE5AC3D3D99EFC3B5,
+0x9FC67802C846BBFD, 0x6CBDA37390EB4A1B, 0xB5DC04579F8215C6, 0x5A59A303E242418D,
+0x0000F0BEA7592F3C, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAD5F1925C7C0F77F, 0xF305182398AE7152, 0x6308C4D9C0EBEB8C, 0xEDC3799E2CC9B170,
+0x25EF7C27BED16B1A, 0xE93BBE7D9182B15C, 0x00007FA26F2ED6CE, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x2135CD2441E0AF64, 0x8CA11D5E075D504E,
+0x88EAB81879C2E171, 0x06F6E0492728DE2D, 0xAAACE638FA1DDE70, 0x6097698C79124EE5,
+0x0000327A0B56CE7C, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA190A311CAD78BD6, 0xE8487B094BAAA80B, 0xC0C484370A187053, 0x10419F2E845305FB,
+0x395ACB6A51D05575, 0x84223D0CBAA694EE, 0x0000ABBE91243BD6, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x4BA489E3E9B5E574, 0x9270BA881BDA3937,
+0x440D235746A318FA, 0x21C34E8A272A51F5, 0xB33985D948FFC6B0, 0xDF50EC6CFD3145CE,
+0x00011F871726FB90, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x27D37C6F3B5A75F8, 0xE68D5D88F4D2E955, 0x6C7F8D6914A8A237, 0x8033624BC6F4112E,
+0x7157A27E7FB21205, 0x246102A04153CEAF, 0x0000436921E72349, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xC179F1451F588915, 0xE9DAB2760C219FBC,
+0x3E209DBF639B7393, 0x7806F826FD21EE01, 0xEA5F0C6304AC898C, 0x6A18A99FC8747EEE,
+0x00008709D1F53F8B, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x762E053FA0AF8429, 0x2CAC26D78DEEE6A4, 0x5F4955A4D40D2CCE, 0x6672F30FE1895F44,
+0xED0CA9B4C031610C, 0xD7841DE3790C20B4, 0x00007DC87051B914, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x120024BE028C1D19, 0xF5D909A020B1BFD5,
+0x58805012397F10FE, 0xD72E60D908BEEC61, 0x6FA2BE545919F018, 0xCEAB99CC0217748E,
+0x0001FE05E6446486, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2C3F926AD0DD5C86, 0x8258C018CE873740, 0x439D47E2DFFA354C, 0x4F430B1F3282476F,
+0x671D917DF3B30644, 0x7E4E0535CF8B5E84, 0x0000B1469514C69A, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x43D6D9E2AD7A0B26, 0xEBD4883D12312F4C,
+0x89F1D090F4FB550E, 0x21721FCB9521B3E7, 0x1CC3603CDBAC2DDF, 0xE072F043A5ADBD4E,
+0x0001002D83F0B605, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2D92B30880D3CCA8, 0xDB62C63BA0AF3166, 0xB696813D51C9B3AD, 0x41A1F9E99D5D1355,
+0x53DAE1D73E6CB8FC, 0xAEDBFD849C6AC141, 0x00003D248A9FF525, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x4098A691E0799D4A, 0x16AA8EB4808401FE,
+0x6E91554308617912, 0x7C6FD6EF8188AEAB, 0x514D190F604FFACB, 0xB4F5876F1BCCAF5C,
+0x0000142520A362F1, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA2F19CF2D5722D3E, 0xB77FBC97D78CD338, 0xD4882A71445A9A3D, 0x6BB5324C8819EC3D,
+0x22709A254418171F, 0x3C285117753B4AD8, 0x00007390C78D1593, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x66C47FD6DEC79778, 0x30C692E43CE579EE,
+0x18BD768B676C99BA, 0x92DF400FBFF6795D, 0x1D7C9789343FF47E, 0x50D490FC90C65F51,
+0x00016C4EF74E153B, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x011B3DD165494FD6, 0xD95FF89EF801322E, 0x546ED4C2A91702AC, 0xEC11C070087B2C8F,
+0x0E995548E5720CE3, 0x24F4E87645ACB9AD, 0x00003A112613399F, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x561D1574620F4DB4, 0x028B81AE9C1118A5,
+0xA510FC007928F845, 0xC5F986E3BA3078E6, 0xB3A6C23956189135, 0xDE2A57B2AD2C4590,
+0x0000102A2BF62711, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x46D6AD82F482D2C0, 0x9389687FE5CDCC22, 0xB39CEA78D808825A, 0x613757F9C9A852AF,
+0x956AF272F8623A88, 0x3F85D232633E30C7, 0x000018EEA11FCD46, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x75340372513E4B02, 0xC23A17C12BB136E7,
+0x75798B9F82B5D37D, 0x73AE66FAAF260E36, 0xA8D8406CBE16E052, 0x817D2D132E648E44,
+0x0000C5D9F94438BE, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2E19ECB98F73B95F, 0x4E30DF3E9C80727A, 0x4B0EF53F15ED86C3, 0xC3A84354D1F45597,
+0x3CE5AA16E1B9F2FC, 0xBDF4EB1B4A44ACC8, 0x00021C67CC782CF2, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x3B3C95E16366FCD3, 0xF489688939E1ABD3,
+0xB02D59AAB6FF9C08, 0x55CEE03658005678, 0x9B10267B6C362C8A, 0xC4080B0A2C9E8DE0,
+0x0001316CDC399C46, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x088245EEC5515AB3, 0xE47483A4AC27DA60, 0x33EAC5AA442A726A, 0xD95ABC15C8DDD0FB,
+0xAF6F290EAA25BBCC, 0xD31E0D2F67F9B976, 0x00009AD574FB3CA1, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x481724E6DA350DB2, 0x91DF05BB15A95E7B,
+0x194A34F6319D29AB, 0x3BA306C143EC74B7, 0x80E3F58DBB881EF4, 0xC18723B011B17B12,
+0x00020563E64376F3, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4406A19F7EECE81B, 0x38BA3B3E64A5EB2B, 0x86AFE67DDFE2ED24, 0xEBB9E9481F74A032,
+0xF848F58E87867D6A, 0x834F6C30328CB982, 0x0002061C6B342449, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xE7224A645211B637, 0x9F539E67EAC93103,
+0x70D95B59767716FD, 0xA20FE30162C6CE04, 0xC63579AE9F59645F, 0x7B6EEE44040C7B91,
+0x0000BC0DB1EF18FF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB426151C02B9EDB9, 0x74CA3AF4B122D7F8, 0xCB59FC6BB6589FFE, 0xFABFEB142FB4D37A,
+0x533D98F40878E2BE, 0x65FCF2BFB6691468, 0x00012D16A7589277, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x07213A0A1E90CC55, 0x8776D9FE5F70C2D7,
+0x51A804EBE71FD034, 0xC47D5879A8AA579E, 0x07CF7A10616443FC, 0x5F07C589BD1D861B,
+0x000011EC67782709, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x78161DBC5EF8E69E, 0x22D345061FF830A8, 0x35EFD4464396E886, 0x3AB29D4A61F785DB,
+0xA45A71D1E115D3E8, 0x6D630C663E67CDCD, 0x0000DBBD0DDEF82D, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x3A213F353CDF1E73, 0xF2AFFCD1292E34D9,
+0x57CDA82C0FBA5506, 0xAF060AD160128F28, 0x03630C42429997AE, 0xFA369CFBA7265180,
+0x0000DC6D128A17D2, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1F8BD1674720CC21, 0x19AF0CA51774C228, 0x3245F4A3FD159D97, 0x72530980B63E9EB7,
+0x6C967AA23D203517, 0x1D261D946A942600, 0x0000A232AB67B504, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xA21A09D8A2E70C6C, 0xDABDDAF12CF23C9A,
+0x7A12034766BAD6A5, 0x3E6709CD73EB0C83, 0x79DA6E6783825680, 0x76B0FAB9A2DB49B9,
+0x00018E98D6682B9E, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4E051C6F57AA7AF3, 0xC6EEFFEC2C5C6219, 0x809E79A39B957305, 0xA88D2F4B4BA0815D,
+0x93EF4D2C2D66F900, 0x41DDA955A2E9457D, 0x0001E7F25D2862E0, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xCCE0042B279E0BF3, 0xB90B635363D64FA8,
+0xD37329E92E8EF0AD, 0x35BA3D233BD47224, 0x1A9DB347368102C1, 0x04D922E707F0BD69,
+0x0000BBB04E3E2391, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3092A6DA2CE80C16, 0xA00E56D1B9FD3210, 0x7AD0BD58B1D493EB, 0x693ED8FAF998B1D4,
+0xB87F7480C0F6A4AE, 0x20259E5E9DC319CD, 0x0001C92EDFAD74D4, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x02608D18205022A4, 0x49473D13C9544C5A,
+0x4918BF0BA4DDF5E8, 0x7DD2E57DC563B893, 0x1495E61743686D41, 0x0768DC2B8BE5AAB0,
+0x0000B58E2CAE40E5, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBF29E39E8073C559, 0x9F5386CBF422906D, 0x9119B3CF41404C4B, 0x63AC9C577BA91CAB,
+0xBBD17AB8C49814D2, 0x15A37BEEA2D1FEBD, 0x0001D3B25DFF0747, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x8C118CDE015A80E2, 0xAED823A93CDCD746,
+0x28D668A2DC7DE144, 0xED2B36B1A8F16806, 0x9ED3CFB0065F05CF, 0xF78CBD9315A9342C,
+0x00019E771D746846, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF8AFD562FD96F86F, 0x2389347B48446517, 0xE9F8C5C6819D1293, 0xEF85F2E57B8B94ED,
+0x99CB0BDD1D56BD71, 0xCEA7AEF7C2EF440E, 0x000069D5D89C7091, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x73A6F5AAC157F7AD, 0x5D01D6050EF525A3,
+0x79381C7F1ED47ADA, 0x373DABA4F0843892, 0xB409D1A521D69238, 0xA455AD7CC78EA8A2,
+0x0001F7FFAFD4A3D8, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9F19D9B9974EACD2, 0xB754FA65B9AAA880, 0xC13CB955F71EF91A, 0xF7E3D81249540869,
+0xCE14038C252F5345, 0x86FDF178B901A09C, 0x00008FCDF4E637F7, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x3FE561A36F14D718, 0x49CB13D323695231,
+0x9F080FC53187CC5A, 0xD13B20A39C169951, 0x1897FEBAB6AE194F, 0x713060AB1FB311CA,
+0x0001C623251F24E1, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCA172D060251696D, 0x2C6C5EC81A015E43, 0x9555FCF457534E10, 0xCC7E1603FF76D42A,
+0x81D9CB1EF7269F2F, 0x181DCDB9FC22D43F, 0x00005D2F62813B2E, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xC03072B7F1DBAD18, 0x4648E2C0628DE696,
+0x3FE54724742E42D4, 0x02D8082ED4D4DDC8, 0x9AA2007A7D34D2CD, 0x13595D41D4B493F2,
+0x0001B01814487623, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7F635FF58E9520A1, 0xB27BCA8448AEC3AE, 0xA58C80E084B0385A, 0x7F94CB2C39D05018,
+0xC3FDB6CC99625554, 0x409B9F8E7B898F18, 0x00012BD6682CCA6F, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xD4F43FD184833452, 0xD11AD33E8838DFCB,
+0x37E3D68ACA898623, 0x9A0A7A8A3FF0EB2D, 0x5C712C26C841D41F, 0x0BF741C835C5CD27,
+0x0001D05FF4E3EA17, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0223FB1FEA1FD91A, 0x0F80329428AD9FA9, 0xB6900372AB8830F8, 0x28A1EC8645F896D2,
+0xCED3D6CE3F6C440C, 0xB788D5A7AB882E6E, 0x000216ADF46D1270, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x08D6D31B0B01793B, 0x3741A3B46B14FE5A,
+0x7FD3BFA7A1FDF20E, 0xE6B2F2BF5572C0A1, 0x657A2F716AAAEB56, 0xA11868E47D2971F5,
+0x000070274A1CA064, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x17B24205B644F734, 0x2273E23C12BEC813, 0x1DABC93328149D2B, 0xB28A8BF514644F84,
+0xF85AA617B6CCA42E, 0x90913F4D22023CBE, 0x0000EAEF4BE4D583, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x931C93DEE78EA541, 0xF8AFBD593A247EAD,
+0x83562757AD1526A7, 0x54F248E61759AA52, 0x73C5E999035F6260, 0x4F239F5824F7ACB8,
+0x0000C7C782DC78BA, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDD743941FAF95690, 0xAD030604165FE546, 0xF0041371E3CFFB08, 0x614ACCB975294A32,
+0x65137C8F5D3F4786, 0x166F59E31AB07119, 0x000193FF9BEF31D4, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0DCB4365BA12EA04, 0x6C8FA18CDC1A74E7,
+0x8E1C53C91A3ACA5B, 0x840E427B320CFD3B, 0x909EEF562E979855, 0x7D746119EFC4B765,
+0x000002B708F93410, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC6656FCA55827A89, 0x864B2D9C28D84D06, 0xA4EF9A3D6054DEAC, 0xDE78BCEA8E7327C3,
+0xFB88548A54303D1D, 0xF9D34B9FE78D45D5, 0x000086F756EACE92, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xD61686C40CF9ED62, 0xBBA7D4EA3BCD041A,
+0x333DAF2D9142151D, 0x31DE740D71E720A1, 0xD8193785C0AE10BE, 0x2B28CAA33068D8F3,
+0x000219A0C011F8F7, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8F21E79D5D832E72, 0x99F491224A19137B, 0xDE4AD415CD11B19F, 0xF067F630CAB16C39,
+0x3184768C185DB444, 0x5ACA9000457E7CB7, 0x00018792BAABA13A, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xCCEAD13988C04DE2, 0xC36B962708EFCEB7,
+0xF0DDCB2DFE9CCEDF, 0xDE3D72F8EB837D7B, 0xA3DAAD684567987D, 0x2F3BD370D22CD7C0,
+0x0002085D4906840D, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC79F6ACC7A740D6F, 0xE577E43EEDEA330E, 0xA53F39F793C4A661, 0x7418DB6562302CFA,
+0xF47593BF4F6645A9, 0xAB70937BE2B29B44, 0x0000A9E68D903B12, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x5F4773544B43B6B5, 0x0FDFBDAF4A5D302A,
+0xD138794D82630266, 0xD6EF876D92E068C0, 0x3008D97B6DDE73E3, 0x2D609000EA5516E7,
+0x0001C7BB0865465A, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9D60AA206FEB22E1, 0x22CD6162F6FD932E, 0x68EB408366601487, 0xF9D9DFD7A40BCA23,
+0xBBE09A283715220B, 0x162230162E4A4BCF, 0x0002068B199F4A08, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x61A3B5F9FD0DF29C, 0xA4BB68C8390DF532,
+0xB72312FDA16D6252, 0xF5E161C85FFCF309, 0x7A5C248B5D0B1EEE, 0x3FCDF746FDFD4AB8,
+0x0001565263715958, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x46BE20AD0DC3CA32, 0xD997D73FD6358FE1, 0x1C102F3209CE678A, 0x2CB5672F80242C45,
+0xF9E1E0326C14487C, 0x2E19F984DEAB6015, 0x0001C4C8BB72B129, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x80AC9419D6F49339, 0xCB0F687DC5077A45,
+0x26312579460F4FE0, 0xCD098EF4EFF44A14, 0x7E8A8FA94864A78E, 0x5F7CC0443219B84E,
+0x000118FA65BB8A73, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9E9E6C5C7D4EE770, 0x948F15624D3DBD5A, 0x44D5B4197754CEF0, 0x8DC8ADD646633815,
+0x5ECD5ACC196F1C75, 0x535D246B6335477D, 0x0001019E39F22C3F, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xF47DD4E45EBBAE31, 0x889DE3DB4B97AFAC,
+0x555917B863DB95D6, 0x5E4C17BFB3015890, 0xE186B706F8968300, 0x0E804E52896307D2,
+0x0001176815C34B86, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x166DC22DD1D5EF39, 0xB1D62BC34A508F3B, 0x659CA5EF42E2F712, 0xE533A27090EEA4A7,
+0x78A2ED87C6AE43FA, 0x34BC0C5D1AFD45CF, 0x0000604169A6CC12, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xA6F86B2200AF6070, 0x42CA1A2DAD079D6D,
+0x9C6579ED5908FCAD, 0x745076E06B049A3B, 0x93822B90F86C04EF, 0xADF62FDBD99FC5F2,
+0x0000F4EF28D6385B, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1511BA378B56AAA9, 0x8447FB713C86E54D, 0x20B85C232020B611, 0x06CF89271B407386,
+0x182479C09A3B07C9, 0x6B1C373A586D0731, 0x00011C5DC98366FA, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xBF790CF820463AD9, 0x1DAEB58E61D65A8B,
+0x185BB692CA9E08FC, 0x4346CC460FE7DDE7, 0xD4EBC4DDF7276B40, 0xCEB559A2D4FE4DAD,
+0x000171D09959F120, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA581F492F00DABA9, 0x4C00C194DC9C14D3, 0xEBE227BD2C7800D9, 0x4577744DE0675D2C,
+0x3C413CD911398E1E, 0x05A023603B2A9BEC, 0x0000FCFFD23437B7, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x5F6562B87825F7C2, 0xCE4DC73D90145400,
+0x7C6E652CEB2D1DDC, 0x5FA14C47B4288DEE, 0xDD25423938F9940E, 0xA62F53929B5E3AA6,
+0x00011D877CA4A3FF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4830DBD5780A70E9, 0x64D64E699272B0BD, 0x123A9F3D329A875C, 0xE8905FF64FB066A1,
+0x509E8D5232384F50, 0xFF04E765CC20676B, 0x000187E4FC6DC1D6, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x05D1AEAEAB37C78D, 0xCE4EEA84AAC67654,
+0x4E1EB17C76B80A52, 0xAA0D25E50C59D2C0, 0x3FC93C05D9F2846D, 0x89C8E40697CB837D,
+0x0001BC90D0D96859, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5039D574AE1A8F43, 0x636B34232422853C, 0x6886CA54F3839851, 0x85BD5FDD62E90F4B,
+0x27348F28A9B9580C, 0xD6B3C558520786C5, 0x0000B7F6CBCF14BF, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0796E1E80437F187, 0x3C450145C448EF4D,
+0x9C9F9E877BF93227, 0xDAA4A4AB8624C1E6, 0xB2A2EB0E4D97198E, 0x97E6FFE6A3C1513C,
+0x0001A0EA3AFE074C, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD9377AD30F83211B, 0x7E0B114876DE30F6, 0x75693CE4E13AC6D7, 0xAF3832CFB35FF5FB,
+0xB6E12F97AE1BE239, 0x8CDB83E698679587, 0x00018349CD14E051, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xF11C546A5653B385, 0x86A6B78BD12CF229,
+0x5910DEFA329B5C8A, 0x9C4CF8661AF05070, 0x6C85509DA15C1663, 0x4A103706911C20A6,
+0x000167D4B72E85A0, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE417DF0DFEC96175, 0x9C71112BA5311042, 0x41D0C84895EAD2BB, 0x8C74A564AA9D98D6,
+0x5BB06C04985073A2, 0x8472F7633D78D638, 0x00022C4782AED362, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x9D4D862C2E93CBD7, 0x27B342B2DE54641E,
+0xBE8C955E54E93CAA, 0x4E75E6BD62647C65, 0x2E97C6128722933C, 0xC1795ACF57A36D38,
+0x000096FBED53E2E7, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBA5AB82AE49D803A, 0xD4676CA641B9D170, 0x88D501B3EAF62A53, 0x06EF4302E4D66D25,
+0x1D4E71207AF7FE9B, 0x9C548BEB5DDE4D7F, 0x0001D781BDA3A487, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x3E3BC46CC145E612, 0x6E434578501EA507,
+0x720DCB9C506F9E0B, 0xFE4D87B4FFBE6308, 0x61C36AB49F2D3D93, 0x207342539E790F97,
+0x0000AC94F464606D, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x76F41226DC8947CA, 0x7BE200A488E52102, 0x487627195F3851FA, 0xCD1A7875F41B286A,
+0x91452FFD41E226A8, 0xD48060A2FA426A2B, 0x0001092CF9B140DA, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x59479F58397C94F0, 0x6E409F3B94C939AF,
+0x8199507BE7FC16C9, 0xBD76A8873C6BB8DA, 0x9B124326AA86EAA0, 0x07CE33E4347F799B,
+0x0001F385C01D077E, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCC63B1CEDCE2B857, 0x0CD32D70C9B3CC30, 0xD5613FFC0ADC8958, 0x6111AC00B60B23E8,
+0x0DE7C4F6CA54E211, 0x3994CDC409FAB79B, 0x0001168C9CE5C24B, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xA894DE296055132E, 0x5DB8470A2CA41235,
+0xFEF5B8443725D1B2, 0x8847FC54F0FEC730, 0x9088574156005DFE, 0x0F65B772A52A8955,
+0x0001DC9BCAEA162A, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFE2A6047FA55E2BB, 0xD004D6A4BA6949A2, 0x24689EB3FDCAAFC6, 0x6D9121CC54FE5C5B,
+0x38A30C21479FC130, 0xBBB8CEF1A3F5C021, 0x0000D3FE7B488E87, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0C634C4819A10536, 0x632268FEB06EE93B,
+0xBECF722F1E15D90B, 0x54F2A49E18A8FB4C, 0x7BED2DED6EC30063, 0x36CA01FA8F9F61C9,
+0x000075AB31DF2DF9, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x94408985DF00CFD4, 0xD7EDAADFA0E53F14, 0x4A245907960DB392, 0x46C3F8B46E2CCB13,
+0x46EA8E74C3FD2736, 0x5F4691D6618DD9A4, 0x00012C5929F51BD2, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0xD9379C3602EEBEE8, 0x14DB81FE5A32C517,
+0x419B8B23501EBE3D, 0x34B9062FE25D0125, 0xA60D309D97786BD7, 0x1841F85FD9FFA1E3,
+0x0000551D74B3B7D4, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2F5CA0C247A31E4F, 0xDDE367BF0F642412, 0x58B8950278FB5185, 0xB4A69A6263AB4D40,
+0xA6B0895E7B5CD478, 0xE740A9CC3AF01E95, 0x000160816670040B, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x2CF9C3DD5753B628, 0xFF75C7C5C8411D8A,
+0x5AC86B4329AA1E30, 0x62815D3D30E83789, 0xD8F65E8DDBF88184, 0x1BCDF180CD9F8287,
+0x000005EC30782B09, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD4A38D9831C78D24, 0x17181235735820DA, 0xCD59E34A61783856, 0x685A3019434EB55F,
+0xCD19DD7D2C76E4F7, 0xE8247C956D73DC22, 0x0000BEF444FE5DD3, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x4E5E5DE514C886BB, 0x2AC2C798BBF7B098,
+0x976EE2F3D5641BC4, 0x8E546F622E1CEA95, 0xD71C920ACAC82583, 0x59858AC8CBECB69E,
+0x00002DD9C7876806, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x000000000000742C, 0x0000000000000000, 0x0000000000000000, 0xB90FF404FC000000,
+0xD801A4FB559FACD4, 0xE93254545F77410C, 0x0000ECEEA7BD2EDA, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 };
@@ -49,6 +49,15 @@
 #define SECRETKEY_B_BYTES       ((OBOB_BITS - 1 + 7) / 8)
 #define FP2_ENCODED_BYTES       2*((NBITS_FIELD + 7) / 8)
 
+#if defined(AVX2_X4_IMPLEMENTATION)
+    // Parameters of the 4-way AVX2 implementation: field elements are split into VNWORDS_FIELD limbs in radix 2^VRADIX
+    #define VRADIX                  28
+    #define VNWORDS_FIELD           16              // Number of 28-bit limbs of a 434-bit field element in the 4-way representation (448-bit max.)
+    #define VZERO_WORDS             7               // Number of "0" limbs in the least significant part of p434 + 1
+    #define PRIMEx2_X4              p434x2_x4
+    #define PRIMEp1_X4              p434p1_x4
+#endif
+
 #ifdef COMPRESS
     #define MASK2_BOB               0x00
     #define MASK3_BOB               0x7F
@@ -104,6 +113,16 @@ typedef felm_t  f2elm_t[2];                                           // Datatyp
 typedef struct { f2elm_t X; f2elm_t Z; } point_proj;                  // Point representation in projective XZ Montgomery coordinates.
 typedef point_proj point_proj_t[1]; 
 
+#if defined(AVX2_X4_IMPLEMENTATION)
+    #include <immintrin.h>
+
+    typedef __m256i felm_x4_t[VNWORDS_FIELD];                         // Datatype for representing four 434-bit field elements, lane-interleaved in radix 2^28
+    typedef felm_x4_t f2elm_x4_t[2];                                  // Datatype for representing four GF(p434^2) elements
+
+    typedef struct { f2elm_x4_t X; f2elm_x4_t Z; } point_proj_x4;     // Four points in projective XZ Montgomery coordinates
+    typedef point_proj_x4 point_proj_x4_t[1]; 
+#endif
+
 #ifdef COMPRESS
     typedef struct { f2elm_t X; f2elm_t Y; f2elm_t Z; } point_full_proj;  // Point representation in full projective XYZ Montgomery coordinates 
     typedef point_full_proj point_full_proj_t[1]; 
@@ -169,6 +188,27 @@ void rdc434_asm(digit_t* ma, digit_t* mc);
 // Field multiplication using Montgomery arithmetic, c = a*b*R^-1 mod p434, where R=2^768
 void fpmul434_mont(const digit_t* a, const digit_t* b, digit_t* c);
 void mul434_asm(const digit_t* a, const digit_t* b, digit_t* c);
+
+// 434-bit integer squaring, c = a^2
+void sqr434_asm(const digit_t* a, digit_t* c);
+
+#if defined(X64_DISPATCH_IMPLEMENTATION)
+// The x64 kernels are called through a table that is set once at load time from cpuid
+extern x64_kernels_t x64_kernels434;
+#define fpadd434_asm                   x64_kernels434.modadd
+#define fpsub434_asm                   x64_kernels434.modsub
+#define mp_add434_asm                  x64_kernels434.mpadd
+#define mp_sub434_p2_asm               x64_kernels434.mpsub_p2
+#define mp_sub434_p4_asm               x64_kernels434.mpsub_p4
+#define mp_subadd434x2_asm             x64_kernels434.mpsubaddx2
+#define mp_dblsub434x2_asm             x64_kernels434.mpdblsubx2
+#define mul434_asm                     x64_kernels434.mul
+#define sqr434_asm                     x64_kernels434.sqr
+#define rdc434_asm                     x64_kernels434.rdc
+
+// Switch to kernel variant X64_KERNELS_PLAIN, X64_KERNELS_MULX or X64_KERNELS_ADX. Returns false if the processor does not support it
+bool x64_kernels_select434(const unsigned int variant);
+#endif
    
 // Field squaring using Montgomery arithmetic, c = a*b*R^-1 mod p434, where R=2^768
 void fpsqr434_mont(const digit_t* ma, digit_t* mc);
@@ -217,5 +257,16 @@ void fp2inv434_mont(f2elm_t a);
 // GF(p434^2) inversion, a = (a0-i*a1)/(a0^2+a1^2), GF(p434) inversion done using the binary GCD 
 void fp2inv434_mont_bingcd(f2elm_t a);
 
+/************ Fused elliptic curve and isogeny kernels *************/
+
+#if defined(X64_CURVE_ASM_IMPLEMENTATION) && defined(_CURVE_ASM_434_)
+    #define X64_CURVE_ASM
+
+void xDBLADD434_asm(point_proj_t P, point_proj_t Q, const f2elm_t XPQ, const f2elm_t ZPQ, const f2elm_t A24);
+void xDBL434_asm(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2elm_t C24);
+void xTPL434_asm(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus);
+void eval_4_isog434_asm(point_proj_t P, f2elm_t* coeff);
+void eval_3_isog434_asm(point_proj_t Q, const f2elm_t* coeff);
+#endif
 
 #endif
@@ -0,0 +1,276 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: fully unrolled multiplication, squaring and Montgomery reduction for P434
+*           (OPT_LEVEL=PORTABLE_FAST), generated by tools/gen_fp_portable.py
+*********************************************************************************************/
+
+#include "../P434_internal.h"
+#include "../../internal.h"
+
+
+// Column accumulation (t,u,v) += a*b
+#define MULACC(a, b)                                                                               \
+    { digit_t hi, lo; unsigned int cy;                                                             \
+      MUL((a), (b), &hi, lo);                                                                      \
+      ADDC(0, lo, v, cy, v);                                                                       \
+      ADDC(cy, hi, u, cy, u);                                                                      \
+      ADDC(cy, t, 0, cy, t); }
+
+// Cross product accumulation (st,su,sv) += a*b
+#define MULACC_CROSS(a, b)                                                                         \
+    { digit_t hi, lo; unsigned int cy;                                                             \
+      MUL((a), (b), &hi, lo);                                                                      \
+      ADDC(0, lo, sv, cy, sv);                                                                     \
+      ADDC(cy, hi, su, cy, su);                                                                    \
+      ADDC(cy, st, 0, cy, st); }
+
+// Column accumulation (t,u,v) += 2*(st,su,sv)
+#define ADD_CROSS_X2()                                                                             \
+    { unsigned int cy;                                                                             \
+      st = (st << 1) | (su >> (RADIX-1));                                                          \
+      su = (su << 1) | (sv >> (RADIX-1));                                                          \
+      sv = sv << 1;                                                                                \
+      ADDC(0, sv, v, cy, v);                                                                       \
+      ADDC(cy, su, u, cy, u);                                                                      \
+      ADDC(cy, st, t, cy, t); }
+
+
+void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
+{ // Multiprecision comba multiply, c = a*b, where lng(a) = lng(b) = NWORDS_FIELD.
+    digit_t t, u, v;
+    UNREFERENCED_PARAMETER(nwords);
+
+    t = 0; u = 0; v = 0;
+    MULACC(a[0], b[0]);
+    c[0] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[1]);
+    MULACC(a[1], b[0]);
+    c[1] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[2]);
+    MULACC(a[1], b[1]);
+    MULACC(a[2], b[0]);
+    c[2] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[3]);
+    MULACC(a[1], b[2]);
+    MULACC(a[2], b[1]);
+    MULACC(a[3], b[0]);
+    c[3] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[4]);
+    MULACC(a[1], b[3]);
+    MULACC(a[2], b[2]);
+    MULACC(a[3], b[1]);
+    MULACC(a[4], b[0]);
+    c[4] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[5]);
+    MULACC(a[1], b[4]);
+    MULACC(a[2], b[3]);
+    MULACC(a[3], b[2]);
+    MULACC(a[4], b[1]);
+    MULACC(a[5], b[0]);
+    c[5] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[6]);
+    MULACC(a[1], b[5]);
+    MULACC(a[2], b[4]);
+    MULACC(a[3], b[3]);
+    MULACC(a[4], b[2]);
+    MULACC(a[5], b[1]);
+    MULACC(a[6], b[0]);
+    c[6] = v; v = u; u = t; t = 0;
+    MULACC(a[1], b[6]);
+    MULACC(a[2], b[5]);
+    MULACC(a[3], b[4]);
+    MULACC(a[4], b[3]);
+    MULACC(a[5], b[2]);
+    MULACC(a[6], b[1]);
+    c[7] = v; v = u; u = t; t = 0;
+    MULACC(a[2], b[6]);
+    MULACC(a[3], b[5]);
+    MULACC(a[4], b[4]);
+    MULACC(a[5], b[3]);
+    MULACC(a[6], b[2]);
+    c[8] = v; v = u; u = t; t = 0;
+    MULACC(a[3], b[6]);
+    MULACC(a[4], b[5]);
+    MULACC(a[5], b[4]);
+    MULACC(a[6], b[3]);
+    c[9] = v; v = u; u = t; t = 0;
+    MULACC(a[4], b[6]);
+    MULACC(a[5], b[5]);
+    MULACC(a[6], b[4]);
+    c[10] = v; v = u; u = t; t = 0;
+    MULACC(a[5], b[6]);
+    MULACC(a[6], b[5]);
+    c[11] = v; v = u; u = t; t = 0;
+    MULACC(a[6], b[6]);
+    c[12] = v; v = u; u = t; t = 0;
+    c[13] = v;
+}
+
+
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision comba squaring, c = a^2, where lng(a) = NWORDS_FIELD.
+  // The cross products a[i]*a[j], i < j, of each column are accumulated once and doubled.
+    digit_t t = 0, u = 0, v = 0, st, su, sv;
+    UNREFERENCED_PARAMETER(nwords);
+
+    MULACC(a[0], a[0]);
+    c[0] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[1]);
+    ADD_CROSS_X2();
+    c[1] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[2]);
+    ADD_CROSS_X2();
+    MULACC(a[1], a[1]);
+    c[2] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[3]);
+    MULACC_CROSS(a[1], a[2]);
+    ADD_CROSS_X2();
+    c[3] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[4]);
+    MULACC_CROSS(a[1], a[3]);
+    ADD_CROSS_X2();
+    MULACC(a[2], a[2]);
+    c[4] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[5]);
+    MULACC_CROSS(a[1], a[4]);
+    MULACC_CROSS(a[2], a[3]);
+    ADD_CROSS_X2();
+    c[5] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[6]);
+    MULACC_CROSS(a[1], a[5]);
+    MULACC_CROSS(a[2], a[4]);
+    ADD_CROSS_X2();
+    MULACC(a[3], a[3]);
+    c[6] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[1], a[6]);
+    MULACC_CROSS(a[2], a[5]);
+    MULACC_CROSS(a[3], a[4]);
+    ADD_CROSS_X2();
+    c[7] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[2], a[6]);
+    MULACC_CROSS(a[3], a[5]);
+    ADD_CROSS_X2();
+    MULACC(a[4], a[4]);
+    c[8] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[3], a[6]);
+    MULACC_CROSS(a[4], a[5]);
+    ADD_CROSS_X2();
+    c[9] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[4], a[6]);
+    ADD_CROSS_X2();
+    MULACC(a[5], a[5]);
+    c[10] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[5], a[6]);
+    ADD_CROSS_X2();
+    c[11] = v; v = u; u = t; t = 0;
+    MULACC(a[6], a[6]);
+    c[12] = v; v = u; u = t; t = 0;
+    c[13] = v;
+}
+
+
+void rdc_mont(digit_t* ma, digit_t* mc)
+{ // Montgomery reduction exploiting the special form of the prime p434, mc = ma*R^-1 mod p434x2, where R = 2^448.
+  // If ma < 2^448*p434, the output mc is in the range [0, 2*p434-1].
+  // Since p434+1 = 2^192*p', p434 = -1 mod 2^192: the reduction adds Q*p'*2^192 for each block Q of 3 words of ma, from the least
+  // significant one, which leaves Q in place and clears Q*p434. The words of p' are multiplied as constants.
+    unsigned int i, carry;
+    digit_t t, u, v, r[2*NWORDS_FIELD], s[NWORDS_FIELD];
+
+    for (i = 0; i < 2*NWORDS_FIELD; i++) {
+        r[i] = ma[i];
+    }
+
+    t = 0; u = 0; v = 0;
+    MULACC(r[0], 0xFDC1767AE3000000ULL);
+    s[0] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0x7BC65C783158AEA3ULL);
+    MULACC(r[1], 0xFDC1767AE3000000ULL);
+    s[1] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0x6CFC5FD681C52056ULL);
+    MULACC(r[1], 0x7BC65C783158AEA3ULL);
+    MULACC(r[2], 0xFDC1767AE3000000ULL);
+    s[2] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0x0002341F27177344ULL);
+    MULACC(r[1], 0x6CFC5FD681C52056ULL);
+    MULACC(r[2], 0x7BC65C783158AEA3ULL);
+    s[3] = v; v = u; u = t; t = 0;
+    MULACC(r[1], 0x0002341F27177344ULL);
+    MULACC(r[2], 0x6CFC5FD681C52056ULL);
+    s[4] = v; v = u; u = t; t = 0;
+    MULACC(r[2], 0x0002341F27177344ULL);
+    s[5] = v; v = u; u = t; t = 0;
+    s[6] = v;
+    ADDC(0, r[3], s[0], carry, r[3]);
+    ADDC(carry, r[4], s[1], carry, r[4]);
+    ADDC(carry, r[5], s[2], carry, r[5]);
+    ADDC(carry, r[6], s[3], carry, r[6]);
+    ADDC(carry, r[7], s[4], carry, r[7]);
+    ADDC(carry, r[8], s[5], carry, r[8]);
+    ADDC(carry, r[9], s[6], carry, r[9]);
+    ADDC(carry, r[10], 0, carry, r[10]);
+    ADDC(carry, r[11], 0, carry, r[11]);
+    ADDC(carry, r[12], 0, carry, r[12]);
+    ADDC(carry, r[13], 0, carry, r[13]);
+
+    t = 0; u = 0; v = 0;
+    MULACC(r[3], 0xFDC1767AE3000000ULL);
+    s[0] = v; v = u; u = t; t = 0;
+    MULACC(r[3], 0x7BC65C783158AEA3ULL);
+    MULACC(r[4], 0xFDC1767AE3000000ULL);
+    s[1] = v; v = u; u = t; t = 0;
+    MULACC(r[3], 0x6CFC5FD681C52056ULL);
+    MULACC(r[4], 0x7BC65C783158AEA3ULL);
+    MULACC(r[5], 0xFDC1767AE3000000ULL);
+    s[2] = v; v = u; u = t; t = 0;
+    MULACC(r[3], 0x0002341F27177344ULL);
+    MULACC(r[4], 0x6CFC5FD681C52056ULL);
+    MULACC(r[5], 0x7BC65C783158AEA3ULL);
+    s[3] = v; v = u; u = t; t = 0;
+    MULACC(r[4], 0x0002341F27177344ULL);
+    MULACC(r[5], 0x6CFC5FD681C52056ULL);
+    s[4] = v; v = u; u = t; t = 0;
+    MULACC(r[5], 0x0002341F27177344ULL);
+    s[5] = v; v = u; u = t; t = 0;
+    s[6] = v;
+    ADDC(0, r[6], s[0], carry, r[6]);
+    ADDC(carry, r[7], s[1], carry, r[7]);
+    ADDC(carry, r[8], s[2], carry, r[8]);
+    ADDC(carry, r[9], s[3], carry, r[9]);
+    ADDC(carry, r[10], s[4], carry, r[10]);
+    ADDC(carry, r[11], s[5], carry, r[11]);
+    ADDC(carry, r[12], s[6], carry, r[12]);
+    ADDC(carry, r[13], 0, carry, r[13]);
+
+    t = 0; u = 0; v = 0;
+    MULACC(r[6], 0xFDC1767AE3000000ULL);
+    s[0] = v; v = u; u = t; t = 0;
+    MULACC(r[6], 0x7BC65C783158AEA3ULL);
+    s[1] = v; v = u; u = t; t = 0;
+    MULACC(r[6], 0x6CFC5FD681C52056ULL);
+    s[2] = v; v = u; u = t; t = 0;
+    MULACC(r[6], 0x0002341F27177344ULL);
+    s[3] = v; v = u; u = t; t = 0;
+    s[4] = v;
+    ADDC(0, r[9], s[0], carry, r[9]);
+    ADDC(carry, r[10], s[1], carry, r[10]);
+    ADDC(carry, r[11], s[2], carry, r[11]);
+    ADDC(carry, r[12], s[3], carry, r[12]);
+    ADDC(carry, r[13], s[4], carry, r[13]);
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        mc[i] = r[NWORDS_FIELD+i];
+    }
+}
@@ -6,6 +6,9 @@
 
 #include "../P503_internal.h"
 #include "../../internal.h"
+#if defined(X64_DISPATCH_IMPLEMENTATION)
+    #include <cpuid.h>
+#endif
 
 
 // Global constants
@@ -379,6 +382,23 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
 }
 
 
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision squaring, c = a^2, where lng(a) = nwords.
+        
+    UNREFERENCED_PARAMETER(nwords);
+
+#if (OS_TARGET == OS_WIN) || (!defined(_MULX_) && !defined(X64_DISPATCH_IMPLEMENTATION))
+
+    mp_mul(a, a, c, NWORDS_FIELD);
+
+#elif (OS_TARGET == OS_NIX)
+    
+    sqr503_asm(a, c);
+
+#endif
+}
+
+
 void rdc_mont(digit_t* ma, digit_t* mc)
 { // Montgomery reduction exploiting special form of the prime.
   // mc = ma*R^-1 mod p503x2, where R = 2^512.
@@ -566,4 +586,81 @@ void rdc_mont(digit_t* ma, digit_t* mc)
     rdc503_asm(ma, mc);    
 
 #endif
-}
\ No newline at end of file
+}
+
+
+#if defined(X64_DISPATCH_IMPLEMENTATION)
+
+// Kernel variants assembled from fp_x64_asm.S with the suffixes _plain (baseline x64), _mulx (BMI2) and _adx (BMI2 and ADX)
+#define X64_KERNEL_PROTOTYPES(v)                                                    \
+    void fpadd503_asm##v(const digit_t* a, const digit_t* b, digit_t* c);           \
+    void fpsub503_asm##v(const digit_t* a, const digit_t* b, digit_t* c);           \
+    void mp_add503_asm##v(const digit_t* a, const digit_t* b, digit_t* c);          \
+    void mp_sub503_p2_asm##v(const digit_t* a, const digit_t* b, digit_t* c);       \
+    void mp_sub503_p4_asm##v(const digit_t* a, const digit_t* b, digit_t* c);       \
+    void mp_subadd503x2_asm##v(const digit_t* a, const digit_t* b, digit_t* c);     \
+    void mp_dblsub503x2_asm##v(const digit_t* a, const digit_t* b, digit_t* c);     \
+    void mul503_asm##v(const digit_t* a, const digit_t* b, digit_t* c);             \
+    void sqr503_asm##v(const digit_t* a, digit_t* c);                               \
+    void rdc503_asm##v(digit_t* ma, digit_t* mc);
+
+#define X64_KERNEL_TABLE(v, mul, sqr, rdc, variant)                                 \
+    { fpadd503_asm##v, fpsub503_asm##v, mp_add503_asm##v, mp_sub503_p2_asm##v,       \
+      mp_sub503_p4_asm##v, mp_subadd503x2_asm##v, mp_dblsub503x2_asm##v, mul, sqr, rdc, variant }
+
+X64_KERNEL_PROTOTYPES(_plain)
+X64_KERNEL_PROTOTYPES(_mulx)
+X64_KERNEL_PROTOTYPES(_adx)
+
+static void sqr503_plain(const digit_t* a, digit_t* c)
+{ // There is no baseline squaring kernel, square with the baseline multiplication instead
+    mul503_asm_plain(a, a, c);
+}
+
+
+static const x64_kernels_t x64_kernels503_variants[3] = {
+    X64_KERNEL_TABLE(_plain, mul503_asm_plain, sqr503_plain, rdc503_asm_plain, X64_KERNELS_PLAIN),
+    X64_KERNEL_TABLE(_mulx, mul503_asm_mulx, sqr503_asm_mulx, rdc503_asm_mulx, X64_KERNELS_MULX),
+    X64_KERNEL_TABLE(_adx, mul503_asm_adx, sqr503_asm_adx, rdc503_asm_adx, X64_KERNELS_ADX)
+};
+
+// Starts out with the baseline kernels, so it is usable even before the load-time selection has run
+x64_kernels_t x64_kernels503 = X64_KERNEL_TABLE(_plain, mul503_asm_plain, sqr503_plain, rdc503_asm_plain, X64_KERNELS_PLAIN);
+
+
+static unsigned int x64_kernels_supported(void)
+{ // Returns the fastest kernel variant supported by the processor
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, NULL) < 7) {
+        return X64_KERNELS_PLAIN;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    UNREFERENCED_PARAMETER(eax); UNREFERENCED_PARAMETER(ecx); UNREFERENCED_PARAMETER(edx);
+
+    if ((ebx & bit_BMI2) == 0) {
+        return X64_KERNELS_PLAIN;
+    }
+    if ((ebx & bit_ADX) == 0) {
+        return X64_KERNELS_MULX;
+    }
+    return X64_KERNELS_ADX;
+}
+
+
+bool x64_kernels_select503(const unsigned int variant)
+{ // Switch to the given kernel variant. Returns false if the processor does not support it
+    if (variant > x64_kernels_supported()) {
+        return false;
+    }
+    x64_kernels503 = x64_kernels503_variants[variant];
+    return true;
+}
+
+
+__attribute__((constructor)) static void x64_kernels_init503(void)
+{ // Select the fastest supported kernel variant once, at load time
+    x64_kernels_select503(x64_kernels_supported());
+}
+
+#endif
\ No newline at end of file
@@ -70,6 +70,21 @@ const uint64_t Montgomery_R2[NWORDS64_FIELD]     = { 0x5289A0CF641D011F, 0x9B882
 // Value one in Montgomery representation 
 const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000000003F9, 0x0000000000000000, 0x0000000000000000, 0xB400000000000000, 
                                                      0x63CB1A6EA6DED2B4, 0x51689D8D667EB37D, 0x8ACD77C71AB24142, 0x0026FBAEC60F5953 };
+#if defined(AVX2_X4_IMPLEMENTATION)
+// Values 2*p503 and p503+1 in radix 2^28, used by the 4-way AVX2 implementation
+const uint64_t p503x2_x4[VNWORDS_FIELD]          = { 0xFFFFFFE, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+                                                     0x7FFFFFF, 0x23CF415, 0x0B7B444, 0xFB5E261, 0xD90F6FC, 0xA03737E, 0xBB4EF49, 0xC08B8D7,
+                                                     0x3023C3C, 0x80CDEA8, 0x0000000 };
+const uint64_t p503p1_x4[VNWORDS_FIELD]          = { 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000,
+                                                     0xC000000, 0x11E7A0A, 0x85BDA22, 0x7DAF130, 0x6C87B7E, 0xD01B9BF, 0xDDA77A4, 0x6045C6B,
+                                                     0x1811E1E, 0x4066F54, 0x0000000 };
+// Montgomery constant Montgomery_Rv = 2^532 mod p503, used for the conversion to the 4-way representation
+const uint64_t Montgomery_Rv[NWORDS64_FIELD]     = { 0x000000003F99AF57, 0x0000000000000000, 0x0000000000000000, 0x8C00000000000000,
+                                                     0x3D9DE6E03538A6D1, 0x2C1625EB5CC72CE4, 0x1532AA124080D875, 0x00086E4AFFAF4A41 };
+// Montgomery constant Montgomery_RRv = (2^512)^2/2^532 mod p503, used for the conversion from the 4-way representation
+const uint64_t Montgomery_RRv[NWORDS64_FIELD]    = { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+                                                     0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000100000000000 };
+#endif
 
 
 // Fixed parameters for isogeny tree computation
@@ -119,9 +134,29 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define mp_add_asm                    mp_add503_asm
 #define mp_subaddx2_asm               mp_subadd503x2_asm
 #define mp_dblsubx2_asm               mp_dblsub503x2_asm
+#if defined(X64_CURVE_ASM)
+    #define xDBLADD_asm               xDBLADD503_asm
+    #define xDBL_asm                  xDBL503_asm
+    #define xTPL_asm                  xTPL503_asm
+    #define eval_4_isog_asm           eval_4_isog503_asm
+    #define eval_3_isog_asm           eval_3_isog503_asm
+#endif
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp503
 #define crypto_kem_enc                crypto_kem_enc_SIKEp503
+#define crypto_kem_enc_parallel       crypto_kem_enc_parallel_SIKEp503
+#define crypto_kem_pk_prepare         crypto_kem_pk_prepare_SIKEp503
+#define crypto_kem_enc_prepared       crypto_kem_enc_prepared_SIKEp503
+#define crypto_kem_prepared_pk        crypto_kem_prepared_pk_SIKEp503
 #define crypto_kem_dec                crypto_kem_dec_SIKEp503
+#define crypto_kem_dec_init           crypto_kem_dec_init_SIKEp503
+#define crypto_kem_dec_step           crypto_kem_dec_step_SIKEp503
+#define crypto_kem_dec_finish         crypto_kem_dec_finish_SIKEp503
+#define crypto_kem_dec_state          crypto_kem_dec_state_SIKEp503
+#define crypto_kem_enc_batch4         crypto_kem_enc_batch4_SIKEp503
+#define crypto_kem_dec_batch4         crypto_kem_dec_batch4_SIKEp503
+#define crypto_kem_keypair_batch      crypto_kem_keypair_batch_SIKEp503
+#define crypto_kem_enc_batch          crypto_kem_enc_batch_SIKEp503
+#define crypto_kem_dec_batch          crypto_kem_dec_batch_SIKEp503
 #define random_mod_order_A            random_mod_order_A_SIDHp503
 #define random_mod_order_B            random_mod_order_B_SIDHp503
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp503
@@ -129,7 +164,18 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp503
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp503
 
+#if defined(FIXED_BASIS_LADDER)
+    #include "P503_ladder_tables.c"
+#endif
+#include "../safegcd.c"
 #include "../fpx.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"    
-#include "../sike.c"
\ No newline at end of file
+#include "../sike.c"
+#if defined(AVX2_X4_IMPLEMENTATION)
+    #include "../batch/fpx_x4.c"
+    #include "../batch/ec_isogeny_x4.c"
+    #include "../batch/sidh_x4.c"
+#endif
+#include "../batch/sike_x4.c"
+#include "../batch/sike_batch.c"
\ No newline at end of file
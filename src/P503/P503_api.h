@@ -30,12 +30,76 @@ int crypto_kem_keypair_SIKEp503(unsigned char *pk, unsigned char *sk);
 //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = 402 bytes)
 int crypto_kem_enc_SIKEp503(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
 
+// SIKE's encapsulation using two threads, with the same input and outputs as crypto_kem_enc_SIKEp503
+// The ephemeral key generation runs on a persistent thread pool owned by the library (POSIX threads), or in the calling thread if unavailable
+int crypto_kem_enc_parallel_SIKEp503(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+
+// Public key prepared for repeated encapsulations to the same public key by crypto_kem_pk_prepare_SIKEp503
+// It holds a copy of pk together with its decoded values and the recovered curve constants (6 GF(p503^2) elements in Montgomery representation)
+typedef struct {
+    unsigned long long curve[96];
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES];
+} crypto_kem_prepared_pk_SIKEp503;
+
+// Preparation of a public key for crypto_kem_enc_prepared_SIKEp503
+// Input:   public key pk         (CRYPTO_PUBLICKEYBYTES = 378 bytes)
+// Output:  prepared public key prepared
+int crypto_kem_pk_prepare_SIKEp503(const unsigned char *pk, crypto_kem_prepared_pk_SIKEp503 *prepared);
+
+// SIKE's encapsulation to a prepared public key, with the same outputs as crypto_kem_enc_SIKEp503
+// Input:   prepared public key prepared, obtained with crypto_kem_pk_prepare_SIKEp503
+// Outputs: shared secret ss      (CRYPTO_BYTES = 24 bytes)
+//          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = 402 bytes)
+int crypto_kem_enc_prepared_SIKEp503(unsigned char *ct, unsigned char *ss, const crypto_kem_prepared_pk_SIKEp503 *prepared);
+
+// State of a resumable decapsulation, see crypto_kem_dec_init_SIKEp503
+typedef struct {
+    unsigned long long opaque[736];
+} crypto_kem_dec_state_SIKEp503;
+
 // SIKE's decapsulation
 // Input:   secret key sk         (CRYPTO_SECRETKEYBYTES = 434 bytes)
 //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = 402 bytes) 
 // Outputs: shared secret ss      (CRYPTO_BYTES = 24 bytes)
 int crypto_kem_dec_SIKEp503(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
 
+// Resumable SIKE decapsulation, with the same inputs and output as crypto_kem_dec_SIKEp503
+// crypto_kem_dec_init_SIKEp503 starts a decapsulation of ct with sk, which must stay valid until crypto_kem_dec_finish_SIKEp503 returns.
+// crypto_kem_dec_step_SIKEp503 runs at most budget steps (ladder bits, or tree traversal multiplications and isogenies) and returns 1 while steps remain, 0 otherwise.
+// crypto_kem_dec_finish_SIKEp503 runs any remaining steps, outputs the shared secret ss and clears the state.
+int crypto_kem_dec_init_SIKEp503(crypto_kem_dec_state_SIKEp503 *state, const unsigned char *ct, const unsigned char *sk);
+int crypto_kem_dec_step_SIKEp503(crypto_kem_dec_state_SIKEp503 *state, unsigned int budget);
+int crypto_kem_dec_finish_SIKEp503(unsigned char *ss, crypto_kem_dec_state_SIKEp503 *state);
+
+// SIKE's batched encapsulation, four public keys per call
+// Input:   public keys pk          (4*CRYPTO_PUBLICKEYBYTES = 1512 bytes, the j-th key at pk + j*CRYPTO_PUBLICKEYBYTES)
+// Outputs: shared secrets ss       (4*CRYPTO_BYTES = 96 bytes, the j-th secret at ss + j*CRYPTO_BYTES)
+//          ciphertext messages ct  (4*CRYPTO_CIPHERTEXTBYTES = 1608 bytes, the j-th ciphertext at ct + j*CRYPTO_CIPHERTEXTBYTES)
+int crypto_kem_enc_batch4_SIKEp503(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+
+// SIKE's batched decapsulation, four ciphertexts under the same secret key per call
+// Input:   secret key sk           (CRYPTO_SECRETKEYBYTES = 434 bytes)
+//          ciphertext messages ct  (4*CRYPTO_CIPHERTEXTBYTES = 1608 bytes, the j-th ciphertext at ct + j*CRYPTO_CIPHERTEXTBYTES)
+// Outputs: shared secrets ss       (4*CRYPTO_BYTES = 96 bytes, the j-th secret at ss + j*CRYPTO_BYTES)
+int crypto_kem_dec_batch4_SIKEp503(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+// SIKE's batched key generation, n key pairs per call sharing the final inversions
+// Outputs: secret keys sk          (n*CRYPTO_SECRETKEYBYTES = n*434 bytes, the i-th key at sk + i*CRYPTO_SECRETKEYBYTES)
+//          public keys pk          (n*CRYPTO_PUBLICKEYBYTES = n*378 bytes, the i-th key at pk + i*CRYPTO_PUBLICKEYBYTES)
+int crypto_kem_keypair_batch_SIKEp503(const unsigned int n, unsigned char *pk, unsigned char *sk);
+
+// SIKE's batched encapsulation, n public keys per call sharing the final inversions
+// Input:   public keys pk          (n*CRYPTO_PUBLICKEYBYTES = n*378 bytes, the i-th key at pk + i*CRYPTO_PUBLICKEYBYTES)
+// Outputs: shared secrets ss       (n*CRYPTO_BYTES = n*24 bytes, the i-th secret at ss + i*CRYPTO_BYTES)
+//          ciphertext messages ct  (n*CRYPTO_CIPHERTEXTBYTES = n*402 bytes, the i-th ciphertext at ct + i*CRYPTO_CIPHERTEXTBYTES)
+int crypto_kem_enc_batch_SIKEp503(const unsigned int n, unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+
+// SIKE's batched decapsulation, n ciphertexts under the same secret key per call sharing the final inversions
+// Input:   secret key sk           (CRYPTO_SECRETKEYBYTES = 434 bytes)
+//          ciphertext messages ct  (n*CRYPTO_CIPHERTEXTBYTES = n*402 bytes, the i-th ciphertext at ct + i*CRYPTO_CIPHERTEXTBYTES)
+// Outputs: shared secrets ss       (n*CRYPTO_BYTES = n*24 bytes, the i-th secret at ss + i*CRYPTO_BYTES)
+int crypto_kem_dec_batch_SIKEp503(const unsigned int n, unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
 
 // Encoding of keys for KEM-based isogeny system "SIKEp503" (wire format):
 // ----------------------------------------------------------------------
@@ -6,6 +6,8 @@
 
 #ifndef P503_COMPRESSED_API_H
 #define P503_COMPRESSED_API_H
+
+#include <stddef.h>
     
 
 /*********************** Key encapsulation mechanism API ***********************/
@@ -18,6 +20,9 @@
 // Algorithm name
 #define CRYPTO_ALGNAME "SIKEp503_compressed"  
 
+// Size in bytes of the caller-provided workspace of the _ws functions, which holds the large temporaries that the other functions keep on the stack
+#define SIKE_WORKSPACE_BYTES    83968
+
 // SIKE's key generation
 // It produces a private key sk and computes the public key pk.
 // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES = 407 bytes)
@@ -30,12 +35,23 @@ int crypto_kem_keypair_SIKEp503_compressed(unsigned char *pk, unsigned char *sk)
 //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = 280 bytes)
 int crypto_kem_enc_SIKEp503_compressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
 
+// SIKE's encapsulation using two threads, with the same input and outputs as crypto_kem_enc_SIKEp503_compressed
+// The ephemeral key generation runs on a persistent thread pool owned by the library (POSIX threads), or in the calling thread if unavailable
+int crypto_kem_enc_parallel_SIKEp503_compressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+
 // SIKE's decapsulation
 // Input:   secret key sk         (CRYPTO_SECRETKEYBYTES = 407 bytes)
 //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = 280 bytes) 
 // Outputs: shared secret ss      (CRYPTO_BYTES = 24 bytes)
 int crypto_kem_dec_SIKEp503_compressed(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
 
+// SIKE's key generation, encapsulation and decapsulation using a caller-provided workspace, with the same outputs as the functions above
+// The workspace must have at least SIKE_WORKSPACE_BYTES bytes and be aligned to 8 bytes, otherwise the functions return -1. It is cleared on return
+// and can be reused by subsequent calls, but not by concurrent ones.
+int crypto_kem_keypair_ws_SIKEp503_compressed(unsigned char *pk, unsigned char *sk, void *workspace, size_t workspace_bytes);
+int crypto_kem_enc_ws_SIKEp503_compressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk, void *workspace, size_t workspace_bytes);
+int crypto_kem_dec_ws_SIKEp503_compressed(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, void *workspace, size_t workspace_bytes);
+
 
 // Encoding of keys for KEM-based isogeny system "SIKEp503" (wire format):
 // ----------------------------------------------------------------------
@@ -94,6 +110,13 @@ int EphemeralSecretAgreement_A_SIDHp503_Compressed(const unsigned char* PrivateK
 // Output: a shared secret SharedSecretB that consists of one element in GF(p503^2) encoded in 126 bytes.
 int EphemeralSecretAgreement_B_SIDHp503_Compressed(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB);
 
+// Ephemeral key generation and shared secret computation using a caller-provided workspace of at least SIKE_WORKSPACE_BYTES bytes, aligned to 8 bytes
+// They have the same outputs as the functions above and return -1 if the workspace is too small or not aligned.
+int EphemeralKeyGeneration_A_ws_SIDHp503_Compressed(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, void* workspace, size_t workspace_bytes);
+int EphemeralKeyGeneration_B_ws_SIDHp503_Compressed(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB, void* workspace, size_t workspace_bytes);
+int EphemeralSecretAgreement_A_ws_SIDHp503_Compressed(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA, void* workspace, size_t workspace_bytes);
+int EphemeralSecretAgreement_B_ws_SIDHp503_Compressed(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB, void* workspace, size_t workspace_bytes);
+
 
 // Encoding of keys for KEX-based isogeny system "SIDHp503_compressed" (wire format):
 // ----------------------------------------------------------------------
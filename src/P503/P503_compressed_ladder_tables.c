@@ -0,0 +1,1009 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: precomputed tables for the fixed-basis three-point ladder for P503 when using compression
+*********************************************************************************************/ 
+
+// Alice's table {x([2^i]QA)}, i = 0,...,249, of affine x-coordinates in GF(p503^2) on the starting curve E: y^2 = x^3 + 6x^2 + x,
+// expressed in Montgomery representation. Each entry is stored as {x0, x1} (128 bytes per entry, 32000 bytes in total)
+const uint64_t A_ladder_table[OALICE_BITS*2*NWORDS64_FIELD] = {
+0xDD27E5ADF7F57AB4, 0x7C1379D2B09F0434, 0x6E267408F1C8C89F, 0xC3BB383C07B60035,
+0x9268C9183A95ECD5, 0x9327EC043E0F021F, 0xE63D2D907A9DE5A5, 0x003110B6B4E0CD93,
+0x40B6BC5F5C2675E6, 0x62AD4B61EEDC2C5C, 0xA1CCA6B5091EF540, 0xC6273D4E1D8FC7FE,
+0x266D8B99EE63A78F, 0x39604E6927906566, 0xAB8BA8F2C6A977F8, 0x000CD759EE7AB739,
+0x273F6C464CB9AB1A, 0x83722DBAE9836B36, 0x7236DD158D1A1BBF, 0xBE84ED2FD6FC9B11,
+0xF4FAC85BBA91E9B4, 0x783D71C36F23AE76, 0x6FC94CF24BDA330A, 0x003929A6320C9596,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x85C7CA3E9EADB0FB, 0x97873829844CF9A5, 0x96510E240E86B156, 0x32DE7282E40EE2EA,
+0xCEB9B74450B1BAB6, 0xB3FB4DD93020D1C6, 0x9AE7942F44820CD0, 0x00237D4C4EDBC0F2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0C1BD72B10DA47B5, 0x084A26F4EE4496FA, 0x34589B9528ECBF9C, 0xFB6222BA5EECE380,
+0x86207CD9E13E1DCF, 0x0ACAB0689E7FDFAA, 0xF44563142F2F6EFD, 0x00363CD5B56E1DF5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE01B02B0FFABEC3D, 0xED5F88D2590604A9, 0xADA943FA1DD8403F, 0xA2330D59DC77889C,
+0x5F02A765521A2BC6, 0x95BD73CA83D0B69C, 0x965B0320353C59EB, 0x000AF09C4DED982B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF238C2032DBAF31F, 0xE29F7AAF15F306FB, 0x45DFA909E7653EBC, 0xD725C090B921F541,
+0xC88AE4785E83E415, 0x3BCE2B70074EB57D, 0xC81F18530733B9F0, 0x00035384FBD0AA03,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF6D3936A7E870AD1, 0x525FDE819DBEBAE0, 0x2874E4ECC2630B74, 0x63BC2C7D26CB7E36,
+0x42C8A8CBE2A8A532, 0x0C5B5B3615F0DC28, 0x74096AD7E8D170B0, 0x00263E4750637DF6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBE269B61D1652EC2, 0xD03EF1FEF08E1497, 0xB699A3117FA61D4B, 0x952788543423CF68,
+0xB7F18BB06EA2704C, 0xE41948B88B61D5A1, 0x9D9834127C12A713, 0x0014E1781B819708,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8C24774ABB7F9C3E, 0x5341695414714243, 0x7673CE34ADCB8932, 0xE24D78196166C3EC,
+0xFE99BEE6F537A435, 0xAB55406EED9889C8, 0xC38F6DF6ECD3BF74, 0x0005C00AF3581738,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4A3BEA3AE93958BE, 0xE03E165866FDBEDD, 0x925C330C1E7D8226, 0x74FB772BB1A85AFC,
+0x8EDC3905F2EC1C08, 0x6763854E99C3C710, 0x40E7AAF8A5B3C59C, 0x000F873B513FD178,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x655858D5FD89E9E9, 0xE47C518457856AB0, 0x6EDE0F13DF8B80D2, 0x0A7A03582B70F298,
+0xC130289C41A372E5, 0x3EEAC2478C577468, 0x12D4E51A79C30B72, 0x0037632411AE8B7D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9E8FFAF253555F91, 0x308D2F92623A0758, 0xE283E03D68849D09, 0xEA2A3E8DC4720855,
+0x0A05639EB2F634AC, 0xD8D4ACCB0D6C1B7C, 0x9379D94A7D65A92D, 0x0027989B6AB37E2F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5E3A092F118935DF, 0x7CE31E0C582ED837, 0xAB07330F1F006699, 0x1F71C77A33D38014,
+0x834A7635433870ED, 0x8044DD1D646E3877, 0xCD1A9D9482C6D916, 0x002C29F5144BCA0E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCA9A36B9F4CD5232, 0xA2D743ED9D94288F, 0xE11854245C2BE3F9, 0x5CDD5D0EA9C62B77,
+0xBD2804ED3DF7C470, 0xBEFAB40B14AC6DED, 0xD9B24D2690B292B2, 0x0000FFC084086174,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8F23E62C402FD6D7, 0x947EF73A4794033E, 0xDF63C67CFBDEF4C2, 0xB7A1E3299594F62D,
+0x8AB9E13948377BDF, 0x6F4C5E77030C6334, 0x676F029C64EE546D, 0x003E7A516A8132F1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x216C54D5330CC618, 0xBC2C3DB4CE0888C2, 0x2C92AA85C95B4DA6, 0xE10E9A4B6E7210B1,
+0x42589D244609EECE, 0xA78FF265DF09B216, 0xCB26E803563101B3, 0x00326713536CF56F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x60DD66091EF9EF31, 0x1713DA394C304A7C, 0x93650F486A1E3823, 0x8B48A18300898763,
+0xA8630053297E336A, 0x590E2C12DEC6F1C8, 0x972D44417C9F6F30, 0x00261D140FB28298,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x36080686BF920DC2, 0x602D018177CD81D2, 0xE3641F6027AF998D, 0x7F8E0FDFBB079394,
+0x1E1349A21FEBF960, 0x90BF0743F0EA167B, 0xF8F82E3F8384E1EE, 0x0007376922B93D59,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4C1AA9CD5080A0D4, 0x12415F1D2B7C1C47, 0xE42D8F52EA34738E, 0x70DFE05607ADE66B,
+0xEF37BA991FD41154, 0x06AA2F5CFF7284F2, 0x7BE466896F6482AF, 0x000F1C0BE2010C47,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC2B0DCCD96D91BC0, 0x84FA2BAC0D3C859B, 0x00C17ED893C59886, 0xAF948BD94C3DC842,
+0x446367EDA3DA7A19, 0xE645A8F28DD4B31E, 0xAA16DAA137685784, 0x00379DF646DEE55E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7D304F8AE560C434, 0x0F5DAC6B99A25356, 0x1CF4C58415593775, 0x6FCA44231F25C19A,
+0xAB564B82B6B7CFBC, 0x073FA04F70CD3EAC, 0x5F57F1EC902A1E7C, 0x003F070A6041D3EC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2F9420C8E8DD3C17, 0xD50455326469FF7A, 0x06D2A21A9C77AEB7, 0x5C88356EB4EFD335,
+0x633C0F6EBF1A9CFF, 0x52C8297A5DD20AC0, 0x8F3B16FF410E3FD1, 0x00253903FEB0CCB1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC9667FEEE14BC406, 0x3ABDA0FF19DD27E4, 0x11E9C4C666AF0D2B, 0xFCDB81838D7FB021,
+0x80D10A35E22B7F12, 0x5729E296503E27A2, 0xAF69944E64647401, 0x000A82F6972900AA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFB7A89D1955B18C7, 0x924C5A87BD5AFB2D, 0xB0B0D6C7D4232D21, 0xD198880C758D5D1D,
+0xF8085817790AB2CE, 0xCF3FC79A8BCB84FC, 0x5B421DD87F6E893D, 0x00236FCD15403274,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1C7D160D890CD612, 0xD8742A80A183A819, 0x1886ADF7A0B3BF7B, 0x1FA31CF776DC029F,
+0xBD948D7D80EC0684, 0xAA47B731FABB31E8, 0x942BF53974FC6CE4, 0x002C23E07BADFEB6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x348427C7A43F0A88, 0x3B4E3840FEE58440, 0x1AF900E7BA995443, 0x29C8816ECC8CD8EE,
+0x4A9B7ECF5B5238C0, 0xB6F7C66555EF953C, 0xE4D65E2E9DAD4B59, 0x0034F76A4767FC0E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAD8D3EF219B161C8, 0x850C2D3DF19F74A8, 0xB6FF920CF9060745, 0x28D82DD90B77165D,
+0x19FA878B1871F802, 0x3243EE6B23584C44, 0x8411BDD58C9ABF03, 0x000F35C52B6C8732,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE204FC1954A7B516, 0x54E6ECCAA01104E7, 0xCDC90F59BA28C8C3, 0x59F92A53CE3183F7,
+0x61791317861E9DF5, 0x83F50C67C47C96AC, 0x509F1005F5461D56, 0x0010DF8F13C5412D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF9D9C38E6C953243, 0x4D3E9C9679B8224A, 0xF56F5A259E8A090D, 0x88244EF93A232DF1,
+0x164AF28D032F79EE, 0x1DFC30A7EC618C26, 0xDD3E9AA6B229A33F, 0x0010CE439DE7888D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x207655795F5D22E9, 0x5D5477DA9C7D11C5, 0x41212F9D7C7E7972, 0xAEFEECE8B6194D7C,
+0x31D64E2369277B21, 0x466A968C72DCF665, 0x402BC57152E6BFC7, 0x000E2CEFC3EFB7A0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD40A3759B50F6D7F, 0x8C11372753F4D466, 0x9E4984B03947D2BB, 0x566C8D2E04AE1E88,
+0xBD03AF0BE7403169, 0xB21B1F56483CC267, 0x2BAF9A0AE26C809C, 0x0039D1BA5FE864C0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x726FA5887421A5B9, 0x1676D2B6343EDF71, 0x64F870687CE0F93D, 0x0E750118FE836D7B,
+0x324E53A4F56EAC88, 0x2216072008C94BB7, 0x46C90630DB49F4C1, 0x00052CB8C25A2970,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3983A001EA895815, 0x1103D63BBEF8E930, 0xE8141486D35B1298, 0xD202F260F0C6E817,
+0x73A4B9B53E1E0B77, 0x7A475989F80FFCAB, 0x086BB42B32979711, 0x00202759A517C9AC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0E9F67B5625F524D, 0x0644D19873C84A1C, 0xA408DADF509C039F, 0x7214D7266AC91EB3,
+0xDCCE78EEF0AF230C, 0xC0AA18105FEE6928, 0xBC9D2AC0EA594ACF, 0x00369235C83351CD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1A6B1F3953CFA63A, 0x9D942A8F71B7914E, 0xCF20CF94BF3E63D6, 0xDC697C1D8C8610E0,
+0x77D01CA084CCCE77, 0xFA3967E32ED275FA, 0x709FA5F62F48C630, 0x0040522A7A0FFDAF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7179426ED339F8FD, 0xC95C088DB6AC5581, 0x4E9EC64F542AD219, 0x6153EC343C4BC3AA,
+0x189844B41FA2C967, 0xACE87D3117EAFC64, 0x48ABF33DB12D0907, 0x0033483A1CBB8ED1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4C7EF82370759413, 0x8DD04D3829E397A4, 0x1D83974E5AACC19F, 0xC9730FD9756CB8A4,
+0x6D4B722248D427BE, 0x880E3A7551CDC970, 0x17C057C905A1CA6D, 0x002EF5E4439CD1E1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4683641EC4024F33, 0x7FFF9B467854DBB2, 0x1C336F8BE4BFC89A, 0x64A94B7F5C212505,
+0x4C9E440B6581D7F7, 0xE5A2D71E9DFB89E0, 0x258D1FB8D3DE13CD, 0x0007B8DBBC97BDE3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2DE16D82F4F83416, 0xF9B162B6438D8DEE, 0x6CD67F54429A923F, 0x1635D4BE4889A969,
+0xD97CD356D7810321, 0x60D260FA1DED7EFA, 0x8F12DC4BE3F07115, 0x001D373B5536305C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x829D14BE24D670C9, 0x05D8840379FDE8E5, 0xA3104BC1499655DB, 0x44742EE25410D39B,
+0x628D855139229474, 0x7D3F613B334B13D6, 0x352E9252BECFEA6A, 0x003A54658B3DC87D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBAA49BE6EE62A614, 0x9258C939A57D41C1, 0xF3D3F452B6DD9D5A, 0xCCFF98FE150B154E,
+0x1E5024067444EF05, 0x645205AF1A1C6278, 0x717244EA0BFA0A94, 0x003277D942033A07,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2680476EC17CE8D3, 0xABE893014CF95CD3, 0xF0364EAEDF0BDB45, 0xF6BAD4D4B06AE7C3,
+0xE5DE9CC6C8D84765, 0x55CAF142297709C8, 0xE506C357CBADDBC8, 0x00147F6051D120F1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFD74AE5FE556BF6D, 0xD06C0EC19856F3B5, 0xEEAC21BF0EA6160C, 0x7516A0565E9554E4,
+0x6768BE2F4C323C50, 0xC48C8FB5F1C2DC4D, 0x3002B75AC1B23210, 0x003AEAA4EC9EB7AE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x62C4EB49B761B9B7, 0xB6D878926F4B22D0, 0xFDE806E02D71D9D8, 0xF449744FB96838D0,
+0x3F4A02ACA21F1EC3, 0xB87E80420FDAD4F6, 0xAB0C1FA49CE2033A, 0x003C542AF30271E5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x530087A2685041B6, 0x997A435E795C8B70, 0x5C4746CBEC6FD705, 0x93857FD5175D3663,
+0x21D35E752C073544, 0xFF99F237C0E30530, 0x4F94145A4AA2AF3D, 0x002B260DBA9E56A9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0A0DBDEFE00A7449, 0x234F8748B4B3A097, 0x84D97B7ABDE189AF, 0x265E0DB63773C6A2,
+0x93C4F05866423ED9, 0x39BEAE4EF20F4784, 0x8AB30F4568FC1417, 0x0027EB52623C7DC3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3F3AC59B62D0266C, 0x5B64111CB1EFF9F9, 0x73267ED600B5CBC0, 0xD5AA3942B5524F65,
+0xDEB45E5496EA580E, 0x26529529AC0C95E7, 0x168B50D9BA94BCA5, 0x00209A2FD420ED91,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBBBDA130364A0D76, 0x042375E17B844072, 0xA83833AAB45E103C, 0xB424422869721A80,
+0x90075B05DAE6FB7A, 0x89781547694DB0FD, 0xFCB8616DDA4BE8D8, 0x000ACB86FA41AA38,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0765951770CB05DB, 0xE3D7DFB47A9980B9, 0x78EDB7FD4CF668E3, 0x6625D28BC58183F0,
+0x6ADF5E2E94D7F98E, 0x2A28F232B2D084C5, 0x4DF4B1700ECFD940, 0x003FC1178FA32496,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x38AD04EBA916CACA, 0x2A3E39755CF5434D, 0x7409225BEBEEB85A, 0x9C1D485D4A8B3A50,
+0xCD51568F67CE2C3F, 0xED89D4BADDF65B18, 0xEFE5D2B0B6C336D2, 0x003B2676C9E93AB1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1E0100EED689C3C3, 0x43F9ED46E1E4E9B1, 0x29A1E63DB1DEBF84, 0x3C8F422BFC0AAC18,
+0x57538617F81852A6, 0xCA16D056ED8ED05A, 0xA4C651F639543B6C, 0x001FF196A536339A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8DA0177AB3AC5609, 0x02FC2A69C2BDAB93, 0x9821AF901999A336, 0xBAE71847B000C1AB,
+0xE474263EC1CD2DB0, 0x13004CBDED13AC9D, 0x1723768CD072BE9D, 0x001FB496E18A172C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEF96CE9558675A39, 0xABF76671AF13E49D, 0xF2CD534F6BA6174B, 0x2D6C3C39DA399CC1,
+0x88E95305FDD46D2C, 0x9C10C0A08A572F04, 0x75C64012603E9906, 0x001672A0087B4041,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD99FCC134F65E726, 0x3E2F87EDA795A170, 0x7C5B444B6814FFBB, 0x73C0F09B668D28E0,
+0x903D54558C7B9AE4, 0x103D3851772227DF, 0x8BBA3714BCA13DF5, 0x001B43F6DACAAE46,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x36A0387E8413C583, 0x8D76D58B224D4496, 0x380F7653298A22E8, 0x88A279C01EE651F0,
+0x4AF59D64A364E966, 0x3387F182C834CB7F, 0x81D63D0F56B5A3A3, 0x002E00A16F33808E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2481649F754506FB, 0x97E471AD7ED219CF, 0xAA19750F3D18E9A9, 0xECEBFC572F2A8E58,
+0x188A2890071F4408, 0xE7A4D45B290D3B9C, 0x73561DB3CB5ADE2B, 0x001E781D2428A220,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA1878DD95D86DA24, 0xF285C5122B6C4F0B, 0xB5B7168A0FAD4B41, 0x89E2CB08BD53E211,
+0x79F53D1F51AC16F7, 0xCC9919F098DD4612, 0xFD198C2412C3E359, 0x00063689A9FF1E7D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAFF1320C7A738637, 0xD08F51A3E7EA8E07, 0xE5DD52189BE94FE3, 0xCF3314A5F8E157CD,
+0xC3CD2EED7EF9814F, 0x2B8ED1442F72EC04, 0xC479DD2FD5C006B3, 0x001279C012667A41,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0D9E28E19BC86215, 0x3748071B4E426F03, 0x9C8E4C44436BA202, 0x1B8F61128CB058A0,
+0x079EB298788AC5C0, 0x0795D63B7C3A56AA, 0x875475048958B9F3, 0x0005B86DE564ED23,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x56E7562A330ECFE3, 0x8B60E6FF8A3EAFC3, 0x04B093BE14B73166, 0x931C1B506AEFC909,
+0x4C0EFA7B7838B324, 0x593C3A495F4F582D, 0xF1A93A12B9EC7C81, 0x0035ADFC42D9234E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1078353CF38421AB, 0xA978861DF7FFCF28, 0x1524F4B9C70179A8, 0x1F5DAEBA282E3148,
+0x9E5FA05B3B988DFA, 0xA95E7A687E49D89A, 0x17000C86BC3BF211, 0x000B773966A2C0D3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x534319E087961C64, 0x5656C54C7E3D33DA, 0xB1E58CF193722D73, 0xCDFDB13CF05E5B84,
+0x6C41DD4C0148CA25, 0x94D92C7EE0DEB4C0, 0xA22402704237EAE8, 0x0002664AB0BDD95A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x264510E2E839F59D, 0xAE6093B709F1F9E7, 0x290451B3091878D4, 0xE1C2C6FA8C93DBC8,
+0x89DFB971054FE410, 0x387917774DEAD63D, 0x535ADA0B0F51B126, 0x000F2FF0C3E9031E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x90F84D8EB0C2A3EF, 0x0335C5A5486CB457, 0x565C20F2E98D77DD, 0x6A14B113E60AF7DE,
+0x2E6B24310BBD183E, 0xD08634A46128D0EC, 0x0DE24DBEA7C6CC44, 0x00297F978F305B73,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x88726D458EF352FF, 0x8A9FF7ABDF529D6A, 0x3B11A254C99EC670, 0xF4E5A6A36504C751,
+0x1234E62653CED2F1, 0xFAC75B5A0DD764B0, 0xACD13491C8AFE264, 0x00330A7C7B1095DB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF00C4F470373E711, 0xC67D3A96938ECFB6, 0xA7225F8F5087993D, 0xBC3273B5CF9DED34,
+0x4447DCE4B5DFAD57, 0x86A5EDD1B6EF7BF1, 0x574226248E2EBC74, 0x0011BDE58945D140,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x88219AC7A638F8A5, 0x36C594C219377691, 0x45AFE246B805A101, 0xA22437F2E14398EB,
+0xBE6475961DA9D255, 0x3031CDC87D51A3D9, 0x4B4856546D92036B, 0x000822DEBA62635D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE286823819BAC276, 0x2759C962924C36DF, 0xD65C6EDA2F4D5862, 0xD23A4CCFFC9B0BDD,
+0x24EFDE0BB9210D2C, 0xB2E07F9F880AF640, 0xABC97EB9909AF166, 0x003D3C66D193768B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD8AFC0EE42ECCDE2, 0x6D7BBE9EF122F4E8, 0x88ED0DD14F9D1AEE, 0x85F5836D5670B9ED,
+0xD59EBA13498746AE, 0x17085202751C7E69, 0xE06A3FE899459690, 0x0017BA92C0E387C0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x79F0B4B4449C9DA1, 0x27D0EC71A18226C7, 0x4B2734B295638CEE, 0xAC01E3DDA230D3FD,
+0x3A71C7CD9A5C5B89, 0x9A835006EE3006AF, 0x00BA0FCAC9D28D6A, 0x00256BA0AF77B661,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0C7CD443A6E6B33D, 0xBE1933430E6967DE, 0xA1E370D0D1C6373B, 0x2448F1EB79C5C492,
+0xF224B2953A8051FF, 0xA2E2CCBD5D8030FB, 0x257771C896CE79A3, 0x0020A8717E2C5D81,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x19551D83751E2B19, 0x85D9DCF7389D2C25, 0x6848A69AE9DC1405, 0x44BB637575E177B1,
+0x47294BF083250C6B, 0x050D45B10BA34A67, 0xAE9FF1CE33B16574, 0x0011598792DF9D34,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB3128A8022983FD5, 0x4DA8243E270A36E1, 0x70F7DBEBB901275F, 0xBCFE0548777736D0,
+0x40CDE0F67E722AC6, 0x07393D26A58DF1D6, 0xC96DA8730ACAF822, 0x0011FEFF0CBFE823,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x313B0098A7FC143D, 0x27DE97D14AA410D0, 0x8C9C363F450A3057, 0x8291F992D7FA07C9,
+0xDC4476779C1770B1, 0x20838A8C0FDAF642, 0xB9E7F33F56656CDA, 0x00012DF116C7C99D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF511BFA9E282D089, 0xC8232FDC845D13FB, 0xDB7E476E0F92EE1A, 0xAF7FC0A6911ABA70,
+0x1034417904E38F26, 0x868154D61C00FAF2, 0x83EC832B36623D23, 0x0022907A141DC4BD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3DD2B1BE08F162CE, 0x917F85F5F0E1DE63, 0xAD54D14254031604, 0x25A1490C1ACC54FA,
+0xFF5C01EDABDAED88, 0xB956F275E75C13FB, 0x58DF7A2A8E94A314, 0x0027F98AB539F57F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0423B728B9D9E8A9, 0x82C0C848ECA75D67, 0x41BE0C82CE9EC872, 0x6DAC8A3D03B6F3D1,
+0x34A59081544DDAA4, 0x8BC4E94260C07474, 0x7A5DBFEEAEE8796A, 0x00394BF9ACE0ED5C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x94A75A75BBE7F73A, 0xDA75BA6E23E5F433, 0xF828BAE75AF9616C, 0x211DD75CA4E89118,
+0x4ECCDDEE0A8B0A96, 0x5191ED3649CEEECA, 0x8E4F55F0F1D45730, 0x0035E03D15CF32AC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8425E7720221B37C, 0x30B9D738F5F077E3, 0xAABF0AEC5528476E, 0x5811B185BC271733,
+0xD26A0474FE0D18E4, 0xDEC49D19F3EFE2BB, 0x0083B6A70AD768B1, 0x003F13E78DFE8E11,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6F350B41B0E1FB1B, 0xEC5AF6CA1C8018BA, 0xDA19B9C99394CDA7, 0x40C1E865B0CA7E02,
+0xBFD2B62F442492DB, 0x14E3EF736F4DF8D7, 0x87E5E268A9357DA9, 0x000AF8990D889E2C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2B9FA38F87211969, 0x94E6A61157AA0B3F, 0xC81C29CE24BFFFCA, 0xBDED54406AB5D2F6,
+0x7BF980D5018F1856, 0xB4FA2DD17020DD15, 0xC771A9A1A3DAB773, 0x0025741DEA6AC336,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x988FA996A84856F7, 0xA0FB1D79FC34ECCE, 0x439A5E68F976E925, 0x47883FC15F3B3C96,
+0xF0198C9056445F7E, 0xB10D89854064AD41, 0x87FDB2670FDB5D33, 0x002AB8FF7A6BFAA5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDC62B3C45930F22E, 0xA345B17AA2F3A849, 0xC6DCE60D7EBDF424, 0x451622ED918D97D6,
+0x70B157B4F21D5029, 0x450C4CE7ABECE842, 0x6E99D5509350F969, 0x00020C70E7113B8F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x69E59024279BC1B6, 0xA535C16FC07CCD3F, 0x922C0F631639BB04, 0xEC4EECC5684D16B9,
+0x4DF87A34201FCECA, 0x57743ACD5B04E373, 0x1A4DD29BC8016781, 0x0029D6078E3FC5B7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1400B7EE02F89206, 0x2CBBBC9D534F5A14, 0x0DDFD61CCE19B7F5, 0x3729BDBDD7D90C1D,
+0xC50BCB28056F2836, 0x2D8075911210D5CD, 0x957F72D2B2A82F3B, 0x003C0822F60C7AF0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x46BD285F4F01733B, 0xBCEEE8DEDE44729F, 0xB266A608304C43A3, 0x95A0AE185A98080A,
+0x93BCAD5FD32EA097, 0xC54695E909002D3C, 0xCE4E64D7E75F5183, 0x003E39211F735ACB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA4903A876351B463, 0x6185CACE787C3AA4, 0x391CB180688EC9C2, 0xF8DA4D3FAC916CE4,
+0xB9439A1E509F6CB4, 0x4A963A3859B6CE99, 0xD1D4CF3D31F5D1A5, 0x0025FE33CEF79531,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xED2828254A8052BD, 0xE3D03F798C3C7D85, 0x2F980501BC14C42D, 0xCB1CC1504CD88F0B,
+0xCFE78BE4F1501EDD, 0x2B8ED3B2A26D46EF, 0x55DCC601E99C31E3, 0x002A139B23AC5BE6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEA5D0FD44E270463, 0xAF0FD99F9D4C3FFA, 0xEEECE581C71D909F, 0x9EAA0EC966667E03,
+0xADE03D70BAAF5B23, 0x5A4FB904D32C0F4B, 0xFBF439A3B1C90057, 0x000C5C05890326C0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF95865B79CCEF68E, 0xA53841D7D8636560, 0x08DF60FE3FE9D5BE, 0x1B3CFAE53A2450D6,
+0x663D7217835019A4, 0xE865A102EAC8F11E, 0x6D9AF2B27EE8E5EC, 0x0014961B996B0250,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA88DDB158285727D, 0x3B306BD1524FD81F, 0x2CFD164F06F3D5BF, 0xE1B1B397861C7ACB,
+0x91F2AD3760031A4D, 0x49A6E8BE887C4EB0, 0x829C56BF72356662, 0x0007F3FCAC311E58,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x950735EE4DF0368A, 0xAE77DCBF9C4F5BDF, 0xD8DB0F61AAE7967B, 0xC119107ED6FC25E2,
+0xF6705DEDFA6113F9, 0x690072648D05222E, 0x582A0A5F52146301, 0x002C891D033CB0BC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4C5B268E90FB49AB, 0x2D00538E3D23914E, 0xBED05266F5B5D748, 0xDDAF59B8782CCC41,
+0xF37EC23DC4CB5149, 0xDD1D10B7D4673A22, 0x2718EBA9DBF31207, 0x002B58D621959AFA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7B70674CA5F0F7EF, 0x3B3E9FA9C40B28D0, 0xC1A0C479D4CE362B, 0x622F8CACE2045627,
+0x0A842D7138838FE3, 0x83248EC34B6D5904, 0x981C3E14A61A8D7F, 0x0020EC3C73BE2B1F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xED1A70377820D3F8, 0xB4677E84D6AC8F49, 0xE6F1DC6EE5FBFD64, 0x109553685CC37CC8,
+0xFE2D47E4FDF1E975, 0x81B65149B3C72E8B, 0x0CCCBDF70E6911E9, 0x00162930CF3EB5CE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE0C0108B8388A75C, 0x2C42BBEC754056DD, 0x054BEE615E6C7FBC, 0x7CFC59EA32CBEAFB,
+0xEA98E63304AD2EC1, 0x202C0C629273ABC8, 0x48E597A7368F97A1, 0x0014EBA2226D3DE0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x69FF2187F902ED7A, 0x15B5694D301D3CF1, 0x724D7BF142B212A9, 0xDCDD53E6B21B649B,
+0x6FBAC81146FDC414, 0x67B9B25D11D3CD58, 0xE3D745235F4ACFC7, 0x000047043977342F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x240926855E054541, 0x7F7FEF162B4C827E, 0x5226E6FC739BD052, 0x193C870CCE7D0816,
+0x96FDBDF60154BE6A, 0xFC8114D93A67F704, 0xFC0C1C499A02CAA0, 0x0038B125984E15FC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1A2D28405657972D, 0xAC01FBED2571D0E6, 0x831AAE78204AC38D, 0xD0488089C0B42EBB,
+0x487E949A3DCE06DE, 0xC7E6282AE80E8914, 0x04D627199D60CC34, 0x0017CE1239CA02E1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6F669A179A9B835F, 0x6BB5B43431CCC687, 0x3378C207A1F931B0, 0x62E2C79DE8197EF7,
+0x0645903EAFADB73D, 0xA791DD4967FCF9E2, 0x1142D9C44445C4F7, 0x0001B298D88A8FFF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2ADCF7661FE08A71, 0x6B210A2CFF4C3073, 0xD444734596E24594, 0x5441D9FB29CE3406,
+0xC49CF32389A26471, 0x2982732123A2D619, 0x422BE6E317FBA1C3, 0x00146947B0946870,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD4806CC55BE5AA0C, 0xD10DECA34F7910BB, 0x5D24444EC920C625, 0x742C7D72511FA428,
+0x8FF349B325B6CAD1, 0x617063982590EA40, 0x53D83C48CC67E820, 0x0011AC2F57D977E5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD2E8AAE8E90B20E5, 0x64B74E0623BCCF3B, 0x8D88848FB5C684CE, 0xA31956BB42D6AB44,
+0x9AC250548BECD875, 0x6A008EBE3A7D98A4, 0x5800F88F34935FF2, 0x00301164386076F5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9B7794C9A3329E97, 0x8DA2896BC1F3ADB5, 0x043FCDEE1A1242D6, 0x7E7D4ED83F93DA8D,
+0x2309D2204F98056F, 0x03141E95EF82A0F4, 0xDB9ECC639F503F2F, 0x002139367CE770B3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDD8354A6768722D8, 0xBB860E2F0E2E6A0C, 0xCA8A1622ECD6D29A, 0xFF06DB3D72B275CD,
+0xE6E61ECC0DA5F1A2, 0xEB1BAFE98E40ED37, 0xB4E18A189345C16E, 0x0009ED14D380F132,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5519978390005841, 0xA8253A86FFF2E350, 0x9C38544011E80208, 0x58F6140453F6D4C2,
+0x43A9E4FA47715454, 0x167DA0B81AEEF993, 0xA1B1BF591B9BA1F7, 0x0001EBD3BB50964C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x96AF44ED4F2FB18F, 0xB833A179F965BEEB, 0xA9C6CC5F7DBA8C14, 0x35460F3DB21C7431,
+0x2F2AEAE7623D72F0, 0x7C848BA234B49C2D, 0x1C7A9054301E7969, 0x0016D95E3C7D4B54,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1F79CF2FE90F0DBF, 0x016C99901E3A06BE, 0x09AF066A9F143710, 0x50876F3F9B5099BD,
+0xF51CA200B818DF4A, 0xD38A5FFCC6D01A7D, 0xB6E99B80CDB16DA5, 0x0032572682C8CAD5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF8BE181BA7F1E8F7, 0xCCB667D74D5B0DFF, 0x7696E760790E13A6, 0x2A91A4F67074F8B0,
+0x275FC80BA35D93F3, 0x830DD68491523DD8, 0x7AF94D0760CDC844, 0x00265B8DB061CCAD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBFFAC8B7A5F9A91E, 0xDEB813D9D8A871B0, 0x9A3C63F95C2BD259, 0x7D73778D0739BBE8,
+0x6B70D0BE057D443C, 0xF4F706151BF0AD1A, 0x0E1693B658FA6D3E, 0x0036F56E6E857771,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8ADDA757A6F89C9E, 0xD6381ADD2C37F8C0, 0xA37F951137FE034E, 0x61565CFDFD93505F,
+0xF32418433DC2BD50, 0xD99AE05D2AC6991C, 0xB8D2674E3193CECF, 0x001A1832247A723B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEB26198CD6C0429E, 0x7F0893F175B71D5D, 0x34B181CF921320CE, 0xD6C64F5D890BFD3D,
+0x2CC00A3853655E4B, 0xBB82F9F916F082E6, 0x1E8D36CC88D2886C, 0x00018CAE48C9C92D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC048735E874886BA, 0xC0C96D143545C73F, 0xE549B9BD4CF416A2, 0xDFCEDCC8CFBC8418,
+0x91BBC00CF2653A5F, 0xF9FA437202EC293A, 0x61E552C030D895A3, 0x0033BC502C2B23A9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6FBDFB444E99FC83, 0xC66B41117A6FC7E7, 0x89BA8AF7FE89B5FD, 0x62E51D3AA9A96D31,
+0xA07FADA7FEB02EEC, 0xC609CBA1D2E86DAA, 0x89531E5623EE99FB, 0x002F643298FCACF2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4685E92E6F2E2E29, 0xA90FF5B347924C55, 0x5F91B4E562762877, 0x3D8A95FC5D9CA289,
+0x9DE9FA489CBAC767, 0x07098D0953C2428C, 0xF2CA759367515188, 0x001986C0988D8435,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x028E3DDDA44DB81D, 0x3589CC501E75E89C, 0x60942C0B8FA8A9EF, 0xF014C180FD2062C6,
+0x7AB4748CD71B2F31, 0x21E8B8594FE8AFB1, 0x2BD8FA38F6BD9CC6, 0x001530964A912A67,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0E1FF2D05D38E83E, 0x36E8F0DBBA90D30E, 0x069FFEB66E415890, 0xA93AF19F3B3EE822,
+0x9801A81E501ACC32, 0x0BB4DE655416D750, 0x35F528AC8103448C, 0x0013F44397603F99,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x01A6901FF2102275, 0xF8B5E3F5E5C86D34, 0x61482D659FE64E08, 0x0D198D474CDB497A,
+0x4DD6CA68E2119542, 0xE644A684F6608182, 0x005B9B386DA4B78D, 0x000FE5124A1B0E19,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x33DD4D6D895D2A14, 0x3E5C5711FFCAE6F2, 0x37AB5ADB7398F4A8, 0x5F18BB7A6A734F22,
+0xAD693CF67EDF0EE6, 0x44FDB88CDFFBEEDF, 0x73F4BAFE673E9FED, 0x001430302A179EED,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB1781614EE3DFB79, 0x25DECAD6B0B6A309, 0xF88DF2C0F6E6F282, 0x915AE13AE2FB0920,
+0x133829C55F7AE8D2, 0xF09C7C1443F69144, 0xF66530690BFEC917, 0x003874FB7FB2411A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x45A0CCE5FFFB345A, 0x05DCE1BFC5FB682F, 0x5E628E2193357366, 0x3B95BDFC7AF10A2C,
+0xABA188F8CCAB2E7F, 0x2AC100A3076FBCBE, 0xF9D3580B4DBE5850, 0x00209B03CD7E33DF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAF9EA8F0B5AD1CF2, 0x7358EF1185FC19C9, 0x9D40341A8DC3919B, 0x3F8E320BA6A618AC,
+0x6D30E6661F936854, 0xFC22A2FDEC3623FB, 0x62D5BDE95950BF06, 0x002E998209EFDDC3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA56FC3307D301DB4, 0x516E6132D30389A6, 0x61F4FDE11814BDEF, 0x5E604BD59109EF08,
+0x052EC64AF40962D6, 0xFDA58AD417F1E9DC, 0x37E261A59AFA8032, 0x0034BBB6E0FDEAD6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2B66C8D54490E10C, 0x7AA7F4362FAB58BD, 0x98CEDE4C3A551363, 0xCBB84DE883540BA2,
+0x9E09C88D561658F2, 0x91ED99402E288479, 0x3C2B0560D6D6A938, 0x0014E25C581F7A04,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC44F2C7AC9C20D04, 0xD37CD80AF4FE21E8, 0x3A30FE09CAB133F4, 0x0319320291E7AD65,
+0xEBC6F8450EBD5799, 0x9C68A9211B8A9113, 0x4BB9E2FA3D9FC391, 0x00269D36C185087E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4D05965B10AA1A70, 0x88D70875860FB263, 0x44FAA5FA98B268ED, 0x57A11E22CCAEDBC0,
+0x15EF0913F27DB2AC, 0x272E023039E1C784, 0x9360D19DF56EB57B, 0x002BE72C94B780E9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF14535C706D4885D, 0x07349555FF2A1BB4, 0xF00280BAF94367F7, 0xDC01B2549F396785,
+0xCE9B3EAAC908D369, 0x5C1228B0B7C4AC6B, 0x3BA387DFFE5C8FB5, 0x0012FF7E7983A497,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x809BEED387C59A10, 0x5B87211ED776BF3F, 0xF0176282A26DF489, 0xA9680710AE673D51,
+0x89665767E15DD851, 0xF2E2A79903BEA86F, 0x809039202986E539, 0x000EB024D7AAD179,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x63520D4CE937A509, 0x2CBB579542DA5E7F, 0x86EC9802720A6A5C, 0xB8F8A727F4314213,
+0xFD73ED579A0D3C08, 0xD2D2CD08B884CA9C, 0xBB542A2C3F1B15C6, 0x00085DF47548894E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6BA2ADF990A71E1C, 0xE2A1A2EF4003DA49, 0x57D2C64D7107EC44, 0x7E249EFE8FFA448A,
+0x375E6936C0ED7E46, 0x683E3334CDD8B3E3, 0x356CD6F62D4BE4FC, 0x0025A060155C53CD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x73D83A9F7155E325, 0x80AC997B4C77F360, 0xDAC2A7EE11DCAD60, 0x97673E41035F420E,
+0x408CFFE998CFD94A, 0x7D5050B8FCCE5A05, 0xB6D8A7DC85DFAD6C, 0x003FAC4B883E9077,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE8E4066B2A517E2B, 0xB8864429D4F0BC87, 0xB717956CB55F7D9E, 0x599A01FE289F9F7A,
+0x1BC4AF7B9174C4BF, 0xBCF83813097CCF3A, 0xD2C78692A033BE8C, 0x00000647568A504B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4497A8049AC5E46C, 0x8F6A705B5A3E38F3, 0xD9199AB2043CD8E2, 0x6894BB97A8BC10E2,
+0x1778362DE73C7D08, 0x7DB19C7432B484D7, 0x9EAB1D91DFA0B7CC, 0x00028ABBB4F9612D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9227BC08543DB8E9, 0x1977AC8D995C7B7A, 0x87CF60AEE878DC41, 0x90E1C26E176ABE9C,
+0xA87596DD28AE8EB1, 0xB276C9E68A5E4B56, 0xAC2E8C7608059C33, 0x003D9E014E27F824,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD60001B835D87B71, 0xB60D85472D9B0685, 0xBF048A370A79B030, 0x4B2319E0345DC02A,
+0x0B0611A670481AD9, 0x99DF7B12DF51113A, 0x336EBF8555DF69DC, 0x003515E39BD3CB1D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x68E98C8F45C72DFD, 0xFD6D79519D3333D1, 0x8286EC5F328BA109, 0x2CB53E4AE0FE676E,
+0x50E25CEEB0BFF0C5, 0xF1B35218DD929F63, 0x9124C86EF560EE21, 0x000B1E3EA0D13F3A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x543623D83E84C5B8, 0xEFB5D6F067DBEE17, 0x394ECCB3030BD90D, 0xB80315680F3577AF,
+0xD2F6AA81CB2BC855, 0x90C67212F74BE3BA, 0xDAE12AAF2F0B1B5C, 0x001559B3B6CA4AD2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB9C256AA695C9C7B, 0x3DDF9650AA14FBE8, 0x4248162C97703EC7, 0x1EC9AF2711E8FFCE,
+0x129AC04C4D3EE59D, 0x76B756CBAD7A1A7D, 0x6A4DCB8EB7E67E63, 0x00008725350FE37C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x37FCE04C6D19B807, 0xB86A2211C91A07BE, 0x09F599F5E382776E, 0xD31B30F45B033647,
+0x04C0CC2C5560EE8D, 0x3CE43052B848B530, 0x6824917A28EE0EFA, 0x0038CDBF000EBB09,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x81A2B035F796F4F3, 0x2088F0CE012D4B27, 0xB6825EFE4BAB0E99, 0x168899140BDDC2FD,
+0xBFFDD612E453412B, 0x5C533EF63B90B74B, 0xB072F6D6AE2F4DB4, 0x00222CB03F17FAE5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF330F84D269D7C79, 0x7BE19AAC189FFEF1, 0x78706A5111D75BF6, 0x64B67CD7BB3F7E3B,
+0x641E8607E66228E2, 0xF164524C8F010EE9, 0xD356FA8C7FB77490, 0x00188B02814A1241,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9C9F3F7F8C5A00FB, 0xCAD78B4E365903F3, 0xDC57DF0665B8EAFA, 0xB407FAFBB06CFD3C,
+0x7A3AED379E123807, 0x2B39E9253EDA17A5, 0xA48E778C10DCFDAC, 0x001015C63E045794,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9E14BE0ECDEED836, 0x96DB752A3CC904CC, 0xD77E6875BB12A25E, 0x83EBC807D6CBAD1E,
+0x23A8953B7AD7AD58, 0x461442B2F81BDCEC, 0x7DE5F26467A5DAE6, 0x0035825DAB6A1231,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDF8BD7C95EE5C0D1, 0xC01BB011598F9469, 0x7903534075F1C860, 0x5963FBB45D4E1BE6,
+0x5A5C1ACB707559E5, 0x03E3C5E5A855DD9A, 0xFCBE631435225847, 0x00219BF832DB6CC9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x568EC71ED01923BE, 0x20F7FE27565CE342, 0x594CB1DCBFE84736, 0xE41566220767E8A1,
+0x395BDCBC2B999E46, 0xB81E56DF1BD12B63, 0xF611F34B0AE6E8A8, 0x0018B0CE92E3A8B8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x54767D8DF193759E, 0xC01CC4C15555EF55, 0x70DF637C9513EAC5, 0xFF50C332827DE04B,
+0xED669AC2CF214248, 0x399FAE56D9EC2878, 0x3222E47829AE30C5, 0x000798023D270081,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x535325B61DD7ABCC, 0x804AC7F824861753, 0xC11D0C995C1C6F7C, 0x04C63B4D869EA675,
+0x0EC1CDD167597B7A, 0x7A62C2D0224E114F, 0x9EAF2D0E6C661173, 0x003AD05E083FB277,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x64778918348C07FF, 0x45605412FA49102B, 0xC954F1B1A623FDE7, 0x078C616CDB5B76B0,
+0x2B285E60D7A15467, 0x20EF661463A69F72, 0x604BF8D599AA4921, 0x002CE9F989626AE7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1D69ED7416D845A6, 0x62CE4CC58E9B0562, 0x4CED04B8FA49FAAB, 0x9F7E200E84389123,
+0x4215FA653872E320, 0x82A7C003BE538EAE, 0x8531770F77FC22BD, 0x001C3FC4A8CB4288,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEF216B57CAF7E08F, 0x08D9A8F13AB4809F, 0x39A26D1C7A9DFAF8, 0xD000389C8E8DBABF,
+0x1477CEF844E7E9DA, 0x114AA2759BEA313A, 0x942FBEF398BE95A5, 0x001E896C369D934B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x527C64A901E254AB, 0x90FC7F75B933164B, 0xFAF93F939900AFBE, 0xEDA713B8F11864FF,
+0x2F303F090696256B, 0xD4B1F6A0017AB0F8, 0x4F4E5684EF301105, 0x0037D3C1488349D1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x091ACB9C671AB731, 0x88FE9E9CEAD2612B, 0xD91A4DF94E36CAF1, 0xBC20032AC6336ECA,
+0x3BD1685F4ACCCEE3, 0x7C963B1AB0FC29FE, 0xDF0E104E4889E8EC, 0x001843065CB35B4A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE938C31391223D01, 0xAEFF76B57D5C1C40, 0x7CCB88AD6F09D186, 0xFAE940576B138AF4,
+0x139B483E89FB88D9, 0x3A8ABE6C65E3076E, 0x585EF681DCD1A068, 0x0004C0130D675967,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x925912B8EFC9CB28, 0xF544DC7F4B1BA484, 0x9153CE3B3A662523, 0xD45CE33D47E36BF7,
+0xCDD87C07FC0017CF, 0x8E24BCC505C0D35C, 0xBCA3E3EE5AC8E3C9, 0x0026DFE662976A59,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAB6C874965C8C848, 0x6F8BFC88F3B08D59, 0xF49740255CBB5EBF, 0x09D132B179EF9ADB,
+0xC48DB6FA463ED327, 0x78B981EF091B7137, 0xE8A21F0DA381E954, 0x0006B17A2FB80C8A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC8A9081D6CB85111, 0x3C99A2CB48B3730E, 0xA6A0AA5D9A012171, 0x143DC1E36A2DB690,
+0x91638A84052E7CCC, 0xD5FF23F7F1B7B510, 0x21286BA5FFA7516D, 0x00077A495418AFE8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x06F80A4BA1C50BEE, 0xCCC66CD69939D8C9, 0xF9940022ED4A23EE, 0x299BAD83EE4FF727,
+0x21949F03B7B93965, 0x5B871BC8DF3D23F2, 0x43122670B7122738, 0x0003CCAC1E32B9BC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA826EC5BC676A9DF, 0x4BA28952AD7516E5, 0x6A5427F6A38E00CF, 0xEC0FEAB0BCCE3E3B,
+0x59D7D13F95791B7D, 0x1B78AA283FDD4913, 0x54E0B19BB8C37CE3, 0x003E087F976E522A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x63EC7D437E200912, 0x53208DE521666D60, 0xC997DA7A372C92C1, 0xE1E927765936CB28,
+0xD720F07749C39C71, 0xA46C53FF54D1025A, 0xD78896CF1B10D9A3, 0x001848867069D2FD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x489ED6A4B557CFDF, 0x08A6DB2B651950C0, 0x524A68843A6054EA, 0x827D0F0BB7B6B384,
+0x1513D7844278FD22, 0x7771D568A50F3A70, 0xDE24B86EF3AFA227, 0x00149770C27A208E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF657CAE9EA862A97, 0x6F39AB8D3C5AC3F9, 0x442691FB392F976B, 0xCD25FF4ABCCA90C7,
+0xA6E692C888B694C1, 0xC755C9C2696C2BEE, 0xAA7CA1F199ADBDA1, 0x00268495D3085375,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x27D8E311F5CAFD3A, 0x6727C75FA36B3742, 0x11E7B8DD06C058AD, 0xC5AC7059A987731F,
+0x80C50113679F46D5, 0x31D8B413A36F5EF3, 0x113B75BD74275C4C, 0x0025C4D0F17E0BFC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2C5317436AA3A65C, 0xC7E1E7ADB96D8AD1, 0xA5B7341BE4DD48CF, 0xCB2A031873808B9F,
+0x2B35E071E29DF163, 0xBFECC11B8A9AA4A9, 0xE599819AF7621A88, 0x0013621BED18114F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE2C322BEEFB4BCE7, 0xE922F2DDEF87B6D2, 0x1CFF76C98CBD30BB, 0x62B588582099A005,
+0x8C3F6DF30BD1EC2F, 0x44F21CB3D2F7A8AC, 0x87102F80E6D171B3, 0x002EB318AD59A43F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x507D8458AD4A9D19, 0x775BA4EB9F27D402, 0x3CA8E9A0CA60FBB2, 0xB3AA02C16B81B780,
+0x18E82220C047C236, 0x4490E2A47563C464, 0xE0B548ECBF5FF75F, 0x0035CD6C0E7EC313,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2AE5D4F5B1C9B206, 0x1C63A11F51220F5F, 0xC2C4164B618ABB6F, 0x2BF13309031D4FCE,
+0x04D5910863D1982A, 0x90262C122424E668, 0x2C4CF5FB6E9C51AC, 0x0030607CFD660B54,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7B38132C51CAE92F, 0x4A7FB08616ABA90B, 0x62F9C8F945A6F494, 0xF5C5763FBD09F26D,
+0x6C097C237BA10163, 0xA92ED9FF767CA653, 0x9008F3CDDA7D3ACC, 0x003E7CC27FADF1C0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6A16EB484DDC1871, 0xFD015449F09681DE, 0xA40667F04E8ED2AE, 0x7198832FC9C026A1,
+0x704DB5F09AAB8BB2, 0xD0E897E2D3BD6AE4, 0x141DF1C622039EBC, 0x00013227E47E3089,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x77D1B40E29F64F36, 0x0A7A1D760F8884D7, 0x207DE24163B2A966, 0x742555532E13188B,
+0x872883085ED12EDB, 0x47EB2102F5E5C1BA, 0xCFF5F881E6BC9F05, 0x003251B0B0C3C9DB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2315FE084482D7FD, 0x5480CD17F6B93266, 0x81633221858BDD7D, 0x95E982F68F509C1B,
+0xC6091C6E511476A4, 0x983E6BD524F0B240, 0x77380D7C9DFA0736, 0x00402BD749A32B42,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB356B4D9498DFDBB, 0x67E1474FF6526FE5, 0xC17E416E7EF2649E, 0x397A71679C12F12C,
+0xF4A916D6E481C39E, 0x62AC483A9D1BC29B, 0x0D1E56ADBDE6B12D, 0x0023945FA665E78E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2BBD625D24C609E3, 0x0ED0620932A2A0BC, 0x7ECB7D96B39B9986, 0x72D8D0F28FBA3AF7,
+0x0D5EECFD96556FFE, 0xB6844C3ED85AF26A, 0x8E383BDE0D8D26ED, 0x0027FFB40677AAC8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x970F04B16939713F, 0xD717C689C2E9ADDB, 0x02862D2E0D3B5704, 0xCC5E7EE29042647B,
+0xD83FC3E05E3BFA40, 0x41A711C6E0E5D3FC, 0xA209EC85E330132F, 0x003D01CBCF7D2C09,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x989B1E4AF1FC3A8B, 0xABF141DB43971C73, 0xD44C430C9CFF3E8F, 0x80ABC6B64EC923BE,
+0xE839E8D4AC741494, 0xCA79CA8A372BD8C4, 0x4045DADF7E118508, 0x00223F988A429844,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEA1C291FFEE4FB93, 0x97FDACB79FA9D3A3, 0x3156E529035C3DEA, 0x27E7558082337037,
+0x14162ABA3AC9B633, 0x10A5CE58D60D368B, 0xA83D3554CDD6722E, 0x0028A8D36B577833,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0A00650C47568432, 0x3C43ECD6B5DC8179, 0xF78BB79D760B0BD1, 0x4771A4C3EDC44016,
+0xE8881F618A31FF35, 0x4E2623B326640CF3, 0x53349989C28617BB, 0x0036281CCB4697E3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x278C221682E9498F, 0x0F120271DD13C10B, 0x3E0E6F6EFFED7770, 0x66C1E6526636B35F,
+0xBC51CADDC7A68109, 0x4446E9A4DAA25E6E, 0x93719BFF77C4FE3E, 0x002DEE3449326C75,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD39AAE69091A538B, 0xD9966330DA15A7F0, 0x060BDD2197E5962E, 0x273E44DB925F3021,
+0x4C7764008D09C0BD, 0x0A8D54F5A2EC728C, 0x2F45752BE856D9D6, 0x002809806837CB5A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD6AEBA44270FE0A2, 0x11B34EC32ACBB454, 0x80D48ACC4C80A607, 0x19727E7728C57843,
+0x9FC37A47CE2D5238, 0xEB9D5DE26D77A103, 0x2F06880452EF8967, 0x00112EEA2F1CC6A6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x28BBDA3B81BD6153, 0x433859058EAA534C, 0x00D770AD2955A1A1, 0xDC2A6B83AC1A8E78,
+0xA4CF547A189704F8, 0x16C2AF7CEC675E69, 0xC2A915744EB44842, 0x0036B51D9255BA42,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD8991FD938C92729, 0xD39C5CD20DA49B4B, 0xE019155D0FA51576, 0x8DB0DE05546A8899,
+0x38D1819CD366E357, 0x6D62A926DCEC2F24, 0x3745A16B066D530E, 0x003FA91DB36FE504,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2AFBF090AB0E8138, 0xE69FC43A09F860F3, 0xC569DD6C4C187864, 0x7C4B00299DB37C40,
+0x26D752D68FDCB5A5, 0x55E0D49E743503AC, 0xF9F3CAD0B961B00E, 0x00090462FB87435D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0B48AF92423D10AB, 0xA6636725E2D2D112, 0xCFCB3AD4203FB56D, 0xD7F3F28CA293AD1E,
+0xE7B0242F8DE39525, 0xDCB5738380BABFA4, 0xC6B3671BD0057796, 0x0023B0C088516A89,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9DC3283CF418400A, 0xD0F623EFECDCA4CD, 0xA4F2BCD58FA2D8EC, 0xD9EA298E9EC3C694,
+0xD6679026DE3CB0A4, 0xB731D813976F302D, 0x010F484705010B92, 0x0013CFE774ACB0BE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEEC08FB722D42630, 0x2119F06A95351EFE, 0x4DA052B9C99150A0, 0xA43A4666EC405E87,
+0x02E43E8F4A9D1D74, 0x8D9E277C5F5E3F0E, 0x420A36F8BA1447AB, 0x0038EFE7A4F3E12A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2522809D645533E1, 0x36DDD8410FB3BD7F, 0xE5A9C43305CF5C15, 0x1A4603F01EC62E5D,
+0x72ADFADDBDF90686, 0xB52D88BB4071F3A2, 0x46D0C2D4CCE84CE3, 0x0006D25A93102FE9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC189EB84929AA8B9, 0x0DB10FD8BD2D3B31, 0xF45402A91DA10EDE, 0x053050E782AD38BB,
+0x3D0251FCACCA85F9, 0x40427C2DFB9ADAA7, 0xBA92871B2F0FB24A, 0x002FFD3AD9BEA166,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDAEE9777512F66D9, 0x2BFF4D684A7C09ED, 0xCE5F1A93A2E1B8A7, 0xC9BA6DA20ED3E772,
+0x946EB09773369518, 0xD67E8030659DC436, 0xE96C4511FF04C407, 0x003A3A7530283E89,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9F87AE1A69D71609, 0xE4B9515BA757204C, 0x7C9EB68A2FB39BD6, 0xFF367A61C1274607,
+0x422BAB3237425B93, 0x55D3064228E599B2, 0x2C92A6746C327F57, 0x003D9906608BB4AE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x31A810F6D7DE11D8, 0x165487E4C2511C83, 0x16735B1D0368C52A, 0x2A7010842579C09E,
+0xD23EC1AB94DDF750, 0xD5EA2641B31583B0, 0x94D3F6204F5AF63E, 0x000ECE16FD1EA049,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE04E3EE89DF9C51D, 0x2D5F391E3AE0C010, 0x9B35CE7620268597, 0x6A68BF744EE7181F,
+0xB604ED10EA938BF1, 0x963AF33CB649605E, 0xB8C9DBDBF0589927, 0x00021F1C493AFD93,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5310D0C9E6E71FDC, 0x3379E34C8255ADE9, 0xCD6DB0803F4EA612, 0xAE6F0239CB3283D8,
+0x430B3FFBBB446004, 0xD65FB1786765ACC3, 0x509B2A28375021C6, 0x001CB44DCB30EA06,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0B4DF80EB1CB0990, 0x85DB43DBDE8FF6CC, 0x399EC33DCFB22C0B, 0xE1A53A64A8BE9663,
+0x4F250E992C858702, 0x0E2C66631E2FDBFA, 0x9ABFEBC055F4665E, 0x00000B042BC3AEE2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF22B8104366C3312, 0xBC9A4EC1DB3718FA, 0xA96B127EE280331C, 0x23E8D449D8915F13,
+0x1E17DFF4A3482E3B, 0x70B0B9E1025FA969, 0xE178C5D8B4C09E6B, 0x0012C7EDCC2FA4B6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5973911E4F0A6C08, 0x1405D5F6AB9232D6, 0x3BA323A33F6AE9C8, 0xD61AA708A677D68E,
+0xE5CCDC85A60E6387, 0xBA8B43CD2975F39C, 0x1EFD7FBCE02C89F3, 0x002EBE17B82FEA85,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3AEA64B8061F8633, 0xFEFD059B76566DD4, 0xA2FBF3BBB343CD72, 0x76A06DA51D9A145B,
+0xB02B0844004F0983, 0x85CFEFBAC7141B1B, 0xF4C8861D894A1BED, 0x000BFC7BECE2006E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC49A8604C9EB46ED, 0xC57C68411C37EE7C, 0x01972AACDCF6BFA5, 0x3F2799CA78D3C64F,
+0x1A739F415408C10B, 0xA3DCBE605F00F9E1, 0xD5774F51D47B5376, 0x002AD6984A9523A2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCC8E965A42A4361D, 0x4305317D40B2D996, 0xB406CC6F3C2A5734, 0x4A3AD76A3A0106DE,
+0x1214ED566401CC80, 0x0F1757F9AC49ADC6, 0xD116CB3E3E9F9DDC, 0x002351094948B0B7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD0FFD8FB1E8656A8, 0xED38DFB6A2EE4C7A, 0x1BCC88130417E7EE, 0xEEEFCABF636C98B0,
+0x70229E56E48BE0F6, 0x53546E70AF611619, 0x4636AEFDEDD310BC, 0x0019AEE4226043E6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5EE54C1CE7E4DEC8, 0x518893D19CA59310, 0x7C92872DCB2452D9, 0x90248197608C4E44,
+0x4D5A7F09B5CDED63, 0x8935E9B4E6EFF098, 0xE7466BED4B7DB26A, 0x0017CDFE43F780A7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4C5E33C0A541B78E, 0x6CDA0AF2A323A3AE, 0xCC4FC1358A3440FC, 0x275258976DBDEB02,
+0x056166B42AB8AAC0, 0xBFEA675CB4AEF869, 0x32E9882C35E9F1D8, 0x0004005F869AD51B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x08FAC0E3559E1042, 0x6EEF759BA02E98BF, 0xEA7CBA27E06CEA5B, 0xBBA297B066B2E61F,
+0xC86A964473AB1529, 0xD32A9F9D51884103, 0xF6010EAD4FAB2BFD, 0x001AA155D27AC834,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7B4425E0E165A9FB, 0x3E23159511DFC7AC, 0x9AE3A16DC1932F4D, 0x54A6E5C24B582DEA,
+0x3E29C0B0295D5FFE, 0xB84384D9324EA63D, 0xD9D5F817DAE45BA4, 0x0015F01B2009EA51,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD0D9067E92AA9EE8, 0x5A2AD78CE79F4CE4, 0xA91419C80465E323, 0x49AF1023E41B7975,
+0x388D7367770B12EF, 0x72F16ACD257A4FC5, 0xFFE2F3046D7B1224, 0x003632C659A70916,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF55C42816868ACCB, 0x70947EBD506A3A80, 0xC1BFE31E437A6313, 0x797FD845DB1D5F2B,
+0x4B87CDD0C953E6CC, 0x0E4A5FD80C14FB9F, 0xF90F91CC3D5B568D, 0x00295AFA300DD760,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA5E47425C4386DB8, 0x367AE5A5B4ACEAFF, 0xDC9BE6CFE56DC639, 0x465564700ADC88CE,
+0x856BD298E8BA1858, 0x561E61472073C041, 0x15163DB76815F278, 0x000ABDDED0241902,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA1B9B4EE408DCE62, 0x55106A3B8451038F, 0x6950CCF46BEB659B, 0x9AEABDE59AB81A56,
+0xB5077AE4574B7A2D, 0x208766165BED76B3, 0xEB0C52DD3550C747, 0x002E33B61C636EF6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC5528511CF103BD5, 0x7C3746CE7D544EAE, 0x70B146FCCE54AA71, 0x654614815BC52566,
+0x98E962CE6624CB38, 0xF2552886610A4217, 0x84A786B8B14C5C53, 0x00162A49A0C39247,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x32BBF391284D0B94, 0x11CB90413E07F3EA, 0xC21B66E54E952078, 0x1484AF3081B48712,
+0xFE6FBD286E8FEEB3, 0xF6FDF4BE492CF6DD, 0xE0390BCAA9DF1F8A, 0x000EAD181DEE610A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE17FEF9C82A1ABFA, 0xD8DFF1004CCFF8D2, 0xAF277BC20656B9B3, 0x8932C862A1362014,
+0x458714EF687C3719, 0xBE9D59DD2CA059A3, 0x0569930895D564AF, 0x0025092450575732,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD731064418149A11, 0x06A3FEF11E3F31E3, 0x98264948E8E9A3C2, 0xC264864827F6F6A3,
+0x6E5A8294941B85BE, 0x36D3C07832F89F2F, 0x417CDE8AB934B218, 0x000F7ABDB871B2D0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEFD20A46822BAA60, 0x3C43B1693B9F7750, 0x0E83CA0444D69C62, 0x38E7D7C0E3E1F2F4,
+0xA9B14893F15783B5, 0x047E9425362D62C0, 0x3598BA6AEFD55D73, 0x0004F7EC6F79E90F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB04B082EAE095BEA, 0x8E5FB9B3BD80EAA9, 0x926852EBD9C787E6, 0x01D4C7C33F91D7A2,
+0x8DE14954DD5CDBA8, 0x4B1860126CDE4AB1, 0xEFE6BD9896543C62, 0x0012AF32F7F9D56A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1846FE81B2BEE25B, 0xD1B8A3CACFF2EBEE, 0x27A6C160D1228C3E, 0x0D59AB05EFED9D05,
+0x59148FEA0DBB666A, 0x51B8B305A393BEF9, 0x0A72F6125B7F352D, 0x003AED3C6092D218,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD2FA60C227C17F47, 0xBD2B95D031EFB1AE, 0xAF707835D5C08C4A, 0x84FE23154C730B82,
+0x13DC474AB2DB82F7, 0xDC231AD5DFBDAADC, 0xCB76B6187AE4E22B, 0x0006C1F02A67B9DA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1920D9143382C689, 0xA6258F8FB0484E90, 0xC86AF2D906DF64F1, 0x1CEE7752BEAC8913,
+0x256D70ECE24FA6E9, 0x64EB9416554A2E3C, 0x8E04AD321D24FCB2, 0x0022FD6B4D75FAAC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA43B30402E168637, 0x41EFDAE13D1BA659, 0x27623B1C51FFB8C8, 0x96297763E56AC927,
+0xE75EDC735FC2A8D6, 0x454D4ACF17638649, 0x1F0346D0FEEBC22F, 0x00394ECD0E46FAA9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7783DCFC5E41AAFC, 0x9E4637AA609C6C78, 0x29F1818BA2677720, 0x06193BC24A42E8F7,
+0x05075C303DF41EAF, 0xC6F63F1AA735F3C6, 0xDDCA234FA98392EE, 0x000B76F010CF61D2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB7906280D9067505, 0xEEEFFF867BFC23AF, 0x8D504191A6D92DBB, 0xE0D014F0FA8429E0,
+0xBFA7A8C7D07C64E5, 0x0784CC206573B288, 0x06386DA76F392B98, 0x002984E0FBD21469,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7DEFB50D32A2B535, 0x57204E151AFB28C5, 0x39F9B857FFCE828A, 0x7D997C9E58AB9AD8,
+0xC1BA570D7833E0B3, 0xDE9EB4F0301804FF, 0x27BD5FB68536BAE4, 0x0005517A90A9A7B5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC5D1154C500926F5, 0xFC744D2F2F2BB1D3, 0xFB63F0C4FAA28511, 0x3828D90CD5F739F2,
+0x73BB6A5B57F3D8DE, 0x014DCEFD057D8A2A, 0xB572520542881DEE, 0x000182F234F6DF91,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5218957BA2BF16BB, 0xAB426E55AB30AF73, 0xE468A22E533FB22B, 0xA40333411D060EDF,
+0x0DB72C956BCB1A05, 0x8553CD8D70F85DA2, 0x03ADA1B918FCA638, 0x003D437C85365C43,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD568B869534468DF, 0xC6A219F0CC420EBE, 0xE226E5541F415CE4, 0x18D8AB3D575B16A1,
+0x5AE26C919BD05E5F, 0xFC2DA8A62C713920, 0xF983634638D438EE, 0x0019D286A9F32EA6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDC22B10DBC0DE46D, 0x54E86E768CDD4D96, 0x4C7396EB07ADA2D5, 0x6A9A86944EF2C544,
+0x4F66FDBC1F613E77, 0xBF5BAF33C8D9F62E, 0x1D5C68503CA50049, 0x0008C6BD2441A5D9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF0982D8883D7AF19, 0x8DBDD2B14DFE51C8, 0x9E65888C378F68FD, 0xCAFD0621785B46DE,
+0x85553781BFB31F9F, 0x34571A46DB77815F, 0xEA92A9ECDCD64156, 0x001816D454612F96,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x19DFF2C4FA57D571, 0x4F9F498DB7A8D03B, 0x80DEC86414E2F5F2, 0x23254B4808869C58,
+0x3532C75443366BAC, 0xB8041422B7B6C9EC, 0x5A7C12CD2EFD7EB2, 0x0006FB1FE26323DF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x239EB158A34DA545, 0x3D2EDEA4F3C739B6, 0x4EF86C1D926A7802, 0xD847A0F20022BCCB,
+0xC61800BAB079CFBA, 0xA1BEB6E6B14194BE, 0x7E0B7C53E1A64F20, 0x001CFAC17B6DB981,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE184E5E009FF474D, 0xA2FA69300A46765E, 0x7FB75C449BC0402E, 0x693BAE299AC46632,
+0x4CD584B6CE4B1DE4, 0x701F872A7C345DA8, 0x372CE881EFD4AA41, 0x0018DD27D4397ADF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3E8F4A894E8A8E19, 0xC7EAB3F76ABC8A18, 0xCD16A56C2BCDC18E, 0x8551AC47C1D488AE,
+0x4076FB53E2463D8B, 0x0A5D3A7391044A96, 0x4ECDFCD518D81835, 0x003820F2B62223A7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x886996AB9A112367, 0x2C78D0E1456DB01E, 0x167E7B3EE37C76B4, 0xA56F50BBC25B1239,
+0x98F91531AC63AD4B, 0x541FF2B4271B8107, 0xE2E77F35B67AEAFA, 0x003961609C6F51E5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x77E0F48001D65F96, 0x67DAB41753E4D84F, 0x726C55593A8A6AAA, 0x1EFB4DD3AEDB578B,
+0x83DAA392D5463BC9, 0x647EDE3EFDF9CB9A, 0xFDCE0A191C628639, 0x00270A60AB6DD6B8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xED0F71A0073694ED, 0x668FFEC134480DBA, 0x753D6D782A88BA78, 0x28ED84D608D5A932,
+0x891D6A42E98C5DBC, 0xCD6A55E109AAEE08, 0x44E2D2EA901ACD11, 0x0033808BB7F13D71,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x37947EDC31EF106D, 0x6740C7FE33CD6841, 0x51B8EEB572BEFC1C, 0x22C267CC958130E7,
+0xE5583A9CD8E97D57, 0xD15F3C7D2C68866C, 0x855BC557A08F4D83, 0x0006CD32B489801E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5C2FE6D6673957CE, 0xB2E02AFA647DD648, 0xBBF4D48038CF7162, 0x949AEAF7A07260F5,
+0x90E1986420417790, 0xAAEF981EE5E43BF8, 0x9AAED6C2FA8C21E4, 0x0001D2B7F319A632,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3B5256C6AC8ED0C5, 0x991C72E5A6C774D8, 0xAA26CBB18064EFFB, 0xAA649BB5BC2C343F,
+0xFE81AFD3598DD666, 0x822DC3475FC2CFEC, 0x77E6E59E7EA0386A, 0x0028C7B5974F3856,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1292011A4F9C16E5, 0xA01C14E0B4A3F35C, 0x5A78799C25406073, 0x26E1955125177B8E,
+0xFFAEFBA0F12F00AC, 0x883E492A743A556A, 0x80027BDA90A03478, 0x002868DB9C47D5CB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x87B4D7A53460890B, 0xAE760E523D10C41F, 0xBE85B02F41FCC1E5, 0x1F8A8032A88D91C8,
+0x6FDD41CD77DBF4CB, 0xBEDAD98C82334726, 0xE9507B0524EA5303, 0x003209F784DF33EA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEC015B20598D3156, 0x219FB828424697A8, 0xF64982521E7353BA, 0xE57F4726D124E30A,
+0xBD8D5A5047C46CDA, 0x44DDFC2471EEF170, 0xD111A2AEC119BEB8, 0x001080F943F222E7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x56B7E5F1CADF2B20, 0x47B6351D7109C43D, 0xDD5666E5339FC4F0, 0x1E8946080066E593,
+0x820B7040B499389E, 0xE2F64AF2137C54EF, 0xB220C3EA3C272D7E, 0x00217AB8767C4DCE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD5693E97D8B53295, 0xE4365A9243F7C564, 0xF4FC3F444CC54747, 0x1F2BF03B2AA1BFC2,
+0x7EF4DB9AB66FC470, 0x310489C82EFC2B9B, 0x20F3A2C6C341133E, 0x000BCAB6E72B24FD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAABA9D1340B0522F, 0xFA67356ACC404A0D, 0x5C87FC45FE5BC1F1, 0x064F06241A283FD7,
+0xA3E626104694F8EF, 0xC7ECBE886EC190BD, 0xC0CDD08CAC7AAA2A, 0x0030A26B08EE10A4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAE98986FBA002B1F, 0x99AC6AC39159C882, 0xBF9ECFC393993307, 0xA9762C6F29AC779D,
+0x83ECB3BF31996C03, 0xDE8C89E81017AD6A, 0xC90FB3E76846F138, 0x0006542FF215351B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0A1076A18D981536, 0x8F06FCF5D6DE4C70, 0xCEC9733838097057, 0x40FB065EA1CD9094,
+0xF1909DA650C00C81, 0x18C0364C7B2F93DC, 0x77FEB9F3D3A81A01, 0x00370307A18444B5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7A813D7910A7A65A, 0xCD7698379F20810A, 0xC2BD0C335C47DA8C, 0x31BCDEB6E1651F37,
+0x6C3BEED1A939F5EB, 0xDF5F7B2585F27EA7, 0xE54484F154FEB143, 0x000F2277D72F5DEB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x30F634EBB1F066A1, 0xB17576DAA833A32F, 0xA256DA0896115659, 0xA3A67941E88E3639,
+0x5EC31292738335EC, 0xF156A0CDC1A9788F, 0x0948186D39A533E9, 0x001D9D0BE6208E5F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1BF08B36A5181614, 0x6FEE26D63FD6D9F3, 0xF4600638B8A000AD, 0xD9A71A77F83EF707,
+0xB234B796421303CB, 0x9067F67A48D5CF8B, 0x263E0C0F07D2955E, 0x00069AE7C52955F0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x41FBF1E190B4BEC5, 0x86BC4E8C911F7164, 0x683816115099D136, 0x4D52357ADE621076,
+0xE5BCF4D5E33CB2EA, 0xB7E4F709F2AA5A36, 0x81925B989075DBC0, 0x002847A52B4C07B2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4A613CC203EE540E, 0xC81E767D21690F5D, 0xF40BD4B57DA764A9, 0xB8DEF84F2C7F5874,
+0x9445E818DDAE7215, 0x9B4C3E34C43DA8A3, 0xA898F3F22A3D240A, 0x0035DFF56368345E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x00000000000003F9, 0x0000000000000000, 0x0000000000000000, 0xB400000000000000,
+0x63CB1A6EA6DED2B4, 0x51689D8D667EB37D, 0x8ACD77C71AB24142, 0x0026FBAEC60F5953,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 };
@@ -166,6 +166,8 @@ void digit_x_digit(const digit_t a, const digit_t b, digit_t* c)
 }
 
 
+// With OPT_LEVEL=PORTABLE_FAST, the fully unrolled versions of the functions below are in fp_portable.c
+#if !defined(PORTABLE_FAST_IMPLEMENTATION)
 void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
 { // Multiprecision comba multiply, c = a*b, where lng(a) = lng(b) = nwords.   
     unsigned int i, j;
@@ -201,6 +203,38 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
 }
 
 
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision comba squaring, c = a^2, where lng(a) = nwords.
+  // Each cross product a[i]*a[j], i < j, is computed once and doubled.
+    unsigned int i, k, carry = 0;
+    digit_t t = 0, u = 0, v = 0, UV[2], top;
+    
+    for (k = 0; k < 2*nwords-1; k++) {
+        i = (k < nwords) ? 0 : k-nwords+1;
+        for (; 2*i < k; i++) {
+            MUL(a[i], a[k-i], UV+1, UV[0]); 
+            top = UV[1] >> (RADIX-1);
+            UV[1] = (UV[1] << 1) | (UV[0] >> (RADIX-1));
+            UV[0] = UV[0] << 1;
+            ADDC(0, UV[0], v, carry, v); 
+            ADDC(carry, UV[1], u, carry, u); 
+            t += carry + top;
+        }
+        if (2*i == k) {
+            MUL(a[i], a[i], UV+1, UV[0]); 
+            ADDC(0, UV[0], v, carry, v); 
+            ADDC(carry, UV[1], u, carry, u); 
+            t += carry;
+        }
+        c[k] = v;
+        v = u; 
+        u = t;
+        t = 0;
+    }
+    c[2*nwords-1] = v; 
+}
+
+
 void rdc_mont(digit_t* ma, digit_t* mc)
 { // Efficient Montgomery reduction using comba and exploiting the special form of the prime p503.
   // mc = ma*R^-1 mod p503x2, where R = 2^512.
@@ -253,4 +287,6 @@ void rdc_mont(digit_t* ma, digit_t* mc)
     }
     ADDC(0, v, ma[2*NWORDS_FIELD-1], carry, v); 
     mc[NWORDS_FIELD-1] = v;
-}
\ No newline at end of file
+}
+
+#endif
\ No newline at end of file
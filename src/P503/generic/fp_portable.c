@@ -0,0 +1,384 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: fully unrolled multiplication, squaring and Montgomery reduction for P503
+*           (OPT_LEVEL=PORTABLE_FAST), generated by tools/gen_fp_portable.py
+*********************************************************************************************/
+
+#include "../P503_internal.h"
+#include "../../internal.h"
+
+
+// Column accumulation (t,u,v) += a*b
+#define MULACC(a, b)                                                                               \
+    { digit_t hi, lo; unsigned int cy;                                                             \
+      MUL((a), (b), &hi, lo);                                                                      \
+      ADDC(0, lo, v, cy, v);                                                                       \
+      ADDC(cy, hi, u, cy, u);                                                                      \
+      ADDC(cy, t, 0, cy, t); }
+
+// Cross product accumulation (st,su,sv) += a*b
+#define MULACC_CROSS(a, b)                                                                         \
+    { digit_t hi, lo; unsigned int cy;                                                             \
+      MUL((a), (b), &hi, lo);                                                                      \
+      ADDC(0, lo, sv, cy, sv);                                                                     \
+      ADDC(cy, hi, su, cy, su);                                                                    \
+      ADDC(cy, st, 0, cy, st); }
+
+// Column accumulation (t,u,v) += 2*(st,su,sv)
+#define ADD_CROSS_X2()                                                                             \
+    { unsigned int cy;                                                                             \
+      st = (st << 1) | (su >> (RADIX-1));                                                          \
+      su = (su << 1) | (sv >> (RADIX-1));                                                          \
+      sv = sv << 1;                                                                                \
+      ADDC(0, sv, v, cy, v);                                                                       \
+      ADDC(cy, su, u, cy, u);                                                                      \
+      ADDC(cy, st, t, cy, t); }
+
+
+void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
+{ // Multiprecision multiply, c = a*b, where lng(a) = lng(b) = NWORDS_FIELD.
+  // One level of Karatsuba on the halves of 4 and 4 words, with comba products.
+    unsigned int carry, borrow, ca, cb;
+    digit_t t, u, v, mask_a, mask_b, ta[4], tb[4], tt[9];
+    UNREFERENCED_PARAMETER(nwords);
+
+    ADDC(0, a[0], a[4], carry, ta[0]);
+    ADDC(carry, a[1], a[5], carry, ta[1]);
+    ADDC(carry, a[2], a[6], carry, ta[2]);
+    ADDC(carry, a[3], a[7], carry, ta[3]);
+    ca = carry;
+    ADDC(0, b[0], b[4], carry, tb[0]);
+    ADDC(carry, b[1], b[5], carry, tb[1]);
+    ADDC(carry, b[2], b[6], carry, tb[2]);
+    ADDC(carry, b[3], b[7], carry, tb[3]);
+    cb = carry;
+    mask_a = 0 - (digit_t)ca;
+    mask_b = 0 - (digit_t)cb;
+
+    // c = a1*b1*2^512 + a0*b0
+    t = 0; u = 0; v = 0;
+    MULACC(a[0], b[0]);
+    c[0] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[1]);
+    MULACC(a[1], b[0]);
+    c[1] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[2]);
+    MULACC(a[1], b[1]);
+    MULACC(a[2], b[0]);
+    c[2] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[3]);
+    MULACC(a[1], b[2]);
+    MULACC(a[2], b[1]);
+    MULACC(a[3], b[0]);
+    c[3] = v; v = u; u = t; t = 0;
+    MULACC(a[1], b[3]);
+    MULACC(a[2], b[2]);
+    MULACC(a[3], b[1]);
+    c[4] = v; v = u; u = t; t = 0;
+    MULACC(a[2], b[3]);
+    MULACC(a[3], b[2]);
+    c[5] = v; v = u; u = t; t = 0;
+    MULACC(a[3], b[3]);
+    c[6] = v; v = u; u = t; t = 0;
+    c[7] = v;
+    t = 0; u = 0; v = 0;
+    MULACC(a[4], b[4]);
+    c[8] = v; v = u; u = t; t = 0;
+    MULACC(a[4], b[5]);
+    MULACC(a[5], b[4]);
+    c[9] = v; v = u; u = t; t = 0;
+    MULACC(a[4], b[6]);
+    MULACC(a[5], b[5]);
+    MULACC(a[6], b[4]);
+    c[10] = v; v = u; u = t; t = 0;
+    MULACC(a[4], b[7]);
+    MULACC(a[5], b[6]);
+    MULACC(a[6], b[5]);
+    MULACC(a[7], b[4]);
+    c[11] = v; v = u; u = t; t = 0;
+    MULACC(a[5], b[7]);
+    MULACC(a[6], b[6]);
+    MULACC(a[7], b[5]);
+    c[12] = v; v = u; u = t; t = 0;
+    MULACC(a[6], b[7]);
+    MULACC(a[7], b[6]);
+    c[13] = v; v = u; u = t; t = 0;
+    MULACC(a[7], b[7]);
+    c[14] = v; v = u; u = t; t = 0;
+    c[15] = v;
+
+    // tt = (a0+a1)*(b0+b1) - a0*b0 - a1*b1
+    t = 0; u = 0; v = 0;
+    MULACC(ta[0], tb[0]);
+    tt[0] = v; v = u; u = t; t = 0;
+    MULACC(ta[0], tb[1]);
+    MULACC(ta[1], tb[0]);
+    tt[1] = v; v = u; u = t; t = 0;
+    MULACC(ta[0], tb[2]);
+    MULACC(ta[1], tb[1]);
+    MULACC(ta[2], tb[0]);
+    tt[2] = v; v = u; u = t; t = 0;
+    MULACC(ta[0], tb[3]);
+    MULACC(ta[1], tb[2]);
+    MULACC(ta[2], tb[1]);
+    MULACC(ta[3], tb[0]);
+    tt[3] = v; v = u; u = t; t = 0;
+    MULACC(ta[1], tb[3]);
+    MULACC(ta[2], tb[2]);
+    MULACC(ta[3], tb[1]);
+    tt[4] = v; v = u; u = t; t = 0;
+    MULACC(ta[2], tb[3]);
+    MULACC(ta[3], tb[2]);
+    tt[5] = v; v = u; u = t; t = 0;
+    MULACC(ta[3], tb[3]);
+    tt[6] = v; v = u; u = t; t = 0;
+    tt[7] = v;
+    tt[8] = (digit_t)(ca & cb);
+    ADDC(0, tt[4], (ta[0] & mask_b), carry, tt[4]);
+    ADDC(carry, tt[5], (ta[1] & mask_b), carry, tt[5]);
+    ADDC(carry, tt[6], (ta[2] & mask_b), carry, tt[6]);
+    ADDC(carry, tt[7], (ta[3] & mask_b), carry, tt[7]);
+    ADDC(carry, tt[8], 0, carry, tt[8]);
+    ADDC(0, tt[4], (tb[0] & mask_a), carry, tt[4]);
+    ADDC(carry, tt[5], (tb[1] & mask_a), carry, tt[5]);
+    ADDC(carry, tt[6], (tb[2] & mask_a), carry, tt[6]);
+    ADDC(carry, tt[7], (tb[3] & mask_a), carry, tt[7]);
+    ADDC(carry, tt[8], 0, carry, tt[8]);
+    SUBC(0, tt[0], c[0], borrow, tt[0]);
+    SUBC(borrow, tt[1], c[1], borrow, tt[1]);
+    SUBC(borrow, tt[2], c[2], borrow, tt[2]);
+    SUBC(borrow, tt[3], c[3], borrow, tt[3]);
+    SUBC(borrow, tt[4], c[4], borrow, tt[4]);
+    SUBC(borrow, tt[5], c[5], borrow, tt[5]);
+    SUBC(borrow, tt[6], c[6], borrow, tt[6]);
+    SUBC(borrow, tt[7], c[7], borrow, tt[7]);
+    SUBC(borrow, tt[8], 0, borrow, tt[8]);
+    SUBC(0, tt[0], c[8], borrow, tt[0]);
+    SUBC(borrow, tt[1], c[9], borrow, tt[1]);
+    SUBC(borrow, tt[2], c[10], borrow, tt[2]);
+    SUBC(borrow, tt[3], c[11], borrow, tt[3]);
+    SUBC(borrow, tt[4], c[12], borrow, tt[4]);
+    SUBC(borrow, tt[5], c[13], borrow, tt[5]);
+    SUBC(borrow, tt[6], c[14], borrow, tt[6]);
+    SUBC(borrow, tt[7], c[15], borrow, tt[7]);
+    SUBC(borrow, tt[8], 0, borrow, tt[8]);
+
+    // c = c + tt*2^256
+    ADDC(0, c[4], tt[0], carry, c[4]);
+    ADDC(carry, c[5], tt[1], carry, c[5]);
+    ADDC(carry, c[6], tt[2], carry, c[6]);
+    ADDC(carry, c[7], tt[3], carry, c[7]);
+    ADDC(carry, c[8], tt[4], carry, c[8]);
+    ADDC(carry, c[9], tt[5], carry, c[9]);
+    ADDC(carry, c[10], tt[6], carry, c[10]);
+    ADDC(carry, c[11], tt[7], carry, c[11]);
+    ADDC(carry, c[12], tt[8], carry, c[12]);
+    ADDC(carry, c[13], 0, carry, c[13]);
+    ADDC(carry, c[14], 0, carry, c[14]);
+    ADDC(carry, c[15], 0, carry, c[15]);
+}
+
+
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision comba squaring, c = a^2, where lng(a) = NWORDS_FIELD.
+  // The cross products a[i]*a[j], i < j, of each column are accumulated once and doubled.
+    digit_t t = 0, u = 0, v = 0, st, su, sv;
+    UNREFERENCED_PARAMETER(nwords);
+
+    MULACC(a[0], a[0]);
+    c[0] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[1]);
+    ADD_CROSS_X2();
+    c[1] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[2]);
+    ADD_CROSS_X2();
+    MULACC(a[1], a[1]);
+    c[2] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[3]);
+    MULACC_CROSS(a[1], a[2]);
+    ADD_CROSS_X2();
+    c[3] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[4]);
+    MULACC_CROSS(a[1], a[3]);
+    ADD_CROSS_X2();
+    MULACC(a[2], a[2]);
+    c[4] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[5]);
+    MULACC_CROSS(a[1], a[4]);
+    MULACC_CROSS(a[2], a[3]);
+    ADD_CROSS_X2();
+    c[5] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[6]);
+    MULACC_CROSS(a[1], a[5]);
+    MULACC_CROSS(a[2], a[4]);
+    ADD_CROSS_X2();
+    MULACC(a[3], a[3]);
+    c[6] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[7]);
+    MULACC_CROSS(a[1], a[6]);
+    MULACC_CROSS(a[2], a[5]);
+    MULACC_CROSS(a[3], a[4]);
+    ADD_CROSS_X2();
+    c[7] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[1], a[7]);
+    MULACC_CROSS(a[2], a[6]);
+    MULACC_CROSS(a[3], a[5]);
+    ADD_CROSS_X2();
+    MULACC(a[4], a[4]);
+    c[8] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[2], a[7]);
+    MULACC_CROSS(a[3], a[6]);
+    MULACC_CROSS(a[4], a[5]);
+    ADD_CROSS_X2();
+    c[9] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[3], a[7]);
+    MULACC_CROSS(a[4], a[6]);
+    ADD_CROSS_X2();
+    MULACC(a[5], a[5]);
+    c[10] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[4], a[7]);
+    MULACC_CROSS(a[5], a[6]);
+    ADD_CROSS_X2();
+    c[11] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[5], a[7]);
+    ADD_CROSS_X2();
+    MULACC(a[6], a[6]);
+    c[12] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[6], a[7]);
+    ADD_CROSS_X2();
+    c[13] = v; v = u; u = t; t = 0;
+    MULACC(a[7], a[7]);
+    c[14] = v; v = u; u = t; t = 0;
+    c[15] = v;
+}
+
+
+void rdc_mont(digit_t* ma, digit_t* mc)
+{ // Montgomery reduction exploiting the special form of the prime p503, mc = ma*R^-1 mod p503x2, where R = 2^512.
+  // If ma < 2^512*p503, the output mc is in the range [0, 2*p503-1].
+  // Since p503+1 = 2^192*p', p503 = -1 mod 2^192: the reduction adds Q*p'*2^192 for each block Q of 3 words of ma, from the least
+  // significant one, which leaves Q in place and clears Q*p503. The words of p' are multiplied as constants.
+    unsigned int i, carry;
+    digit_t t, u, v, r[2*NWORDS_FIELD], s[NWORDS_FIELD];
+
+    for (i = 0; i < 2*NWORDS_FIELD; i++) {
+        r[i] = ma[i];
+    }
+
+    t = 0; u = 0; v = 0;
+    MULACC(r[0], 0xAC00000000000000ULL);
+    s[0] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0x13085BDA2211E7A0ULL);
+    MULACC(r[1], 0xAC00000000000000ULL);
+    s[1] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0x1B9BF6C87B7E7DAFULL);
+    MULACC(r[1], 0x13085BDA2211E7A0ULL);
+    MULACC(r[2], 0xAC00000000000000ULL);
+    s[2] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0x6045C6BDDA77A4D0ULL);
+    MULACC(r[1], 0x1B9BF6C87B7E7DAFULL);
+    MULACC(r[2], 0x13085BDA2211E7A0ULL);
+    s[3] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0x004066F541811E1EULL);
+    MULACC(r[1], 0x6045C6BDDA77A4D0ULL);
+    MULACC(r[2], 0x1B9BF6C87B7E7DAFULL);
+    s[4] = v; v = u; u = t; t = 0;
+    MULACC(r[1], 0x004066F541811E1EULL);
+    MULACC(r[2], 0x6045C6BDDA77A4D0ULL);
+    s[5] = v; v = u; u = t; t = 0;
+    MULACC(r[2], 0x004066F541811E1EULL);
+    s[6] = v; v = u; u = t; t = 0;
+    s[7] = v;
+    ADDC(0, r[3], s[0], carry, r[3]);
+    ADDC(carry, r[4], s[1], carry, r[4]);
+    ADDC(carry, r[5], s[2], carry, r[5]);
+    ADDC(carry, r[6], s[3], carry, r[6]);
+    ADDC(carry, r[7], s[4], carry, r[7]);
+    ADDC(carry, r[8], s[5], carry, r[8]);
+    ADDC(carry, r[9], s[6], carry, r[9]);
+    ADDC(carry, r[10], s[7], carry, r[10]);
+    ADDC(carry, r[11], 0, carry, r[11]);
+    ADDC(carry, r[12], 0, carry, r[12]);
+    ADDC(carry, r[13], 0, carry, r[13]);
+    ADDC(carry, r[14], 0, carry, r[14]);
+    ADDC(carry, r[15], 0, carry, r[15]);
+
+    t = 0; u = 0; v = 0;
+    MULACC(r[3], 0xAC00000000000000ULL);
+    s[0] = v; v = u; u = t; t = 0;
+    MULACC(r[3], 0x13085BDA2211E7A0ULL);
+    MULACC(r[4], 0xAC00000000000000ULL);
+    s[1] = v; v = u; u = t; t = 0;
+    MULACC(r[3], 0x1B9BF6C87B7E7DAFULL);
+    MULACC(r[4], 0x13085BDA2211E7A0ULL);
+    MULACC(r[5], 0xAC00000000000000ULL);
+    s[2] = v; v = u; u = t; t = 0;
+    MULACC(r[3], 0x6045C6BDDA77A4D0ULL);
+    MULACC(r[4], 0x1B9BF6C87B7E7DAFULL);
+    MULACC(r[5], 0x13085BDA2211E7A0ULL);
+    s[3] = v; v = u; u = t; t = 0;
+    MULACC(r[3], 0x004066F541811E1EULL);
+    MULACC(r[4], 0x6045C6BDDA77A4D0ULL);
+    MULACC(r[5], 0x1B9BF6C87B7E7DAFULL);
+    s[4] = v; v = u; u = t; t = 0;
+    MULACC(r[4], 0x004066F541811E1EULL);
+    MULACC(r[5], 0x6045C6BDDA77A4D0ULL);
+    s[5] = v; v = u; u = t; t = 0;
+    MULACC(r[5], 0x004066F541811E1EULL);
+    s[6] = v; v = u; u = t; t = 0;
+    s[7] = v;
+    ADDC(0, r[6], s[0], carry, r[6]);
+    ADDC(carry, r[7], s[1], carry, r[7]);
+    ADDC(carry, r[8], s[2], carry, r[8]);
+    ADDC(carry, r[9], s[3], carry, r[9]);
+    ADDC(carry, r[10], s[4], carry, r[10]);
+    ADDC(carry, r[11], s[5], carry, r[11]);
+    ADDC(carry, r[12], s[6], carry, r[12]);
+    ADDC(carry, r[13], s[7], carry, r[13]);
+    ADDC(carry, r[14], 0, carry, r[14]);
+    ADDC(carry, r[15], 0, carry, r[15]);
+
+    t = 0; u = 0; v = 0;
+    MULACC(r[6], 0xAC00000000000000ULL);
+    s[0] = v; v = u; u = t; t = 0;
+    MULACC(r[6], 0x13085BDA2211E7A0ULL);
+    MULACC(r[7], 0xAC00000000000000ULL);
+    s[1] = v; v = u; u = t; t = 0;
+    MULACC(r[6], 0x1B9BF6C87B7E7DAFULL);
+    MULACC(r[7], 0x13085BDA2211E7A0ULL);
+    s[2] = v; v = u; u = t; t = 0;
+    MULACC(r[6], 0x6045C6BDDA77A4D0ULL);
+    MULACC(r[7], 0x1B9BF6C87B7E7DAFULL);
+    s[3] = v; v = u; u = t; t = 0;
+    MULACC(r[6], 0x004066F541811E1EULL);
+    MULACC(r[7], 0x6045C6BDDA77A4D0ULL);
+    s[4] = v; v = u; u = t; t = 0;
+    MULACC(r[7], 0x004066F541811E1EULL);
+    s[5] = v; v = u; u = t; t = 0;
+    s[6] = v;
+    ADDC(0, r[9], s[0], carry, r[9]);
+    ADDC(carry, r[10], s[1], carry, r[10]);
+    ADDC(carry, r[11], s[2], carry, r[11]);
+    ADDC(carry, r[12], s[3], carry, r[12]);
+    ADDC(carry, r[13], s[4], carry, r[13]);
+    ADDC(carry, r[14], s[5], carry, r[14]);
+    ADDC(carry, r[15], s[6], carry, r[15]);
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        mc[i] = r[NWORDS_FIELD+i];
+    }
+}
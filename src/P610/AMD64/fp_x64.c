@@ -6,6 +6,9 @@
 
 #include "../P610_internal.h"
 #include "../../internal.h"
+#if defined(X64_DISPATCH_IMPLEMENTATION)
+    #include <cpuid.h>
+#endif
 
 
 // Global constants
@@ -471,6 +474,23 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
 }
 
 
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision squaring, c = a^2, where lng(a) = nwords.
+        
+    UNREFERENCED_PARAMETER(nwords);
+
+#if (OS_TARGET == OS_WIN) || (!defined(_MULX_) && !defined(X64_DISPATCH_IMPLEMENTATION))
+
+    mp_mul(a, a, c, NWORDS_FIELD);
+
+#elif (OS_TARGET == OS_NIX)
+    
+    sqr610_asm(a, c);
+
+#endif
+}
+
+
 void rdc_mont(digit_t* ma, digit_t* mc)
 { // Montgomery reduction exploiting special form of the prime.
   // mc = ma*R^-1 mod p610x2, where R = 2^640.
@@ -723,4 +743,99 @@ void rdc_mont(digit_t* ma, digit_t* mc)
     rdc610_asm(ma, mc);    
 
 #endif
-}
\ No newline at end of file
+}
+
+
+#if defined(X64_DISPATCH_IMPLEMENTATION)
+
+// Kernel variants assembled from fp_x64_asm.S with the suffixes _plain (baseline x64), _mulx (BMI2) and _adx (BMI2 and ADX)
+#define X64_KERNEL_PROTOTYPES(v)                                                    \
+    void fpadd610_asm##v(const digit_t* a, const digit_t* b, digit_t* c);           \
+    void fpsub610_asm##v(const digit_t* a, const digit_t* b, digit_t* c);           \
+    void mp_add610_asm##v(const digit_t* a, const digit_t* b, digit_t* c);          \
+    void mp_sub610_p2_asm##v(const digit_t* a, const digit_t* b, digit_t* c);       \
+    void mp_sub610_p4_asm##v(const digit_t* a, const digit_t* b, digit_t* c);       \
+    void mp_subadd610x2_asm##v(const digit_t* a, const digit_t* b, digit_t* c);     \
+    void mp_dblsub610x2_asm##v(const digit_t* a, const digit_t* b, digit_t* c);     \
+    void mul610_asm##v(const digit_t* a, const digit_t* b, digit_t* c);             \
+    void sqr610_asm##v(const digit_t* a, digit_t* c);                               \
+    void rdc610_asm##v(digit_t* ma, digit_t* mc);
+
+#define X64_KERNEL_TABLE(v, mul, sqr, rdc, variant)                                 \
+    { fpadd610_asm##v, fpsub610_asm##v, mp_add610_asm##v, mp_sub610_p2_asm##v,       \
+      mp_sub610_p4_asm##v, mp_subadd610x2_asm##v, mp_dblsub610x2_asm##v, mul, sqr, rdc, variant }
+
+X64_KERNEL_PROTOTYPES(_plain)
+X64_KERNEL_PROTOTYPES(_mulx)
+X64_KERNEL_PROTOTYPES(_adx)
+
+// mul610_asm, sqr610_asm and rdc610_asm have no baseline x64 versions. The plain variant uses the comba functions of the
+// generic implementation instead, compiled here under their own names
+
+#define FP_GENERIC_COMBA_ONLY
+#define mp_mul                    mp_mul610_comba
+#define mp_sqr                    mp_sqr610_comba
+#define rdc_mont                  rdc610_comba
+#include "../generic/fp_generic.c"
+#undef mp_mul
+#undef mp_sqr
+#undef rdc_mont
+
+
+static void mul610_comba(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Multiprecision comba multiply, c = a*b, for processors without MULX
+    mp_mul610_comba(a, b, c, NWORDS_FIELD);
+}
+
+
+static void sqr610_comba(const digit_t* a, digit_t* c)
+{ // Multiprecision comba squaring, c = a^2, for processors without MULX
+    mp_sqr610_comba(a, c, NWORDS_FIELD);
+}
+
+static const x64_kernels_t x64_kernels610_variants[3] = {
+    X64_KERNEL_TABLE(_plain, mul610_comba, sqr610_comba, rdc610_comba, X64_KERNELS_PLAIN),
+    X64_KERNEL_TABLE(_mulx, mul610_asm_mulx, sqr610_asm_mulx, rdc610_asm_mulx, X64_KERNELS_MULX),
+    X64_KERNEL_TABLE(_adx, mul610_asm_adx, sqr610_asm_adx, rdc610_asm_adx, X64_KERNELS_ADX)
+};
+
+// Starts out with the baseline kernels, so it is usable even before the load-time selection has run
+x64_kernels_t x64_kernels610 = X64_KERNEL_TABLE(_plain, mul610_comba, sqr610_comba, rdc610_comba, X64_KERNELS_PLAIN);
+
+
+static unsigned int x64_kernels_supported(void)
+{ // Returns the fastest kernel variant supported by the processor
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, NULL) < 7) {
+        return X64_KERNELS_PLAIN;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    UNREFERENCED_PARAMETER(eax); UNREFERENCED_PARAMETER(ecx); UNREFERENCED_PARAMETER(edx);
+
+    if ((ebx & bit_BMI2) == 0) {
+        return X64_KERNELS_PLAIN;
+    }
+    if ((ebx & bit_ADX) == 0) {
+        return X64_KERNELS_MULX;
+    }
+    return X64_KERNELS_ADX;
+}
+
+
+bool x64_kernels_select610(const unsigned int variant)
+{ // Switch to the given kernel variant. Returns false if the processor does not support it
+    if (variant > x64_kernels_supported()) {
+        return false;
+    }
+    x64_kernels610 = x64_kernels610_variants[variant];
+    return true;
+}
+
+
+__attribute__((constructor)) static void x64_kernels_init610(void)
+{ // Select the fastest supported kernel variant once, at load time
+    x64_kernels_select610(x64_kernels_supported());
+}
+
+#endif
\ No newline at end of file
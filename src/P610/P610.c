@@ -69,6 +69,21 @@ const uint64_t Montgomery_R2[NWORDS64_FIELD]     = { 0xE75F5D201A197727, 0xE0B85
 // Value one in Montgomery representation 
 const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000670CC8E6, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x9A34000000000000,
                                                      0x4D99C2BD28717A3F, 0x0A4A1839A323D41C, 0xD2B62215D06AD1E2, 0x1369026E862CAF3D, 0x000000010894E964 };
+#if defined(AVX2_X4_IMPLEMENTATION)
+// Values 2*p610 and p610+1 in radix 2^28, used by the 4-way AVX2 implementation
+const uint64_t p610x2_x4[VNWORDS_FIELD]          = { 0xFFFFFFE, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+                                                     0xFFFFFFF, 0xFFFFFFF, 0x3FFFFFF, 0x605CDC0, 0xBD154B5, 0x5762F09, 0xA091FF3, 0x35CF7E8,
+                                                     0x1884A55, 0xAB65F42, 0xFB11964, 0x2184A3C, 0xED10320, 0x04F7ED4 };
+const uint64_t p610p1_x4[VNWORDS_FIELD]          = { 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000,
+                                                     0x0000000, 0x0000000, 0x2000000, 0xB02E6E0, 0xDE8AA5A, 0xABB1784, 0x5048FF9, 0x9AE7BF4,
+                                                     0x0C4252A, 0x55B2FA1, 0x7D88CB2, 0x10C251E, 0x7688190, 0x027BF6A };
+// Montgomery constant Montgomery_Rv = 2^616 mod p610, used for the conversion to the 4-way representation
+const uint64_t Montgomery_Rv[NWORDS64_FIELD]     = { 0x0000000000000067, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xBD32000000000000,
+                                                     0x9898A76375831D51, 0xACC20B3B2A128BEB, 0x3F84FD6341150BDB, 0xDF0941D10BB7DF64, 0x000000001FC2A4F3 };
+// Montgomery constant Montgomery_RRv = (2^640)^2/2^616 mod p610, used for the conversion from the 4-way representation
+const uint64_t Montgomery_RRv[NWORDS64_FIELD]    = { 0x00670CC8E66A8120, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x3DC0000000000000,
+                                                     0xAC85ED004E433BEF, 0xE2B590499C67640E, 0x805F17E58F2708C0, 0xB39C3F1F8276E732, 0x00000001499D2D01 };
+#endif
 
 
 // Fixed parameters for isogeny tree computation
@@ -121,9 +136,29 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define mp_add_asm                    mp_add610_asm
 #define mp_subaddx2_asm               mp_subadd610x2_asm
 #define mp_dblsubx2_asm               mp_dblsub610x2_asm
+#if defined(X64_CURVE_ASM)
+    #define xDBLADD_asm               xDBLADD610_asm
+    #define xDBL_asm                  xDBL610_asm
+    #define xTPL_asm                  xTPL610_asm
+    #define eval_4_isog_asm           eval_4_isog610_asm
+    #define eval_3_isog_asm           eval_3_isog610_asm
+#endif
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp610
 #define crypto_kem_enc                crypto_kem_enc_SIKEp610
+#define crypto_kem_enc_parallel       crypto_kem_enc_parallel_SIKEp610
+#define crypto_kem_pk_prepare         crypto_kem_pk_prepare_SIKEp610
+#define crypto_kem_enc_prepared       crypto_kem_enc_prepared_SIKEp610
+#define crypto_kem_prepared_pk        crypto_kem_prepared_pk_SIKEp610
 #define crypto_kem_dec                crypto_kem_dec_SIKEp610
+#define crypto_kem_dec_init           crypto_kem_dec_init_SIKEp610
+#define crypto_kem_dec_step           crypto_kem_dec_step_SIKEp610
+#define crypto_kem_dec_finish         crypto_kem_dec_finish_SIKEp610
+#define crypto_kem_dec_state          crypto_kem_dec_state_SIKEp610
+#define crypto_kem_enc_batch4         crypto_kem_enc_batch4_SIKEp610
+#define crypto_kem_dec_batch4         crypto_kem_dec_batch4_SIKEp610
+#define crypto_kem_keypair_batch      crypto_kem_keypair_batch_SIKEp610
+#define crypto_kem_enc_batch          crypto_kem_enc_batch_SIKEp610
+#define crypto_kem_dec_batch          crypto_kem_dec_batch_SIKEp610
 #define random_mod_order_A            random_mod_order_A_SIDHp610
 #define random_mod_order_B            random_mod_order_B_SIDHp610
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp610
@@ -131,7 +166,18 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp610
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp610
 
+#if defined(FIXED_BASIS_LADDER)
+    #include "P610_ladder_tables.c"
+#endif
+#include "../safegcd.c"
 #include "../fpx.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"
-#include "../sike.c"
\ No newline at end of file
+#include "../sike.c"
+#if defined(AVX2_X4_IMPLEMENTATION)
+    #include "../batch/fpx_x4.c"
+    #include "../batch/ec_isogeny_x4.c"
+    #include "../batch/sidh_x4.c"
+#endif
+#include "../batch/sike_x4.c"
+#include "../batch/sike_batch.c"
\ No newline at end of file
@@ -364,17 +364,36 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define mp_add_asm                    mp_add610_asm
 #define mp_subaddx2_asm               mp_subadd610x2_asm
 #define mp_dblsubx2_asm               mp_dblsub610x2_asm
+#if defined(X64_CURVE_ASM)
+    #define xDBLADD_asm               xDBLADD610_asm
+    #define xDBL_asm                  xDBL610_asm
+    #define xTPL_asm                  xTPL610_asm
+    #define eval_4_isog_asm           eval_4_isog610_asm
+    #define eval_3_isog_asm           eval_3_isog610_asm
+#endif
 #define random_mod_order_A            random_mod_order_A_SIDHp610
 #define random_mod_order_B            random_mod_order_B_SIDHp610
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp610_Compressed
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp610_Compressed
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp610_Compressed
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp610_Compressed 
+#define EphemeralKeyGeneration_A_ws   EphemeralKeyGeneration_A_ws_SIDHp610_Compressed
+#define EphemeralKeyGeneration_B_ws   EphemeralKeyGeneration_B_ws_SIDHp610_Compressed
+#define EphemeralSecretAgreement_A_ws EphemeralSecretAgreement_A_ws_SIDHp610_Compressed
+#define EphemeralSecretAgreement_B_ws EphemeralSecretAgreement_B_ws_SIDHp610_Compressed
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp610_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp610_compressed
+#define crypto_kem_enc_parallel       crypto_kem_enc_parallel_SIKEp610_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp610_compressed
+#define crypto_kem_keypair_ws         crypto_kem_keypair_ws_SIKEp610_compressed
+#define crypto_kem_enc_ws             crypto_kem_enc_ws_SIKEp610_compressed
+#define crypto_kem_dec_ws             crypto_kem_dec_ws_SIKEp610_compressed
 
 
+#if defined(FIXED_BASIS_LADDER)
+    #include "P610_compressed_ladder_tables.c"
+#endif
+#include "../safegcd.c"
 #include "../fpx.c"
 #include "../ec_isogeny.c"
 #include "../compression/torsion_basis.c"
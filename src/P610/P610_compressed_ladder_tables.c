@@ -0,0 +1,1534 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: precomputed tables for the fixed-basis three-point ladder for P610 when using compression
+*********************************************************************************************/ 
+
+// Alice's table {x([2^i]QA)}, i = 0,...,304, of affine x-coordinates in GF(p610^2) on the starting curve E: y^2 = x^3 + 6x^2 + x,
+// expressed in Montgomery representation. Each entry is stored as {x0, x1} (160 bytes per entry, 48800 bytes in total)
+const uint64_t A_ladder_table[OALICE_BITS*2*NWORDS64_FIELD] = {
+0x2728178178DEAFBD, 0xD377C4656DBC71F0, 0x968642007B807932, 0xB8B04B1039062A21,
+0xF824771B468A977C, 0x260F1C50354F46AB, 0x78A3D37CDBBD4DC5, 0x1FB1BAC6851BA175,
+0x0A73444F1CAC4A10, 0x00000000F3A5C2BB, 0x4F828B752E825BB4, 0x82CEA210AC766C69,
+0x8B1BBC87DAD8BEDD, 0x9BFC5B9CE215B423, 0xF7E1BCC0C541177C, 0x7727E3A0F1A1AF24,
+0xFBCFE4177D2B0221, 0xBB15BDCC160D902A, 0x3FE1467B4A911446, 0x00000001A495CB35,
+0x02C9E52FA31B9B76, 0xEF4088AD3E54C6DD, 0xC18E7055D2CFF348, 0x24B3268C87D5F690,
+0xDD80D94ADE7B0A93, 0x5EE075B1E9A6C6BD, 0x27F68F76241404BD, 0x2B267148416A9627,
+0x27270DAFD0DD30FF, 0x00000000D8B7E841, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0D8A293A9ED92973, 0xE1B641C07DDEAD64, 0x752811982A639080, 0x5EF082EEF14391C0,
+0x8803530B77F63838, 0xFB78F75DCBF72341, 0x7E86C13B523152FA, 0xB9B3745CF6FF51D9,
+0xB0B2C0DED3844AD6, 0x000000008FA8CCD2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x535C6E807083BFBD, 0x0AD64453323044A7, 0xB68696F72CAFB024, 0x67ACF707BBC8B400,
+0x8785973E18A70792, 0x7B0C19F31B0332E4, 0x4797319771BED227, 0x43E99AFC2246DC4D,
+0xCBF511118A7BFE57, 0x00000000BB2F0DA5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB7306FE5F8AEB2E1, 0xCADFDF1D57932310, 0x4FB22989A00760AD, 0x4DE5D4CCE59DBC2F,
+0x6638897142B34383, 0xE2A4EA4A059BA01E, 0x7DCCC57435AEE3F2, 0xD4D1C14C75457BCD,
+0xB69F7103FB978B62, 0x000000002013C55A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE3EB3AB746259173, 0xDAE56670F6991736, 0xA79D1B2DE9F5E2B4, 0x490044836A4C4FCD,
+0xE083EEE8B7FF06AB, 0xBE1A8EAA099A33F8, 0xAC2BAB911D8240E8, 0xA1873B4C17C74000,
+0xA53BF039918D53E0, 0x00000001E4AD37ED, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5F22068A1B32AF99, 0xC7432715BDAC1304, 0xAB480DDE9A1BC065, 0xD162573FDEC6853B,
+0x6F74082590792F4C, 0x442FE60878E2FBFD, 0xE6A077D26B5AD4E7, 0x9C1D69688D67B885,
+0x98382CD2E92D3485, 0x00000001885A20EF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x013BBB9B4D27BC4F, 0xD9AAE4D9D8B2AF0C, 0x06D732141024FD8B, 0x437658E4F1FC83E2,
+0xA4934F0A48D4088C, 0x4B6B6E6E46EF342F, 0x47023E115A6427E1, 0x67C67101F68C2B83,
+0xC0C220FE61E0C5B3, 0x0000000085E9562C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8F9948536D801AD9, 0x36F97D42A2D36739, 0x7DBAB23D616B79C8, 0xAD727678D082265F,
+0xD43EED08A53063F6, 0x78EE031C23DD1CDF, 0x74A2455402419124, 0x9E8865F79760E5B9,
+0x5EF1939373B1BB9B, 0x0000000213A560A4, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2BED0C1F155F60DB, 0xDA2A696BC0B3494F, 0x50C4F1CF4E48D8AB, 0xDFCD6052BA3FAC7A,
+0xBCCFF1E373F5AE6F, 0x9C0B22879AE1155A, 0x8337C017F78AE6E5, 0x0C694E161D2CA112,
+0x586F02369228AAD4, 0x00000000E34511F4, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA92675E37C72BA6A, 0x658E0A94E9D4D9A5, 0x06BC9B662F494C1B, 0xDAFE8559BA3E1DF8,
+0x17DE293B06D5A0CA, 0x30C4653A4CFEED84, 0x831EFA5227139E3F, 0x66983B9F2C773A78,
+0xD974A223F1FC227C, 0x00000001F286FB52, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x74F374F2E1C447BE, 0x44C89434120D6D2E, 0xF401B2042193889A, 0xB93371C269702247,
+0x09B397514733E4D3, 0x5E9CD7268F038822, 0x769455DF9C9B2C55, 0xC57D706F2B007BC4,
+0x6489F9013C8A28C4, 0x00000001A7ABFAD0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0D3D423F68601BB5, 0x62DBC05C75294BCA, 0xE621CB241200ECB6, 0x6360EBAC16390DA6,
+0x6D09BC81DF7482B9, 0x553029D80A781149, 0xFE97C185B1AB6C64, 0x1BA7C0E2E1494BA5,
+0xBCB73C88D0504325, 0x000000022EBFB155, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x28B5AF5C88B42E2F, 0x528CB9D9B21CC751, 0x72D66CC56F07FA93, 0xC1210F83201EE242,
+0xA2B0FF2CD2A8CD73, 0x2EB156A00BEF9A19, 0xEAC0CC486B059AD8, 0x508C11D68CBF41F6,
+0x70C3A8C19B6757D0, 0x00000000767264AE, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD60B3DE70231BBB3, 0x8815DBC4E44E3949, 0xC120B9BC6535BE7A, 0x4334403ED19F8D29,
+0x1CC09DEFFE38083B, 0xC6ABB3E63412D855, 0x0C2B7C84855DAB66, 0xF3845B0EEC3E5774,
+0xC033281FBA6EA3DC, 0x000000019DD94F4E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2AA8CD217D15EBA0, 0xA6734DABF1B6BFED, 0x8010A84842280324, 0x104C2556EAF398E5,
+0xEB22B68834B313CC, 0xB72FC59F0938E997, 0x55474993788BA7F5, 0xEA5C0261CA4CDE9E,
+0xD062D592FC4C35BE, 0x0000000138AC993F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1640B030BE2C9659, 0x6AEC0D11CF5F1EA3, 0x9B3A4CA591917194, 0xCDAB2BE379984218,
+0x60FDFB622D58A965, 0x7D2726EB54F84A4B, 0xB43E8F2825188485, 0x667B99853733CEE8,
+0x3E5FCA68AD9A8786, 0x00000002777658F0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0FAFA702C17F1AD7, 0x3587A7ADDD62850F, 0xBFC0D0555338C346, 0x49F0225252A047F3,
+0x4F74BD167BFA5429, 0xA641D121424F4ADD, 0xB6CDAEF01CA76C58, 0xAC997A7260CDDED0,
+0xA8B2BB17E285B7E2, 0x000000002C0A5F1D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC1EF49332ED4D5B1, 0xAEF34A2D8CDA036D, 0x49D8A63D61663C0D, 0x43B856CC72ED457A,
+0xC3149DD7571C3983, 0xAB9A147ECA1AD43B, 0x375F54AAB4E927A2, 0xB3A2D20A4CEC5BFE,
+0x0B25F57ECA606C4C, 0x000000019870E2D2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB3C6DAC8111E90A2, 0x5DCF7654EFF59EFF, 0x738D97792CC55170, 0x37AABEC24B49DCC6,
+0x24AD354793EC4681, 0x5AEA4112D9311455, 0xF70224E23B1D2972, 0xAF696A5CE0A470F1,
+0xD8CA240206B2C51B, 0x00000001EAFE1C98, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8D1C8FE4F6867637, 0xFA789D51B48F1BF6, 0xC08928E058969E6F, 0xCBC918BDA08EDB63,
+0xC89A878DD8541000, 0xB53D62C163FF4AC4, 0x9D341AB5FE82AF48, 0x53862163A2775CE3,
+0x800A3FCD30F3178E, 0x000000003B789A0D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7EB25AB1D54B076F, 0x8B910F9B746725CC, 0xE71BB1C25FA868A0, 0x80189A7087F2DB1F,
+0x4F109A429A6ABF06, 0x90716F37753E733D, 0x9B395424E18F1510, 0xE4F2106B0D76435A,
+0x5CD6D274AE18648E, 0x000000002EB7EE85, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB774D48070927FF4, 0x4AE43F37B5812D1A, 0xD08C33FBB8CE45F1, 0x830B77E63FD61E57,
+0xEC062992ACE8447B, 0x854F8CAF07231F85, 0xD2F5431128A5C947, 0xEE8E35A7E960EA4F,
+0xBBB4E3AC6729931E, 0x0000000207D016AC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD80E7FAC42B09D9D, 0x2C7D6538223E1E4A, 0x751708CD3068606C, 0xDA3BAFF229939A7A,
+0xA6FF40039104F608, 0xFA48B3C328111276, 0xFA3DEC8EE7674A00, 0x05BB096D783F1804,
+0xFAA3AF6E5556ED37, 0x000000026423F45A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1931C8CDA0502086, 0x71AC68AAE6AFD897, 0x3A4819E223911668, 0xE9C7A3BFE34A8289,
+0x2196BE26145CBCF5, 0xB73BE23979D88C8E, 0x3E8AC6A7E3C9FBC3, 0xD1F3890651611B38,
+0x584EDA5C08CE67EA, 0x000000024A764FB7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1BDE1FC5CEA461DF, 0x38AA9222836CDC10, 0x39B4B45BFD01CF89, 0x5C0BCF66F690606A,
+0x9CCFD1A344E1702F, 0x9B374623EF428253, 0x1D856E03DC26B00F, 0xE15277A4CE90D060,
+0x8EE5D12F74BFEB1E, 0x0000000256C4BFDC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x65F7CF1AE3CFBBB0, 0xEA22CDAB452542B0, 0xEB88F3BC9623E803, 0x9DE16B6ABCF79031,
+0x27AEDAC9C43708A2, 0xEAD52F135081B410, 0x15FD3525F66C7977, 0xA9F5394FC1B61FAD,
+0x818B055EB710CAEF, 0x000000001811512D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3E0C904C2E8595E7, 0x68EC6A05B4B84BF0, 0x15F86EAC4634F525, 0x6B829AD93C500767,
+0x966BAD50CB72D2F3, 0x7EA30E2B6505BF7C, 0x163EFDA73417C141, 0xF4F7D5AE5EB2AA5B,
+0x4D11BD696384E0EA, 0x000000017FE2CA02, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x34C134ECD3E9E94B, 0x78EF16CB2A1B8BA4, 0x9DA4FEF217A734CC, 0x23CA49CBEB5AC385,
+0x93E28B5F9F1F5FE4, 0x92805F098568E8EC, 0x75B3BE7DAFC65584, 0x0DB59D3FFDCF3D4B,
+0x74308FB0D59D58A9, 0x0000000085AB5CC1, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3C402D70D580ACEF, 0x72360211C3F6ECA3, 0x5B7711DC0DEE04E8, 0x26117E7625B1690F,
+0x9633DA0E07C1FB84, 0xF875DE9CF501924A, 0xF8AED082CFF2C067, 0x86C2B6F915371B9A,
+0x0080B78687E1788F, 0x00000001DD8A3394, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x31CE119685F3B5A8, 0x321C3A0B7B16006C, 0x2B7E52783BCF2B21, 0x4456D981B006BD5A,
+0xD279E42FE49B53D5, 0xC16F2F3F07F12C80, 0x5B73F9736315C808, 0x6E416EC3697D007C,
+0x361A13D7F057D651, 0x00000002132174A8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCCD6B75C4B85B88E, 0x2F3B24325145C2D2, 0x2301EAACC422FFE6, 0xDB21C4A45CE6401F,
+0x43D73A5EF8A14B18, 0xE0C02084D7E5E8F7, 0x849161618C6B0883, 0xC984AF8438BEB3CC,
+0x0D2CDD3E473E6A36, 0x00000000E5A509F5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3996C32D98A07E90, 0xF13C733AA24C1977, 0xA63EC47AD146EDD5, 0x7A3290DB5499C339,
+0xEE15B17019123440, 0xB052A48A3B5DDDEF, 0xAEE1775B9440C7B5, 0xCEDF2FB9678035B6,
+0x2B499249C3EB960C, 0x000000003533DC33, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC8EAC3C5557EF51B, 0x5C7FE864A19A2716, 0x698047415788CF6A, 0x092CB19554D0DB7E,
+0xF9F81E6D591A558A, 0x577ED877E1BD112D, 0x4065429D4E6D17C0, 0x470090FF255A4D75,
+0x1A13E24B9447088D, 0x00000000094DD559, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC5FA9362FE9DC9CE, 0xB1A77D21FBFFA00B, 0xFFE4536BD2FC0753, 0x0665077786FAAC5E,
+0xBBF3FF865486801B, 0x4471EC01BFA6F402, 0x7632D9D63DA3B3E5, 0x2FCCB5BC6FBA481F,
+0x74E638A129B1D932, 0x000000016B7FB788, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x03AC0819234B51AF, 0x1C93CF27FFF4E0DD, 0xB28897142E35BA04, 0x5912DBF0A8379841,
+0x3CD42ED6EDC4B51F, 0x235712FA4AB5CA18, 0x062849F30776798C, 0x39CB4FBC75B78CBB,
+0x93511E6FAFA597CD, 0x00000001A4EAD6FF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAFE15B130AA9CD22, 0xD3BDAFD5CAFB0F1A, 0xD776856893AE8D7A, 0x33561CB3A8E0A58D,
+0x2170D011BB8B3F8D, 0xB38EAF121E8A04BA, 0x456C710345C48C33, 0x48569F71D0E07355,
+0xCAE873C87D3E525C, 0x00000001CB78F451, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x123BBD20B8DEC616, 0xBAFE58D06F738E99, 0xB8F26E9CCF02D9F2, 0x5C0D032ABE80C623,
+0x3FC33D8B17599717, 0x926CAA0DA7B70390, 0x3B5EB1032AB4B58D, 0xB73CDAB221C06D8C,
+0xB6209244824C1D7A, 0x000000025393A2B2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA985EC14402DF930, 0x187D082BB1F2485F, 0x22CF807FB92106A4, 0x04AEB2B4476D02D3,
+0xBE3B4EEC0B1E8D47, 0x0189DC8FAA5B190E, 0x4FB9D247F3997931, 0x894261957C60A9DB,
+0xE9B786869A2B8EF5, 0x00000000BB7DCA02, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7BA3EF76091FD303, 0xBAFC44C8346E7F35, 0xE234EC0291E3C3F3, 0xAED545D2DF38FD35,
+0x729953A2BCFDBDB7, 0x945F5B014D6F1B81, 0x1E0E36998F70675A, 0x3B4DCBD0514E349F,
+0xE0EBCAAB0183962D, 0x00000001198F921E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5423917BDD1B992F, 0x1494ED40D6A56B97, 0x3D43B1829425E704, 0xC6E51D9E00C2ECBE,
+0xE7041E4DA2279A99, 0xA9307F62257B7F83, 0x695835B370C2723F, 0x553AD70E12B86FB9,
+0xFA4C4198353D1984, 0x000000025D3314F6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x72F8A8E5C72B8931, 0x99F74E651DE3E9E4, 0x48608E5F64C5CCE3, 0xE02CD4FF460462DE,
+0x35719A4C3254BC76, 0x63C819621658B607, 0x0FB960A9C81B103C, 0x76AF0878600D3457,
+0xE4385966311844A3, 0x00000002795E91FB, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1D9606D377358DB9, 0x8A5D03D931E8F18B, 0x55D752238A4044F3, 0x93B7CFF69A8CA10D,
+0x1D68A34ED2E888F5, 0xD90FB6E4D12FFD7E, 0x5988EF7BAF404643, 0x17C5525A8CEA9CCB,
+0x7F88E95FF31F2724, 0x00000001A7EECC59, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x25B65501E32540A8, 0xA41D0D07DC4E2151, 0x246618E06FF2688A, 0x293B769EF63DDB51,
+0xE251D221EEF2E287, 0x9FA946AB17ABC659, 0xFA4A9B2A8124DA71, 0x383CC6BEE94AEBC4,
+0xD62EB1A8CB6B436B, 0x00000000B005CB50, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x78654157C1A78C9B, 0x25DE13F0078B9DC1, 0x4DED147ADF0FB4F4, 0x4555E0B6990FE31B,
+0x6DCEFF8A7DACB6E4, 0x8EB91E241D18BFBA, 0x08DC7B6448924C36, 0xAC319911A0B7FCC6,
+0xDD3F2A666C06C997, 0x0000000255FB449D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6279C55BD49ECEEE, 0xDCC5044E36D6F6FC, 0x4F49C6D356FA6EFD, 0xAB2B333BC5EE85D9,
+0x66BC2815D1E39FEA, 0x2B6B3E32B077385C, 0x3A37367E5BF981C4, 0xB64F4E1BCE9E6D79,
+0x542249DAB2980EDC, 0x00000001C6BFDA76, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x875C859D5E9F820B, 0x2FDA04A1A00DB3E2, 0x0AE9402F6549F65D, 0x54B989000834AAA8,
+0x7444490CF76D958C, 0xA1B3A9B36EFAA363, 0xE7DDB71650C0E2FD, 0xC80609A012EB958E,
+0x74DDAC228930944A, 0x00000002602B8ACD, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x14AFA46B61167BF5, 0x20556E164FC8C4E8, 0x2D741BFC84566FA1, 0x66F957EFBEC86FB1,
+0xAF3AA56F202B9D65, 0xA9102D533D661D95, 0x01F0671F85C22AA3, 0x0C745B75EDA2775C,
+0x766B96B4E3EF5B43, 0x000000018A95372C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDB39A5233DF31B46, 0x02D7D525C9E20A13, 0x97FFC42291578A4B, 0xC5D3180C6BA04A64,
+0x52C4C972D4498BC1, 0xB93F79042D639AF2, 0x5AFFD4EB40211FEF, 0x484A21BBE53D050F,
+0x310AC33A3E0905D4, 0x00000000C57C68A2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x20A91CC04BC6FEBB, 0xA83D03DA90DF5D1B, 0xE21B16C062E7BA4C, 0x98217903A047182D,
+0x56B1CDE09EA2F383, 0x917D00FD25375F18, 0x23348CA7E7D95747, 0x80324AA9DCAB07B3,
+0xF62A0DB4B2AABE10, 0x00000001B53F0EFE, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA57DE60F6649722F, 0x11952DDADB859D2C, 0xB09945766408565B, 0x10788158DBE62774,
+0x22FBE67B99E053FD, 0xE65470C70D787D82, 0x4C7A762103396C77, 0x0B4775B0B3433654,
+0x462E6534214C4A63, 0x00000001A7160464, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3EF26DF47B7A879D, 0xC321E585CAAE26BC, 0x3786ECCAD2C711EE, 0xFED8C6645B725172,
+0xCBEAD4E7FB5683E7, 0xA13028FA7FFF3E84, 0x30847CAACFD923C9, 0x98609407F8A711AC,
+0x51A9151A71C6CA73, 0x0000000160133F5A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x52B2177E5555FB29, 0xC0801028E43FB04E, 0x3946420FFA08AC75, 0x448AE22AE309E067,
+0x7A64F48BA134FE69, 0x24225732E2223B7E, 0x11F292874DD4115E, 0xB6008727C4DC2A09,
+0x3C9358503483D31B, 0x000000015543E610, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x55DE7BF0DBB2C1B0, 0xB35B6C4F805F3FF2, 0xFB8349006A77FF0B, 0xACA807409AC43AFC,
+0x5DBF04A48E5E75A1, 0xF6C8F8252F3C8F3B, 0x40EE7BE00E99C448, 0xCF1B60A4FCDD9E13,
+0x7E8F53A5E71B4C56, 0x000000015FC8B14C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDEE0E6CD059123D6, 0x9F304598AF70390C, 0x9B35C6A74B9F3821, 0x656C47703F739B34,
+0xE156DA700DC32449, 0x86DEE7A9AD55BF2E, 0x2B29C334FA440B24, 0xF1201F6F0078345F,
+0xA75DE04E8E58FDC4, 0x00000001BFCAF11D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x795EFDEBDFFFE306, 0xAA3F2E7DF653C1EB, 0xD26142842D4157A5, 0x35F1594D0F1DCCF7,
+0xE0EAC5863C11923A, 0x22AA317F876F9425, 0x9F2A7B6AE86F693C, 0xBEA480D09C62BDE4,
+0x7B2962D5A9BA0D61, 0x000000002EB63AA8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8D44057EF8B277B9, 0x3EE1A31B1F075852, 0x2534D7B6D135988B, 0x7D1BE429B6E1ABEC,
+0x4FA9EE86ACE393A0, 0xED0657521D952E23, 0x83DD16EC5A26F747, 0x83320DF7D0EB4D45,
+0x02EA4FEBEE1A53A5, 0x0000000000E375B6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3128E0DCDFB7F856, 0x3B952E7CB7A6C065, 0xE107D54D686E9005, 0x153447E218F61198,
+0x7971810EB91FD2DA, 0x00B002C871613B8C, 0x1C9D442FD0977C77, 0x02FD7294A7858007,
+0x6299F50550E96C20, 0x00000001E332A436, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x17D496B06A4C26CE, 0xDFBF9AEB09D81868, 0x372E450F50CF2B4E, 0x406B3C6C5E233626,
+0x6D98C964D67ED9C8, 0xD8F57E6E011F343C, 0xA3ED28061E83FCFD, 0x74B80F3DD65A97CB,
+0x21632D4EB68EB161, 0x0000000216C8CC10, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x47115F693C6D70A1, 0x9EE95514ADFE3357, 0xC9936202FACF7E32, 0x8BB92E6888918D2A,
+0x3136D05B6F3EC36F, 0xA15BE62E676E01C6, 0xC59905E8137362DC, 0xDA99CBA9669AF464,
+0xA25788F64E345A85, 0x00000001497E6F34, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2C6D037C1CEF7E42, 0x512020479BE8DA3B, 0x7DCA979E9CBAA567, 0x0B3538903961D0C5,
+0xD16B60C04D963ABD, 0x48359C9DA6DC6F30, 0x97F4696B28262EF9, 0xA87AD600317B08D7,
+0xC9366884358F1874, 0x000000008A386804, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xABCB7255BF41016E, 0xDB8D8C883DE6F012, 0x8811A56695F7ED50, 0x391852548972689C,
+0x8A13BF4DF223D642, 0x79BB0E0822007102, 0xA8F1DFB23B4800E2, 0x9F919F3ED91EFF60,
+0xED6108250C62DA57, 0x000000016BCAF945, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDE8CAD9FDE3A7241, 0x7CFA25282F927F3E, 0x4230583057264FA6, 0xF7C4C55BE4E225F9,
+0x9121B7E34A951223, 0x8FEF63C4B6B217C8, 0x1AE56078D314466B, 0x8A2B5FFC1619AA8E,
+0x42B6E9D376C3CF9F, 0x000000026D29509D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD30089F3233242A8, 0x1FDBACA3D14AF12C, 0x87E49D9BE8FE3DA4, 0xF2D18D2BE8ACAE5D,
+0x087CF892F0F39C35, 0x7C502B60D0915952, 0x34D4AED317AFBDA5, 0xF2929EAE6FF28779,
+0x77723501A100C6A4, 0x000000011D3418C7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5BE15CB86AD10B2A, 0xA2F29EF7C77169E9, 0x82176C8707B639FB, 0x482E398ED9FC3760,
+0x5054A51C94310ECB, 0xE5B9E4AB4E45FCC2, 0xBFF304D64AA8743C, 0x8C6E7AB83A8F2AB2,
+0xCBBEE0D1FC4E0A30, 0x00000002581836EA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF55820A0773C643F, 0x78FA1A781B82DE35, 0xD41C8860AE33C74E, 0xF8F253F2256B47C8,
+0xA7C18BE437DE0DFA, 0xC1DB9234F1102759, 0x9BAF5574038B446D, 0x60D45A264DA1CD33,
+0xD285AF01591554DC, 0x00000001238DF470, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x86D711FB7F679B7D, 0x0D220C3E2412A2C7, 0x8FCECDFA6C225A66, 0xEFCCD43D4520EAAD,
+0xA332DADE33F53A9D, 0xEF7215E62026A7BD, 0x52648A763E87BE73, 0xEF515006473A7188,
+0x22AE699AF9F0F836, 0x00000001DCCC71C9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD2788F9FCCDDD1C8, 0xD811A7E9AD74A3C5, 0xCC5F18B2E7848EA7, 0x7C9B9F55EC16D776,
+0x0E023C38C8F150B4, 0x597E6552D87E632E, 0xAE98B508C307471D, 0x0FBB93F4C1822F24,
+0x06B342E5DA7A192A, 0x000000016403550F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBE3326EBBE1B9D41, 0xD4652D9C0386ADDA, 0x58A6BFE7328C431F, 0x937E457DD870253D,
+0xA89DF7835F935CAA, 0x21B435097A4FC579, 0x383B8092D6CF919B, 0xEFD8D85B115424C1,
+0x4F19B8A58692F1EB, 0x000000006A4873D8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE4E6FF1FBE4E4C08, 0xE7148F4B17A63CD3, 0x2C32356F6180234F, 0xD46B47D2F9A15FCC,
+0xD346348D59FC558C, 0x0BB73D51B72DB355, 0x1F28E0DA58F74C53, 0x729E08392CC29912,
+0x08604D53C2F83261, 0x00000002158E4C59, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x72A9399FB950BFAE, 0xE9B217364F79C375, 0x9946C83A06DD9AF5, 0xC249A71F1547AF03,
+0xAA75A36189695E21, 0x105DFB219E1DEC7A, 0x1FDB31D6CFC7F9C1, 0xB5A1BE02B77DB45E,
+0x0EABA41B541F022E, 0x0000000103615F8D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x08B6A631E7A1B4E5, 0x357CD28B85377F01, 0x79A95F425806B3E3, 0x9331A0E19D4D90C6,
+0xE90CE23359DCD3DD, 0x5EA621BF66629106, 0x1599E9A2E1DEBC9F, 0xD60794A3D99E7223,
+0x38249BCA0F1C57E2, 0x000000001C994F82, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x13330EE6B1CAE60B, 0x23312FEB0E35FA83, 0xC9A9DC3428299E9D, 0x1C9029A95E3388A5,
+0xBF340D2D10B15559, 0x98C19AAC93A36BDE, 0x84496C919AF5F9DC, 0x408F1278534DBCB7,
+0x691315A50D9B3332, 0x000000026ED081DF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x571E72FADC30232A, 0x8CF92F641BADC1BE, 0xC9B7FB8855504A9A, 0x5126D271A9D422BA,
+0x8BE0BB866AE6F44C, 0x36F547EC76DFCAD4, 0xEFDC836A82F654D4, 0x940DACCCEA548FDA,
+0xF75EB158040118EB, 0x0000000184B3A371, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3E062BB75DFEC2B8, 0x3C953EEB777F5487, 0x9F39E4537D700B16, 0x88FD94C11E3ED09C,
+0xD440A6E1CBFE7910, 0x0A12A0270D532708, 0xBF58B3499B79D94B, 0x3BFDEF06C7028D1D,
+0xBEF0F3B143EE0473, 0x0000000268AE811A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x69012CFB482430C4, 0xBA5A834251764177, 0x47C1E1C2FED158A2, 0x375BEE75113BD313,
+0x39C197737663665E, 0xD473447FD0381D44, 0xBC35D62ABF01857E, 0x2103D588160C103B,
+0x3CB15445CDB2C0AA, 0x000000014520F1CA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7F3150FB8E8747A3, 0xB3C74F9F08BDAF8F, 0xFCC8DE48EA374EF0, 0x8ABFF6DFE0CDDDEF,
+0x684931046D4810B1, 0xF0E4E073FDD9E263, 0x6E2FD7FC68735B5E, 0xE961A3BE47CBDB4C,
+0x2FE42DB0351AC557, 0x0000000251226885, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x89E039836BE8A7A0, 0x0060D92CB40A900D, 0xE6777AD6ED89AE1D, 0xCBAD0DE579C8F193,
+0xBBC6D572A6D8C0C0, 0x732A3A5D8A1B416C, 0x9497BBE226175B62, 0x95FDFB50D516BB01,
+0x3A9D492C50380885, 0x00000001DF44D456, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x706BACBED1BC5076, 0x616DF50D7BE75036, 0x1DB78BECA98E845C, 0xCC7FD98DA3EB5242,
+0xA429DBCCD5CDCC59, 0x6745EA361CC2BCE5, 0xA96E6CD7AB0820E4, 0xCD484E41E2A38B93,
+0x6C4DCBDE7D25EBF6, 0x00000000FB9AAFB2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x414E6FF125C62499, 0xF195736DBCCE3E3A, 0xE514B685498A3D34, 0x9A1E31EAD7CD8FA4,
+0xEF2F6B4B4D704803, 0xCDE432C0E03C4281, 0x23F34FD6231D96BA, 0xCAFD618A5E8DF8D8,
+0xA36AABD360D1CB13, 0x00000000B44168F4, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3A78B66311E70693, 0x13175AC6038F056E, 0x1D3B858B01DE41D0, 0xD229F3D7F4A6D4C0,
+0x0A16C5FBC1535F3E, 0x4FC4F738F68D3ED9, 0x2DD6DDE0E1C57445, 0x75592599FF90053A,
+0xCC2F2B6625B6FB99, 0x00000001EDEA68A8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE59ADA518777E3BC, 0x87A186192F7A76ED, 0x3108869A9DBF094E, 0x8CA19ACA2A68104D,
+0x94E51AB311BF7F1F, 0x16E593BAF6C641AB, 0xE877F9E2E05A1F67, 0xC889C75A4B45BB13,
+0xB0FC81A6FC51DDE0, 0x00000000C1644E42, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3D7B78441014EB35, 0xD377FEEDF3218FBB, 0x2AFE0EB076CA57B7, 0x094BD10A996F141C,
+0x37355559907B9D99, 0x4B74049EE25B64B2, 0x42B95F3BA2F470A1, 0x29D8B8DBC6EC7AB0,
+0x10EE378AF1346287, 0x0000000138B54B17, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF379E5DCE1E6DD72, 0xEFBECCD271BE7013, 0xBBB2115DFFC96258, 0xDB16622FF585B1B8,
+0xB533307542134F25, 0x2EE96F08FBBCD220, 0x589C2C79199912BF, 0xAB86982F6ED4FA8C,
+0xF8CCFBF7EBAED42D, 0x000000012EE9634B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCB88706E3B32F9A8, 0x8D8B3FA22723CA05, 0x6CF5C2E9FFD547D6, 0x754D16C0EE1C84C2,
+0x1535D65062FBC871, 0xA2E81ABC3C1EFA24, 0x3D4AAA059F5ABFB1, 0x24DED977D0559560,
+0xD98204EAFE527C34, 0x000000016A90FB94, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDE833048B9A559BD, 0x27943E30152B0011, 0xF972D6240EB52365, 0x4F217346E20FE326,
+0x3F7D0E839458B98A, 0xFA8505ADFB9BB195, 0x67249562BB0B39F9, 0x613CC1ADF745A947,
+0xBFE7D727F5A04B7E, 0x000000000357BFF3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x89B734F9049D6BBD, 0xE8E31EE932B32529, 0x5422C77DE3F7F78C, 0x5E17B43E2AA02C1A,
+0xB34FEEEDD2D28447, 0xAC8FFC5011E8EC70, 0xFED7E366B55FCF7A, 0xDC8061011045476E,
+0x5189D780152217DE, 0x00000001A6291D3D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBB8BC0E9EF68DBE4, 0x506CEEC404096D94, 0x89E788E2CFD039A6, 0xFE77571F963ED7DD,
+0x3626108CE2D64E36, 0xCF9F0A9812D21043, 0xDBAD58968E12414E, 0x5E1636BF974A6DEB,
+0xAD53AD0865424131, 0x000000008EE57D3B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8AA8258EE4E39EE3, 0xF7B01C7707A793D8, 0x30718F58E7BEC70E, 0xDAC3AFF97471636B,
+0x67140D5CA181696D, 0xD2B093ED9D2FB6FF, 0xA783CC68E98F438E, 0xAD7ED9E6524CB913,
+0x542DA85360AEA8FF, 0x000000003CA366DA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6A0D51A43AA82062, 0xA3033C53F9C34247, 0xF3CDFF9C8C0A8BCB, 0x6FF0F154016AC85E,
+0x94BA1BF126B833FD, 0x9B2A6B0C5DE3B61A, 0xF421FD938BDB3F5F, 0x1B273803D7A37BD5,
+0x1806D3CC2BA7702D, 0x00000001C47D9B34, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4CF6B8CD17D7D1EF, 0xAB5F8C0F6E58318B, 0x19E9CF821B0F80FC, 0xC204FE5D68F679D8,
+0xE6AE59D892DA27B3, 0x5673741ED8A7C228, 0x6EC68262399EEBBE, 0x905DC4256A55D41C,
+0xA16F6400707A18AD, 0x0000000110DF2795, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x79A4E5ECF4745248, 0xE09BD9A5EFD7597F, 0x6C573CFC224FEC42, 0xBA95D61A6374CD63,
+0x25F163811F6A2DA7, 0x4C903AAEDA8918C3, 0x88DE610B02200E0D, 0x6A4C8A82581FA474,
+0xA943E6632E2A519D, 0x00000001F4730A0B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x06D8E7A8CF9460D1, 0x1DCE9B4E1F0A8EF7, 0x59D6713F2AD78128, 0x707775708B686C55,
+0x5467ADCE493BCC71, 0x2CA6A609F50D2F39, 0x612C511C93379D65, 0xFBD9D563CAC7F06A,
+0x8367BB708D68C2D5, 0x00000001165303DC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAA83B429FE7B9800, 0x0A553DC6653629FD, 0xBA5F224E60350C72, 0x022ABA80448F2D19,
+0xA03E723E5E23139D, 0xE7DE9294F75BFD08, 0x2A3D37925B460B19, 0x1009C2F9697C4CBF,
+0x7A1E62A623651C5D, 0x00000000ABC8852F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0CF11B80472D40DC, 0x263D709983818B76, 0x40ABCA0D0DA71BE0, 0x9CA882D7EA9591E7,
+0x2B94AE5A2B4C93E6, 0x2E094BDA6E835456, 0xFB0BA4640159B6A5, 0x04DA66F08D572692,
+0x200C5B483009724B, 0x000000022930AA2A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6DF05BDA7E895257, 0xBD1BAA40A85A1C59, 0xCFD30C0D11B7B8B8, 0x5DA76089638B1C8E,
+0x82A2BA3F2191F4CE, 0xCC229AB842942F61, 0x76E90EDD57CF338E, 0x1AD22108664265FE,
+0xB2350106855CCF8F, 0x00000001CE099405, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0E7503FE02F417C0, 0x60C613A626A0C6DD, 0x25336CDAB28A0C6D, 0x902D0C8CC3A5C9EB,
+0x19A797652DB6E07B, 0xAAB27CD48A6DA116, 0x8DF3DD6E10C9E7F0, 0x22FA7756C290193C,
+0xC5761CA05EA31C51, 0x000000000612A9CB, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3532F9A752762A47, 0x4025DE5BE3F54D06, 0xA68323416F1FD188, 0x65E57B8B843E0D7F,
+0x0E7DDF27FB5ECA08, 0x9EA7E990B6B7F07B, 0x217755E0172D4E33, 0x02B77D403F2D8170,
+0xACBA42DD60BFB837, 0x000000014DBC2048, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC616249453EE24F0, 0x13ADB7D4D04DBBE8, 0x8669AA2C0BC60747, 0x16339A068DEBD3F6,
+0xA7C7FCFED98396B0, 0xD27754A0B457066A, 0x074EF807882DFEC1, 0x38F146E8A048054D,
+0x172BAE738C71985D, 0x000000000F827B39, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x562E08BC6F6BB642, 0x246EF47E35EC08F5, 0xC3F734040224CF07, 0x7579C3045D9726A9,
+0x6FFFD0EE471F5068, 0x34340C5C1045979E, 0xCCBCB504DBD66387, 0x92FF8F34268E3952,
+0x08E6A0D686BC7F1B, 0x00000001A46FDE3B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7C67AB2F9A3C8EDA, 0x84E0518E1166E716, 0xDA6575F426C61387, 0x4F1EC01EB32512AA,
+0x51E04F3C3C840A06, 0x06C3ECB8D9A64FFA, 0xCB8105F64BC3EDC8, 0x604EED277B9B0902,
+0x897D4671F2D270EB, 0x00000000F3A256B5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA14E319E1DD584B9, 0x1B384E3E43A0CC02, 0x680A3558C1C9D78C, 0xDEEAFFA05BD50A5E,
+0x7EAE72879A532D4E, 0x0C5D7142455A7A0F, 0x0919754790F9AEC0, 0x54DE77FD0275299F,
+0x747E22E1DC716651, 0x000000025FD78CC6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA0B97424CDC042AB, 0x45651D9BE007EE25, 0x3BBD0CA3B76CD696, 0x78A8174B3E98450B,
+0x108639336A3EC5CE, 0xA5F187D3943BB310, 0xB74ED8A472D7675F, 0x74A20C3CFF9D5849,
+0x7814201735E2B516, 0x000000015034C06F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x944B06E27CE0D262, 0x2B4F394112B92B0D, 0x29561FDE1E54A260, 0xE649969751416E43,
+0x02C6BD60ED457D7F, 0x6F962727E5AC5DDB, 0x9E5CB48855543D0B, 0x0F86E50D6230FB01,
+0xA310B17C68A1AC0C, 0x00000002759927A3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2EDE93246FFCDD11, 0xB58333CC0EF6D542, 0x197BBF397795BB8A, 0x53AD320DB6913FBF,
+0x7E7CE26A0E328CBC, 0x43B334439A06E4D7, 0xF0A6478167197127, 0x860542EBD345BF62,
+0x99E748F4EE41693B, 0x0000000118FD2BC9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4852C6E6BC26E00F, 0x207C9EC61F834001, 0xB4448E36141D7899, 0x81BBBE94FDF57481,
+0x697806E1F31DA7DD, 0xFF1C3C52AF5B4BF9, 0x433F57FBB784D9F7, 0x079BEE9D77C90A65,
+0xD315579F29F006BC, 0x000000024CFECA05, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x999DFA3767F3DF29, 0x122C9FD7B6307802, 0x674F67142CD76EC8, 0xC28396E1FF45E9FA,
+0xF7FCB50DDDE69AA8, 0xFA148EFDC2911DEF, 0xD1D618EF6DF5D563, 0xD1182F77418DDE20,
+0x6ABD07FC4D74A490, 0x00000001C6AB3058, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD6A2D0618F0BB471, 0x4BA4F812AA22D923, 0x23F45A04D0D97276, 0xC24CC05A9552423C,
+0x5B95C5F7862CC7B5, 0x93EE82EFDB705512, 0xE3624A246F7686CC, 0xABEFCEB3BB4E4581,
+0xAF27A8076273E017, 0x0000000210BC1B7E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2E273270500FEAB7, 0x71078530FA84DB5D, 0x91D89E3CA53C711E, 0xA8221757BDD71444,
+0xA71715EB77684AA6, 0x6426313E3635B388, 0x0BCA729BC70E17F6, 0x25519190DF5BE4D9,
+0x69EDE1E3D8DBB1F1, 0x00000001ED470A29, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEACEDCC3F2570A40, 0x472F91762C0F6194, 0xB5C7847B1C8CF5FC, 0x130A1A9417248EF0,
+0x41D137293A24DF19, 0x73E8CCF99EE81765, 0x1723141438378C32, 0x662CF2281A8F0262,
+0xF6CFDA6A53107D2E, 0x000000022C14E8A4, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x79998CB541640AEF, 0x0E03798C28FED25F, 0xA024CA543A83F5DE, 0x5D87E9B76D9DA6BB,
+0x5EE6CC8E8A27366A, 0x2BE4CADAF78B1547, 0xDA3DC80405AA9B3A, 0x22447D4B09368BD0,
+0xD6A78E125D0BE28A, 0x000000013EDC0B87, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x88FB45669553A233, 0x50A74A8DF50ABEBA, 0xFC74DD75EE2235C1, 0x167261E85DA665BB,
+0x69C663664640C0E5, 0xE89D4138F22CC79E, 0xE68E9DE0E55993F6, 0x961ABCA2ACE81E35,
+0xB5302AAF36E0CB85, 0x000000006531641A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1CA848A250557CEE, 0x49A992356F7EA735, 0xAD48E5B1426CCDEF, 0xAF15217D67522922,
+0xDF8FCEE0FAF81BE8, 0x0A934B9F13FB09C8, 0x9AAA351A764760AD, 0xE7E2DA8C7C81BDAB,
+0xF4ECEE44EFD1D799, 0x00000001F940A3CF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2220EE69364FC196, 0x377E43D3BBF5871F, 0xCF22350DB92127CC, 0xEB5394F74622ED4B,
+0x59D709EA5401FBBA, 0x12D98E30A8B134CD, 0xE79768B7528E4962, 0x7B823D2E84E130C6,
+0x876231735AF4DF44, 0x000000007C87AF55, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF7A5CA1A461ECD49, 0x6CE81BC4B0A56E39, 0x75746F35FB6F514E, 0x31E9027740D745A6,
+0x74976D28BE46D103, 0xFB2378407EC432D2, 0x03EE9D8FF4B61ADE, 0x629CB882AE62AC8D,
+0x8ACC48544E39B4E5, 0x000000000993AF11, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1E815EF41D295FB5, 0xDE29CD8679E9BD8C, 0x10E5884733255A48, 0x05B1A23DEF002085,
+0xF8B2A5466C9F44A2, 0x90930510BCA5A41A, 0x09794BD893DC1706, 0x56657C6CA1CF58BF,
+0x026817C2328C5073, 0x0000000234204CBA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x33F0DBEC8F4A7E7D, 0xA0DF11032E7931E2, 0xFBA8C030758C60A9, 0xA43683B91D675432,
+0xC698F037C4844039, 0x53E8617C2BF1DF69, 0x838DEF165721E41F, 0x70EE3846A16307D7,
+0x0333B8B1E3CEE453, 0x0000000221E70D63, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x993C570D7D8EF58F, 0x94AEEDFD640DCB84, 0x9E1FCB8F9B66EFA6, 0xF53C89EEFD140DD1,
+0x5A9C2A301C8C8E82, 0x75A31F5E568DEBBB, 0x622F451E5447B6FF, 0x23C8B97D35058C09,
+0x8E80F1DCDAE46DFB, 0x00000001544E9CD6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x05FDE735E13578ED, 0x5D5DDD6EF5AD3C5A, 0xF99BC4D6D6730284, 0xB78FD27FFF8A71DB,
+0x3D399042AF31FFC1, 0xBF1F532EFBC41291, 0x5A9673E290814D57, 0x5B80EE0F3E48FBA2,
+0x9971A363C24A017D, 0x0000000250166870, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE36BCE1B4ED7A3ED, 0x7367FFBBE6CE09C7, 0x38CBA30A8BC9274F, 0xA954484B7BFF64EB,
+0xB7F70F4B37195E12, 0x46CA2221CCF10E2B, 0xA87A8B2B1DE7805F, 0x3ACEAD21A6485D77,
+0x7D8E6645CF7189E6, 0x000000012633BB18, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2D8673F802AD2A6F, 0xDCFF04624B5DFCA8, 0x151956BDD592343A, 0x2A05447B2B8F20EF,
+0x6FAFAB7893F13CB2, 0x0E25F56F35B6CE9D, 0x7551669C4175AC18, 0x9C0B046BC8E3B07E,
+0x015B4FBC27EB58DB, 0x000000011FBA4F9B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA62E82142908445A, 0x55E2C3BD55F7FCB7, 0x3FB3F11985154206, 0x79887851C465C79A,
+0x42E17D5F24188158, 0x6D9290A6216EA01F, 0x128061DB7A6F6D94, 0x7114CE73E50C620D,
+0xAFBB4F096E3D2A68, 0x000000015799EBA8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x72694407B632CB2C, 0x8104F157EB9EC165, 0x41075E84432DAD3B, 0x8DB04845C4E2C490,
+0xB6D21857D5F98F65, 0xA038EF82D98499F1, 0x28D9C9D6B6376496, 0x230502DC875FF33B,
+0x9B48D9CB3020C5E5, 0x000000018557DFBD, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x81DE1350C5579A92, 0x8885FB82B2A15B19, 0x53202B71EDF43A04, 0xC76873DDE578BC61,
+0x4038BCE10A71EBE6, 0x8F2B2C31D6074E34, 0x65B26F854B40B792, 0x0147101DA17441AB,
+0x54781251577F5C0F, 0x000000016F039B23, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1237C96DBB2F20C2, 0xB9F0FABC33875C12, 0xCA592C0A7B08FF4F, 0x6CF10EDFA4523AC4,
+0xE05B72E4EC8EC377, 0x9D20ACAE59612872, 0xBE3B190DE1EF0A79, 0x12018C6537FC0421,
+0x14DDB5500866BC11, 0x0000000185A8DA0E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x98C638E30780CF31, 0xFE0C64662B1F2B32, 0x246A8978E60466AF, 0x3BEE193887456F94,
+0xC2548BEC3BA9D703, 0x6D68329E2C1DBA1C, 0xA9E30165CB98A5F5, 0x579B2D732328CE16,
+0x40DBD79F3A097EE3, 0x000000009F7601EA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x03B3B3537D5A7785, 0xB3A07C01D3D564AF, 0xD9E279A6D982D45C, 0x59BA9FB2C62D9BB8,
+0xE12BED50D743CCD0, 0xACE45AB3A54EC5D0, 0x6949B9EDA286E1BA, 0xC118CAC511E07CEA,
+0x994C6D38334AEB39, 0x00000001FDCCC205, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD5B406075CC41965, 0x6F53EB1BB4164EB6, 0x28183192ED062F8B, 0x967ED1BC677EAAFE,
+0x65D90E47F0E24FDA, 0x768668EAC2CFB629, 0x08F3E95B309CB6ED, 0xE7BCE2DFED6AC05E,
+0xBCACE7244CF79A1C, 0x000000019F57D44D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2A0EDFED9DAE6D11, 0x54523077A091EBCA, 0x79A95A0A6FE9FDEF, 0x44780E24067F402B,
+0xAD132C8FEE90EEEF, 0x0B81BB4746B4F4A0, 0x8713EF4F3B52BBA8, 0x4854903F36EE27CA,
+0x4690D024BBCB1799, 0x000000026B02ABE1, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA42A84922BD26817, 0xFA0F9D21141017D3, 0x44384D4B18B300B4, 0x1DB6C0CADA990BB7,
+0x9E91E42CD962DDFB, 0x19F9A7610B6A8892, 0xDD8BC16D1B98625D, 0xDE6ED669034C8728,
+0xA7320A893ED0D9DA, 0x00000001D96DD222, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB74D429541418FAB, 0xD8F1DFF378718C83, 0x061400EB0A491380, 0xE43CD7E8EC9E379D,
+0x21C5EEE3A7986B71, 0x92F2762129811324, 0xE8C26A5331BB95AD, 0xD278687063F82ED2,
+0x6D1A3133160CB446, 0x00000001650E089A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9B9E6770C2497494, 0x4F060A0741984461, 0x92C97C45C430DEA6, 0x6AB182408B2D3D8F,
+0xF6CE4D89C1CDA90F, 0xC18BAA85B5F9B096, 0x465E069E84750B58, 0x3C5419AB12E0E1D5,
+0x67C22CA964EB1CCE, 0x00000001F2FFD565, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8D120F85C7A93147, 0xF8824E4706B1EF96, 0x7FF20E0D3151B561, 0x338EA73BF880D284,
+0xE861B70605AF750D, 0xFFFA5C054734955B, 0x28DE63B6294211ED, 0x97C3EC7BEE30D30B,
+0xE0FA2883A1692414, 0x00000002010D7D05, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2C1AD034F0880301, 0x0A5ADD7E255DC8BE, 0x565383448D1A8D68, 0x540D24F72D128744,
+0xC04CB5150090C884, 0xC62A6D538BC6B750, 0xADAE9466165A59B0, 0xA65AA7740FC9C115,
+0x3BE733E79042ED54, 0x00000001C555472A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5AE6C21FE5766AA0, 0xFD7173ED72CC5233, 0x18EEB5B73CEB7AEF, 0xE5308A45417D21D8,
+0x1C91F8DDE05BBFF7, 0x0045339F610B8243, 0xA82CEF222EF37664, 0x1BE3C6F8DB18CD34,
+0xF7C3B53CA3731962, 0x00000001B93921FC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDA828F832E9C6A8A, 0x09CDAA47E030B13A, 0xC39CE6784177DC4E, 0x624326774C7E0633,
+0x41D1252590F2D7DA, 0xBA66D9262F0C9115, 0x03FFE4C9296C9102, 0x219A0BA2AC4A079D,
+0x6D60F3788B218D18, 0x00000002219E1C39, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x56263D4CD088EB0B, 0x9F2911F5CAFCB525, 0x40E2FD434E764B25, 0x3FC97722C8467737,
+0xD66FB1F5F5A99881, 0x7A79C43EF06C7D66, 0x7989B9F2A21E7857, 0x26A881D05D86F59B,
+0x504DEB6E3A027028, 0x000000018D94FED8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x06D2F0F980D30CF5, 0x8EBD9B780E724DA0, 0x462CD82CD5A57B54, 0xF4680306C82C4EB8,
+0xD34C89587DE4C135, 0xF54ECA2F93043301, 0x2EDE6BD8E6C00A79, 0xAA42902516AC0838,
+0xFE303A1BED27C6A4, 0x000000010F17D821, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0428B98FE3A8DAEE, 0xDD890059B124CF5D, 0x806B9DF3509051DC, 0x93BA96242AE50C10,
+0xEA036FF43A310F15, 0x968EB13651B8AE29, 0xC038BF213DA62324, 0xE9370807A191FA16,
+0x26812EF2A31475EB, 0x0000000031F25CB8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9574C7D601229D64, 0x6BE3A6E1B05391AE, 0x81A39CBA78B57282, 0x25B56A46778E9FBC,
+0xC2EE7427BAD953BD, 0xB8679E74E39E9CB2, 0x1DED20733D64E817, 0xC5C3C6227AC4F8D1,
+0x60876E8FCC2F9546, 0x00000000C6299D44, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3CCD22FEF36D30DB, 0x486679E055A35F03, 0x2DA75B896E5ACD00, 0x570AB320E567A8EF,
+0x9FBA062DD81CF261, 0xDEC06D9D6E49A1E6, 0x1A03550625C35AB6, 0x1FF26FFEF605D616,
+0xCF0E1E8939574B2D, 0x0000000047B184BD, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x63E00E6CCEDBCE2A, 0xB5AB8940D649508C, 0xD09317FE70D090D4, 0x81F03A5B14AE84F9,
+0x0D76658C247E3AD6, 0x1D614B0108BB07A3, 0x708E06FF08D58C61, 0x2AF0B5AF5389C8F5,
+0xB900A80D64BB61A9, 0x00000000AEB16E2A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x983EB8BECB1BBEA0, 0x8380EE4F0362AE47, 0xA46C97D002C15D4F, 0x631B3B385DE6540D,
+0xD0DEB11CCB5E9F6D, 0xB7626686C891CF97, 0x37B1D3227C94CA9B, 0x3F14AC459A07E13D,
+0x1D15D29D1EAB322B, 0x00000000141A644B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x314BB8C31B917A50, 0x9076587DE5DA08FF, 0xBAEBF74905BB1497, 0x130D73F271DC2727,
+0xC72C1F9BEE61B333, 0x4C545FBC3227652C, 0xE4AA04E07AC8FBF7, 0x3AFA7CD76CC988F3,
+0x70B826D0C64C7C66, 0x00000001EDC6E084, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCF87EF030D2A7466, 0x066FCDEEE07671C2, 0x645154C84FDED670, 0x99E93F876AA89ADB,
+0x459F55D0AB08BE3D, 0xF0FCF6F9F8B1A503, 0x9601F6378491970F, 0x091A3C057EB6AB9C,
+0x177FCCA57230563C, 0x000000008B3D96B5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8720B8E1FDAB96A1, 0x4E093F9E8C99C35B, 0x109C988A45D7D7D7, 0x89C12F99FCF5B167,
+0x5941AC56E29500FE, 0xCC546A259FCDAA4C, 0xAED7B11A1D3B797E, 0xF780C2A2B5C762D8,
+0xFB388E7D21789BEE, 0x00000001089919A6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE79DEA79711C11BE, 0x880DC2A7B9F66DAC, 0x7CE62758C5256EB8, 0xBFD0A245137E3FFC,
+0xC542543C72FB2468, 0x9F2FEB7D30C7E264, 0x114C39AD1FF7DADF, 0xACBE6E909DD084F4,
+0x0CB8FBD2845B8B9E, 0x00000000AFD59B63, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8A0A58CAD7410E88, 0x29069A518D58D16D, 0x7D45F08F7FCEAB3B, 0xB5CB16311C128A48,
+0x55ABFBCCDE03ED19, 0x9935414DA6645ECE, 0xFE649B150D88C141, 0x44A7CFD058A238F3,
+0xAF7EAE716B0836F0, 0x000000006A2E834F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFE5CF171DD1C9132, 0x00227DA7ACFC0E7E, 0x9399B48F4EC8ECE2, 0x72864078040FB04E,
+0x5784CC8CCD62EF79, 0xA91F856ECAA018A6, 0x4DBD093FAF1B25B2, 0x90CD5E891FAEE1AE,
+0xBB5B1324ABA4F430, 0x0000000083199913, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB8560C7DFC3D7D45, 0x7EF5F7ECE14108AA, 0xBBAE98E1679FA778, 0xEF42E23097779D43,
+0xCB392AF151AF659B, 0x0E11CBB082B0166A, 0xCE2705E7C0BD09CF, 0xB1F20433296EBA0B,
+0xBD567DF969265DCA, 0x00000001D0DFC609, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE2B51D42FA7B1638, 0x83C2C7AD271AA35C, 0xB2A0F17C6BEC1128, 0x9574AABDBF691F4C,
+0x23906528548C6F9A, 0xBB9C0C70F5D61951, 0x065A8583286321DB, 0xA27DED8A1E75DBDE,
+0x9DAA47AB8A73C182, 0x00000000C2BFE0BD, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x93ED0E048FDD6FCA, 0x8833A2D7E7A4A063, 0xD4F909643B247C3C, 0x44D1EE62D085E8D6,
+0x45E7FC80EBD286C9, 0x3EFBF7824C6E4CF0, 0x0B093872A084EECB, 0x9978AC9ED8403DE3,
+0xC6A949DB6EAF7E8E, 0x000000013B15C36A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7A7FCDCDA0C0446E, 0x1FFDB61C78BFBF8C, 0x7F9ECAF8CF60E0BC, 0xFA943434F5E1CC57,
+0x4ABB9BC796A2E336, 0x781578AD18C8D467, 0x16D774DA6B3BF5A7, 0x551F2C297B2644CB,
+0x69344132A7B53E66, 0x000000020D453DAC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2B9E3C2BBC6B5635, 0x6A87BB492BD41648, 0xEF940E097B9D7EE6, 0xEB942C6A3B2E3400,
+0x345E3CAA96F2178A, 0x20BEC89066E85693, 0xB1CE6A3EE4F2DBCF, 0x4725CBAD8CE80627,
+0x3C8171ACEEDFAA80, 0x0000000110809745, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBFC6DEF1B5FA569D, 0xC4B21BD5FC11EFE1, 0x301CF4A219B14341, 0x96982E21EB16DC7D,
+0xE61994EB2768B101, 0xBA5143B7F024EEAA, 0xE75684ECC47CE77C, 0x4E2900382F921ECF,
+0xB109BFE86C35E31A, 0x00000001554FF9FB, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0E13538A0CE7E52D, 0x325B160A9E508009, 0xADF4E43EB8089B93, 0xA29D0EC59E19120F,
+0x9711F717E3888B2D, 0x1AD7806FB0D69CA5, 0x0DDC443E409C286A, 0xB8A0C5174AF3B204,
+0xD58BDCCAA237AB4D, 0x00000001BAE600DA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x97899748D2DB4DFF, 0x4BDB79A099351068, 0xE9B6400CAAF70AA2, 0xE0281E8D809A67E7,
+0x8B44D5A4C3D1E8A7, 0x4463829757C04201, 0xB8DC974370F83B21, 0x06817A6C88056022,
+0x9D21D1E23CA9791E, 0x00000000D2D99C53, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x52A6AC2083C74311, 0x6BFF0F7F5CFB5B31, 0x721780973E163253, 0xE8A8ACA5FB15E3C9,
+0x34B5557E574AE911, 0x92E4DBB2FAFBA0C5, 0x072CDF5DD1E546F2, 0xCAA156AED8B6A0A1,
+0x0C4BA0B2FB752A01, 0x00000002106355C2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x33396ABF03ACDF98, 0x7B1B0AAC74D953E4, 0x9B045E25BB0D5AE6, 0xADCA9A3C026B1350,
+0xC70547EEC883DB73, 0x8B2C62D5635236E2, 0x11B4787CD1E4773D, 0xFC78B688A80B0772,
+0xD46996056146CA19, 0x00000000C6987506, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE2EFD1B2BAD7A12B, 0x4487A63EB7000A21, 0xB11EB8DBD99535AE, 0x99A82A5D678CD882,
+0x126D97D1F815387A, 0x18B296D1F6EE6162, 0x6C1035A4E35AC06A, 0xEA1DB61104A2F7AC,
+0x1FE5D6EB4772D94A, 0x0000000274C12C7B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x15750476590BA030, 0x4D193FEF1AEF3CB6, 0x28BED5C0F0CF29A7, 0x9CA6205363C22BF8,
+0xAD0197AE1CF6805F, 0xAD09A981A97DD95F, 0x71AA1DED3CFD8B5C, 0xF217D77B08F02F73,
+0xF1D23E99865549D1, 0x000000003D4EBA0D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x91EAF89BAE70F4F3, 0xEC35E0742DE3227E, 0x6388FE613697C4C1, 0x862B66263466B314,
+0xF817AF296214FB61, 0xC44543AE5461D19F, 0xE609673397FA633D, 0x27ACC345E85CDE7F,
+0x3EF9270E5AAE060B, 0x00000001951AE660, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x790E8BE158D9C2BA, 0xE09AE53668B1821E, 0x03CDEB43A14C39EF, 0xCBF2E20561B74D95,
+0x321B77882386D84E, 0xC2B1F14C5408F3CC, 0xE6F3E5557AF3FB84, 0x6E064DA3EC27C50B,
+0xE60C56964D577743, 0x00000000CCE264A2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD1F02385FC64C72C, 0x9E7A144FFE08C7DA, 0x92366FE7D7A9BC73, 0x67663249CACBB91C,
+0x4AEF94152C6C0170, 0xFFFD14F3BCF26D04, 0xCBAE4050993B87DE, 0x4C7E1BE501C52301,
+0x21D398DF6B114F25, 0x00000002004307B3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF9550CD02BF651F2, 0x19FCFB5AC4023B07, 0x49824A8F3B70CA2A, 0xE4CF5BAB9F0DE70E,
+0xB27E237E3880A461, 0x98F5F1B5774B1AAD, 0x116A67CE58BD9843, 0x399F1EAFFF2F7B3A,
+0x14E272AB55B2CE38, 0x00000001C2AA2B79, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF51250C70EFFA47F, 0x55CE7B230F6DEB13, 0x24D68F8A802F43C2, 0x61A44874D6F13171,
+0x1F3D6A7E54C9B3F6, 0xBE2077BFE6602947, 0x3652EF4AF11AF6C3, 0x4217A8100DCC49B0,
+0x49AB6E92BF0DCE05, 0x00000001E8C40CD5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x96002C7F65130D01, 0x1BA13A1FC6E18B34, 0x8BFA4C3CB41B9E8B, 0x1B4EF546C4238D88,
+0xCD9CD123E08E36BB, 0xD5A8F2B41058AB5F, 0x8D5F8C566B024600, 0x843354FB723C40C7,
+0x0AC4CA59AA2E77AC, 0x00000001FEAB2811, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB96ED686918055EF, 0x83FF4C878E74AC24, 0x07532D455E653620, 0xDF4D45AFFE29F83E,
+0x2C51258CC296361D, 0xE5C7F04F2762C0A4, 0x8F7DF8AEF5B24AFB, 0xD947D0C4B2DF7BE1,
+0x9B7E9907DC5D1AC8, 0x00000000DDA2919C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5256BCCA11695868, 0x41B8D45F402D5059, 0x5372754EE49AAFB7, 0x4F19A3CD8E264AA8,
+0x35FF688BB60AC2DD, 0x1C7DAFFA84CA5372, 0x0C7C00E7A10687E1, 0xE6628F1A68644EF2,
+0xF6753B154D5F5986, 0x000000002E9A10AA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE36735EBD1E3BB12, 0x0A6318340C137F7C, 0x32DDD0A7FEFA0EFA, 0x8FFF02C03F11DAE9,
+0x5940EEC013AB7DB7, 0xBA73C89B37551B40, 0x1163E635134DE51D, 0xFFD873403B1923A2,
+0x779AC4183958959F, 0x0000000196AB3853, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE1851264352E0C09, 0x865FAF7770A3C3AC, 0x44335900B29935E3, 0xDFAC7B703C87E00E,
+0x54CF9969255CCA3C, 0xE084076D213BD22F, 0x3BC3CCD86EED2D48, 0xACFAF2FE5ED44537,
+0x0611BB81ED5D1E5E, 0x000000002CDD0727, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x29FADF167E7AB3B8, 0x66C5A64D201341DC, 0x7DDDE25A606A4F43, 0x075D76737D7153B9,
+0x4D093B5329B9311C, 0x7C87C496598B81BF, 0x77578F3E86EE7B0B, 0x3E3FE0784EF42234,
+0x6EA0B8B9190C0F9B, 0x00000001395C2CE3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA8D8E0F3127E6277, 0x52CFC561AD0CC649, 0x25F90F7DD92D6358, 0x38D540E1850A9CB4,
+0x2AEA31D08919900C, 0x95AA4CAD7D6D89C3, 0x5B358268D0A97F79, 0xC31F9FDC9220460F,
+0x3E365B68C19BFF35, 0x00000001B16BA90A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEEFA1E6572307A16, 0x4374C345FFDA8C8B, 0x62FA3B244DE1ECE1, 0x9A01F5604153E2C6,
+0x2F53ED911FF8D7D0, 0x0FAA9ED8FF03CA88, 0xB0B554E378EE2161, 0x7AA3D6AEFF6CC26A,
+0x3F337B21C9762A7C, 0x000000006F7C4E67, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC840316D111588D8, 0xE8C7688A5E064538, 0x49FA91233CB949F4, 0x892C8544A917226E,
+0x11485521D7C71EBA, 0x01D5BF51F26BA800, 0x280D6BF53A4E0ADC, 0xE13D84A1426F0356,
+0x31D117D16118513F, 0x0000000210670FBB, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6FE851DEC097EC9D, 0x13B4E1B9EB7F858B, 0x1F9376EC6284D7A0, 0x5C6583261B794D07,
+0x43A190170F6BED14, 0xC5E6755EA32B4BA2, 0x26BECB701398E88B, 0xEB5536BBE29F30A2,
+0xADD3EC204677D538, 0x000000016BBB2C87, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF109FA8B03E164FA, 0xB5122E99F751A36D, 0x50CB64709A59C710, 0x9853E24772980799,
+0x6B3F09B2E2849F21, 0x8A4DB5E7F18A0E33, 0xF4C73F5ED93B7EA6, 0xD0CB837C349E9CF3,
+0xAEE95D68E711F16F, 0x000000014A3DD6E0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7AECC8821ED75403, 0xD1CEC6621F240688, 0xF455848D4E13EA26, 0xB56A52479998E2AD,
+0x2F447D005678D89C, 0x2E0D25AB6828B574, 0x6876B56227D3FB36, 0x6E0FD0CF68936154,
+0x09CC3F616E348028, 0x00000000E2766C08, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF7B04EFACB1E2E59, 0xD1128E5F3FED0AF7, 0x5E0CE2BA26F871F0, 0xD139E37A7CE785F5,
+0x0358A6599774C2CA, 0x8E6DE7DE8E4EC77A, 0x0ABE93884F2B96B3, 0xEB8311C87A62F5ED,
+0xCA51F0E90CF5FC96, 0x000000011DD31767, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA95370253E1F6E54, 0xA6FD29D04CEC6D87, 0x240AED21F0EBF971, 0x0BF311B1F10AD195,
+0x0E8B56B9ED6DAC1E, 0xEA0FD27DCF7EC183, 0xFC3070B201B229FD, 0xF2E4F965256DA409,
+0x1694A0EC420FE25B, 0x000000005F669DE0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x09B603E872662ACB, 0xA8F25C14035D4A16, 0x48D1F546ED03006F, 0x55E082D87632104B,
+0x2055BBC8EF5B20FF, 0x6BD90C33BFD15896, 0x5ED3EEFF36CBB649, 0xD7E48EBB7507D1E5,
+0xCD2F3E3FF752FD15, 0x00000001A4022278, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x481FF49C738AA300, 0xC2C56B6CBB1F043C, 0xA2F1B7FFE4F36C2A, 0x54EF722AB4CDFE5C,
+0x2A2192224F41B208, 0xC8EF6ACE0E177E3F, 0x8D72B32857EADE87, 0xE3C5D09D2775B48E,
+0xE789A4CE91171473, 0x0000000233D72E0A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD4388E7CB0646F83, 0x918685DCB2CCB470, 0xADAF3946DE3AB538, 0x0ACFFC5398781D01,
+0xB7B06E10B3B26EA4, 0x55DF402B6F566A06, 0x4FDC8C05C39F1B18, 0xCEB4CCC05BCCD9B5,
+0x5E3C34BD658CFC29, 0x00000001A109A7C3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6657ACB08BC2B169, 0xB635E277C5774E5B, 0x9B22957E63915584, 0x4AD059229349B122,
+0x506ED0790B435B5D, 0xCEF743D2E6A3C94B, 0x0254566F108B9548, 0x97EF4AAEE0D965D1,
+0x7CC343B9CB52A5B8, 0x00000001486065F7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB984296E242F7484, 0x471F27E57A3544EA, 0x406B0198CD47EEDD, 0x124B64A213CF1B78,
+0x540D1BC5360E7741, 0xCB559E16C7AA2591, 0x12FD1C4284FA4F6D, 0xB7D7C4BADA35D2FC,
+0x7B2E43DA29862CB8, 0x00000000E85668E7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0344F508D1EF1654, 0x4DB2466355612E71, 0xA3887B5EFE979F03, 0x0C621FA4A5C846E4,
+0x559EAEB698946646, 0x21958C43991813E0, 0x8FB5A4CBA99FAF66, 0xB02847D0B9D5260F,
+0x8787D2C94AFBBC20, 0x00000001EC331460, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5EA05C1FD67934C4, 0x38F8F6CCC6F8B541, 0x2FE56B5931A0C6F1, 0x96128A966BAD3CAA,
+0x5B980398A0297279, 0x979F6ADE5BB5C7D4, 0x0460F5D5B141AA2B, 0xCA6E527B2E53C0E9,
+0xD474777756886726, 0x00000001D6B99278, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x27E9CDF65E36EC48, 0x3EBF6EA50D1A9F4B, 0xE7DCF27C3DFED1DC, 0x5D6574C21A108C7F,
+0x72E95D55BEFABCCB, 0xB875AD59895F4F34, 0x1387DDF6A3CD620F, 0x61E38BBB2BDC6590,
+0xEB761CC31356A5FB, 0x0000000136E926C6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5C39DB56AEBF508D, 0xB053D601E92C7816, 0xD0C90B16E3F57AD6, 0x6043C33FDC100699,
+0x04CE19F6FFA2F89E, 0xC715113BABE125CD, 0x228C06484FFC7ED5, 0xA758EBE353E3322A,
+0xF755155BF2385842, 0x00000001AA1B3657, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x325585EAE2535342, 0xB33C756B795730AF, 0xB444E3A447416A16, 0xD6271B9A11AF3264,
+0x12823A3FCDD3214A, 0x09C1C17AAFCBA2DE, 0x26B174171CAAAC22, 0x85FF61C089682D46,
+0x877A5C8714C6FBF3, 0x00000001772A3EA7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x572BBB57B93AC1D4, 0x2646FEE34CF69B91, 0x2080B00CBF542787, 0xB6062F612DB22589,
+0xF2F3E404C6354655, 0xD173EE1D9E5A2061, 0xF6E3B3FEBDD6169F, 0xC5B7A6AC8E7E4212,
+0xBA853C29C6CD9E85, 0x000000005D83CD9C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE4B0039BEA2E71C5, 0xB0BFBC0EEFEAC205, 0x71E3E3D8F81BC335, 0xDDC78CE5513925A6,
+0xC2120589FEB5BB30, 0x3FC2596EF513C788, 0x78DD9BB4D0C16C0C, 0x7E6A16C87DACE121,
+0x1B88F0BB14B441B9, 0x00000001B68EAB7A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3AB14D2C26997F28, 0xAE2DC828B3568515, 0x420AB7350BDB15DD, 0xBB128AE35AA69EB2,
+0x8CFB12A7085219A1, 0x58B9E403BFEB93C2, 0xACF4075782C8D9D0, 0xCF3015AB82821759,
+0xEFEC22981EA2BC98, 0x0000000054E9EAAD, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2ABFEC6C0D94693B, 0xABD9EB6F1CE1619B, 0xF2959E2F7D7D456F, 0xA5D11F4B26B4366A,
+0x37D79B6B4F68A7D5, 0x0249E438DF2139D4, 0xB1177B8955786806, 0xC50F73DD86A93AB5,
+0xBF47D80447B351CD, 0x00000000BA1D196F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2BE326265D5E97CB, 0x638712B7BF460538, 0x3A6ED25A9B380901, 0x2D22F1F97A195A9A,
+0xBDADC31C36455792, 0xF46254A4D826A49E, 0x2ED0B0756953B66C, 0xC0594F6C7D59CB58,
+0x3D243015E7ACC900, 0x000000002563AA33, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE74D7814C6E817B0, 0x3B4ABE10A98723F9, 0xE4E5D5973DB1593C, 0x69A7064BED6436C3,
+0x9E3EDC44A9260E7B, 0xA08182CDB00FA47D, 0x37188B3BC0EB35FF, 0xFC5594D26C0836E9,
+0x684C884554F93907, 0x00000000B5DCE40D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB9AAA28EEB64FCC0, 0x6FB9C0ACDB608989, 0xBC73BC420D696C3A, 0xCB5B634E7B72AF02,
+0x7710D41E337B5BD1, 0xEC5F29A280B13471, 0xDABDC726D0EFAC7C, 0x33A1EE04AC817407,
+0x0DD68F6B752B7C1C, 0x000000024AC3672A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFCE99EDFF8DA2A42, 0xD46D3F4913578ACD, 0xCE1207FA123EDEE1, 0x40A611F448BAFB1C,
+0x65D7C84439368ADF, 0x877D560BA567BD78, 0x2DAB3C0727C3490F, 0xC96EFC9748A23AA0,
+0x950ECF4BA12FE44E, 0x00000000670A3620, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB90F214C7F497F84, 0x071C53F816C16845, 0x804DC156220335AF, 0xE4EA54AE47A953C2,
+0x1A653F86ED9FFF84, 0x5F953E847663C0C8, 0x0C52EBBD1B12880C, 0x6647D8703ECE46DB,
+0x85EB063FBCCCE07B, 0x00000000679F7C51, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2978EFFCE9614578, 0x3CB8D8F77D0B5D53, 0x8BD1B6AEB7E09518, 0xAA6E36643B11658E,
+0x41170FF4BE65AA94, 0x88E05372B3D80858, 0x5E662928287483B4, 0xA13FBEBEF7FBFFB8,
+0x03C6B6F5843FEEC0, 0x00000002243D620B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7BDCA97A4A006310, 0x8176F1CB56FC5EF8, 0x0ABC521A8B24FAE8, 0x2767E7C180FD9146,
+0x1BE85CE37A86A319, 0xEAF08914A19D1CBA, 0x861A1939C578081B, 0xEF3DA9043A666C3D,
+0x2B9986E1B18F7AAC, 0x00000001E295F3A2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x673446D668EDE758, 0x9E7CABE786B70B5B, 0x2C7A72758F92B5FC, 0x44DB91C6CEE4414D,
+0xC7A596896F4854D6, 0x080CD7519370B7F8, 0xAFE68BB58A57559B, 0xC62125D9B7BA90D4,
+0x4CBD086965BFF6DE, 0x0000000065007174, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4450E34E38B2117E, 0xC38806FB7B9A9D4E, 0xACF870ECCF075A50, 0xCCCFE2A7440FBB40,
+0xD11F2CC2C700AF19, 0x9CDF3433A794D64B, 0xCD412CD71F594259, 0xAAF23F993128CE47,
+0x27945C2B37F988D7, 0x00000001C02F5740, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC1E432807C67216E, 0xC4755529CB7A1C6C, 0xADBE4E39779270E3, 0xDA918604C3680067,
+0xBAA6D3C95FF9DE19, 0xC2B01E637F2729BF, 0xD098003446F3FE48, 0x1FE0E3B1D49217E7,
+0x5CE3C88B0CD71EDB, 0x000000015F7F7C11, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x743E2663C1DCADF0, 0xD09EABE6BAF23844, 0x2469248A7A4ECF30, 0x496678212F89D042,
+0x3D3BB09AFAABBE5F, 0xCFCED103020B5649, 0x7530158F7EDE9761, 0xF32A65FD001F3C65,
+0x15BB1570658B7C33, 0x00000000E8C6A195, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x64723D4A7EBBBE79, 0x7FB9878F9D828FB1, 0x1224C91D9687DB05, 0xE9A7D53B5897C8B5,
+0xBF1764874ED8C689, 0xF0266F3EAB21EEFB, 0x4148990E6108C3B8, 0x6F09A8175E8D7A10,
+0x9B8D5951E88CAE2E, 0x000000019EA51412, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB3FE84A52CFA6262, 0x29D17F19B606B4C4, 0xCE33E10B3C44467E, 0x79F67B8E7D58CD9A,
+0xFC8AE14D64C27034, 0x05DEE9DF8BCCF08F, 0xE37F16D430A8B6C6, 0x5DB2FFC690C6755C,
+0x132252ABC22DCDAF, 0x000000015CED034E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x229D51258126B28B, 0xA30A5367A18C614C, 0x99C827565210E7C0, 0xDF5CF896D99E1DA2,
+0xEAEDAAF6EE3C4761, 0x6262E63F0FE7B9DB, 0xAAC086141431230F, 0xB69615132DA6B424,
+0xC1BE2D60B842643D, 0x000000012981BC70, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x43B0E673EF433D80, 0x270F51AD589477A3, 0x6B627AEE106C22A2, 0xB498F15FD7E2BF86,
+0x7D2BFECD9512945D, 0x8552AE228E2C160E, 0x5F6EC46BD0726E20, 0x54171B881ADDF2C8,
+0x3643666FD8F65927, 0x000000018078E380, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3B50080AA3DE57AB, 0x77C4ADE26DD5D929, 0x2186149241A1900F, 0x1B4294200D2E4D45,
+0xC7E750F115B201EA, 0x350CF1D54318CE1A, 0x997A1D0FE4C4EF94, 0x3ACFFD258E88A37E,
+0xEB8FA0D8DCED5372, 0x000000007B35A141, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x599AA8CB34CC441B, 0x604FF7E3AE5F347E, 0xCA4E2CEF15CC5713, 0x6C43CFE9E19B7368,
+0xED68D8453BC850A9, 0x748EC499006BAD5A, 0x9BB895339461C870, 0x2C6D96FF0064A567,
+0xA1C08AC8EF20D8F5, 0x00000001117E4877, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE594B776F08CD382, 0x4EBA4F19A5256607, 0xAA3F70EE7240C560, 0xA281318C9779054F,
+0x332BD755CEA8FCB8, 0x595C0ABD8143485E, 0xECF26D02899D201F, 0xC85A14673006D799,
+0x56D91BC16D2FB2C3, 0x000000010158E247, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFD2E3DE2CF114C7E, 0xDA7617B06F209515, 0x35B0BD46E342D3C0, 0x0EA90E9C1D0AA5AF,
+0xE1DBB9935C254AB8, 0xCE72D8D9931586C5, 0x50B65396DFE86118, 0x29A0D8A44827DFEB,
+0xC0DDB66A0039E141, 0x00000001EF18ABF3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x82300D18D2B83DF4, 0xB01F8173D79897C4, 0x7B3FDB54CB7AF611, 0xA85ECEA13F7AE1D0,
+0x0EA1552B1AB04225, 0xDE623FB72C84D75D, 0xA541D11514027440, 0xFDA18F7750CC83F4,
+0x870504C58490D395, 0x000000001579396F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC88688A1D9BD248A, 0x5A07C2F8943D3BDD, 0x586A6E68CFCCBA25, 0x3A0DE7E4CADAFCC6,
+0x5094B3A55B2F23B6, 0x818AF1B8989D452A, 0x402C750BD0F6FBE7, 0x68F2FAF1030548CA,
+0x664E8EEFB10E45CB, 0x00000001029C967F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x27AAF5BCE85C782D, 0x6E2C7C71B9928F0E, 0x854EAFE823CD0BD8, 0x7671D1DF369290F9,
+0xC598BEB09C459C52, 0x35D7D62EBF16D3FB, 0xECF51051A35FA674, 0x36FC38BC439E3A8D,
+0x808D9472F8BD5232, 0x0000000264C76C6B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB432DE4E3E35CBED, 0x0DD882A4A2AB66B3, 0x43D7E9169C12ECC3, 0x7B4C02A95367F585,
+0x86973095F5CFD8D5, 0x82D717EEAA215745, 0xD35FC38AEE757409, 0x26950708C5E37554,
+0x1EF58C40EF054EB2, 0x000000023EA6E285, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3C511302A5BDB87B, 0x78205C019D7ED6CC, 0xABEF676045D5844D, 0x6ECA0067888DE4FA,
+0x9FC2ACC77AF07EA5, 0x8D4EE6D1F85C31D9, 0x3E7182AC50B696A3, 0x950FC870991FB5E1,
+0xE00420F62CEC1A01, 0x0000000130B8BD0B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2308CF49B58EC7A2, 0x52DC0E473374600D, 0x946FF6BCF102D373, 0x189106EF713026F3,
+0x6FCD294EA222AF70, 0xC243E8688586B4ED, 0x7311B081BD98AF69, 0xB5CE62499B3B512D,
+0x7351462203A54FE1, 0x000000024B9B2C89, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6641C80E6E204653, 0x68F81F5D19C78822, 0x23F61F1164815F91, 0x6952F434998A64C5,
+0xC11253F9290D2FA8, 0x719F7AFA8234A27B, 0x938F1EF1981E5F94, 0x91E9C237BB9DB265,
+0x0B119DE419F48B21, 0x000000010DAACCA6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x438C46A93471DC55, 0x76144E705C51DFF7, 0x58BBAE66BFC74BBB, 0xEC83087D5958AE36,
+0xA0C769CE57086A8A, 0x0F49EE8ECF3DDDA6, 0xAD017164411F2185, 0xF261480C2054A15C,
+0xE118104518958FE0, 0x00000001ECC0B427, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x672DC785E48E5C36, 0xB83FEF28723422E2, 0xD2FD51A96163F2DA, 0x2AF6C72492C36DC1,
+0xFDA5CA42FD152064, 0x9D284D2C6A1CAB0B, 0xE8E9D78985D02DDD, 0x67BCD9087B29FA8A,
+0x31BBF51CAA8CBC2B, 0x0000000041A02D1E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x99C01C4C22A5F14D, 0xF19BB16D70D2E40B, 0x9F2D0F6120228C9E, 0xABEDF0619C9AEBFA,
+0x995F08DF57B521F3, 0xBA54A46C8CEFB3B4, 0x37FB3408B40A55C9, 0xAE9887ED94D05510,
+0x259BB3B67298CCAB, 0x000000009FB5804D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE47B86334F07CE8A, 0xE6AFE1B648607F93, 0x19577C7086EEB557, 0x373EE9E701C98719,
+0xB4A897D71AAA1E29, 0x8177FEA2102FB0E8, 0x6A209298A1A4EDA4, 0xC5E6DE92240F1C71,
+0x403AD90476110340, 0x0000000092175EC6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3327D4CD77352C4D, 0xB0D9FF9C3B3E16BD, 0xEEE20C6823124793, 0xE159E239CE69325D,
+0x7ACD5CEC677734D9, 0xF64EFB8866CB371D, 0x1EDF2012680C4853, 0x17050BF1E7F92580,
+0x26CA616872AD7E68, 0x00000000D7258BCB, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x872C96C604F127A4, 0x03580B4FB097D2AF, 0x214E095E35E4E9B9, 0xC9F56EEF9AE34AAE,
+0xC401420097220A54, 0xD8E8A248FDF3C014, 0x268EBAF91E8B9312, 0xD63850050DEA6B4A,
+0xE6A99EFD67C815C0, 0x00000000D6EEE4EE, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x85A97C1F33EEEAFD, 0x8622139810893688, 0x161322C7455C94BD, 0xD8CD7CC534DA9A85,
+0xD6A14401BBE28C21, 0xFBB8330F5D412B19, 0x598B92AC6993183A, 0x89419B5EE2C0A78A,
+0x0C7DB0D2FF0BC77E, 0x0000000260B4227A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA574BD34892AE742, 0x8F2AC1B23ED9D40C, 0x6DCF5DC28A9854CC, 0x4E8D7D729B9DA84C,
+0x6220A79F7344C9CF, 0x8DBE918E260D6851, 0x07E110CAC789A08E, 0xB669F1B6646C6530,
+0xDC84EAABBC74D8AD, 0x000000027273D903, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC0FB96CADE5A9F17, 0xD2FA4D8E691CA620, 0x93D77E96617A43D4, 0xDAD1D7714DEEBDA4,
+0xAB20ADA1E0D6798B, 0x6FE831CC9F952468, 0x3C9045E4E7590133, 0x2259BB4C897C23C7,
+0xA1EEA46AB8D7AF80, 0x0000000147945427, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB701ABC52C0C4A76, 0xB7C5916144B1C8E8, 0x19B0AEED1FB065DD, 0x9374B33E83F78C50,
+0x0DF2226240178E22, 0x18B1A6FDCDFD0A7E, 0xD652B5D58FAA4D97, 0x16171FC08A08CC0D,
+0xCF4645B0F1A8823E, 0x00000000B5EAD394, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2E02E5B7BBFEC138, 0x2C79AE4AFC9E28BE, 0xE366267BCAE8ABCE, 0x5FC56A3E1F53364C,
+0x85DC87012D558503, 0x67575BE474B8F1AC, 0xE091F330FDEBCC1D, 0x8E332595EDA1BF78,
+0xB3D6A355F5C15362, 0x00000000DE41D778, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x02EA54B7BF6B97A0, 0x35EBF5286709C6EB, 0x966A918CBEE3C903, 0x3DF2EC8B7385B71C,
+0xDEF1062F3FE43966, 0x350D589E2BD5F518, 0x58A367DFA539AAB7, 0x0D94E49BDC66E221,
+0xE39BDAC3925057DA, 0x00000001A7B287E2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x90F167C0D7E0C64F, 0x2530D54C24689F60, 0x982C874DC9256480, 0x246F884DBC88561E,
+0xDAC9808C74AF4F71, 0xFBD4DDDBE5E5F3A0, 0xA4A36FD95EBC5DB9, 0x485E652726B42A7B,
+0x9FDEE4C83325ED31, 0x00000001184693FA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFD4FBB81B27A46F0, 0xBEDF6C45BBE4BA60, 0x119707CA51D076FC, 0xF868C278515679E1,
+0x63BCB7224FE75055, 0x06840D10BBD326FE, 0x117AFFF21B2D9A83, 0xFF222415F15EC856,
+0x951781931A49676D, 0x00000000E515DBA9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3BE5032D8852E0EA, 0xFB4B334E9D3D2858, 0x1ECAADD03CAB4150, 0xB0AB4D0574015493,
+0xC3FF480B67460689, 0x87C2866CC3F081C9, 0x01BC197365CA3085, 0x89DF50D7A8DD5F39,
+0x4143352DB49442C8, 0x00000001ECA2A547, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA0B65DBAC000A39F, 0x8D3ED7484C77F4AC, 0x0FA1B5C5E74B0B74, 0xDBA1F309B4371351,
+0x74C2348DD7AE81CC, 0x9884941C4A964E08, 0xC1D32D1E3FD1FF2D, 0xC00A34D56D809B38,
+0xEEBED7BCF1125BF0, 0x00000000F0865424, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x96A9CC6A613C806E, 0x3C0E95960ACEA034, 0x53A5FD617B3DAF7F, 0xD7A6715633248B26,
+0x8FA74A09A38C5070, 0xE62BF7A825DFFE39, 0x4C0534795D70C0E9, 0x3A73BA78E498A197,
+0xC0BE1AD034B658ED, 0x00000000C93596C0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x796CDC96D50A404B, 0x24EF4DBEBDE3E90E, 0xF8FE93B7D2917FD7, 0x0AC4A6AB4E0B53D3,
+0x49BE0AD1E209DC40, 0xF6CCA668909898AE, 0x2D0E64E834CC4AC3, 0xF3458EC44DFBDB03,
+0x210D59C22FB618BF, 0x00000000BB1DE3C4, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3029E45BA138D733, 0x2C51392FD11B727D, 0x2C29BA7157C4F82B, 0xD8D2A96696CB7431,
+0xB8ECC5D6DD3751C8, 0xFBF2DA08D438B6C0, 0x008F015ADAF6658A, 0x63F7C8B7DFD8D23B,
+0x5456B4E0D4692B87, 0x000000010B545499, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC340664A08559593, 0x58B58940D4B22D92, 0x8199D64536ECFDBC, 0x47E06313A1ADC904,
+0xE4F2C4CA03D10913, 0x59CBE4B005C70021, 0x0A34925F2D4DC60D, 0xA7BAA48764DFA46E,
+0x5996E26A37AEDF22, 0x000000011302345A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1CF79A594519879E, 0xF48DC70113A5B728, 0xD127385D444F272F, 0xE0547603D4181AAE,
+0x921EA40B9AF89DAD, 0x973B98053ED99F50, 0x3313A93FFDA8899C, 0xC3A852A847AB67DB,
+0xEAE0C48CBC93AA10, 0x0000000232802578, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB8E33F72739F7F3F, 0xF573C3615F6563E1, 0x703F202E9C81AFC2, 0x4DCDDE216A9BB612,
+0xA8F4D9FF69DC89F4, 0xC76626EC3245260D, 0xE49BD702F7FF361A, 0xC4FAADD602092AA2,
+0x72DEB3FD9FD2C97F, 0x0000000134F42C9E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC4357400EC021BEC, 0xF5CA42BBECF7ACF9, 0x10A55819B169358A, 0x51E9E5ECF996370C,
+0xFAA0442770CEADEB, 0x4E39445807295637, 0x88555F858032AC04, 0x0FB19615B10C9656,
+0x28CC84DAD3A26A93, 0x0000000014500872, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB50463B4B083B543, 0x90D2754D6772D708, 0xEC5ECC0EA23BB60A, 0xABA78A7CFA527343,
+0x13534D7D4664105B, 0x4E709C75EFD8FD29, 0x44E338C4A9CD80B8, 0xAB11EE6DEA414188,
+0x8E451F58AC016945, 0x0000000002769951, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x87E1C9ABEAFB1F1A, 0x14383543F11EF74B, 0x94C3ADD28E305019, 0xD675CE8191B1DC71,
+0x85C496238AE1D13A, 0x37F33EE9CC4EF8B8, 0x2CF9DA65120C365B, 0xD25BBF4B161E3E50,
+0x8B98855069E8ECE2, 0x000000009515873F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x05F3A4CF72C05DFF, 0xD282BFE201375D53, 0x15DA58BBCB167CA8, 0x12591A734664B527,
+0xC2DB4CC8DEC5E7C6, 0xBEC0AF06F827D726, 0xC8B4FA9E2B0A8C4E, 0x4E098D89A5006B0A,
+0xC05E7BABDC14311B, 0x0000000099B1C482, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE93900FAD5F70923, 0x700D3DF99A6CED17, 0xD920EA596C71AE51, 0x735B4D3570AB1C22,
+0x218F8E2BEB4E19B4, 0x67380EFF84854127, 0x65916597577CBF8E, 0x0FDB03CF815840E3,
+0x92B0F7F6766C722A, 0x000000004E296BF2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCC1140CA3CA68170, 0x14C541EF93F79AF7, 0x653F7242CA644E4F, 0x33BE0FAA19546A8F,
+0xA56A984BB7ADB01F, 0xCF1713F0DEB1D767, 0x9EE7D4386FD210D3, 0x81E2F025ADD6A8C1,
+0x047D42087199100D, 0x00000000476BB06C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1B00C26898E33301, 0xA4747599D3034E95, 0xFA6BF0F00B3EC69E, 0x6B4C9F6C44A97978,
+0x8A45D55A66E99591, 0xE827ED993017DB36, 0xB6B7A33DCC579B1F, 0x3B78DE86B469D6FC,
+0xB708D3B1EA745DCE, 0x000000011819293A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6FD62340EC42AD5B, 0x21F2DFC06DA5DF52, 0xE779E0B19F7C0F4C, 0x4EE7CCE903B78097,
+0x5FEE5603D9DA6D35, 0x8F99F509F0A93FD4, 0xDB2CC81586561F72, 0x5E9A83ADBEC104A9,
+0x57A7E04B36D58721, 0x00000000FEC2890D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3B0465C7134934B8, 0x48E2A19137E14259, 0x8DB213F10B45054A, 0x77D53CE1070620F5,
+0xC3603FF6A8C258E3, 0x4A253E7EAFE3C420, 0x424268973CE48650, 0x6E648B9C17E0ED18,
+0x83CE9833D7072C3E, 0x000000000DF5AAB8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFC0792671F5AC11E, 0x6F0FC37402859939, 0x57A7B24B429EAD1C, 0x35FB0213C31A7113,
+0x6CA68D7AF945F7C8, 0x0C79AB9C89BA8176, 0x2422A4D30D6CB6B6, 0xB4FBCDBD58735228,
+0x58B3D979FED2A65B, 0x000000003928B0A4, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x23CC08755BC9D941, 0x4FDB55C5D903E410, 0xCFF2E4BC2FA0CFD0, 0xB59A13B4D773CAB6,
+0xDEB7B3D023FE0AF8, 0xC7643A94B183F3C0, 0xE981D589EFFC7ECF, 0xA5A752C5138BCADD,
+0xA5F9464461C092D1, 0x000000007FB988B0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x87AAED3307BEA8E2, 0x7B334172117FA45A, 0x91BA797A4E70C46B, 0xE6A5E50567FFA709,
+0xA945276042511F9B, 0x64804A3DB91C6643, 0x2ED23C9C47728349, 0x5AB2B7682B9B7CE8,
+0xE5128BB406B97771, 0x0000000010938F92, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF98C3B61D332BC3F, 0x8F9EC444A18AF324, 0x2BC634BD97FF4727, 0xB4421357A13B7D9C,
+0xEF28DCF621CA1133, 0xD56BC50BDEF3A9E1, 0xDE15CFEB3CD8D432, 0xAAE05687FBE223B9,
+0x01F29C753BE753F7, 0x000000017C62C0E7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x280CF92A3456D28A, 0xF0640FA1A71F876E, 0xE4CE0E18CF4AFC66, 0x17EC6D3257A064D3,
+0x5AFC3BBCD0E10B9B, 0x97A1091C5642918E, 0x8025DDE1A8149BF4, 0xC9F402B00F80A47E,
+0x15C0053A436B4328, 0x000000015B7C20D1, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4729111350EC316B, 0x6886A64F4113DE0A, 0x7B8EC9252749FE44, 0x144D81EA7E95E9B2,
+0xA25015B8B56DDA31, 0x32C65679015C7C39, 0xB0795CC9E9EF0753, 0xD6A76A8DCC76160F,
+0x6626A57EAA9ED24E, 0x0000000113041BE0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9E5FFF7E9D58ADA0, 0x6C692C61555EAC63, 0x4123DA568E67E342, 0x586E04DA3639546E,
+0x54F38EF19B5CB1FD, 0xF2DCA18B57A70426, 0xEBB8764CB597D43D, 0x4B1CA765186BD1A4,
+0xAB151BB929B40CBD, 0x000000025CABD69D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x61AA1E9338E00B94, 0xDEF66061105B886E, 0xA8D663021AAB19D6, 0x1EFE6FE574664C5B,
+0x81D04940CEBBF816, 0x51DF90FB2C3D8C6B, 0x4E78A3E6CCD13553, 0x0FFB1C166787EFE3,
+0xD04B8D1739DC6894, 0x000000024FD1D118, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD7861FB8DEAD9CCB, 0x1FFE0365E77421B3, 0x20025E30AF7F8684, 0x665AC570336AA030,
+0xBB6257F22A9E701D, 0x4743ABB559803FF3, 0x4892B307D46851F7, 0x0A47220466F5C0BB,
+0x29B446EB70387D07, 0x00000000C1FACB93, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9DC6DE502FCD3A23, 0x720E27A35441A6CA, 0x48E2CEF841FAE4D1, 0x7C04A8166977455E,
+0x9A3B18DFF1CFFCA6, 0x09E70F8E5154C9B3, 0xAFEE98FC786AF6AA, 0xFA5E655355C91085,
+0x548B134A73FF222F, 0x00000000992A60FC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC08DB7B3352A64E4, 0x6A2EC4677239C591, 0x9CF58F1EDB6CC898, 0x65F4C2303B0A5F51,
+0x6FFC40500F8E7A19, 0x9353448C9C1E3ED8, 0xABDDE44ADD5CF080, 0xE5EDD3F5315F0A1B,
+0x9645545E37B627C8, 0x000000003461EDA7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x912FC331043B0BC3, 0x3CC05240FC5F6FED, 0x922341008665BF31, 0x2DBFB2099A12855C,
+0x23F08F0B66CB5274, 0x31A636CBB5F2B6C1, 0xF228FCE7624875BC, 0xCFA9BB5EE0BEC003,
+0xD27E6C0B57014F82, 0x0000000191CF2C58, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6913B96CE934DFBB, 0x225612FDAC660A4C, 0x4F6AAD7DC7A8BB8D, 0x8000861E54546F0D,
+0x2C9AF74543FCAB04, 0x9DAEDB3C1B766099, 0x4A7F5A045D0AD7EE, 0x1C08B9B2D724E3B6,
+0xCD1EECFEE006D6BA, 0x00000000B65BF30D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5E19EA2B2A56B183, 0x7AF73D53CB4B371A, 0x89F37C136C28427A, 0xBEBD0EB88B2D611F,
+0x5B4EC39CBFD5FC09, 0xEF51ACF9DBC037A8, 0x33C54D8FB4A5EFAA, 0x7380B5EB09A6798A,
+0xB9C34B278E049194, 0x0000000173DDFCC7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD6DE26067AF8FA15, 0xEF54F07534BE04F5, 0xE3F65FC9B864D5C1, 0xAD1409541018964C,
+0x25469279E295362E, 0x84E8F6074E70418A, 0x76CD617AC542E803, 0x32C132A10155E9AD,
+0x828F122852F70AD8, 0x00000001FEE7555A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x03BCA48CCC66407B, 0xFE99D92CD6A7E87B, 0xEAB61166AABEC612, 0x3901DE1DB32778C6,
+0x66FBD8FDA86116B2, 0xCC6BD93865B51C72, 0x89EEF757ED4E4100, 0x8B50F3174AB61ED3,
+0x60232398112FF238, 0x00000001393E7BE1, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x14078F8C1C928BA8, 0x57FB45616DF0EACB, 0x6EB091955270B202, 0x6C8439DB177FAD12,
+0x57E10BC74499AD60, 0x7EC93ECD0D5219F6, 0xA3B498F0F783865F, 0x4BAFA63A3C81B5DB,
+0x8A6179476739EE6E, 0x000000001D7B8219, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x41A1C98E7DE5D973, 0xA64AD9D27A5E4F1B, 0x09832B6690E789AC, 0x59423AA014174546,
+0x3C6F8BF28A6ED248, 0x886CD8F110D3A15D, 0x06BAF5F7E55C2256, 0x7D0596E88BDB7DE1,
+0xDE2CA4C786B6EE5D, 0x00000001817FA64F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4F728368CCE0FC50, 0xBC0E73FFF43AF9BA, 0xC187EFF70B49DB4E, 0xE2821990BF585F19,
+0x29F4D9CF27A567DF, 0x8544D15158C82F72, 0x27860A824834DE03, 0xB8F78746E50138F3,
+0x5E0A2AEDBD1BCC21, 0x00000001D4981FB5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC1AE3D576AC06F38, 0x2BFD42685AAAB514, 0x981347626C7B3763, 0x4A288DEC22865D04,
+0x8A9D06D8EC93FDD0, 0x380F9927CFD17974, 0x8B5E44038852B595, 0x6615409B17752332,
+0x0611815703C0D19C, 0x0000000279A93610, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x37AFD6B4F586707C, 0x28529D0672C63D20, 0x2A8C9A9EA095EF5A, 0xD44990EC63E0B959,
+0xECEA6541019ED404, 0x6879BA385466DA91, 0x5630290F41723E94, 0x645C3511E43BD7EF,
+0x7671422EE874AC4F, 0x00000001FAF91A3F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x690E4203A9ECB9AA, 0x97ECC4B3EAB9BBBB, 0x84ED223DA69C3CBC, 0xF8AD4F600957D332,
+0xAF0273B097E340C6, 0xD3BD2308E2BB4C1A, 0xAA679003CFBB3295, 0x8F1D4B31A89990C5,
+0x17E1F4403DBDE593, 0x00000001AC485D26, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBAA76287A03A9046, 0x9A67C43297759E9D, 0x54B238520E0B8E5B, 0x4779A2BAB6F36D74,
+0x026EB7E1EB6CDC27, 0xB0406C69E7C48756, 0x36A488E64C878D8F, 0x5FE2218684C1858B,
+0x94215AE3ECE75BD8, 0x0000000021F8D368, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3BC54C49E7129D22, 0xBBE77D66D4AF6463, 0x4AC7FEBBF7F13865, 0x84848C5C0BD7A841,
+0xC3610D9F4145B93A, 0x9DB268763051C12F, 0x1B2C4B02F556E50E, 0xF51B7874FA4B665E,
+0x207A54C3B0CC9029, 0x0000000028DC16C9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x99EDF39316AD864A, 0xE530D1FFCEE4C474, 0x0CC798DA5ECA35A1, 0x9862D3493E4263AA,
+0x222375BB889B3094, 0x5CB5CEC5C5412738, 0x5ECD3B5EF5381820, 0x59F263D9769F0A9F,
+0x5B3EE2F067209258, 0x000000009A8B83F4, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9531063808176ADF, 0xBAE868443542E59A, 0x3DA32D2DD3A12B83, 0x4C000DC24DD610DA,
+0xA434F3FD34D28A2B, 0xBC1217F4CB341F93, 0x9944F31CD4154A9B, 0x3CE3960899B5311B,
+0xF210CE544A912828, 0x000000009721F329, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x41E0D0212A3CA1D8, 0xBFF9CB171EDBCEEB, 0x4A1D1B441E1D7A88, 0x7110D599FA345D08,
+0x91F903C8808771DF, 0x8FB58EFB0B20EA69, 0xDA1E8A4871619974, 0xCA7780DA06AA216E,
+0x62C89396F39554F7, 0x000000026566898F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE2E79E629F14B013, 0xBAAA6BB6FCA3AA14, 0x5D93AC86807EC92D, 0xE41738B0D6559E1B,
+0x1D053D978AF7D756, 0xAE68F53C49EE5CE0, 0x17751C41DA05660B, 0xA1C1663675E7E22C,
+0x2B9CBFFD03DAFE1C, 0x00000001213A7932, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x685F6002B259DF5F, 0x30DECA815D696128, 0x809FB05720540728, 0x0C0EE283E878F607,
+0x7F459DED76CF14C3, 0x1389EC04F349FD73, 0x45E4749115B26811, 0x921119E76371D8D1,
+0xD7EF71C0803E1517, 0x0000000183C7DBD7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x848FD81EEE4D64BA, 0x45AEE6307528427F, 0xC6E337E6F65E9D02, 0xEC76329EC4140362,
+0x03C5BB4DFAF9F56D, 0x2AE5FCF12C633FEF, 0x495A82ED2B6FA3B9, 0x61BDCBCA9C26B18A,
+0x4185B93A6AB4F5B6, 0x0000000205ED683F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8C78CC9DAD5DC059, 0x082CA3253BCF347A, 0x8B396D7676A56C95, 0x944442601B7FF309,
+0x32FA4BDFA91C78FE, 0x63CBBD88136ED32B, 0x09F90288EB5AEAD1, 0xB21346571C0A4AD4,
+0xDA81F597CFED2E84, 0x00000001EEE65EA7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x147C0925E9DF8E79, 0xF1145B4BF244B4D3, 0x8F285BD34409E26C, 0x5C174813FEB92AFD,
+0x52D357262527209D, 0xF9E7D92B8A52A5A6, 0x45B7B25F8B85C241, 0x6CC660B7B3BE15CB,
+0xF8AC3CBCF08A8614, 0x0000000043AFFDE5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x89C0B4B822868387, 0x1F9EA9B69F9E63D4, 0x8D932A4C860DD86F, 0x5968A5A951B983C3,
+0x66C7D9F07FC910C5, 0xA1FF3D4BEB5F0CB3, 0xFAC6595E79A60441, 0x2F9C95A6C8578A1C,
+0x12DA04C8F7E9DFBF, 0x00000001E1B6368E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8539C9FFFE1436FE, 0xB6982BF1E2D7D332, 0x62BCBE33FB37E340, 0xABB01AA6E5D6F583,
+0x098C208B38532FD5, 0x0200A158DDBF381A, 0x452F7F13A417B9A2, 0xEA4C00B2AEC0A825,
+0xA6C2083242D08C51, 0x000000000AEDE78E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x368D48E1D82EFB04, 0xC75A35EB1A53ECF8, 0x6F2AC698072F414E, 0xF825967E5DAEFABF,
+0xD6715FB0856CE904, 0x7241C8F602B35696, 0x5616343E31C8B081, 0x2A46685A7BBAF827,
+0x82CF20BD29BF87A5, 0x000000024D6AADA9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5D00E828D1BA9944, 0x95872533E484FB92, 0x9EA31EA314B34ADB, 0x03CEC9BB6C1EB06D,
+0x72FD181410E93957, 0xD7014AD06C35A25A, 0xC224EEF4E09ACCFB, 0x8154080C96D2A352,
+0xBD9CE62CE945E278, 0x00000001280B507B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFE80C3DCBE21AD62, 0x276B9A1BEECD4997, 0x7F1759E98A5161F8, 0xD9C920AFD6D776AE,
+0xAF6E3C97E3FC0BFA, 0xEC8CC833C8B4D283, 0x5CC0610AD82E9EB4, 0x1C7BC1B109ADD3B8,
+0xDAD289C07F813D0A, 0x00000000C17CF385, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0E24AC67C68A4D98, 0x847CA39ABDE25B64, 0xAE12ADBF5AE1C557, 0x568C5F1B34D44333,
+0x3903DD3D947D212B, 0xE2602E383A5635AE, 0x4D265AB71F6879CE, 0x9ECCBCE8BBD03461,
+0x9E7EDCCF186DAF0E, 0x000000009DDA1CA1, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC45D479F5D2FDA45, 0xD81F798B123FF502, 0xA517AD9A5E88B983, 0x64E120C7D2901F63,
+0xB4D624B920A51CDC, 0xECE33161D622ADBE, 0x84D32199CECBE6AE, 0xE926951B7F20AD85,
+0x36028D8537427468, 0x00000001CEFBEAF3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2740EBA8703DAD51, 0xB8F549736C4D338E, 0x33E3C42795245E80, 0xC8A1047F84153AAA,
+0x9DA76935DCBE9A9A, 0x98A6439403473DE4, 0x273FA8D27D9C3D2C, 0xFF8600EFAF6D8D2E,
+0xDAD536A57C3DDB0C, 0x000000002E1EFD46, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCD71481031F4661C, 0xDDD2FEFBC0080819, 0x1D0E74018E58C0FA, 0xCC7687CC82E3764C,
+0x82AB7C02FE715AD6, 0x3D77BFDCEC8465EB, 0x9EC029CD8048CE57, 0xEDDDE266525532F9,
+0xD470CB2FF6075A53, 0x00000001D91EA72B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA7109DE0FB0E295D, 0x308C5D190C04D526, 0x7EAE9FA6EB3862E7, 0xC3D7703EF66D4CD9,
+0xD933EAC99AC0D1A8, 0xC48E585702BF1D4A, 0xA896852D39E96FDF, 0x5100A8E5A9B911D9,
+0xE25E658296F1ABE7, 0x00000001A3C87A73, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8A12754E85E707CE, 0x19381C3B6FB8AFE1, 0x72C233072FBA3FC3, 0xCA865119FA53B7BD,
+0x5BC178FD63A082B8, 0xA3BBE3D4DBCDEF87, 0x1CCFE88C033D97D2, 0x6A77980F6C0BAEDF,
+0x861099263C52024C, 0x000000000C1D6D87, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x397E71C47B599DC0, 0x432AB7EF0D3F7058, 0x99CFE128A7B8077C, 0x53E9711BFF869847,
+0x96415EC2D788F24B, 0xE11C9B4C6CF8A867, 0x95B44D97525BA9C8, 0xA731C252CBD23BAA,
+0xCB17760527C76B0F, 0x00000001CEA7C693, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x435A401317B19D54, 0xCCAFD73B5446292D, 0x74F742C0E2AFD734, 0x3A8EC0D583E53691,
+0x63746E0E49216648, 0xDF59C73F1D9F6691, 0x33E743B06BA2909D, 0x4DB1400A8C6331AA,
+0x069E72F5B4A54DCA, 0x0000000024BB38CC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEC29A1090CFC421D, 0x5F774EFCE982C2F3, 0x05F74E78E44B69AF, 0x120AFF25CC30DC39,
+0x30B8E68F95F24CC5, 0x6BBE6B6EE96C05DB, 0x66305858A8908722, 0xD15ECA47E3A49755,
+0x2DFD9A3E06785991, 0x000000007EE672EE, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDB22E7B9E553D41B, 0xD5ADE73DF81EC28E, 0x7E8456E23AFF6B57, 0x87039DEC9700FBC0,
+0x10C1A7CF153F5BD9, 0xF10E9AEF9BE84DD0, 0xDBB2B3F62287E5A9, 0x0AE074613366EBE8,
+0x2157850467140689, 0x0000000072BBD233, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x346C217BCEBC7B09, 0xCD0A4DB898461F8A, 0x3CAF1893582D1452, 0xC075F8E13E1C0CFB,
+0x0D65B8B006725B61, 0xD402DFE4EAEF8619, 0xBD50AF536840E238, 0x99B31801EF654D57,
+0x17BB57A541FE8AC1, 0x000000021A4CC109, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3E7D0E312732AD71, 0xC48A8FB59B9DDC39, 0xB9E84DB3D80F8953, 0x6B51302E99F1F671,
+0x2D9AD562824DAA52, 0x1E4393933A32A897, 0x7AD8D8F4A7F483F3, 0x6EB96935B71F03D3,
+0xFD1539E9D7CEDC76, 0x00000001905D1CC2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x486DB286F4D9DEF8, 0x1C2AE6A84E04475A, 0xEC4E2893ABABAF1E, 0xF9BB7FEA0043D08F,
+0x672875A853E0C0D6, 0x4BD761FFBF9D5B8B, 0x5078BC581B5ADC98, 0x0AF26458DE354E6B,
+0xAA15D2AA05B9F2DD, 0x000000008628A425, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAF4153F5E09D2A3C, 0xC781C8DF4C260895, 0x1430B38E81A6D386, 0x0178FB186EFB1A72,
+0xB7D7EA164E9EC0E2, 0x0C8CC78CD749E2EA, 0x3E0438C887521D35, 0x09B850631AE9FB70,
+0xEB9F0017C69FBD95, 0x00000000FDF24C0F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2DAA234C46F1CD58, 0x6A0BF7BCE763950B, 0x39DDC826FBBC3C15, 0xC0B037E5BCBC4A39,
+0x0A76F7741936C443, 0x4BD3AD75AFFD6DE0, 0x7007A7D25DD4CFF9, 0x27703D135F846F23,
+0x5983B489387EAD33, 0x00000001DAD264CC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x00000000670CC8E6, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9A34000000000000, 0x4D99C2BD28717A3F, 0x0A4A1839A323D41C, 0xD2B62215D06AD1E2,
+0x1369026E862CAF3D, 0x000000010894E964, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 };
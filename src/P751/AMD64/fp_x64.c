@@ -6,6 +6,9 @@
 
 #include "../P751_internal.h"
 #include "../../internal.h"
+#if defined(X64_DISPATCH_IMPLEMENTATION)
+    #include <cpuid.h>
+#endif
 
 
 // Global constants
@@ -579,6 +582,23 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
 }
 
 
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision squaring, c = a^2, where lng(a) = nwords.
+        
+    UNREFERENCED_PARAMETER(nwords);
+
+#if (OS_TARGET == OS_WIN) || (!defined(_MULX_) && !defined(X64_DISPATCH_IMPLEMENTATION))
+
+    mp_mul(a, a, c, NWORDS_FIELD);
+
+#elif (OS_TARGET == OS_NIX)
+    
+    sqr751_asm(a, c);
+
+#endif
+}
+
+
 void rdc_mont(digit_t* ma, digit_t* mc)
 { // Montgomery reduction exploiting special form of the prime.
   // mc = ma*R^-1 mod p751x2, where R = 2^768.
@@ -904,4 +924,81 @@ void rdc_mont(digit_t* ma, digit_t* mc)
     rdc751_asm(ma, mc);    
 
 #endif
-}
\ No newline at end of file
+}
+
+
+#if defined(X64_DISPATCH_IMPLEMENTATION)
+
+// Kernel variants assembled from fp_x64_asm.S with the suffixes _plain (baseline x64), _mulx (BMI2) and _adx (BMI2 and ADX)
+#define X64_KERNEL_PROTOTYPES(v)                                                    \
+    void fpadd751_asm##v(const digit_t* a, const digit_t* b, digit_t* c);           \
+    void fpsub751_asm##v(const digit_t* a, const digit_t* b, digit_t* c);           \
+    void mp_add751_asm##v(const digit_t* a, const digit_t* b, digit_t* c);          \
+    void mp_sub751_p2_asm##v(const digit_t* a, const digit_t* b, digit_t* c);       \
+    void mp_sub751_p4_asm##v(const digit_t* a, const digit_t* b, digit_t* c);       \
+    void mp_subadd751x2_asm##v(const digit_t* a, const digit_t* b, digit_t* c);     \
+    void mp_dblsub751x2_asm##v(const digit_t* a, const digit_t* b, digit_t* c);     \
+    void mul751_asm##v(const digit_t* a, const digit_t* b, digit_t* c);             \
+    void sqr751_asm##v(const digit_t* a, digit_t* c);                               \
+    void rdc751_asm##v(digit_t* ma, digit_t* mc);
+
+#define X64_KERNEL_TABLE(v, mul, sqr, rdc, variant)                                 \
+    { fpadd751_asm##v, fpsub751_asm##v, mp_add751_asm##v, mp_sub751_p2_asm##v,       \
+      mp_sub751_p4_asm##v, mp_subadd751x2_asm##v, mp_dblsub751x2_asm##v, mul, sqr, rdc, variant }
+
+X64_KERNEL_PROTOTYPES(_plain)
+X64_KERNEL_PROTOTYPES(_mulx)
+X64_KERNEL_PROTOTYPES(_adx)
+
+static void sqr751_plain(const digit_t* a, digit_t* c)
+{ // There is no baseline squaring kernel, square with the baseline multiplication instead
+    mul751_asm_plain(a, a, c);
+}
+
+
+static const x64_kernels_t x64_kernels751_variants[3] = {
+    X64_KERNEL_TABLE(_plain, mul751_asm_plain, sqr751_plain, rdc751_asm_plain, X64_KERNELS_PLAIN),
+    X64_KERNEL_TABLE(_mulx, mul751_asm_mulx, sqr751_asm_mulx, rdc751_asm_mulx, X64_KERNELS_MULX),
+    X64_KERNEL_TABLE(_adx, mul751_asm_adx, sqr751_asm_adx, rdc751_asm_adx, X64_KERNELS_ADX)
+};
+
+// Starts out with the baseline kernels, so it is usable even before the load-time selection has run
+x64_kernels_t x64_kernels751 = X64_KERNEL_TABLE(_plain, mul751_asm_plain, sqr751_plain, rdc751_asm_plain, X64_KERNELS_PLAIN);
+
+
+static unsigned int x64_kernels_supported(void)
+{ // Returns the fastest kernel variant supported by the processor
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, NULL) < 7) {
+        return X64_KERNELS_PLAIN;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    UNREFERENCED_PARAMETER(eax); UNREFERENCED_PARAMETER(ecx); UNREFERENCED_PARAMETER(edx);
+
+    if ((ebx & bit_BMI2) == 0) {
+        return X64_KERNELS_PLAIN;
+    }
+    if ((ebx & bit_ADX) == 0) {
+        return X64_KERNELS_MULX;
+    }
+    return X64_KERNELS_ADX;
+}
+
+
+bool x64_kernels_select751(const unsigned int variant)
+{ // Switch to the given kernel variant. Returns false if the processor does not support it
+    if (variant > x64_kernels_supported()) {
+        return false;
+    }
+    x64_kernels751 = x64_kernels751_variants[variant];
+    return true;
+}
+
+
+__attribute__((constructor)) static void x64_kernels_init751(void)
+{ // Select the fastest supported kernel variant once, at load time
+    x64_kernels_select751(x64_kernels_supported());
+}
+
+#endif
\ No newline at end of file
@@ -69,6 +69,23 @@ const uint64_t Montgomery_R2[NWORDS64_FIELD]     = { 0x233046449DAD4058, 0xDB010
 // Value one in Montgomery representation 
 const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000000249ad, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x8310000000000000,
                                                      0x5527b1e4375c6c66, 0x697797bf3f4f24d0, 0xc89db7b2ac5c4e2e, 0x4ca4b439d2076956, 0x10f7926c7512c7e9, 0x00002d5b24bce5e2 };
+#if defined(AVX2_X4_IMPLEMENTATION)
+// Values 2*p751 and p751+1 in radix 2^28, used by the 4-way AVX2 implementation
+const uint64_t p751x2_x4[VNWORDS_FIELD]          = { 0xFFFFFFE, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+                                                     0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0x51DD5FF, 0xA93F0F1, 0xC7D92D0,
+                                                     0x7EF98ED, 0x2B36342, 0x7D0EDB5, 0x30CFADD, 0xE90109D, 0x08B964A, 0xD0AC56A, 0x2F75B8C,
+                                                     0xC25213F, 0x83EE381, 0x0DFCBAA };
+const uint64_t p751p1_x4[VNWORDS_FIELD]          = { 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000,
+                                                     0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0xA8EEB00, 0x549F878, 0xE3EC968,
+                                                     0x3F7CC76, 0x959B1A1, 0xBE876DA, 0x9867D6E, 0x748084E, 0x045CB25, 0x68562B5, 0x97BADC6,
+                                                     0xE12909F, 0x41F71C0, 0x06FE5D5 };
+// Montgomery constant Montgomery_Rv = 2^756 mod p751, used for the conversion to the 4-way representation
+const uint64_t Montgomery_Rv[NWORDS64_FIELD]     = { 0x0000000000000024, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x6F40000000000000,
+                                                     0xF2BAD541990F083E, 0x42F6305531273F47, 0xD4F29165C6D34F49, 0x3E1E8B62F6EBB9DE, 0x0563A98EA9B90195, 0x000043AE02B9400E };
+// Montgomery constant Montgomery_RRv = (2^768)^2/2^756 mod p751, used for the conversion from the 4-way representation
+const uint64_t Montgomery_RRv[NWORDS64_FIELD]    = { 0x00000000249AD67C, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x42C0000000000000,
+                                                     0x88FE3B2A1F9800C5, 0x176236DB777B3264, 0xFDD6E970232B83E6, 0x5F35D4D762277573, 0x38C4FC754CD16C01, 0x00001BF8F69FC724 };
+#endif
 
 
 // Fixed parameters for isogeny tree computation
@@ -123,9 +140,29 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define mp_add_asm                    mp_add751_asm
 #define mp_subaddx2_asm               mp_subadd751x2_asm
 #define mp_dblsubx2_asm               mp_dblsub751x2_asm
+#if defined(X64_CURVE_ASM)
+    #define xDBLADD_asm               xDBLADD751_asm
+    #define xDBL_asm                  xDBL751_asm
+    #define xTPL_asm                  xTPL751_asm
+    #define eval_4_isog_asm           eval_4_isog751_asm
+    #define eval_3_isog_asm           eval_3_isog751_asm
+#endif
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp751
 #define crypto_kem_enc                crypto_kem_enc_SIKEp751
+#define crypto_kem_enc_parallel       crypto_kem_enc_parallel_SIKEp751
+#define crypto_kem_pk_prepare         crypto_kem_pk_prepare_SIKEp751
+#define crypto_kem_enc_prepared       crypto_kem_enc_prepared_SIKEp751
+#define crypto_kem_prepared_pk        crypto_kem_prepared_pk_SIKEp751
 #define crypto_kem_dec                crypto_kem_dec_SIKEp751
+#define crypto_kem_dec_init           crypto_kem_dec_init_SIKEp751
+#define crypto_kem_dec_step           crypto_kem_dec_step_SIKEp751
+#define crypto_kem_dec_finish         crypto_kem_dec_finish_SIKEp751
+#define crypto_kem_dec_state          crypto_kem_dec_state_SIKEp751
+#define crypto_kem_enc_batch4         crypto_kem_enc_batch4_SIKEp751
+#define crypto_kem_dec_batch4         crypto_kem_dec_batch4_SIKEp751
+#define crypto_kem_keypair_batch      crypto_kem_keypair_batch_SIKEp751
+#define crypto_kem_enc_batch          crypto_kem_enc_batch_SIKEp751
+#define crypto_kem_dec_batch          crypto_kem_dec_batch_SIKEp751
 #define random_mod_order_A            random_mod_order_A_SIDHp751
 #define random_mod_order_B            random_mod_order_B_SIDHp751
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp751
@@ -133,7 +170,18 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp751
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp751
 
+#if defined(FIXED_BASIS_LADDER)
+    #include "P751_ladder_tables.c"
+#endif
+#include "../safegcd.c"
 #include "../fpx.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"
-#include "../sike.c"
\ No newline at end of file
+#include "../sike.c"
+#if defined(AVX2_X4_IMPLEMENTATION)
+    #include "../batch/fpx_x4.c"
+    #include "../batch/ec_isogeny_x4.c"
+    #include "../batch/sidh_x4.c"
+#endif
+#include "../batch/sike_x4.c"
+#include "../batch/sike_batch.c"
\ No newline at end of file
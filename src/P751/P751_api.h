@@ -30,12 +30,76 @@ int crypto_kem_keypair_SIKEp751(unsigned char *pk, unsigned char *sk);
 //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = 596 bytes) 
 int crypto_kem_enc_SIKEp751(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
 
+// SIKE's encapsulation using two threads, with the same input and outputs as crypto_kem_enc_SIKEp751
+// The ephemeral key generation runs on a persistent thread pool owned by the library (POSIX threads), or in the calling thread if unavailable
+int crypto_kem_enc_parallel_SIKEp751(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+
+// Public key prepared for repeated encapsulations to the same public key by crypto_kem_pk_prepare_SIKEp751
+// It holds a copy of pk together with its decoded values and the recovered curve constants (6 GF(p751^2) elements in Montgomery representation)
+typedef struct {
+    unsigned long long curve[144];
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES];
+} crypto_kem_prepared_pk_SIKEp751;
+
+// Preparation of a public key for crypto_kem_enc_prepared_SIKEp751
+// Input:   public key pk         (CRYPTO_PUBLICKEYBYTES = 564 bytes)
+// Output:  prepared public key prepared
+int crypto_kem_pk_prepare_SIKEp751(const unsigned char *pk, crypto_kem_prepared_pk_SIKEp751 *prepared);
+
+// SIKE's encapsulation to a prepared public key, with the same outputs as crypto_kem_enc_SIKEp751
+// Input:   prepared public key prepared, obtained with crypto_kem_pk_prepare_SIKEp751
+// Outputs: shared secret ss      (CRYPTO_BYTES = 32 bytes)
+//          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = 596 bytes)
+int crypto_kem_enc_prepared_SIKEp751(unsigned char *ct, unsigned char *ss, const crypto_kem_prepared_pk_SIKEp751 *prepared);
+
+// State of a resumable decapsulation, see crypto_kem_dec_init_SIKEp751
+typedef struct {
+    unsigned long long opaque[1184];
+} crypto_kem_dec_state_SIKEp751;
+
 // SIKE's decapsulation
 // Input:   secret key sk         (CRYPTO_SECRETKEYBYTES = 644 bytes)
 //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = 596 bytes) 
 // Outputs: shared secret ss      (CRYPTO_BYTES = 32 bytes)
 int crypto_kem_dec_SIKEp751(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
 
+// Resumable SIKE decapsulation, with the same inputs and output as crypto_kem_dec_SIKEp751
+// crypto_kem_dec_init_SIKEp751 starts a decapsulation of ct with sk, which must stay valid until crypto_kem_dec_finish_SIKEp751 returns.
+// crypto_kem_dec_step_SIKEp751 runs at most budget steps (ladder bits, or tree traversal multiplications and isogenies) and returns 1 while steps remain, 0 otherwise.
+// crypto_kem_dec_finish_SIKEp751 runs any remaining steps, outputs the shared secret ss and clears the state.
+int crypto_kem_dec_init_SIKEp751(crypto_kem_dec_state_SIKEp751 *state, const unsigned char *ct, const unsigned char *sk);
+int crypto_kem_dec_step_SIKEp751(crypto_kem_dec_state_SIKEp751 *state, unsigned int budget);
+int crypto_kem_dec_finish_SIKEp751(unsigned char *ss, crypto_kem_dec_state_SIKEp751 *state);
+
+// SIKE's batched encapsulation, four public keys per call
+// Input:   public keys pk          (4*CRYPTO_PUBLICKEYBYTES = 2256 bytes, the j-th key at pk + j*CRYPTO_PUBLICKEYBYTES)
+// Outputs: shared secrets ss       (4*CRYPTO_BYTES = 128 bytes, the j-th secret at ss + j*CRYPTO_BYTES)
+//          ciphertext messages ct  (4*CRYPTO_CIPHERTEXTBYTES = 2384 bytes, the j-th ciphertext at ct + j*CRYPTO_CIPHERTEXTBYTES)
+int crypto_kem_enc_batch4_SIKEp751(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+
+// SIKE's batched decapsulation, four ciphertexts under the same secret key per call
+// Input:   secret key sk           (CRYPTO_SECRETKEYBYTES = 644 bytes)
+//          ciphertext messages ct  (4*CRYPTO_CIPHERTEXTBYTES = 2384 bytes, the j-th ciphertext at ct + j*CRYPTO_CIPHERTEXTBYTES)
+// Outputs: shared secrets ss       (4*CRYPTO_BYTES = 128 bytes, the j-th secret at ss + j*CRYPTO_BYTES)
+int crypto_kem_dec_batch4_SIKEp751(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+// SIKE's batched key generation, n key pairs per call sharing the final inversions
+// Outputs: secret keys sk          (n*CRYPTO_SECRETKEYBYTES = n*644 bytes, the i-th key at sk + i*CRYPTO_SECRETKEYBYTES)
+//          public keys pk          (n*CRYPTO_PUBLICKEYBYTES = n*564 bytes, the i-th key at pk + i*CRYPTO_PUBLICKEYBYTES)
+int crypto_kem_keypair_batch_SIKEp751(const unsigned int n, unsigned char *pk, unsigned char *sk);
+
+// SIKE's batched encapsulation, n public keys per call sharing the final inversions
+// Input:   public keys pk          (n*CRYPTO_PUBLICKEYBYTES = n*564 bytes, the i-th key at pk + i*CRYPTO_PUBLICKEYBYTES)
+// Outputs: shared secrets ss       (n*CRYPTO_BYTES = n*32 bytes, the i-th secret at ss + i*CRYPTO_BYTES)
+//          ciphertext messages ct  (n*CRYPTO_CIPHERTEXTBYTES = n*596 bytes, the i-th ciphertext at ct + i*CRYPTO_CIPHERTEXTBYTES)
+int crypto_kem_enc_batch_SIKEp751(const unsigned int n, unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+
+// SIKE's batched decapsulation, n ciphertexts under the same secret key per call sharing the final inversions
+// Input:   secret key sk           (CRYPTO_SECRETKEYBYTES = 644 bytes)
+//          ciphertext messages ct  (n*CRYPTO_CIPHERTEXTBYTES = n*596 bytes, the i-th ciphertext at ct + i*CRYPTO_CIPHERTEXTBYTES)
+// Outputs: shared secrets ss       (n*CRYPTO_BYTES = n*32 bytes, the i-th secret at ss + i*CRYPTO_BYTES)
+int crypto_kem_dec_batch_SIKEp751(const unsigned int n, unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
 
 // Encoding of keys for KEM-based isogeny system "SIKEp751" (wire format):
 // ----------------------------------------------------------------------
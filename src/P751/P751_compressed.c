@@ -382,17 +382,36 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define mp_add_asm                    mp_add751_asm
 #define mp_subaddx2_asm               mp_subadd751x2_asm
 #define mp_dblsubx2_asm               mp_dblsub751x2_asm
+#if defined(X64_CURVE_ASM)
+    #define xDBLADD_asm               xDBLADD751_asm
+    #define xDBL_asm                  xDBL751_asm
+    #define xTPL_asm                  xTPL751_asm
+    #define eval_4_isog_asm           eval_4_isog751_asm
+    #define eval_3_isog_asm           eval_3_isog751_asm
+#endif
 #define random_mod_order_A            random_mod_order_A_SIDHp751
 #define random_mod_order_B            random_mod_order_B_SIDHp751
 #define EphemeralKeyGeneration_A      EphemeralKeyGeneration_A_SIDHp751_Compressed
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp751_Compressed
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp751_Compressed
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp751_Compressed 
+#define EphemeralKeyGeneration_A_ws   EphemeralKeyGeneration_A_ws_SIDHp751_Compressed
+#define EphemeralKeyGeneration_B_ws   EphemeralKeyGeneration_B_ws_SIDHp751_Compressed
+#define EphemeralSecretAgreement_A_ws EphemeralSecretAgreement_A_ws_SIDHp751_Compressed
+#define EphemeralSecretAgreement_B_ws EphemeralSecretAgreement_B_ws_SIDHp751_Compressed
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp751_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp751_compressed
+#define crypto_kem_enc_parallel       crypto_kem_enc_parallel_SIKEp751_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp751_compressed
+#define crypto_kem_keypair_ws         crypto_kem_keypair_ws_SIKEp751_compressed
+#define crypto_kem_enc_ws             crypto_kem_enc_ws_SIKEp751_compressed
+#define crypto_kem_dec_ws             crypto_kem_dec_ws_SIKEp751_compressed
 
 
+#if defined(FIXED_BASIS_LADDER)
+    #include "P751_compressed_ladder_tables.c"
+#endif
+#include "../safegcd.c"
 #include "../fpx.c"
 #include "../ec_isogeny.c"
 #include "../compression/torsion_basis.c"
@@ -6,6 +6,8 @@
 
 #ifndef P751_COMPRESSED_API_H
 #define P751_COMPRESSED_API_H
+
+#include <stddef.h>
     
 
 /*********************** Key encapsulation mechanism API ***********************/
@@ -18,6 +20,9 @@
 // Algorithm name
 #define CRYPTO_ALGNAME "SIKEp751_compressed" 
 
+// Size in bytes of the caller-provided workspace of the _ws functions, which holds the large temporaries that the other functions keep on the stack
+#define SIKE_WORKSPACE_BYTES    184320
+
 // SIKE's key generation
 // It produces a private key sk and computes the public key pk.
 // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES = 414 bytes)
@@ -30,12 +35,23 @@ int crypto_kem_keypair_SIKEp751_compressed(unsigned char *pk, unsigned char *sk)
 //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = 410 bytes) 
 int crypto_kem_enc_SIKEp751_compressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
 
+// SIKE's encapsulation using two threads, with the same input and outputs as crypto_kem_enc_SIKEp751_compressed
+// The ephemeral key generation runs on a persistent thread pool owned by the library (POSIX threads), or in the calling thread if unavailable
+int crypto_kem_enc_parallel_SIKEp751_compressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+
 // SIKE's decapsulation
 // Input:   secret key sk         (CRYPTO_SECRETKEYBYTES = 414 bytes)
 //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = 410 bytes) 
 // Outputs: shared secret ss      (CRYPTO_BYTES = 32 bytes)
 int crypto_kem_dec_SIKEp751_compressed(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
 
+// SIKE's key generation, encapsulation and decapsulation using a caller-provided workspace, with the same outputs as the functions above
+// The workspace must have at least SIKE_WORKSPACE_BYTES bytes and be aligned to 8 bytes, otherwise the functions return -1. It is cleared on return
+// and can be reused by subsequent calls, but not by concurrent ones.
+int crypto_kem_keypair_ws_SIKEp751_compressed(unsigned char *pk, unsigned char *sk, void *workspace, size_t workspace_bytes);
+int crypto_kem_enc_ws_SIKEp751_compressed(unsigned char *ct, unsigned char *ss, const unsigned char *pk, void *workspace, size_t workspace_bytes);
+int crypto_kem_dec_ws_SIKEp751_compressed(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, void *workspace, size_t workspace_bytes);
+
 
 // Encoding of keys for KEM-based isogeny system "SIKEp751" (wire format):
 // ----------------------------------------------------------------------
@@ -94,6 +110,13 @@ int EphemeralSecretAgreement_A_SIDHp751_Compressed(const unsigned char* PrivateK
 // Output: a shared secret SharedSecretB that consists of one element in GF(p751^2) encoded in 188 bytes. 
 int EphemeralSecretAgreement_B_SIDHp751_Compressed(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB);
 
+// Ephemeral key generation and shared secret computation using a caller-provided workspace of at least SIKE_WORKSPACE_BYTES bytes, aligned to 8 bytes
+// They have the same outputs as the functions above and return -1 if the workspace is too small or not aligned.
+int EphemeralKeyGeneration_A_ws_SIDHp751_Compressed(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA, void* workspace, size_t workspace_bytes);
+int EphemeralKeyGeneration_B_ws_SIDHp751_Compressed(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB, void* workspace, size_t workspace_bytes);
+int EphemeralSecretAgreement_A_ws_SIDHp751_Compressed(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA, void* workspace, size_t workspace_bytes);
+int EphemeralSecretAgreement_B_ws_SIDHp751_Compressed(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB, void* workspace, size_t workspace_bytes);
+
 
 // Encoding of keys for KEX-based isogeny system "SIDHp751" (wire format):
 // ----------------------------------------------------------------------
@@ -0,0 +1,2241 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: precomputed tables for the fixed-basis three-point ladder for P751 when using compression
+*********************************************************************************************/ 
+
+// Alice's table {x([2^i]QA)}, i = 0,...,371, of affine x-coordinates in GF(p751^2) on the starting curve E: y^2 = x^3 + 6x^2 + x,
+// expressed in Montgomery representation. Each entry is stored as {x0, x1} (192 bytes per entry, 71424 bytes in total)
+const uint64_t A_ladder_table[OALICE_BITS*2*NWORDS64_FIELD] = {
+0xCDD55D2646A1DE32, 0xAA056CDD8B80E53E, 0xAA87189B3A885C53, 0x9F6D9809057564A1,
+0xC59794A13E1D38B8, 0x97F8ED39F3FA7DE5, 0xFC0CAF68C8B95129, 0x393F28B240A42FFE,
+0xCD99B2F9792DEF96, 0xF1036825CBF416B9, 0x877B835F0533F2AE, 0x00000CDFFE238E18,
+0xAC4EF1B17010B136, 0xEC411E1B5AD8A667, 0x7737372EDB66A1AF, 0x43593ECED672CF87,
+0x1E418547C7B8A975, 0x8CC78DCB18BD469A, 0x6C9FB93FD2EF8496, 0x8A4AC42666AB8545,
+0x8A973B8387C15F1D, 0xC1657503D4BB4ADA, 0x22F49E4311D7BBF0, 0x00001299B8FDA94C,
+0xAC2B2D74F883DFE4, 0xDA9B5D82CAA27D78, 0xF8656EBC40D57F4C, 0x5E1CD5BDBF041897,
+0x1A30C6A718D110C8, 0x3C8DEF0DC70D6806, 0x91AB2C2C9282D88C, 0x8B6AEDD25D129720,
+0xAA92DD198282D20D, 0x0976B9255CB297EB, 0xF6D8AB5C106EBE7A, 0x00000C5FB17B0515,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x41FEAA3F23179F5A, 0x97F8BC8686891429, 0x56686BC64B25B1FF, 0x2CC4DECC8CA1D20E,
+0x6AD16AF6F21BD80F, 0x215BFDB8AC2567EE, 0x9342D99E4B5E85E2, 0x820AFE8C6DAC811E,
+0x9E01954F4458E2A9, 0x627C71B18099B9B2, 0x64791AD62ABDBCB9, 0x00003989A79EAA53,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1896832C8E420AF2, 0x201684DF9A73CD95, 0x5B8BD5CCFA47E7DB, 0xB9C637B9DDB78EA9,
+0xB6FA06910C4576EA, 0xC59FBB74B0F51F6C, 0x650AC6FFE031F50C, 0x2A825C695A766EA8,
+0x9D86D4B051651720, 0x9A82C97B1A2BAF7D, 0xACB2C843383E559F, 0x000049F1FC564E65,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2497081E98D2BA3C, 0x984E40412694B161, 0x93BB72B5CCB1484D, 0xC195C4D32240423A,
+0x382B0072EE919E37, 0x649D8D479807ED4C, 0x563E2252AA9F13CE, 0xC7EA1D0AD8EBCCF2,
+0xCAA9E77F060A231C, 0x1FBA6ADDBBB50C80, 0x7B1455DBF4207395, 0x00005CCFFC6A7DD9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7DE89EB39CBDA808, 0x106C387265B69E3A, 0x8CF3A280D95F3FEC, 0xA76317D104A9C84D,
+0x7BFDD754FE07719C, 0x255C0F6D3528D7A0, 0xAC1C02ED459EFA75, 0x0C8C3B5C84BD8B40,
+0x3F58473798F35175, 0xBCF01493A295D016, 0xB5F9C95BE3A74150, 0x00005DD2559ED1AA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x18C5CB26C857A34F, 0xCEBE765747D8ABA0, 0xDE857021D0BC3BC0, 0xFAEFC794723E74A4,
+0x9FAE9057F8A57AB4, 0x64B3DBB3F9216329, 0x6417CED91DCD1B39, 0x1D84AC09A0848C8F,
+0x353EDA86867F9538, 0xD6DECD2DF6EACF0D, 0xF7EA3F3FC1064DC5, 0x00006028572DD5A4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF7BBF940DB209EC8, 0xF508512B81BAA047, 0x3604A37B3C0F7250, 0x01A5AAC257B46434,
+0xE9A7DCD97783105D, 0x47CCAB56484A3AE9, 0xF9F2E18315E8FFCC, 0xF3E625B4E5741C8D,
+0x158E21E431CC221D, 0xD9371535A6D9A48E, 0x2D0E790A6E3997A7, 0x00004BFD88C09201,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF69CB74F4B1E7F4C, 0xFE2141EC83DB9093, 0xC737A8013581358C, 0xEA1B48DD7839A2B9,
+0xE6C3BA0539731E55, 0x3878934AFCB2DBA2, 0x0DD9CEFC437E5950, 0xE3F1A419D0E19A2F,
+0x23F1B5F6C5E7B294, 0xCFE0252276E2F425, 0xEF185D79AC696D39, 0x000060242C17AA31,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE55BE122B6766AD3, 0xE45AE41FD3CC1390, 0xBC667DFA66539555, 0xD85470081E324755,
+0x678E52FB7559B94D, 0x4563A7C24B6A3824, 0x598FA5D5884982C0, 0xB2150B1CA0D4AD3D,
+0x6871B34DBE9D6E34, 0xCFD16934B593BE3F, 0x4CD48E6C7D24775B, 0x00001300A00C94C3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD5EF67D174FCFEB3, 0xEC581EE34206DE9D, 0xC0A40DF96BAE4C15, 0xAB5797EC29219B32,
+0xE37FF347DC996140, 0x60D5D81C58B1F068, 0x6C68FF74AD464AE3, 0x4F54D3228027732E,
+0x5A1AFBA04CC60644, 0x0101E249B29A3229, 0xA8C7A20D23186D44, 0x00002A542C58A017,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA05EAAB8C9B95006, 0xBBACD4C2509610B8, 0x1BD0354BA8EE1C41, 0xB63DE836D1CF448D,
+0x2C3D81D0D6001430, 0xF17E5F1599B51142, 0x749992507D48EC35, 0xB5456C8ED1D54F0C,
+0x436707D1AAA40CFB, 0x61C00AB302054FBF, 0x922340438DB5609A, 0x00003B32C0791404,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAD41F9E45A765167, 0x52FB46556B4C4239, 0x05B393866A3DC800, 0xF6FB9729D903C714,
+0x525846399056D232, 0x6494FFB8CEEA4336, 0xC41819AA8808712C, 0x5E1AA266792E0F0D,
+0x972C3A4D875C2691, 0xC421C8A8516A0F00, 0xF7107AB52BDFB43A, 0x00001FBB33882609,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC1FF64E6AD7B98B0, 0x68CF36453DAAE4DF, 0x387ADFB2F5305825, 0x80731715ED3D5891,
+0x22AD8F352BB7391F, 0x5DE05D7556AF5DAF, 0xED1DC2EF8AEE34C5, 0x30C756E3F4AFF29F,
+0x6A6659354543E8FB, 0x90457E3DC4DC6382, 0x93F41D7AAEB10117, 0x00006B89051CFBDF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x609599110A5AAA0C, 0x3BD789C721897187, 0x50D3EF6A13105673, 0x9E5E02B09FEECC22,
+0x2704C3833EF70F47, 0x8529277154B8E684, 0x1A9C36A87538E5EE, 0x7FA069FE61EF96BC,
+0x283F5B03F4DBCA91, 0x4A325F1A7D4F80EE, 0x9C845FCFBFB4632D, 0x00001B5CEFD0D4DF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x99C76C144C009B33, 0x334DC40BBB3996AD, 0xBEAFD2D89C78248A, 0xFE7EB7CD75CEFA17,
+0xA0D2442A24979501, 0x8D88E9DA87B24482, 0xA2ACB616D00DD97F, 0x2DCCA8CAC272AA8F,
+0x14CAF0570CEA072B, 0x8C3A91764E39173B, 0xF832039824190B43, 0x0000061C0B85EA78,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF36EBB47B781872D, 0xBB3313F7A7FE6FEB, 0x2F27EC12360FA186, 0xF7D1291D514D318A,
+0xDFBBFAC6A8FD3E73, 0x4E7EE25B8427BB93, 0x696EAEC7F061FBDD, 0xBE92F94A6CA799B6,
+0x7E008F0BBC0658C6, 0x47C488CB069B8586, 0xA87D6F8658DB9652, 0x00006DFF9A83D954,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x65D540EDC0140E79, 0x52BBF1B531AD2B9B, 0x2EBCBE11E5744F3A, 0x37D9B7E64E682E38,
+0x9E92A2C536AC0EBF, 0x043A6DF5D1FF8334, 0x62D27980EC86F0BC, 0xC4930A81944F085C,
+0x03B9C56E13C30B5E, 0xE872F10110AE3683, 0x2015FD6F7438FD9B, 0x0000125AA060C4D2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x683E09E6EB308166, 0x802C1C9A976F5102, 0x8B97D106DB5A63D9, 0x69C944E2207D9447,
+0xCABD0048D82F911C, 0x1A5FB7383E246D8A, 0xE94E53DF31CD6B0E, 0x68982A0E589CAADE,
+0x6DBD7E6879B23038, 0x5E542F05891BC0F5, 0x0CE692157814C723, 0x00002509F9ED2FDB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x454B7D047FFBAEBE, 0x5A3EF9383FA81AAD, 0xD72564A33F1684E5, 0xE8B48A5A8711C893,
+0xDE2829583D87485A, 0xDE47090B68C8AC28, 0x2BA7F53F6325F08F, 0x7EFCF2939E9F6A93,
+0xCFF16552C64A9AB8, 0x89A3635E5891A90C, 0x3106FF69DFA9B6BC, 0x00004B946570DEFE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE4B4FA14993DC819, 0x927A5100C8F0E638, 0xB830FFB7DB41E9B9, 0x380F40E0E413D841,
+0x9EE079D9150DC8DB, 0xB1B6B2B9224C3045, 0x94AB9E1E83C37AE3, 0x6084ACD7154B1182,
+0x15C769436A9D6E36, 0xCF53B754FCFA08FE, 0x2B60F2F565A1EAE8, 0x000061AF75D467B4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x81C492FEF2203A91, 0x487972102B68900E, 0xA6960606722DF71D, 0xD7479A64EDF4B88C,
+0x0CCCF6112C1690AC, 0x11AE2655AF226A1E, 0xE907D433A28B952E, 0x2CEAE7FB3AD55DA8,
+0xEC73EE0F90B24F17, 0x6BA9D16366B71484, 0x3B26C4037C479DBE, 0x00000E319F019B19,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x664E06C79363158B, 0xE79D2DB253CFDB2B, 0xE3C5FA1FD411FD73, 0x105EB6D5FB0F4F86,
+0x115FED122871934F, 0x088DF6EB5A6663D6, 0x5662A2FD32035464, 0x8971C51920F45AAA,
+0x37AF82F0C96CAC99, 0xAB13D4194045F587, 0x4A1BB2B1095A0358, 0x000018E6108F012F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC5CA22063BB96633, 0x0ADF526D169E1212, 0x75462201B9F592B1, 0xF42C6A51ACF650A7,
+0x38305A0D37698AA5, 0x83C66261A6833DEE, 0x6A347A0E16AFFC84, 0x43ADE7511B476C1D,
+0xFBB9C8F0B13D2759, 0x56ED123A36C71DAB, 0x2923321FA2FED61C, 0x00004B0756643DC8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1EE5F3851AD8B8A1, 0xAB016A4C2E4CC7CB, 0x7279A26C789D3D02, 0x4931277F21C77C5B,
+0xF7B0D25915BFE3F6, 0x97FA4F5920085F2E, 0xE5E9E6F521E5FCFF, 0x8D889CE33BD3A957,
+0xCC57F6EA4E8DA773, 0x74763477B7F0D597, 0xFBB2D49113DC7982, 0x0000106920DD7333,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x651B31593DB07D9E, 0x55E0ED4E37A0B6CB, 0x9CAE3BF52D139480, 0x1D534D5CD1A32673,
+0x91E33F64C6ED9C03, 0xF1565D34D304A4D6, 0xA42206DEAC5FABFE, 0x7D88E5D553F85896,
+0x88D89511450282BC, 0x000E0EB0DDBC4AA0, 0x3B287DDAA70573B6, 0x00002788A682639C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x02AEEE0069F9B215, 0xFDF13FB76C0A815F, 0xA50A0470D1F6C56B, 0x30CC06CBEF9AA555,
+0x04656CCCC9E12E84, 0x7F82C7F619A20F3A, 0x4CFAD1D4F76A3063, 0xF338032F9844B3ED,
+0x1612C5C79B4FD605, 0x1B0F8551B988351F, 0x342EEB145AE794E8, 0x000025160787D345,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB1C5C8DFDFCCB9AB, 0x0BA019F769D4C916, 0x25D8192A7959A3EE, 0x0C8A40E3E303C0C3,
+0x74068F581FADE821, 0xF2C1807F63DCE343, 0x85C42E61663E78F5, 0x01D5FC94300F5A0F,
+0xD0220A8123DD653F, 0xCEE61846477E11BD, 0x3A17BCE6FDE5A91B, 0x00005D5F18A32907,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE5D2302CF47558D6, 0x4806747FAF5DCAE1, 0xA99CF095ADFA9E0C, 0xF0DC92A8BF044293,
+0x655947A0DBF317DF, 0x4710E5191E379855, 0x181B231983753FC1, 0xE9B3765381AA8EB8,
+0xB214FBCFE50F8697, 0x3D0AD04258FED846, 0xD5129F86D51C9377, 0x0000286DF2273255,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC69587B26C22FB24, 0x1AF7CB8C459E0F80, 0x3F521FE012BEBF8D, 0x0C0CC4E0B5870A33,
+0xFEC49CEDBB053935, 0x9E8CB85E71160E19, 0x1C13716947E3C318, 0xE2A6C859D0F55230,
+0x5013ECBC54562C85, 0xC569082DCDE4BAF5, 0x2DE03F4277E7E61D, 0x0000079FE8723E70,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2DF09C4A5D3D0B51, 0x061B9A332C3BA401, 0x971E95552D7B1954, 0x7A96E5EEF93B398A,
+0x15695E1392784958, 0x1EE9D655475CAC09, 0x9DFC02FAEA1AF3A3, 0x52B24F23E30D81AA,
+0xB293CA014DDDEDBF, 0x3DC874439B589AED, 0x2AFC0476FA203937, 0x00002420C8B74753,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5687620B66722E05, 0x2DE8E4F270898DE3, 0x7ACAFF0EFD554C0F, 0x73ED8FB50364107C,
+0x929188B715DB705E, 0x54385429ACCFD4B5, 0x6A2966A2C243328F, 0x8614D98DB5005586,
+0xDEAF7B2E673A4360, 0x144BC7A9D68277D5, 0xB44D03D753BD68E1, 0x0000207D80AE3E67,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF7FA1610D99DBC83, 0x53D6099A888B5118, 0xC5E2B2C51DF1B07D, 0x56ABF6C122A645A2,
+0x241E92B82A7DC020, 0x3458A23E81D3C331, 0x8DDEBEA091121014, 0x491DE89ECB940AA3,
+0xD207030AF2771336, 0x18E7C0D76755B55F, 0x3AA0532E4494E0E7, 0x00001B6382ABD379,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7D82181A28F1D01E, 0x3761143898D00F24, 0x34FFE8CD5550AAB1, 0xCC450906D4EEF821,
+0x0B06A3475DC44017, 0x84DCB5AD606926C1, 0xB8176AB7C97E991C, 0x2B891254B52BDF15,
+0xFF910C1CCCD68EC9, 0xBEFF00FEC2E060B2, 0xA707D43C54FFF9E9, 0x00000C73E7855C81,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x597C3A8BECF955F1, 0xABAAE22AB7A0EC58, 0x2A049C653DA2211D, 0xACA2D1AF447FBC4C,
+0xA50A55B0789EEC3D, 0xBC2A9D9A1F9EDECB, 0x920496726B30E2BC, 0x7596B7547964CF5D,
+0xE132BD323615794D, 0xC15723FE22C0721E, 0x64AAAA54BB83E0BA, 0x00005D4FC9DB4160,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF49B2B576F58D095, 0x186F468FB8151454, 0x64A9079E6EAF076D, 0x77EC18A7B87EA755,
+0xE5B9F5BF0F2D3F57, 0xADC8E469304AD593, 0xB05670BCB79FAD77, 0xC250C4D320D80D8F,
+0xC39270B19DBFC66F, 0x2765623564A93417, 0x1E918467C69D91AE, 0x000046B79AD920E7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x34AAF502D1A55421, 0x445B83A1BBC8BEA8, 0x2AD0171E35B1ECA4, 0xC259A19AFE15043C,
+0x6B631CF467A00498, 0x9B403BA3DFC3E2BC, 0x345C05F412B58C75, 0xF5CA85852D8DAE4E,
+0x988D735C426CF81D, 0x9FC9A75F1D10E6BB, 0xA306190FB03DCE07, 0x00001CD31EE8171E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5D2E3F10E7567FC9, 0xFB937675D2A21C6C, 0x4142274776509836, 0xCE5273859476DDDD,
+0x83647388C07A74DA, 0x51BC4FED2F6D97AD, 0x338D91533E4C69E1, 0x7E7AE2607D4DBEE1,
+0x18124E8778F2022E, 0x48E7C28D4D0D1DC2, 0xD421427F2ED4B25F, 0x00002B1F93E18670,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0F438EBE196094F3, 0x8637338619EC997D, 0xB07E01AF5F939214, 0xF21D2A1B8133F21C,
+0x00803010C2485ED4, 0x96B8EAE4ED42B8ED, 0xFE5357231E379532, 0xFFFF858DB0BE9088,
+0xC0708DC63EBF6418, 0x494277E6CE0D18C2, 0xEA37A4F975743A44, 0x00002F94803FB819,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1B3703174E321039, 0x4A99AC81271D784E, 0xB6C6AC73191B5A7B, 0x67F2E53F7C094E9B,
+0xFD603CB64C10D475, 0xD15D9B171110B528, 0x98350C5B1A617958, 0xE222E89CAF749786,
+0xF7C2F2AE7C765739, 0x92488518135059EA, 0x4890B7745D0F52E2, 0x00001F7BEF26E023,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x666B79F32BD49EC3, 0x02A69E5E8A12EF67, 0xFCFB61D335FFD378, 0x03355B9EB9AE86B6,
+0x5286E07E1B607206, 0xB2FF7A09B0F20260, 0x993E5B73B73B011E, 0x84A9B17F530EDADE,
+0x14630F7289B105CD, 0x98E2031705208ECF, 0xABBDA81DE1F4E4CF, 0x0000245E858854DB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA13BD3E18B1A8FCC, 0xE69D441EB9CB6561, 0x6266491E09271566, 0xA8E2CA3CFF37FF85,
+0xB2F0983DBEDD2167, 0x965F6DB131ED4605, 0x06D8CDC1CFD9B960, 0xA50D4AFC991C41E7,
+0xD6C06C8FA2136AEC, 0x9668C34A45B4AB9A, 0x2EAD0C3065BE110E, 0x0000512565D2B7F3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA15419F0D36734F8, 0x8941F251A760DBB2, 0x2C9A65F91A3268F8, 0x3571A4992D55A7FF,
+0xF763B542177F1884, 0x7639068FB5B554F2, 0x3FC3E21E9620E673, 0xA10A09BCE3C91150,
+0x237197C459E6DA68, 0x6B4F0BE7EAE6DACE, 0xF3C1C0D690C91DC4, 0x00001A56BA404086,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3444D1A6B405095B, 0x3D5F404B487996BA, 0x6023D7D2958CD968, 0xC3EDA0C8B609DD08,
+0x05F66725C52DCEC0, 0x2321926881956964, 0x54A65273E9923BAF, 0x1CCB53C80C25BFBA,
+0x5BE47C4F30EB7E0B, 0x192B387EE97D341E, 0xA44B030516790E1B, 0x00005A7F54F23021,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC6CAA597D2569E00, 0x23AB1D6CB132C96A, 0x5AC33A36A13ADA41, 0x7337F24A4870230E,
+0x5897F52FD63E967C, 0xA5E5DEB0C4AF9F17, 0x0D3F7A6B75272FB6, 0x195FFCC1F4CEC069,
+0x5644DC02BC8D0B3A, 0x2F1924DF02967A28, 0xF3209B875FA0CC74, 0x00003D8BFB6E9496,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x623FC7C40F58A259, 0x2D6B1E55EB2316F3, 0x7AD3A88F414A4091, 0xA61CC91772636369,
+0xB518BE3270A84D38, 0x82EA0CFE2015C683, 0x73C81AA3F5294496, 0x4A1CB8797A710C2D,
+0x26F8703D0207D5AA, 0x75685A1C928A5D75, 0xB01F71E33B5316AB, 0x00005A73647691F0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA0C2C814ADE045C3, 0xA7A5DBB027B96B31, 0x214A4B9E823746C3, 0x8888BCB73B2527DC,
+0xA2F2B092F8CB11B0, 0x7280A7653E5ACEBF, 0xC55E4FD4DD292196, 0x2A72BA91392E8DA2,
+0xA05E50DF78C518DB, 0x1FECC5CF335F8A5A, 0xE30A393467B4FB9B, 0x000060C7C142D44C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAD74F354586C62BB, 0x85BFFA53FEDC63A7, 0x68C21E3D7F7AFCFB, 0x4E4396E2EB99CA54,
+0x614F48E64DD5AB46, 0x6967469CB04A164F, 0x046463BE1BB7491B, 0x20977E99FAC03306,
+0xD08B3EA9C14A078E, 0xECFF43E337A20C68, 0x26B5F58B600D5765, 0x0000007CDD39EE51,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x35A120BE13B6B8B6, 0xF3D6C1F924010A58, 0x772155E01CA67183, 0x14B637B57CCBC012,
+0x3E408A44A643A2B4, 0x287B159D52127588, 0x3349C446BCA9E71E, 0xCC6DC7CCE164D5E2,
+0xB6F376AFBB8C0A0D, 0x2911136EC92F6A0E, 0xBEAFD7F1E7B582B6, 0x0000657488887EF2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7ED54E50F2544726, 0x3BAA66A1E177E704, 0xF8F42D125389D478, 0x14C40E3565C380ED,
+0x72560A4E6EA5FC18, 0x2665A3F8ED6F42A8, 0x624DF26F440931A6, 0xC44D858B995AC7FD,
+0x0FCE1EC4FBD02CB9, 0x016216CE3C23F21F, 0x8B674D4E1D458094, 0x000024D94184613B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB7F50E5A5E06AD12, 0x6FB22BE8CA68E941, 0x2FE78899EC68153A, 0xC2952CA8BF7BDE8C,
+0x9AB36AECD51211E8, 0x44A09EAD1B1361B4, 0xF620A4F37B54E3DE, 0x76863C7F659AF7AC,
+0xCF11DC10933B37A2, 0x414B5B57EAB5173D, 0xC326FF14DC6ABA9F, 0x00000E86DC19498F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xADA5D1B22D69C56A, 0x7A373E94D0855B75, 0xBDAC2FAE54B27E57, 0x593555028749E0D3,
+0xAC1EF8B5CB03ECC3, 0xC44F6B0DE9BA20DF, 0xD84E7C1EC5862515, 0x44A99F0112322FD2,
+0xB754542CC9906046, 0xF6788C6741B43BA3, 0xA67241E773847F65, 0x000068B1F0E90317,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9DA9EF9A08A56101, 0x09DD2F75105150BF, 0x14574CBA104B4AD8, 0xBA16B8116E9EF3EF,
+0x5344EBCB004C928B, 0x56F61018B8073DF8, 0x8CED1A9B6976D004, 0xADFC436A0F60752C,
+0x4332FF84CF09477D, 0x992FA064EA6B974B, 0xE348D0302FD0457A, 0x000030E0D636EC47,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9C145DF538812328, 0x76419C2C31488AB7, 0x7A71297E24CA807E, 0x6C842B7C3B79C8CF,
+0xCA3BE614CAFEB8B0, 0xA310989AAE3291EA, 0x91F897AE72F84429, 0xC2316E60BACFEB14,
+0x7FE9F5ECD4396354, 0x66B2DFE12209391F, 0x0D87EFEFBC45DF92, 0x000048B6B56FDE0B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE2C7F5DF19EE0CB3, 0xC6F96078EAD43607, 0x8782923662CDF6E4, 0x63C29AA976C39E6B,
+0xE974565276D59E47, 0xAFCD716ABDD9EE17, 0x0C58E8F7D6D7A1D7, 0xF8D13D09A85BEACE,
+0x41ECE2BF8AA97DF4, 0xD8289AF0F7FFC382, 0x72702B69A93DA06B, 0x00000590087B32BB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x64FDEEAB00411A77, 0x8A9623FF15706840, 0x955F59610A3DA2D1, 0xEA806BF416FFDB87,
+0x8C9C3F9032B022D9, 0x760EFB88C5707507, 0xCC7FDFBB726D0054, 0xD704C3F8E163A326,
+0x1F8E36E02904F84A, 0x67727176B1932858, 0xD9FAEAA1F328CAB8, 0x00002B300DC14096,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC56E5633CACA7F67, 0xEA69E34F8058B253, 0x55333AB738523D4F, 0x44A28321D859CCA4,
+0xC4741E48BB59FF39, 0x1BB7CD9FFB261ED8, 0x0C568A0ED35D3D67, 0xFC8381E12446B96A,
+0x1D50203653EAFFA3, 0xDA1640A3C60099A1, 0x333F60ACAA345F29, 0x00006D73745B37C0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9B66044FE02B32F4, 0xF6B61734BF44BFEF, 0x9A76936ADAF5A86C, 0x52C9707CE8F3F0B2,
+0x228A4631C3FEFB84, 0xF7DA4A34CE6C5014, 0xACA1D438B4EEA89C, 0x8C62F072097DF8A0,
+0x34466179EB6A7656, 0x4057D93EEEC7A7DB, 0xA63C08B850FE0D23, 0x00006EF104756F7A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB5334245F8D19D75, 0x14443280A700CB82, 0x669C23E505DA076F, 0x63492A318B49DCD9,
+0xF83496241E141A20, 0x022119ED1BE0EE5B, 0xDBB328D80539A99E, 0x74B1E07006E0E6D2,
+0x6873932A9724E1BE, 0x2FADA3F08A558AA5, 0x9042690B37963E33, 0x00001C46AAF070E7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x51D55BE908BC68C5, 0x68EB810C0FEC769A, 0x822669571F93C810, 0xB0DD1795BF9DE8C1,
+0xBE531844CBA15E7F, 0x1D97606E71A0B964, 0x1159F37E89A454B6, 0x9B24352DD4EFA0C7,
+0x24DA6F340F3D45B2, 0x21791C2233E55A72, 0xF32BC4811B80B268, 0x00004CA75B39F14F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0A72A42FB4601987, 0x72F3C5B2C2C3E985, 0x3BF96FCDEF5BAC5C, 0xA28A32775791104E,
+0x56E398FED35F667E, 0x9B41C78D20512197, 0xE71A54F41722FB5B, 0x462D109C2F0275C3,
+0x5F9771191B05D953, 0x94859CD248F428DD, 0xBDA59540D10F2FA7, 0x000029796F393BB1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9DC1C12BC1FEF78E, 0xDAE7B42E6C3F9BD2, 0x997ADB902C54695B, 0x86A6BD45A5B24127,
+0xF10790CB73A9BFFE, 0x607E51848F497A1A, 0x453EF18316E933C2, 0x523839203E5EDFF3,
+0x80335E75194ED74F, 0x0B43426C7A7D9DB6, 0x2817EFA3876B5D1E, 0x00004F5FEAF79265,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA1322EF0ADEB67C2, 0x58B475B17EC4BC7D, 0x0E13016825C6A5A0, 0x3289A6773796D3E1,
+0x917189B6113F1501, 0xA6F2FF0D941D89BD, 0xE3C6C1A25DA7FD34, 0x432071DB008A4F4D,
+0xFA0A6370185CA1CF, 0x5F3160182C170C97, 0xAD91A3818DFD73D0, 0x0000295C97594896,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x513C831570FBB9D7, 0xB67CB682E0BB4D54, 0xBBE6BCF22788C1E5, 0xA0C0D54151C6A503,
+0xDBD0373F91729A36, 0x1DA355ADEB7EF85D, 0x48B1CDB6171E7E02, 0xDB5BFD1652D7F6BB,
+0x11DCE3678E4EFCFD, 0x8D363758CA848BCE, 0xBF5507036E34EE4B, 0x000017AA8FE430A1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC15E477263D3AE75, 0xC1C9148C6F1589EB, 0xC08EB7AB0F550685, 0xFC58166722BBCE74,
+0x5D78846BE399B2CB, 0x0195F6C94685992C, 0x40EEAE496CBA339B, 0xE11AC569DA0EBD2F,
+0x3E475F8095DB4AC6, 0x40AFB9568266ABBF, 0x76B4402B97A5332C, 0x00006F2F146BCF38,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x422D030F3E97A71E, 0x4FE0CECED8598531, 0x9EB6044477426191, 0xA8AB70AABA11E567,
+0x4410A85AD2B20C1F, 0x9B4B4AF2E1BDDDDC, 0xCF7E099493D17342, 0x00CAF6816D264AA2,
+0xE81588E0CE18AFBC, 0xA2E238AA0644AE3C, 0x68FF705E004203E1, 0x0000455D952E30D1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB3B3B2DBFF10B83B, 0x513EDB8C10D8BB82, 0x1C87612ABF17C0AE, 0xCD8DB5F4D0399371,
+0xDD6BB11183F0CA90, 0x17770E3106BCEDF9, 0x6571ADC4DE341ACD, 0x43CA515C83C22CCD,
+0x96E21E00B0048AC3, 0x58937BDAC7562830, 0xACF46AF557DD783D, 0x00000A689B1A5DA6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFF2C7EB3648447C1, 0x401E26CD8A892FB9, 0x569CAB5F815B8F0E, 0xE444A7489E0EF73F,
+0x1E97A53C67FC24C1, 0x829FDB096F021F0E, 0x331C11B7D1E4E8D4, 0x3DC712DF2D623E87,
+0x17BB49FC8C246B3E, 0x41ABDAB4D3C1B0D3, 0x7C540BFCC6A8F4CF, 0x0000659862EB5C4F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8A7278F3CF4EF787, 0x0CE9B1FEC967C616, 0x3375E38DBC1B04D0, 0x49DADFA9AF5BD413,
+0x51F909F676EEE6F2, 0xF5828126BE8B3ED7, 0xB2FA9DAB38E19A5E, 0xA70D84D9B0A02027,
+0x50F2EBAAE31860F7, 0x2510D54E0FFE8A21, 0x9E404F458B666E37, 0x00001426910383D7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4EC5CADDEC227A2C, 0x4516172305A7E495, 0xF29C5EC3739827A4, 0xB07298D013D60893,
+0x24A69A390445CE5C, 0x9F778B16EB29F7EC, 0xEC273BDE714C8265, 0xE489FA69BF8B4314,
+0xC7CE1EB59124FE39, 0x7351A286B2B4A212, 0x4494BA81219161D1, 0x00004C43B07A9E1B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x77A9D6EF98930B40, 0xCF569D5B06B3A86F, 0x3CEA37858D78F782, 0xA5ECD931FA9F33E6,
+0xBAA80D16BCD77CAF, 0x07CAA6A00DA992C9, 0x9E6CE8C222E5E3EA, 0xF0A3F8FC00582027,
+0x336AABE275914B12, 0x2EFD51C9F32543C6, 0x2164301B6AFCC944, 0x00003D5C72F42DE1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD77E7DE3FD174B8B, 0x0D49A1AA7952346B, 0x5DD9944BA28B73E2, 0x633A59276617D792,
+0xF7F74270739678B6, 0x887A1EE72864B13F, 0x5311C436169FEC77, 0xD17255DE15C163CD,
+0x6C9A372200F78BFD, 0x79B5C7361FDCDABF, 0x9EAE1B896C3E5173, 0x0000161F2D26DED0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x539DCF8BBA0C1D34, 0x26C94FD37B2F2ED5, 0x1C4E2FE77D341B8C, 0x3C85C35211D63215,
+0x81FD4A55CBE2B25F, 0x7C6878AEBE56382F, 0xFA9F4E0B4ABFB443, 0x3E68FA7ED1FEE31E,
+0x09126A186EEB8FAF, 0xD7C2088755671EBE, 0xAE07CFF57D33419E, 0x000068C6C064A3A4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x18FA5BDBCC6BF80A, 0x16BF975547511F7A, 0x0BD33255C7AD8196, 0x547C876E661EC911,
+0x8F09732893C83D1B, 0x5988BEC5126CFE9E, 0x2D1927DED499C35C, 0x45C36B8372F461E5,
+0x81E12A3BA2241BE3, 0x5377C5C0A9690800, 0xF43CD1D60560D11D, 0x00001B1AE8FBF486,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0705C584BFE75033, 0x33B613499DCCF62A, 0x14551971EB75162E, 0x7298F2774483E468,
+0x1F135CF1A321F70F, 0x29D94A0F64553E82, 0x73EA1987B9F4A8D7, 0x3D4F9D382F4CD873,
+0xC2CE15BCDBE415ED, 0xBF8785D64E5A62D6, 0xDC1F399DA0316F02, 0x00006F243F2B49E1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE589B1E686F9D995, 0x07DDC50D8CBD5280, 0x66205AFC545F095E, 0xBDE3943117471E2F,
+0x5DAB1C935AF7741E, 0x38BB53E871D9105A, 0x4013F9F8E12AF079, 0x20437BE865C3C2B4,
+0x2E829E07E543E1DE, 0x9C29BC2BC4CC81AF, 0xBE40C90CBA85772D, 0x000064AD643ED275,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x17163F0B0A214C31, 0xF47F9A4FA104695A, 0x3CB8EF090B1F395F, 0x189034D5AB8F4A72,
+0xA16B51CB640B1A99, 0x85DA5EE5F19C7142, 0x6B319E5A728AE541, 0x66DEF93321760104,
+0x67A2E5A44003BADB, 0x3CA4DF075C4C9792, 0x8DCE1718129AB72B, 0x00000E33B16B0288,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2FF7FF8F5079E950, 0xA5C836D56C910249, 0x992B680E262EA14C, 0xE3DCCC9C769E943F,
+0x4E90624A443C0570, 0xC8FC83D9FB8526C7, 0x92F748A7E1B5E16F, 0x376852821E3748DF,
+0xBDAB03D2EBD1BE03, 0xA60C77C98D72ADD6, 0x31BCB49EA4821151, 0x00001BD5B6036EA7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x78000967BD82E751, 0xC3A64E6F2533A0B3, 0x3C1F3E26E9315EF0, 0x930A417A2D48C43C,
+0xF8F817C1AE8C3BA2, 0x07DF76DFF781A0F2, 0x1114B9C1A56B12AD, 0xF4AE2F4C999E7E5A,
+0x5CD43225D18BEA71, 0x78916AF632D1C52E, 0x97CA8022ECCA05F7, 0x000010850AD8A1D9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5DF67AF1B5906F1C, 0xB251D9F4ADFFF57E, 0x2ADEB89331AF7B2E, 0xAB3238B084C5024F,
+0xE072AC018EFA1679, 0x8A7A3BE9FEE81688, 0x0C878937655A2767, 0x70525703DD794932,
+0xD9FAB2A6E38F8D6A, 0x5509B507A2F29535, 0x1407B789DFA933D5, 0x000019D0D26BFB5E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0B1E75172662236C, 0x84948DA6EAB10569, 0xB5984920E874A98F, 0x49D45C95A842C8CE,
+0x4957318264B6D1DC, 0x5EAC59170BEDFE44, 0xFAE6AFB03D2648FB, 0x93DF2F4DB31BFCB7,
+0x5E775EA650BD54C2, 0xD9591F6A6889C19E, 0x598CA972BFEF4AA2, 0x00005EC9E407EDF9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5D811B866992C5BF, 0x2FBAC389038878F4, 0xBC0072A531FE6D0D, 0x44F6AD37F0A8BC9A,
+0x35342E009EFF5AAD, 0x7BF296F6A8F1114E, 0x20015290C1C192E0, 0x2695831365586BC7,
+0x72D9954C0251CA6B, 0xA17E05EA10B37EBD, 0xE45E4E0BECF76D2F, 0x000037B7B6073E10,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFA79FB14CD89AFC6, 0x8FBFF950EBB11BBE, 0xAEED2CCF4816F674, 0xB71171C4B05E2B51,
+0x28F1322E357B64AA, 0x71327FE998D0BBBD, 0x0E17E6F245762D7E, 0x550814EDDCC52E9E,
+0x61D90B3095A23990, 0xE59750090F430AFE, 0xC35349C0DAF47A8D, 0x00000D1AB38F14F2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF869BD6FB9F2D08F, 0xA515FCD269B95887, 0x5A76A29FB3FDCABF, 0xDAB7E4841A4B16F2,
+0xBA5A77FEC6BCA314, 0xC73B7ADDAFBC4C1E, 0xC977C43EEDAADE88, 0x69839A6D5F3A9BDA,
+0xFB2A275872ABED28, 0xF8574DCCED83317D, 0xA3AA415EB93D8FEE, 0x00000E3E5B0F3A38,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC292EFCD1801ED09, 0x6B866ABBC3711192, 0x02C10A714CA1D8A3, 0x7467002B18C22BFA,
+0xF8C22873AE3589D3, 0x82F51DCAB7D5685E, 0xD6F118B0A5F2E05E, 0xA082D767FD32C6B4,
+0xF069D5C6302612C5, 0x52270A33B41C5D29, 0x0FD86DBD4ADCBE8A, 0x00001F128AAE58E5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFE6E081103808D0E, 0x49B28CE4AB068106, 0xBE9F673A3BCF9E53, 0xBD55E83EEFB03B77,
+0xF5FE52B9341CE77B, 0xB380133ECDD6B524, 0x8227109ECF3E3812, 0x2EFBA1B7D3F183E5,
+0xE98BBF9CD18F01EB, 0x8E43373144CC3DAF, 0xAFF6CC0BFB3B2F19, 0x000006B344C896BB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9D18B0814F42C3AC, 0x01B3E14F241532A2, 0x906C443CDAC95CBE, 0xD120E8DD41E43944,
+0xB28F4A119574AFFD, 0x8BA2B7BBD91F73ED, 0x2D62B495D033983E, 0x03D2856202F4B148,
+0xF809985068B139DA, 0xF00C06330461574C, 0x7995486BC12844D8, 0x000030B1AE6C2E66,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE3143F81154A516E, 0x488E5B2284F159F5, 0x33CA2DEA64579DED, 0x11D1B155C04FB7CD,
+0xF562D028B979E01D, 0xDC887ECE884DA0F9, 0xB890CF31A2631E02, 0xF516464D2DFF6808,
+0xC0CB0C14257274DD, 0xC6ABD03B23270366, 0x3F0A30C3BCA1DADE, 0x0000578F8336D9D2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x982566D5D3BCF7AD, 0x0961DADB4EE39A29, 0xD38E173A25D466B9, 0x78EF41CB0EB09C44,
+0x96AA4D3A2D989F4D, 0xCD390DDCF0228EE6, 0xE1ECFD94088654FF, 0x6BC53493879C0ADD,
+0x1B52E56CBF069C63, 0x1EA50D1FAFDC6555, 0x4C4AE9F3AECA8B4B, 0x0000067538491AE9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE59F81AE98D00F90, 0xA9B5F93612E008F4, 0x5DA3BC06491BD121, 0x7815D7DF0EA4E7A9,
+0x6DC8A4F8FCEFB8AB, 0xD635E434644BA153, 0x225DE58CED9DE4F9, 0x66249F6DE8A19AD1,
+0xD4ECFBF718B1DC48, 0x31F82C379007ABFA, 0x3F0498307980DFA3, 0x00005E18C1D04B95,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD3D71FB974220734, 0x7B72D515CF159163, 0xF2106AA700549551, 0x448DAF2D04CAAF7C,
+0xDBFE25AE181E0AB2, 0x2A8FE93AFA7810C0, 0x919E6C89193C7203, 0x03388B3A458C8B5A,
+0x42C6953CBFD38689, 0x3C74C4A9DA571B6D, 0xD0D24BDD1A561627, 0x0000573DF0F597A5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE3D7EACF3ECF2BB2, 0xBFAD322F47CB82BA, 0xDC0F69E18D473D7C, 0x65B036A6E0D5D411,
+0xAD1243631A242E09, 0xFE51976602D6BAD3, 0xDDDDA3019210DDC8, 0x983F3CD8ABD647FA,
+0xD7B8659A50AB302B, 0x3F3431EA4DF85C53, 0xF236E4E0CDAAD767, 0x000020A7B68BA1E1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x070098279AF8D19F, 0x424C003BE4FA8ACF, 0xD924C4117F97036F, 0xFC72FFE6FB3F2393,
+0x1A7169BA70BDC67A, 0x974800512BDD2EE7, 0xA14E36659FD09073, 0xAE71E20B4F07C8DE,
+0x8350A61666FA4113, 0xA015891B93E9F8BC, 0xD9D5DDCA0A8DE56B, 0x00000C04F3837B40,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBC783974730A62DA, 0x2BB38A0A0EB497ED, 0xC2773F24D96B3177, 0x1795B6905D0D854B,
+0xE5968714E1249AF1, 0xB13148126EBA887C, 0x01A3784C429F8910, 0xD3B64A619053137B,
+0xAF9FE0A3C8E224DD, 0x9D45A81F130705E8, 0x06AEFF40EFB91380, 0x00003AF1CBB1A7AA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x75770B5E31977791, 0x266EF3297D92899A, 0xD436A40609185BF8, 0x240ECA01906BDC85,
+0x47E39A3195EBCFEA, 0x2B468C5D01C0DB40, 0xA27FE021B3599047, 0x5AEAAEEF2F42431E,
+0x834C9482830D48F8, 0xFC7062E06334C284, 0x870997262D6C5880, 0x000020ABA3649FBA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFB3E5091A948E260, 0x5615567DD1803179, 0x65431F8790BDCBFB, 0xD13B6F72BD2F9373,
+0x9203E725BC80F58E, 0xE92F90864729D851, 0xFA3BD1A17F287A63, 0xD6422C30948824CB,
+0x4BD8748CD2680326, 0x599ADC8367A9190E, 0x4C7ADA7F11184818, 0x0000288DAC461351,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x67F7E284C72D231E, 0xDDF9DB270790C86E, 0x8F8C9844100F1E6E, 0xD71B424B2E1357CD,
+0x54F06F9DAE962CDC, 0xD29E82A69700D90D, 0x965F89EB55383E2D, 0x729D6226B1CBEC31,
+0xB2A59F780B998C80, 0x1C3E3B79A04E6472, 0x376630437A970411, 0x0000322941C75AA7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCFB69DFE712B0352, 0x81D36E868F16039E, 0x8A8934A4F2401CD9, 0x9581F1176F0BE73A,
+0xE90E7B5C52435F85, 0x1DD01CD2EF98B3C1, 0x53A1A6E0A38C8321, 0x7467AB2661B14D90,
+0x8FF71A1AAA2F8EF3, 0x757CDF332CFA714E, 0xF9C895CD0A326C9B, 0x0000044B5EC929D7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x812E26F9641D8B28, 0x36ED2A968C3E835D, 0x7B4FD87C63BEC349, 0x074B78013C5CF26B,
+0xF5AA61B23BEEA319, 0xF31295030FBE1ECB, 0xC043039E48CB1BE5, 0xDD52B796BE930CEE,
+0x23C6F94600DF7FA1, 0x561F040D895503C1, 0x70F43482D62AE857, 0x00005E0E452CF382,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB70BE3E92E93BE88, 0x48D8C10280FA4F53, 0x0ED83AD6099534D6, 0x242E110BE20838CE,
+0x6D15A1F7289D7230, 0x99AF89AAC4F30484, 0x1B8AC12B61103405, 0x97F317585860EC64,
+0x2A82F779C3DDEE50, 0xE1CAB4F2057E99DD, 0xC3B760D482BB350E, 0x00001D337E4A09A4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB20B41008A6EB5AC, 0xA9FDFAB2451A5BB0, 0x7CAF8E09ACB07E04, 0x7F84F8556C219317,
+0x60BFEF8911D1CE5C, 0x748416F08A0B2276, 0x62AF4ECF7F32CFC6, 0x8DCAE9A277202280,
+0x744CD2A4ECB32EB0, 0x1DB7AB8C8831FFEA, 0xE11A690B107B01F2, 0x0000016E6F1A92D5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x84FF1E0894CA5FA8, 0xD7AA7E47348E0A4C, 0x3BDB8F6C2D373A31, 0x1348A94BD7AD1BE7,
+0x1105D99F78104EE7, 0x2989D84C01130688, 0x89A97BFF75A5EDA1, 0x7DAA524ECA8D93D9,
+0x86FAC4C35D094DD8, 0xAA10A3154D95C6B7, 0x765CA9CC396163BB, 0x00004D5505C519C8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x10761B39B48B1537, 0xF9262EA62E1C43D9, 0xBB64493BCDA297D4, 0xB9EE037C0966CCBF,
+0x59DBE3A4B55133DC, 0x11621F1279E12FFF, 0x513038F1804C1ECC, 0xD4A219A2470D6DCD,
+0x6DB35AFB976D6B5E, 0x14C93D3AA312334D, 0xA4FD0644E578EE3E, 0x00004472537D88C0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE6299E94CFDA9945, 0x6D5405B71D5D5745, 0x961D1972BCE6E17C, 0xE437B05584B78CB1,
+0x4D86B18BAC0DDAF4, 0x3F7500CB560D423A, 0x6A982894944B84FC, 0x58F133E577CFA845,
+0xECEC9CC42E5BF3A0, 0xF694ED2F71FA1E42, 0x5A3663CDF3726EC7, 0x00005ABBA9C8316A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x31E7D1E51B8D80E7, 0xCEFEC2704B47DCAC, 0x2BD94B2AFD1F3F0C, 0xB92D71B48B014D5F,
+0xC4604AB4367A05FD, 0x49BE1BBFAA71BCA5, 0xC947EAC08AAD4A89, 0x61C33D8DA776C7CA,
+0x51B3F0A0D02570A8, 0x0CB878E379AE74A9, 0xAC4E346169BB8007, 0x00000FCADC18F97A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA6CAF83C7F6DE17A, 0xB0DB4B9A0FB0BBAA, 0x61A6A285AEEBF972, 0x5CFCFE09863F3234,
+0xBA9FC16EE4D1711C, 0x58DE760FF48F5CEA, 0xDC7B8913209624AE, 0xCC5B5ADC8481FCCB,
+0xB3EC7EDA232EF4F5, 0x66E32A894AFEA6C8, 0xE08DD681EA958804, 0x00006D5A69FA3512,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3B20C62CAC8AD70E, 0x093B647895F5D153, 0x0D9F3F7E9CFBDCD8, 0x60610040F80BA3C0,
+0x772BE9B2374795C2, 0x758AE22FAA0E4507, 0x717E9E82FD7148D6, 0x3D0C870E425A6F1D,
+0xF4ADB88A6BF8CCAF, 0x9B80CC3299C9AE2E, 0xC1DD980C0FDC23C0, 0x0000572759DACA11,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE0DCB7622DC3E2AC, 0x28DECDBE87A77C3F, 0x2F8AA9F03FD3C04A, 0xB0839A16C11E59BC,
+0xBE278ECBE2AB7227, 0xA68537AEEE1B1D90, 0x90B162DCE3BA2534, 0xBED18110038A1FA4,
+0xC639722EF6EBF7CD, 0xB865F80CD116E403, 0xD166E5CA52640C7C, 0x00000ABE704BCA96,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x83CB289FAD46A4FA, 0x46EC1659AB2F2F65, 0x1741226B89D72185, 0xE772B88C7836441F,
+0xC11A5D58B78718F8, 0xD08C75B6462CB9CD, 0xC7AB77CA7F5EF5D4, 0x5DFB49E9A35E27D2,
+0x87F3AC7F021B5230, 0x1627D3C17A82496B, 0x104639D12D42A79A, 0x000065298E2EF5E3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB96486E895DFEA6D, 0xB8F69056A0F9E024, 0x791D2F26A8C07E24, 0x338F3DA5DE31E458,
+0xE6876CF298F043DA, 0xB5233EC9B7F253FB, 0xF0DB566633AEDC6E, 0x821DADB63D419B58,
+0x00513F7E154465E3, 0x5013A6FD86B53DCA, 0x845D607C83F102D5, 0x00003D58E19FF36F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x32D16EC252C6ED99, 0xDD2BB936F1F0E4F3, 0xE745C7F8B3CA5F78, 0x1D6511ECEA67B446,
+0x33D7D269A4D7ECE3, 0x45246DAC959A6AB7, 0xC83B7C0DF63ECA3D, 0x7C6BEDA6DD6DA371,
+0x4C62E7C38051DDF3, 0xAC4B110B56D2C8BB, 0xFFED7724EB66C664, 0x0000401A18715AFA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF802A2ADAEE4302C, 0x77CDD0170A070E51, 0xE048E9D6EEC0A004, 0xF0D0DA05FA6C6F25,
+0xF96AF0F2968598F5, 0x3775DBBFCFE07229, 0x1D1602994C436AA8, 0x929DB109FE52E252,
+0x14139F27C4C13EFD, 0x784F7511ED89D155, 0x76E31DA38BA89824, 0x000033C8EA41EAC5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3F5819D15F1E9E0D, 0x572AA2C23D8FA829, 0xFCF7545104295238, 0x042E37E9CAC1C1B1,
+0xCBDEB90B7AAC682B, 0xB693FBC7C2C02A36, 0x89347E066FDDEB03, 0x73565A3FBF0F3F32,
+0x63A38AE403961A19, 0xA25407076BC2CD7D, 0x0D539D45729BD078, 0x0000067A6520DBC9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFC5DEB13438092CF, 0x137321A3AE8B8B79, 0x9BFAFAE14605B507, 0xE35090D1450D0AAB,
+0x54CF2226A2C8BF51, 0x577B90F679705EFD, 0x8CBBC7C4E4F7B293, 0x36C7946BE925CB47,
+0x05C3A31A2D243B5C, 0x316706AB169ABCA5, 0x2B88060783C1175B, 0x00003AED08CB79E2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0156BF6899F7AA0C, 0xDB58540D53FC70D4, 0xEF44A696E2CFC280, 0x757FD1A92AA49145,
+0x63371818CA37A2DA, 0x954A04C96E819EC5, 0xC60BCFC23E796F6F, 0x710C4A4C78934AE8,
+0xFBFD595D21AE9615, 0x8B236648C0B4640E, 0xEF84CF166C4572CD, 0x000038EC91CFF2AD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1E0D9CE0EB310DED, 0x5D95460DEAE0D98C, 0x4CD665DA47C18590, 0xD6EAE59372E6ACE4,
+0x4E2BD8662376B935, 0x0404B8BC2EF992E2, 0x3B52A934338DC98A, 0x97B07241EB25486E,
+0x5E1C02E51887977D, 0x74B5C17D771DC130, 0xC8934FD9C011D883, 0x00001C1AB0A83187,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFC22B3F8DCB50777, 0x6C07E95D898A34DF, 0xC4D054E0CBF1F7B8, 0x01C8C051F085B4F7,
+0xD3D2B67EBF90DCAA, 0xA2B6CFCD2E4CE4D0, 0xFF70B1E321C4EC92, 0x350A5EE9818475A5,
+0xC7B55BCFF7A69ADB, 0x054134EAD0334550, 0xE5A37F9C93013908, 0x0000595186008C01,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0A915BF50754ACE1, 0xFD8967FEDB555410, 0xD211AE98F441ACFA, 0x6E982B7F038D1BB7,
+0xA2A2D112912FDE09, 0x522AD521F8201B02, 0x224C59B50DEE0A5A, 0x38D05CB1AEEFBC40,
+0x62D8B1C4E6D6A818, 0xFF91E2513278A2E0, 0x4888224A7C83A9BA, 0x000069477BA8B56A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA5A98C12E264A5B1, 0x35886E9A7267025E, 0xB2BE7FFE7A42501B, 0x6F733E92F6F2836D,
+0x8D854ABB08C2FB94, 0x182142AEFE740586, 0x1D4CF443DEC244E4, 0x98E72DFE65FD7F4B,
+0x5C2680374CCA91D4, 0x08269F55E301CBD1, 0xB49BABD6B6E18FDC, 0x00002DE5B6D873C4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEC914749E0A1FE27, 0xD93947C5FDF07680, 0xE446AB46BCC5278A, 0x743D463C505D7B11,
+0x9BBED06D538C0285, 0x6F7AFEC81358CBDA, 0x8F994F4CB356EB94, 0x65AB97D395D409BB,
+0xBB88B3908C8D1A9B, 0x482009AEC5F75E72, 0x057D47842DBCE4CD, 0x0000292179A77F67,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDA7E37D219B2D39B, 0x2286B70FE596E57F, 0xBF9AC727AE9892FC, 0x1CF84663D4B1A2CB,
+0x6171E93B4E234C33, 0x055FE49508C4FC04, 0xC6C41F3FDCC188F3, 0x33B1AE690A5717E7,
+0x976B293553A45B93, 0xB6DDEEB12954A5DF, 0xCA3171B22387C001, 0x000066910A1A8E23,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0BF87D710212C36B, 0x9095560328D965A5, 0xA207B4F08DD35D61, 0xADD275B6D36035A3,
+0xE3F75707C1F489F4, 0x2A62E426419F7085, 0x749376A922665D09, 0x1E8BC9F39F265400,
+0x3A0A550029E073B1, 0x24A939DC6E1F5728, 0xB517C02071C00F32, 0x00002FB5563EBD4B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA24BA8426548C3A4, 0x2379678785AA1291, 0xC120742CF1AE9A58, 0x25339FDCA994C734,
+0xA0046995816559F9, 0xCED5E8CA47209500, 0x36C2731B23101BB4, 0x85140E29C344F8C8,
+0xA257A9F1AB7BB8DA, 0x1BA5E5782EC62DDC, 0xCD63FF057EEE96F0, 0x0000358FC623DFDC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF29C58FF458D8DB7, 0x7C0B050EB3813E2D, 0xDDA259387960AA6B, 0xDF257E8F5279419C,
+0x7988BD53C4FBD0C9, 0x060DBA822E3DE6E4, 0xF4A357E797E8871C, 0xB8E1DAC5FA92D6F4,
+0xE796B2FD70B2917A, 0x087C699D9ED624C3, 0xFE5FE61E5E12549D, 0x000036921BB7513E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x81EFF51E302844C1, 0x67EB55D87F18E2AF, 0x3782444C2145B4C9, 0x4783D9B1CD6530CB,
+0xD50EFF6F21231C80, 0xDD7F1AA61C3652FB, 0x3DB3005CF1105E5D, 0xBC4DAE65FD1F5561,
+0x0B4BD5D1434FBCB1, 0xDE6DC06E77F731C2, 0x7A49E273B62A0521, 0x00006C2A2DCFAF0B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBF3106CDAC580136, 0x4E17ABA0B4E16D80, 0x14E6B541E9BE799A, 0x1DB30B764F56A507,
+0xBDE3A5B8BC20B284, 0xB9852C065221C7B0, 0x0A1A7A4A9CE78472, 0x132C8F7C9C15DDFF,
+0xBD76E4610FE05120, 0xE6A0D4A41CC1FD32, 0xA490AC8B45015CCF, 0x000063606598D40C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE2EE0A44079AAA5B, 0x054EA4CCB672517C, 0x4250C41795022095, 0x2ED5E54583F570CD,
+0x9E907DF26D6C6C56, 0x48B78DC458DF0235, 0x8943E0029D50E991, 0xCEE1481F936850C3,
+0x253FA796C400B185, 0x1C3D12056A6551B3, 0xB6514C8FCA71F409, 0x000033BB713635A7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD24D2D101F7DD06E, 0x8A7857A0286318C5, 0xAA6F56A3BFB41491, 0xBA17976C5DA47029,
+0x6D008A849EF0D29A, 0xBAF572F31AC2E918, 0x5409151A87C94ADB, 0xA60FD641949D0B20,
+0x31C1116FF5181D53, 0xD142F0047476766C, 0x0361512CAF6F24A1, 0x00005C50895631DB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x683399F50A1B8866, 0x829E4BCCBBD08660, 0x25C9A6B53124EAFE, 0xA366982923AB14C6,
+0x3BB84D9B71ADC79C, 0x5FE045E7A6239F92, 0x6703294A9EB14F8E, 0xA8859F3B75CE91F1,
+0xDB900AA487F7DD73, 0xABC156B798BB575B, 0x9FC1CC6A231DBA47, 0x000047668AC8E7EC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x70C3A0886910F7C5, 0x968D2730DC32585F, 0x4DC7748DDDB33185, 0x468FDB687E86C6DC,
+0xE2ACD03427251E4F, 0x7A90A5880A6D426D, 0xCE3183FF0925C11E, 0x49304372991D66BE,
+0x46A14393A4A02DBE, 0x5423CA3E81C62CF9, 0x7C385139F967D540, 0x00002B22B6A1325E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x672D3F8086376E92, 0x5E5D319B05DAD5C5, 0xB8A85D33B6B86AD3, 0x4EADB64C9B6E7A1A,
+0x42B0E6C03171700C, 0xF2FB01C7414C7D3C, 0xD05ACFC777494628, 0x38FCBADE31762C44,
+0x71388AE781DBAFEE, 0xEFBD5C22A0CD52A8, 0xE5D07BAA0D12D26E, 0x000069AF1BD7EC56,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0DEE0FD37A44352C, 0x59F4253896107659, 0x38508609398B0B43, 0xE6D8A07EE2399752,
+0x7DFF7C26DBA41D1D, 0x8427B96C8BCD5062, 0xA86EE33B11B84781, 0xAFA202DCD20A1D82,
+0xA7A43F472DF1B2CC, 0xDBAB7A6AA6CF75AD, 0xE5831E7EB6B4CBE7, 0x00001F7FA3B085F2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8FC352E8972E9B46, 0x8339C1B9662A48CF, 0xFEDB1BA236804A2A, 0x6E284E978A4B3DAA,
+0xF8BFCE1FC68715D1, 0x4A0B573A5AF25E4F, 0x24A431E3B9D0F41A, 0xAB6F2F7A33EE12FD,
+0x7B3B6E645FE194E7, 0xC5551A22DCBBDB04, 0x77A87E92FBCAF1C9, 0x0000000A08C49F07,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1E549139C9D6C187, 0x0D1424A096B74E26, 0x525E449AE284C901, 0x30CCC2BC2E50D71A,
+0xAAB6B289E6B9DB17, 0xDC4A1C80DE40C043, 0x3F54C5214DC7C98E, 0xF460589367631013,
+0x011B2CCCF0DCF233, 0x65E9F7F41E818696, 0xE153562D24168578, 0x000055D17F0F062C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x90385416B01656ED, 0xDFFE3D554DDEA4DA, 0xA780667E05486C90, 0xCB078589825246C9,
+0x978CD9FD291F99B2, 0x0AD4D7A14756CE1E, 0x5A7429F8C041698F, 0xA534A188602A5BEF,
+0xE9B7A4DDF16AD71A, 0x3289186580F9D1F4, 0x8FAC7CBC9A390782, 0x00003CAE45A44785,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x81B5DE654B285CCC, 0x7581537EB9B7F373, 0x7748E5AD76CCB131, 0x9793AAD2493EBE06,
+0x681EEA79200F14F4, 0x9BAA9657D981CC60, 0xA5DC2F4157AABC60, 0x8087C82C4CA9914E,
+0xED6D67C968793D68, 0xB2608CE9CACF697E, 0x948F397C52D190A5, 0x00002AFF03C37AFD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0B03CDDE4E8E26DE, 0x2A5E085F823A492F, 0x115EB4A610225F2B, 0x6EDF1E786AF2DCF3,
+0x22FBA2F8187DB0DA, 0x2034A6AA1C7F6E3B, 0x8C3CB80C574DD3A3, 0xA838112824AE1854,
+0xF7041BF1614C0F34, 0x45C3136C1B1308F2, 0xD45C6E846F1962B8, 0x00002B957B700F94,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2DD3EA6F71F1CF76, 0x4E08197F14342A0F, 0xF61F7E0D22FB6805, 0x0DA273CEB1CC03C7,
+0xB803A52B569A08F0, 0xE533EC4A44237D70, 0xAAC67FF54EA23BB9, 0x8EE1FF246E48F6D1,
+0x01998BCF0C7BF6A1, 0xF10540A5ABAD7869, 0xACCD794DED9916C0, 0x000000BE0009D725,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF7B396E138AE2C30, 0xA27D8CD57EBE7707, 0x47251527E0526802, 0xF428DF3C092F5924,
+0x037F8AE4F4213B5B, 0x06AD2973FAA5FE96, 0x187E61AC940E6368, 0x304F19FEE1C76C5B,
+0x616741869FD4FDA6, 0x88DE711349D12A82, 0xBC94A526C6C3B471, 0x000003696B5FC713,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9485AB2F6AAD52B6, 0xF28F12BD64DCE521, 0xFDCCCE9488CF5FA4, 0xB557BA8763D624D0,
+0xBFC69F34FDDD2160, 0xA65B69A51628B108, 0x9FC0D802ACCF1309, 0x0C7365FAD8BF20D9,
+0xE4DFDFE28CBD751C, 0x4C2293DC77C39172, 0x46726762C5B4C43C, 0x0000199D275AA81A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1E0B71045034B74D, 0x9814E3DFC92FB44C, 0x3C344932A1F1C1D4, 0xB7A3EBA25AC86BDA,
+0x9E24E202A46EE4E3, 0xA1C16ADB8143F75A, 0x9A94843B5B2D2E78, 0x47F9DAAA2C454322,
+0xADD24AAF0BA2EFFE, 0x399DB9FB05D39D19, 0xB3C076FD95A62236, 0x000013F804C1B417,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x80BC92E09AC3CA63, 0x716373C62020E672, 0x9FCB3524A45BECD4, 0x47B4BCC5805FB509,
+0x64ED5B220B979C69, 0xCE9618519EF143B5, 0xA4149606C2C8C2ED, 0x8C5A92BFA3AB9B39,
+0x64FB01F313E9BB4E, 0x8420D892A91E062F, 0x99A27FD5EB249649, 0x00001373BE2CCE03,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3C7ECD3EF1D47E16, 0xB52B0625AFE8056F, 0x648F7B001408020B, 0x82FA1AAA3EE9506D,
+0xE169E9FCB99E4031, 0x5AA6F70BB089CED6, 0x5CE4E561C1A7B8AD, 0x4CADF7A2BC262F27,
+0xFD050FA2242C8784, 0x5B2C4637B30BC1F6, 0xCFFA816A647DC090, 0x000021C697C7848C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x050FF13FB2449ED1, 0x42CC11F809D66966, 0x9429432B6F3259DF, 0x0822AB5ADE581895,
+0x8F6D8B6DDFDC91C2, 0xF2A868D8BA5D50A1, 0xD46A1E6B1AA9B52E, 0xB73B7DDBF5361EF5,
+0xEED5E042B3479404, 0xD44F05883BA69607, 0x67156C4F7DCA9970, 0x0000145C23925E0E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCF19754DAD452CF2, 0x687E8D38C3A33A85, 0x16F9531C81E30CAA, 0xD79905DAE6E51A93,
+0x47F27DB37384C160, 0x0D46015D2B044F08, 0x44CB0E62648D065D, 0xD377ED4258FE6726,
+0x1C11365695D1ACD4, 0xFAE58C162A870081, 0xD9FDF4AC6F781569, 0x00001CD80D69906F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAD9D2E229089B7F3, 0xB7C5F9B3C44C8BF0, 0x3D0FDFE0BD5CAEA2, 0xBAB715DDEFF428A7,
+0xE7F68E17F937578A, 0x26B8EBFC407C72F3, 0x127DCABA8A6AD2BB, 0x9C77868E5FAE259B,
+0xBE0665E31F8C7B4B, 0xB10E40FA4E739645, 0xFB17924B9A261D2D, 0x000068A2E763E30D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9EE12F11DA9B49F7, 0x4E17708C910EFE1C, 0x7CA000CDCDCFF69B, 0x77FD9CB7862B6F8F,
+0xD40E0472111E7876, 0xCB71071EED30BE95, 0xE97D591C9B5C7C38, 0x0D4D8957AF051109,
+0x8D6D90C54482329E, 0x2BDA4333DA5C0630, 0xCDE964315BE227F2, 0x000055C2035D5531,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3CEA22779627FFC2, 0x7D06C145DFBBCB02, 0x1382326FE815B896, 0x07F7CC7D8D1D24DC,
+0xC89B9BDC1E8B836A, 0x0A1FD35B7E293B3D, 0x6F81A167B08CF192, 0x9EA79EBA7A1A8288,
+0x5253E7A29ABF7702, 0xEEA954759489BCA9, 0x3A9527B86FDFD81E, 0x00001543E527747A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFB7F2CA5DC9AE452, 0xF2752FC70AC73FA7, 0xBCAEA18F9001CF9A, 0xC51006C571ECE797,
+0x870A4CCCEFA5246B, 0xD6028D1B4E28A51C, 0x584D4AFE0D95C970, 0x43024A3620A71C60,
+0x22E00ACD8578DFDD, 0xBF10550D9322410E, 0x135E3841FB342C74, 0x00004E0FD79F6F49,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFBF1998BF6831DD2, 0xF137A3D903C58EDB, 0xC76921598D32D225, 0x0CB972EC194C0FF9,
+0x1387D4350C1BF167, 0x6A40160AF7FCD221, 0xA9765A79DEE732BF, 0x8852E133AC39AC99,
+0x6CA03AA008FFA3D6, 0xAD0E1727E14D5026, 0x2668D4FF6BAAFF22, 0x00001A2B26721CDC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA4A9D2A756FA04A3, 0x4667384CA4806BF6, 0xABC8B8420CA39B16, 0xC6B50941D2D9C6E1,
+0x769928DC8160DF42, 0xE2D8ABF97E905FAF, 0x6FD96FD9709722F5, 0x5F50F50799657EF7,
+0x8C711EB61041A365, 0x409A7D6D06B47111, 0xA1FB8A42FBA387CC, 0x00006010A29A4DC5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE7DB0D6D9298B204, 0x341A8630393504AF, 0x487E28370830833A, 0xABEE61FC517C51DA,
+0x8B56BA1C9358C531, 0x6E9D2DE657302393, 0x4CACB5342BD72C76, 0x76409A12B9DB6EB3,
+0xDC19F94D0C878626, 0x52F9CD34E7FFA9F7, 0x8D607016F6B2047A, 0x000067975DBB9646,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x00411F3CF629B6AE, 0xE4CA8F4D6D2C5EDE, 0xCF4440BD5D313342, 0xA4E75FD4C3614AFF,
+0xFA37EABC5D52235E, 0x7BCD3127957BA124, 0xA4F6CCF5722A418F, 0x028D7D1F8587D7A9,
+0xF57C2BA67962A4E0, 0xBDDCF038B9D02AFF, 0x2CD25DEDF03FB083, 0x00001CF922476BE0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF35354D24E88B9AA, 0xDA9FCAD7D648C7E8, 0x570D7113E3B9246F, 0x07B2364EDCA78227,
+0xFDD25B0EAC52149A, 0xD0D3AAFFD8D52E8E, 0xAAFF0D21EF267FB8, 0x76E3F7A3D6E44AEA,
+0x19863B065F03D48A, 0x5785C9DC5927E1B1, 0x0F96EEE0C16AD121, 0x000035D4A5430005,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE6A4FFACBA54F0EF, 0xBBE3EE5A179F6037, 0xAE0334B0631F9BFB, 0x6BBE392A6117B84F,
+0x4C45BA098A413951, 0x4550D3B5814CEA79, 0x1EB8C048D11BD68A, 0x78A027D794D04897,
+0x13E0166B76E6A36F, 0xC8848B6951F2A847, 0x1A22AD8235F67DC0, 0x00003AB5DC71855B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x289451C32344730D, 0x4ED414EDD812F10C, 0xEB79E402D46332E9, 0x0DC2204F4EA513F7,
+0x9444AEC18B772CC9, 0x1E7A884FE826E5BC, 0xABF606FEBB2E2450, 0x3D2EE8D78AAAC7BD,
+0x439C542F9FB24B17, 0x9E7485E18644E610, 0x3E6F7F2C2D852829, 0x00001C7F717373D2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB44CC5045109F44E, 0x6CBCA50D1AC21829, 0x1E15497592C3B0BE, 0x4CB8E9725579CB59,
+0x5D0359A90411FE31, 0x4DCAA2CEA7A8AA98, 0x141CE623A3B35F85, 0x233B9EA0F94DAAC6,
+0x34B3F1360AE8B02F, 0xEBEE8D21F9E27946, 0x774C098416732F08, 0x00003E8DFAFDF1C2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB84F20CE2A15E58E, 0x7E9D0639C1ABBB5E, 0xCC6512CDFD1503A7, 0x799FF1E08B0D4474,
+0x208F6C5007C3E5E9, 0xBB874BA1425860E3, 0xFBA899B8890ECA36, 0xFF14FAE06BABEB27,
+0x751CA6CB4EC402A3, 0xC2021753F0FDA156, 0x951303E25061181B, 0x000024805FF91DBD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xABA28347EF8DC3B0, 0xD996436EC6CFA5F1, 0x0F2236AF0AD9603D, 0x39B3CBEEE0C4BDF1,
+0xBFCEA91F6D38E79E, 0xFDFF101BDD73A101, 0xF1FF805DF364960C, 0x754647680F5E7145,
+0xA4CCE7173A92C7C6, 0x5A23369878A18308, 0x53D5C7FE1B3EB6AB, 0x00004FCB2F54FC93,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD877EDCDE9774142, 0x44B0822FD8624C30, 0xF772354634395C44, 0xA100BABF72D7CE09,
+0x315BC804AA67EFDE, 0xF920FE80A966F5F7, 0x8E5FBB80C8826FBE, 0xE7E75273EECEE7C9,
+0xCFB2A5952865545E, 0xD37C454A7CEC8745, 0x53C8983F5679B952, 0x0000172C5396D5CF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA702E9C735CAE678, 0xE5C5E1574C7D8B6E, 0xF597A9698E1AB9E4, 0xA65C46FEB867FF76,
+0x8DA695B76B1684BF, 0x158A7656DA390F34, 0xEA2B4ED577646522, 0x6FDC8870C9C28B43,
+0x3B734A4170305060, 0x6FAF4B28137E07FF, 0x446BA7BECF2F8490, 0x0000158B0A0FF992,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBFEB6E5D7E2F1A3E, 0x6BDCA04172E26CF8, 0xA38E20EE24770E85, 0xDC5E6D6865638939,
+0x2E9A09668D7A5388, 0x51693D4F77D4613B, 0x47168FABDC4E45CD, 0x985BF42569CC1F92,
+0xE571F3DCC1895890, 0xA3F504B3984686DE, 0xBEBDD4F61F563BC3, 0x00006070F34DD957,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8B70484C7E6AF2A5, 0x84C259D2C6725A57, 0xADC1473802CA922E, 0xE3BC74D40CEF851E,
+0xFDADF1D158DAD6DA, 0xF5CB11B2250A3695, 0x58D84C44FC786F46, 0x55E6747C7726DEE9,
+0xFA5A34035C2D6521, 0x676E6EAB71932612, 0x6E3639472449316D, 0x0000269344C456F0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1586CF6F061B0733, 0x81BD939D65C9CFEC, 0x79F8B73F863E28BF, 0xBF089D494F2F5795,
+0x2AF740986D1331B5, 0x104F46D436E28FF2, 0x9D9105FA0DC20729, 0x863336D965998F35,
+0x80EB5E67367964AE, 0x08A0758ABD57E574, 0xD752A0B9A4CBEAE1, 0x0000213105D9E7A5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5E3E7803292301FA, 0xB357DF284464F257, 0xDB5DE62B6FFBBE56, 0x1E16D7E44F456D00,
+0xC35EA7B312148343, 0xBA6B72A406F017CC, 0x62D0583F2A7B07E7, 0x8C8B315F4C44E839,
+0x73612F8119E5745C, 0x5813BE143170D1DB, 0xE48E7FADB984CF87, 0x000063FD573E14FD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF7EEA3F43ADA0D83, 0xFFC1BAC859EBE937, 0x173A0289B948CB7D, 0xBF38FB0ADB8FE860,
+0x9A71C4B7D7BB6C8D, 0xEBA5501EA77F8AB6, 0xA85B739BE9417767, 0x912E948F51A8A41A,
+0x980E1A3032B3153B, 0x326F8404783138D5, 0x4EA03FC8FCD010DC, 0x00003A1FB176557E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x608637937574A405, 0x2D0AF24AE145DB6D, 0x6CC1273C4CD5961D, 0xAA0F4995C7BA549D,
+0x95ABB0E80983952E, 0xD0818E9D6BE76773, 0xF262DF5730323441, 0x7A0F3D965D556D90,
+0x7DB6F9697FE5FF95, 0x16516BA9564BE85D, 0x2836B83E422B7D78, 0x00004BA6E9C27F8D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA8479D7F33BE213E, 0x29790500F286B568, 0xB68041B7F9F9AB3C, 0x52104AE79117C01E,
+0xAAD3425A308C394A, 0x1550181F9273133B, 0xE0EF9AE116186A6F, 0xFEF6928E1A31EEFF,
+0xB2508F554A8F2B82, 0x6A3897D550F21F04, 0x4EE3FAE17A884C39, 0x00003A1D93AD437A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8CC4332E3CF6A063, 0x30160A6AC2C875C0, 0x0D2F89DFBC0E93F4, 0x86A1B3368B088955,
+0x4D9FAE99ABAB1DD4, 0x0DC49C6044C2E134, 0x3DF11EC9E938DD4E, 0xC199355D94717B3A,
+0x443B947436C33EEB, 0xAB23DE0FEB77A48D, 0x45D836B6BBAB9E08, 0x00003DFD36F26AC0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4F5B0F79B1796AF2, 0xB6444A3F1BAD6724, 0x7F3BDF69EFA3AC85, 0xA7583BE9D59F65B2,
+0xC7194CC6DB3DC39D, 0x5C6F5187D27A4854, 0xD1B581843D712318, 0x2D321DC6189F9BA8,
+0xD5FA5D7611938F50, 0xE1E8AD74A9551DAE, 0x59D3EB630FC34590, 0x0000639D20E46C98,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9E7C1763EDBBCFC6, 0xC4CAD4C48609D0F2, 0x83C1ED03AFC38217, 0x90865CBED2EEB4E5,
+0x599CDDC717DACBEF, 0x73D9D21AAD5173A6, 0x0D88D0D0D37278B8, 0x93121BB690A85923,
+0x67D0244AAC8C466E, 0x9AA812D3DC5D6A79, 0x949D58A7AA117B65, 0x0000341A84135389,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD5EFFBE82B78F1B4, 0x5960DCE6991133CC, 0x1445C790F9A66B20, 0x651BD319C40CEF59,
+0x28441943A54A4789, 0x111C5C5753C641DE, 0x10F04D6B5990D5AC, 0x71B6F1C638BB0188,
+0xF92BBB635E987A75, 0x4912677B09DFF229, 0x149498D3437C1B35, 0x000039F742DC48EE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF18D4AF5732DE1A0, 0xD43E2C402DD8C40D, 0xAF40967E6A8F5851, 0x2643EB5D3655129A,
+0x1547CA0865DC5D23, 0x7DDF5F03A37A9650, 0x969287BAE160DEA4, 0x526BB5995049DCF2,
+0xF8B84296068F8459, 0xD94014D4C6220994, 0xE68197B37B836FBC, 0x0000630C8A332C8F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBD997C394212F8E0, 0xF562D350073A227F, 0x5EEA7862DFC69759, 0xA517A896A9B5ED6E,
+0x8E61164D047F3E21, 0xA8CE57ED11C5E707, 0x5F456573C2C51622, 0x03A995778098CC5F,
+0xD10FA2C00BBD7229, 0xF7B4A07168102EA8, 0x77188363D8057D0B, 0x00005010E6D35950,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA5E10CA3732EC1F2, 0xFE9A8F5CD372D90C, 0x938E9A054A6AC042, 0x393D166B051D03BE,
+0xA3BAE05BFDBD95AF, 0x6CB9383EC7EDD427, 0x70C96C0BB1411E50, 0x376F0DD15ADB04FA,
+0x39C028BDED1D0F60, 0x926514D1F82FDEED, 0xD0698E1E25F717E9, 0x00004C8B7FB9D85F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x18049F252D93F146, 0xDD8DCFBE7A866600, 0x7CD310581E502AD3, 0x19D93BF6C8AAA3D7,
+0xE0F55F4EDBC05BED, 0x5FDD5340D3E09CE1, 0x4A9CC18D0169AD9E, 0x4FE6FB5001B322D1,
+0xE370FB281C8D8E4A, 0x2039AE0FEAAFD402, 0x6027BAE4763FA72C, 0x00005BA6C7FF864F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5E79F600AC9FF5E4, 0x7D93914E957AD35E, 0xF5B27EE35A6508B8, 0x5AD83B307032B265,
+0xA8CBAE460E686898, 0x5B5C53319C1D823C, 0xCBD75EA9E1C1EBB5, 0x43EAEAC3A7D5DA1E,
+0x06BCA0757F727235, 0x98DD6FF70DE197E5, 0x5F6A1A47DB9A53CE, 0x0000470213DB3D7F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x10822D50395205AD, 0xE4349914C4FFC623, 0x0CFCDDC9E343EFFC, 0xB9147471C0C86893,
+0xEC202E784BD6B876, 0xDE8980C9D12022F1, 0xF5C2C6912AF8B085, 0x01F18E090A28EEAF,
+0xC993CEEA5B77C8DC, 0xB1CB13C28E7EA937, 0x3A858825E2B1CF4D, 0x00002EDC32CEC464,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x629F886479C38DC1, 0x852A260401E39192, 0x7473B26EC1BEBEC1, 0x1F3B3104DB02DF65,
+0x78474C311C43BCD0, 0x340A4EC9DD25E366, 0xEA7BD892C86768D7, 0x4E8062D805102B26,
+0x310D09794BF46F05, 0x382B36BAADE09DA1, 0xAE6D4B72F186537A, 0x0000099D44E73BBE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEAE09FD049BDF7A0, 0x91E9B97E20539E80, 0xC3FE6C429A5D0972, 0x8EF86C37147EE41A,
+0x402B3B4189523467, 0xAF5E4C62F4394E5B, 0xC97DC231EB58D1C6, 0x4849311E182011A3,
+0xA540FB0A31A1AFAA, 0x5B394012DC2B30F5, 0x3145A492E1B4EF90, 0x00004AE933920465,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE3FE3D1E8F4817DE, 0x7189CD76E2429216, 0x3C9F04279AEAA03E, 0x8779D6D82273E4A6,
+0x6FBE451FA69BCD65, 0xB2A271F48B55B4A1, 0xD763DA45CA44748B, 0x701121A7ADBD2719,
+0xD9C415BCF35AA993, 0x5BDE401F15129588, 0x16B0FAF81CDD900D, 0x00003A93FF584328,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x34AEF3BD75B49604, 0xAAA6D79E3BE135C6, 0xAD371ABF8CF5A517, 0xD67974F47C328756,
+0x6C36DE089B882CD3, 0x00D928865515FFAB, 0x3364AF0F69724148, 0x5BC42AB92D5D06EA,
+0xF389328A66519C7E, 0x52C3D20E5CF0FDBD, 0x8C950E7D5D0022D8, 0x00004D64E4D3E79A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9BBE5825411F3DD6, 0xACFC0A1179797326, 0x2067FF5BCC4ABFA2, 0xA2FA3389E7AB9DD7,
+0xDCAFD0975EA3A800, 0x44394A8531887E11, 0xC199E6307AC3F184, 0x7480BB14F7DFE683,
+0x8BD8CE9E4ADE7FF5, 0xA495462399CBD82C, 0xDCD19143ADA88CE4, 0x000022E300097D8C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x62D92B4D6292C9CC, 0xFC6CDF2C30480383, 0x7991512F438CA8A9, 0xF1D0C9D8EEB22B77,
+0xE40E44DE4CA284C4, 0xCF5E1EC3A3BC9A7D, 0x5E697CF009A968A0, 0x838414BBC777FCD9,
+0xD4BCEC727D5BAB3A, 0x467D4F3BB29E5FCC, 0x172D382AB3E6487A, 0x000033F9E1AB2CCF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBC2AC1A114CCF511, 0xECEDBA5FB92064DB, 0x9660C0B9467137BF, 0x55D16CCEB40E4471,
+0x62D309C00B413E71, 0x49625A5C665C9B21, 0xAFC97F4FD8A279F8, 0xF0F75488A0C57ADB,
+0x125A227B6C129930, 0x33AE2B55C85915C8, 0xB1CCF365CDAE260A, 0x000016E3FF20D1FA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9261FCD1C2E6AC67, 0xCABCA98ABBD0855C, 0x1163741DA01CCB28, 0x8EFC30DCE3873737,
+0x1A44E0DC41A5DF9E, 0xF2F2462078F10291, 0x704B42F1A13A64D4, 0x1EAB38F7F36406FB,
+0xA9AF35B83A0345E8, 0x932DE395B92CFF0E, 0xA1DF56B8FA722914, 0x0000029139AF96F4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFD40AB54D4E14C94, 0xBA476C8FB4F9B37B, 0x0D471FC6B1D04863, 0xA9A327595D4E5FBB,
+0x3B1382E9472E7A8A, 0xD45DAB2A2CFF09B5, 0x77C01931682E453A, 0xC66C036A5D61DD19,
+0xF91301019E18DDBE, 0x09663F77980147D3, 0xD684969308D3FE9A, 0x0000004052BAD2D7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8148545797141F5F, 0x565E8A0FC3A98F20, 0xB22102C0274FC7DE, 0xE08EA88D6FBC897A,
+0x74F49ECFEC8A4F1B, 0x7F77A465BEC47A15, 0xCFFDD0C18AE8E469, 0xFF3013784EA3BC1B,
+0x7681BA69062DA006, 0x6932C3D37AA40C75, 0x08B16570724436DB, 0x000001A149AB53D1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE2FD9A4FF84504D5, 0x8F7E29CAF3250E65, 0xD09EF7B73B48F307, 0x0439927E8AE7970A,
+0x83C7D78CD70E9166, 0xE1554272787B066C, 0xD42C775BF15B07E8, 0x012A328DEB53B967,
+0xEC405AEBD92C96DA, 0x7844027CF0B6CA54, 0xAE637CABBA2B0E24, 0x00002E5752022231,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8A28C5047DA8634A, 0x98588497CF3CC8EC, 0x66814759A43B0DC3, 0xAFA7482461B2895D,
+0xFF94FE31B3F46E21, 0xAA836EC3F908A4C2, 0x805AB3AA64CF8A1C, 0x2C9F379BC5DA8E46,
+0x68052170C270E126, 0x3DBEC50AAC496334, 0x4C2DBD859E71DE42, 0x00000D107E367667,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x36B84A5B34B2EAAD, 0x42A760B370F0FDAA, 0xEAD35D8C2634FC1E, 0x69D2ED138BA02F2E,
+0x0691E3FC29AEE9B6, 0x926ABD2CFE1817A7, 0xCD53F36B3A36E85F, 0xDCDDFB72D977CB89,
+0x0BAD6359BE445172, 0xA7CCC212DC7883EA, 0x84082C91BBE8B078, 0x00004CBE97C5CE53,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCEA893B621A0B007, 0x23DF233BB4AE56D0, 0xC659B3FB77C15963, 0xECF4B39836AD04DE,
+0xF275D5E9C96D00C8, 0x82F03F725E814D83, 0x0D4C7C2AEFBFE41B, 0xAAC2686DE0E6872A,
+0x2E4744BB44EB124F, 0x1B2F59E81AC754CE, 0xF56E9B857444E4C4, 0x00005C297686F7E9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3FA34F764E2C0D95, 0x26883CCA4A3C77DB, 0x1F73FFC0474640E6, 0xBE88F2A3244EB7B8,
+0x5FF7E756B5812FB7, 0xD22BD29F3EC07776, 0xA2F1C7B7969F308B, 0x62EB4FFCCBB57BDB,
+0x1E10BD2D472604C0, 0x9FE6916E555F14A5, 0x5A2F17B155593A93, 0x00005AD2F6237D4E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x926240DC99C69E9B, 0x8D84D1889CDAD19C, 0xF4BBBA0D6ACA3D35, 0x69A8B11D42E2990A,
+0x7B0AFD362762EACD, 0xC69A123DF7CE03E2, 0x33DB1EDA8AF651AB, 0x05F3A77067CC38B6,
+0x9D5C3BA52FC3BDF0, 0x6BCCF52B8042ACCE, 0xE25479E7A6930F72, 0x00005B7EF6397B45,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x32E3C28472FE0367, 0x67BF4BBDBF8DD919, 0xF8AC1C1F323C48F7, 0xACDBAD07F1BEC3E4,
+0x5A4223CFCFFD483B, 0x067193B45F7AF091, 0x1FD91D29E8367C5A, 0xA14A376509054C2B,
+0x8A860776DA4CE488, 0x1ABF0348FE3CD507, 0x919BF76EC941EDF8, 0x00006D9BA9011A09,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB8715855E9862EC0, 0x6C4915CF89B3FAE2, 0x62BF625BD4A94E84, 0x80949E5F5EA7884E,
+0xEFCC50C31A8AA60A, 0xA7E1C9E2F280C436, 0x716D282F6CD1BE1E, 0x85339EDF86ADB810,
+0x0FB158B6816F87C3, 0x0D2A48A4A208ED16, 0x6F4860FA531F0376, 0x000014D1007D5BE0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFB598F22BD02E8A3, 0xD287B778F853123E, 0x17A82ED8EBF7B7A8, 0xA2B20F0E873F2114,
+0x42E48BBD3E27648C, 0x529F1069D84A9753, 0x286E72535130C83D, 0xC0FC094C02DEA538,
+0x9057FEA9724228CE, 0x1BBBD42B1D24C95C, 0x2C87B1B20ED54F18, 0x00001D155EE1476C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD0053CCE0318B385, 0xA6C8F84B5ABA6CB0, 0x2B5998DF9EEEB751, 0xCDD879A6A333D65A,
+0x2C67801BA138AEE8, 0x8056EDCF638B1B3B, 0x487DD58325C4A742, 0x67C52ABDC4F81DD0,
+0x01B4C7E1A4CE87D5, 0x54D12146EE2D7A66, 0xE79A84EE0DF0326B, 0x000005C49610479C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB7EB9EE07A1D7BDE, 0x5ABF44A330B475FE, 0x18CFB3DA83439218, 0xF94E8223A5735643,
+0x811495492F51A6A1, 0xC0CADB4A30B7EE30, 0x6E874BA9BDE8EF10, 0xF518D156A53B670F,
+0x16EE5A85D1700CD5, 0xE6358415F90308DC, 0xE67C35E30D959F75, 0x0000463A7434AF2D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC8AF8D5FD38969D3, 0xD2B821381C459F8F, 0xF65A73B3D279721F, 0xD1E8E6DD2FF5AC38,
+0x4EF0B459984E7E31, 0x5FB420600B8C3148, 0x5ECC3A157520E1BC, 0x351051D6F6A76D4D,
+0x5699F3C65949B0A5, 0x494824F3C325A19A, 0x6B8A73598F0107A2, 0x00006BAFE3E32B47,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xABEBA07B27A121F4, 0xCBD05DEE459DF507, 0x05D46EA516CD60ED, 0x24E9F09BEEFB7400,
+0x6B2A2BAB89E135E1, 0x55BC23EBE86B5B06, 0x32767565A42DCC45, 0x18DDAB412F4B5B55,
+0x4E1D376439C74CB6, 0x488D93EB5E4DB855, 0x0DCE0899981B2944, 0x00001C5D7269E8EF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC4ADA4F0AFA8F870, 0xAC9843D6CF413426, 0xFDF4938DBF01D1AE, 0x7AB5E76C81FC33BE,
+0xEF207428D99F5D69, 0x286DFF85DD408633, 0x79957CBF5F9262E8, 0x88C894EBC370EE47,
+0xF3A42D9A4B56A1C2, 0xB5A246E463A8A25D, 0x0E7DEC6A201B95BD, 0x000039B11AFA2611,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA4CADDFAB6EAC7D2, 0x1E77E9406F6171BA, 0x3328FF726B8F329B, 0x41908294B6C060B4,
+0x9F1F6D6429F62862, 0x33FCC45E88285C5E, 0xB5CB761CA173B207, 0x773AF0AA58D97758,
+0xD1DBE125D3239914, 0x1DF706E9582DC5F0, 0xB7D16F849878FC7D, 0x000052548D75CAC0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF49698C176F34E56, 0x50871F39AC31B290, 0xB54DA367A148BA8C, 0x53F3ACA25AE0D9CE,
+0x6C0139694D2D5342, 0x7593C193AE7A6376, 0x33F0D545FC956244, 0xDF82B2662E9F4244,
+0x921DF04F0A7D1085, 0xF02F98BEC64DE03E, 0x4040ED83D694E292, 0x000057F0125A07AF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x676F5E555D725AFC, 0x67115410E8A6EBB5, 0x76C71FB2CE3FD937, 0xE7612726F5BCE396,
+0x1372F357B9B38892, 0xEEF187AAC611C559, 0x1FF3FEC8AAC2103F, 0xA503122ECFE76705,
+0xBF4F3F6D673BE467, 0x312C1C54F8DA73BB, 0x5B983C29870CB405, 0x00001BF8F66B620E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x538227285E6759FF, 0xB022DA8FB5C2F020, 0xBFB0FD9C6A979916, 0x87585F034A09605B,
+0x305A754E63A5BF63, 0x3963F791A3204023, 0xB562EF1498620A86, 0xC1502ADE11E04720,
+0x14FC75B86912C8EA, 0x08EDFF1D42159C56, 0x84443ADF725ECCF7, 0x00001AA120B9FBD3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6A10B8B3A8DA5742, 0x0748EE447C7B3D15, 0x12589F79CB3C2E2F, 0x8C92ED8F1A26B6BD,
+0xDFEE1AD98D0776F5, 0x8B4C92D91F4935CB, 0x89FE006FA9718A17, 0xBCE7E27F0A0E36FD,
+0x84BFD32C2B0134DD, 0x858F8D209E62EC4D, 0xAFBBDD7E3118974E, 0x00006CF75798A501,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC670D5B6BFC879AB, 0x96C8CCBFA9267481, 0x03A1926222F690B1, 0xCF081383F82D77E9,
+0x27461B49D49354F7, 0x34B97CD9580E8AFA, 0x1F4A588BC5BBD392, 0xB92A422D6418D7A5,
+0x3ACEBDDA5065298F, 0x84B133880F493F44, 0xDE3E7D15597C4A17, 0x000047F49556E1FD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE21699E756628703, 0x4F57B62614EB53C4, 0x8C3D1E0667800637, 0x3B1EC43D843EBC3B,
+0x5ABF6445486AE151, 0xE871ABDC78F98430, 0x6C59436D29FEDDB0, 0x09E4453E7AB87C70,
+0xCD87EB20D9BDF64D, 0x0BE4B7A79BCB0F7A, 0x4FF78D085153D9C8, 0x00000981F173372E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x24B7767663B3B1F8, 0x00390F705DDBF163, 0x9C797D236BA6D335, 0x0C9A23F20DB6B7C3,
+0xB81FBB018CB16646, 0xAE40CF49B53215D0, 0x229603210CA05591, 0x778C91B98C666C78,
+0xB5BB0F880F676019, 0x7659F716258C4030, 0xC742255A0BB04C47, 0x0000186443CBDBA6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7B8526FCBFB2F9D0, 0xA4DC5695EA539DDE, 0xD651A944E5597FC7, 0xC9D5724404560C22,
+0x2E064F0E10E86F7B, 0x79164D5C64A98A49, 0xA6DF08C7385059ED, 0x2EADBE17567A7BE1,
+0xC9927D857E32EB72, 0x1464EEACF57AF2B6, 0x1947289638EEF574, 0x000020A6468E6098,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x83315A3555CDFF3A, 0x41B0EA3427E1A268, 0x77DEAD6A96CB9E2C, 0x61AE68B793349256,
+0xD228595188DDB085, 0x24F707D28F1FE4A2, 0xDDF54A99053E67CA, 0x44AB9296D0F9A4C1,
+0x68C9DB56E88AF861, 0x5678FC070C772523, 0x11F09DAFEC75C878, 0x000013B4B255FF7A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7B7D325C09088748, 0x825BC42FBD0E6B07, 0xE479359B39725439, 0xEABD1441D5928B5C,
+0xD9C8E726A00D8650, 0xAEACB94C7E90CA2F, 0x628735B8D834F2C9, 0x3D5A4C57FC3AFF9E,
+0x0C51AB28B43CA190, 0xE846E7FB95706E1F, 0x004BF8A19C64A1D5, 0x0000335D00FC70DB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBED846B6B8A2BCE2, 0x0E17F2BC35659982, 0x4CEC0DF2E204334F, 0x9FAEBEB8F14C5E7F,
+0x0F14BCB3BAC49A3E, 0x360BB0CF9C676F36, 0xB7D805A031B65703, 0x84F089CDCA5C514C,
+0xAE81EF12C44F680D, 0x2F331D28389C44F1, 0x8864601A1D7279E4, 0x0000187C4F52EA4D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF70F61FF46E59702, 0x4BF04037BA8F85DE, 0x8EAAD05019AC1EF9, 0x0B528475AA248A81,
+0x2122720928CB2A94, 0x56DD1676F93CC09F, 0x1999FCC3B6819FF1, 0xAB5D39DF3258BD50,
+0xFB17D0E9C79E01B7, 0x63AB854CF2BE04DE, 0xEB0912160381BFDA, 0x00005992A45D8459,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x653383CA0BCB6C3B, 0xF38D25AEE76FC6EB, 0xBE318036073F754D, 0xBB296E8AEEE865FF,
+0x78BE77328F5DD616, 0xC57D9C8637FEF9B0, 0xD87B8F5673B41720, 0x689A7A9E469F5A15,
+0xE87DEB8EB4F9428B, 0xC9D0C70DBD64A1C0, 0x8550B42C6CFA66D8, 0x00006FC6D53FB29B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x66E67ED6A334963B, 0x8B568E7E1A1A5B99, 0x75747900DCD22320, 0x397357128ABB727A,
+0xEC2DBAD1D9D80CFB, 0xB881B5C788D09317, 0xF0873686A90ED968, 0x1AD8B54523AB4334,
+0xB84292B10B2B0E28, 0x4523ADE4733C055C, 0x1122980287878AAD, 0x000042AB4DCE52F9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x50E9F49C3111920E, 0x907B8426E3FCD1E3, 0x4779063461846270, 0xE9637968740C01B1,
+0x91369F000C5D8206, 0xAB021BEE704547B6, 0x1997C37747BCC9EE, 0x4757AC68821E5A10,
+0xD4A37165DC38C791, 0xD004865E279C8DD5, 0x0A3424BC67E1E6FD, 0x00006CDC6CD168CD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xED31F4EA6F6B5358, 0xC2C16D97F78C5151, 0x722E242662DEB595, 0xD634F093C9EB942F,
+0x12D72E3FA095C445, 0xFE648EF9B2794069, 0x9C4B68F17AE64CAE, 0x6CA8170B184D907F,
+0x57642566A5F27940, 0x14661EB652CF436F, 0xA51A92363210F568, 0x00006BF73B87CA34,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x321DED95E5C22BBF, 0x107C8741893F8E04, 0x5D8FC41A86027E5D, 0xB9CC54760A220962,
+0x7FFF48CC5E387070, 0x697AE7D11C262F37, 0x23819AF04B5FC98C, 0x21E1E73377F59579,
+0x85D4A5000EC3BD10, 0x44FDED20C65615F1, 0x28AEB8B916FF42D8, 0x00001BBDB6FE3EEA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5AA1260B5D03A01B, 0x38B136D03B1D7DEF, 0xD4B75727965FABA0, 0xEDBF6FAA64DF1078,
+0x74320B69FA9E3ABF, 0x5457192FDDAC4CF2, 0xFDB36927AE33636C, 0x5DE11DF4FA8FD087,
+0x34AE61A3A4B81F73, 0x1BDCF7AEBA43BF83, 0x05C40BF8B2817DCA, 0x000007ABA0F00207,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x02364D8B7246E487, 0xA5B3B48CC97B98A9, 0x4BBBDD284F798A66, 0x4A752155A35B54E3,
+0x4EA67C737B3F5C96, 0xC2B3E5429C5227D2, 0x722CD6A482BF559C, 0x3E210C6AAF0246EB,
+0x3C9681C3D7409CC6, 0x3BB9E9F7D98148F0, 0xA5C22B1ED26A91EF, 0x000022D6436A81B8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x80913A93EDDE4631, 0xD9131258F5D985BF, 0x6D363C968E27DAD2, 0x31E0EA93FC739650,
+0x260362C1DE0F7D22, 0xD3C834A52178BC5B, 0x72B560B6F6EE9B5B, 0xDAF906091E6029C7,
+0x7EB5255240361E4B, 0x367F940F7301A59D, 0x0A59AD7768291D7C, 0x00002FEE48CEB49A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC655F9FEACCAD22C, 0xB0178D0888759B5E, 0xF770FACA00471FF2, 0x7EA287A39FE8A0ED,
+0x1334DBEBB131572D, 0xEA3E41EA3CEBCBD5, 0xA53FA50259921113, 0x519E8443C696AADD,
+0x1755479A76B73B52, 0x994961182891558A, 0x75AEF77AE4792CFC, 0x00002BEC59CCBFEB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2EED6282034AFC83, 0xDA3774AE1A817176, 0xF3369A6344F66575, 0xE43F8CB039D96B67,
+0xB71C9CC02930F3BC, 0xFF6A45E7E217FA11, 0xDE337631DF629D14, 0xAC100E5E68D94B7D,
+0x92FA21AA806B76A2, 0x36F908637349911C, 0x059810AD980407E1, 0x00000AF1687BEE8A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xACC515B1666D1DC4, 0x1E0A310B1E93660D, 0xC4AB9A72B83D1C4A, 0x33B40C224DEF0F09,
+0xC4AF32D5480308D6, 0x78989ACD561E79C3, 0x844CBBF9B774546C, 0xA344A3E52789D0F4,
+0x81D1AE424A95FE5C, 0x4BBACA10CA831849, 0xB5561095417596D1, 0x000003C118044500,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1145E0A75F0A80C4, 0x506CDB0BB106F180, 0x3928D3F10D0A8051, 0x1B9868E14FB8406E,
+0xB69559F37C2914FF, 0x1B03D3A5585B4251, 0xE34172325524B5E2, 0x7DAB149AAAE05313,
+0xD5229DFFBD8E6BA5, 0xC961A7F5FA9A6E0E, 0x5AA5CB6BF4FD1DE1, 0x0000412B53E5376D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBA5EF6C9DDE2D07B, 0x61CD7183FB29E330, 0x61C5C8D9BF0774ED, 0x62332D6573ED95A6,
+0x8AB7E2973B1BE7B4, 0xC4B11C7674BE71F5, 0xC6F853DA5EB1AECE, 0x14E7101ABEF95059,
+0x28B2DB80945A42A1, 0xACB1C2C39CF79004, 0xD3745D8B3DFEC7EC, 0x00005C05B406C0FA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x73EA325BFA489C2B, 0xBACEA8E47A8AF4E7, 0x61820596EFB046EC, 0x8C09DD278D0019D0,
+0x2C766CEC90A12C99, 0x3EA9FD8AD81AAB45, 0xAEC44A2E5B95031E, 0x984029B8B0A4CE0D,
+0x26095ECFC8B6DB7E, 0x60A1071543B7DB32, 0xC415244D96623E0D, 0x00005BADDA157695,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBA8A0BFD5A858E02, 0xEBB4EAE6313D833C, 0x12B3E37875738C99, 0xE2DDB4863C3389A5,
+0x0B54C805D665D29E, 0x90E4749B2AA91452, 0x16E60A776ED7FD9D, 0x99242D3D8F232398,
+0xDF8398C6AB8F1506, 0xEE0BA6723E72FE04, 0xA395D41B67DAE9FF, 0x00001A4708704B62,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x425E706426D5B4F9, 0xC2B062B2C72C3EB3, 0xB42A48F9F37822D6, 0xBFF3BC18EBD8C01B,
+0x0AB78477EBC34142, 0x83F5BC0E1506C793, 0xD6DC3A87ED42686E, 0x41CC7F53303DB80B,
+0x3DECC7AC41C0D63A, 0xDDACE1F78F1FB8C0, 0x61B0E4F97A88D1C3, 0x00003F0AD0F50E2E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3AD93552E7FD43ED, 0xB2DB6FCF895715A5, 0x45894C02BF2DF0DE, 0x05ED16AC3AFDEB6A,
+0xA82B86CB32FB6C9C, 0xA8DC903551375F49, 0xFAC7EC949FC0DE7E, 0x6B19674BF69B338B,
+0x3A64BD2D67A384BB, 0x0B5074C90809DA9B, 0xB42947F99786CEB4, 0x0000147FDE623C0D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEBBBC254798C4EE6, 0x98C6D579E03F92E9, 0x7CB9D005AA0C3C03, 0x17C733EAFED162AD,
+0x151FB4F1CC2289E0, 0x5FC3713BDFF9AB69, 0x6D3B834965EA0CCC, 0x4FA44082210686D5,
+0x2826E9C1C4244580, 0x2B16B3A904F2689C, 0x48464304FBB88051, 0x00002AFF533BED8B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x834456D953142273, 0x2D742185EFFC203B, 0x44D8D6E826BC6470, 0x8E4CBDD8EDADBB76,
+0x68EF2283F6CC32CB, 0xB31556C3515047C9, 0x21330CFCE484D4EF, 0xA1B39DBFBAB6BA80,
+0x9F6D072B7AA44819, 0x03CB1FCA5601E2A2, 0x6CD483DE19D8E41A, 0x00005C843D165286,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9984842E08F3880F, 0xE91CB5AADD1BFBCA, 0x8BC5AA332B2151F3, 0x65F0A08377C36453,
+0x6C0B7009CEBD802B, 0x3D84901DEA331679, 0xB58980355C27A7D1, 0x414AD2D3B7CEB141,
+0x8F45152487958F5A, 0x88EE5202EA1C892E, 0x4FB55403035D077D, 0x00004337FD7E4502,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFC4C5961CF3C0D32, 0x1FFF8FE2429A3360, 0x43C1C295E5711C8F, 0x3916AE7B7CDE031D,
+0x62F4DFBC10378434, 0x5E1F36C27A85DF2E, 0x47E8BA19FCFD6BE1, 0xC5F94605EE61257C,
+0xCD7414765AD68FDF, 0x69D4CFA186A90E55, 0xA27E51F72431C4D0, 0x00006FB255B3A610,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x551283BD10EB08B5, 0x940D874FC08F881F, 0x831F4E9A0B3B0284, 0x2F3B6FA8B9EF33E7,
+0xE49991C1640B6F89, 0x7A208E23C93DA3C9, 0xF6EAB8B319BC89EE, 0x63EAA1DE5786120C,
+0x67EE9E6B0BF7D64F, 0x714D4E97DBB533BE, 0xFD70ECB722C2C7F2, 0x0000491C147E985D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD2FCA6E5707CDD45, 0xE8D0BB4AFBC7803D, 0x403B501A2466AB9E, 0x57A0FA604B555D11,
+0x7AB2417991BA3FCA, 0xF9908A35AF101BE9, 0x566031603D196BB7, 0xA01EB111034AC3DE,
+0xC3FCBEFF7F16A74B, 0x01A1D48768515DCE, 0x246425A962E847E5, 0x000066A5B06C7F6B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4C76A35707753917, 0xDA11C84D83C71D82, 0xDB9F17EBBD2B7AAB, 0x378266E5144B9BA2,
+0xFD38C50EC7BDDF85, 0xEEDEDE87A08D07D1, 0xFA9CE60C2E431FBA, 0x28CFD3AD964984D0,
+0x372A5E27B3C9BA0A, 0x4CD3E72AAE463C6C, 0x4DD5B8829C2A72B1, 0x0000102F0A0270CC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x13F3889059CFC959, 0xE30D9CA1576C131B, 0x570D43AA7566955C, 0x60EF72BF7798A3E9,
+0xFF5F14DF701FE889, 0x79329A4A59727E04, 0x8C19D46AAA172181, 0x17C7E832F663EBC4,
+0x1C145D3270A7807E, 0xB864FBEC0A3340AC, 0xA805BF0A1F48D053, 0x0000023D16DB6550,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1229A2531F6DAC44, 0x922A03FCE2A70C10, 0xF55063F015874852, 0x4B7EC51D4C56F452,
+0xC2BE74A772794C1B, 0x5645E985E518DD85, 0xFB98E8AB63375103, 0xFDCBED824DA773A2,
+0x802EF364086413E3, 0x3DB56F8A6CCCBE54, 0xD5F63DF0D16A87EA, 0x00005C321A1EBEA5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x973663E744489834, 0x97936D39882D32CD, 0x44F9552E3A656A95, 0x4E6C4191D7719469,
+0x048939D0B989D95D, 0xB7B7A18C5D385250, 0x45C74EC3D43E05AB, 0x7F9188EA9F6A8199,
+0xD9D92B88CA1F90E7, 0x04126F4D57B8A7A0, 0x49E3B8E011DA6EE7, 0x000044B1E0856307,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEBE7646923F9439F, 0x297EF4BEEFFC006C, 0xCE2845C2678C5F90, 0x31F9EB7FE634E96C,
+0x71A4ADB103E4A869, 0x09048FC05CC7B4B5, 0xE16D7D4497A039E6, 0x423EAD1362D47BD4,
+0xA39693A1A291E46E, 0x02B8A570000ECFC0, 0xB9EC683E1DA4936A, 0x00000BC2EEA4AAD3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7BEC425A7EE13116, 0x1778F12C72C5A6D6, 0x8F8FC4F2719B5FF1, 0x56516AF593735EA1,
+0x85BF496427DEE999, 0x52A7A5780F2F2660, 0xEDD4505C82625E48, 0x6C53E494AD66C1EF,
+0xF395D09FB60B1FC4, 0x22362821D21F19D4, 0xC4D9020FAED32098, 0x00003DB53D58C154,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA0EAF98F414A8774, 0xAD9A739797777BC8, 0xD10E5970AF03D211, 0x4885CC6F4504A773,
+0x73FF3D34EDCB1622, 0x4A7D454E17AABE90, 0x1FC6E5BFF3C1C7AE, 0xB473BE6AAC691F68,
+0x1E61A41EA3A9E1CD, 0x7E9976F2CE6D5D36, 0x9508E630FF6E5447, 0x000004C954075BE9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA1E6A67F0F76494F, 0xC84A1F4382D4AABD, 0x90AEC2933F797082, 0xED55EEFD496B87BE,
+0xD9A6F3ED1756929A, 0x8FE84832FA53660D, 0x17870376B68C7694, 0xF191792BB6DCD3EB,
+0x6634D93E2C72627E, 0x42E786FE684DD984, 0x7F99BA842DFCA4DA, 0x000030180EA6DC59,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAF24FD9D2678C1DB, 0xDEDF01A8138EE2B4, 0x13CF027EAA49D09D, 0xB071EE5DF63D3FFB,
+0xC66AB6AB71C44E91, 0xB5A72F9947E4ED6E, 0x53A2245876EC2D66, 0x7DDEBB760ECEB414,
+0x01F62AD041CBC8E8, 0x1832775A8D8290FC, 0x3B25A713536DDE2F, 0x000020C92F03A13B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x89CA63231F8C147B, 0xD87073DF1D4062C1, 0xCDDCC91A6D192E9B, 0xE005AEA12EE8C1A8,
+0xC561BE5918C6C62A, 0x0601128BEC759CC4, 0x1D14266984DDE1F2, 0x6E1F0B0A98B95D04,
+0x08B8CD6006E91736, 0x547296FE0241BF65, 0x51B2EDAF91608A87, 0x00000CEAD9DEDA10,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x872BB253AA9C89DE, 0xCFB6FA67E492FA00, 0x4B9C298DA5B0A4F5, 0x644D9194CFEAA695,
+0x75C1A33B251EE034, 0x39DA45B9905E3986, 0x2F672EE0B262C45D, 0x91C3BCAB91A10FA2,
+0x6A4F80DF4C03E3D5, 0x62D129B9C514D185, 0xCDEC0508F75D62D1, 0x000015B6C03B3F43,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFBDDEB108869A8FD, 0xCC9989109E220C44, 0x9617E71B08DFCA2E, 0x72963650DF5D5A43,
+0x91BB559FE06DC23C, 0xD758B51D20CD1B29, 0x48FE5767CC78E5A9, 0x24641145E2498A9A,
+0x330474CDBFA36002, 0x2E6D157C07A51DF5, 0xFAB960B65D6516FB, 0x00000B376FB1551D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x99F800429EC09E66, 0x24E34E3DF7392ACB, 0xD7548731940B4AA8, 0x593FEE9AA217A207,
+0xF0BD3FBF175EDF33, 0x7856503869032A5D, 0xB57CEA6F1AB7B2B0, 0x562AE1B7213DF264,
+0xFFEB71AFFEC21751, 0x8DE7D3E1FD2FB0C7, 0xB5BA9BCCFEEF3524, 0x000015E6C12C2AD9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x49485B8A5D5A8A9F, 0xF3034C438FD1FE65, 0x3BA8ADC7C6413C2E, 0xB9EF482BD8E150C4,
+0xED51ED92895E5E35, 0x863021536CF0C1BA, 0x84F844319DA5CD51, 0xB5B05494D27F3267,
+0xF4791EBFA4A40BA6, 0x1D63C82556B8CB5C, 0xD8829DAAFA12B199, 0x00002F3475432D10,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x77FB2272BB0DBFCD, 0xCEDEF16D18EEE058, 0x985B7DA929F4B962, 0x87E9ABC8985AAD52,
+0x9C24FDEEF052DB4B, 0x0F686E6DF4E9209C, 0xCAB3620928ADE245, 0xA16142E279C1890E,
+0xA61687A14E4E5519, 0x2644503F2C777320, 0x9613D744C7393934, 0x00006964A3CAB0F6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB6252124D06EEFF7, 0x8C5621845B361557, 0x634CEFDB3B84EAA3, 0xFFE741A4A82331C5,
+0x386FD1D6DAD216C7, 0x7FA496E877FFBF4B, 0x689F7370E49D9F1E, 0xD638F32F654D2A0B,
+0xBFB37FF28ACD250F, 0xB2C42A245BEA0745, 0xE157067D4BE4C3E1, 0x000047BCC4453D30,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA81E7FE1D083CBF8, 0x64798E91CC1CE881, 0xD58109075CCCE721, 0x659ED914B543D733,
+0x313D63B039360E1C, 0x0CE7E318423F50D1, 0x0B8B8F445F29EE5B, 0x300117FA3275BEB1,
+0xAA34C92BFBD07DCF, 0xC8E44C01E9B2E57F, 0xDAA634139CFED590, 0x00004920929BA505,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x29698A429424C097, 0x7382D852053DF010, 0x5BB05C63AF523861, 0x3245D1ED53A02A65,
+0xC8B13EACA3950A59, 0x3594962396E9CD02, 0x123E27A0FE80ECAE, 0xFEC35EE17AAA9A4A,
+0xA023F02BE406F9E4, 0x737BFFA516D587F1, 0x8F6DB26C2EBD0E4C, 0x0000276A7E324EF4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9FD1935EE62C72AC, 0x783C7D3AF99DF866, 0x91809EAA1E1EDF32, 0x453C49D732095A6B,
+0x67DE1313C6C6CB91, 0xD6C6B7BD787A03DD, 0x3725D06B2FADA70B, 0x3CFBF2D925CAD713,
+0x953FE11719724DB1, 0x7C73BADDE636BD09, 0x1902550B596557C3, 0x000016FC5B5F0CC6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x45CF166517034B2C, 0xFB713C077EA37C59, 0xE531C051957A1738, 0x5793CC0BB896544B,
+0x27B22C7968B507B4, 0x5CDF95DF17FE0384, 0xFB62A2B101BBEFFE, 0x82A4DA0757FD1A60,
+0x430D2808B0E61AF2, 0xD33019947EE2D1D1, 0xA2C5D6837DEA01AE, 0x0000385907CD4441,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC308C0C6EA6F4BD4, 0xB4549D3B9EEAA8CB, 0x7D364EA9350E400A, 0x85B3F2E01FFE60C3,
+0x5DF8B45614A58FF4, 0x4DFF26C3D4E1480B, 0x7F780BC21E42FEA1, 0x17F6873B18D8BB10,
+0xD4E69B7EF462B94C, 0x9B727DD6A2D86DF3, 0x551CF6DF25340AF8, 0x00000A5B771762AA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3E70F47EA25FC2E0, 0x18C29AE74E6C2154, 0x6B297390D83AD7A6, 0xF26B8004EE73DABD,
+0xA2552226ECE2A647, 0x057B7916B485F3DA, 0x0BA023D22605C81E, 0x633F7A458DA03397,
+0x13CFC78909CBDAEE, 0xB1FF551A68C9558A, 0xAEF3E9CA4DC7617D, 0x00002ED53AB1E0EB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x16E299A48367D1FE, 0x98A926D03E8CD51F, 0xEA690F659A81DDCF, 0x7B3AB2908791A190,
+0xE203785F1C990385, 0xDBC13D9832DC4178, 0x4F3CA2336F597AC2, 0x08FB0BD2EDA7846C,
+0xEF844E1A90660B8F, 0xCF4A6167FDFC182E, 0x4A92170EAADE6F3C, 0x0000157452BCE494,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFEEDD8D9AAF90537, 0xBC2FCB4A88E626B9, 0xFB14BB880BF194C5, 0x634782C75C94EDA8,
+0x020CAC2B522E36A3, 0xAD1B387D9339B4C8, 0x502084635D9ACF95, 0x023CCACD1AD6F0EE,
+0x0824BA54D4FE69CE, 0xF4D1B517A9489072, 0x9F2F3439A532AA3C, 0x000053FF5960D70D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x941F4F7E850B18CF, 0xDE619B0715C5B0F4, 0x334B133EA8F3C334, 0xC78410EC1C1EC994,
+0x6184622473A79DF7, 0x287D3DFE2506FF71, 0x7ABC3984FC8EB17A, 0x75D199E6366F8617,
+0x3FCE61465B1AB1D7, 0xBDA939522EC03A2F, 0xCE6A58669CB309CC, 0x0000399D695C8240,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB072B7EAF0151AB6, 0x125D13A283135FC9, 0xFE4A1CE3B158F979, 0x7BE113A86803AD63,
+0x832690D918DDAE74, 0x421D2FA15873513B, 0x8CAADE20400EA606, 0x5CBC8346DDF2452E,
+0xE057FA34B5B17916, 0x18379ABD6738875A, 0x2A72FADC39B77A8C, 0x00003AB7E49F7C3D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBAF7917240A151BF, 0x9BFAC28E2F2CF88A, 0x6077420E9AD3C3FF, 0xD0CA28B48FB545D0,
+0xA856D152FEF4A227, 0xAF5D74F2B01707BF, 0x2155609C7335479C, 0x84EF32994857D5C0,
+0x56D8C79F1D0E295B, 0xFD148F494AA697F5, 0x3A54E52FFCBF9260, 0x00004E2634C0F347,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDDBBF48AEDEF6A99, 0xB1C5564DF6C7B1AC, 0xA0D6C96E33506CA7, 0xD7F409AC39FA7FF6,
+0x127DA7E1207B2634, 0xBAD25B79ED28BE06, 0xD4EE2902542A4082, 0xCB2BC8B7FDA72916,
+0x6AA9C95C38077B7E, 0xA304BF337302C553, 0xD2656711814148C8, 0x0000521F80DA2768,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA40DE18563CDE050, 0xC51A752354905A08, 0x2788B8FB5B52F7C6, 0x4727776F51868E15,
+0xE490469A647E188D, 0x30C330D18D49355A, 0xED8A113DDE4586C3, 0xAA0C97482CF80B4B,
+0x421235B1C61CD969, 0xF12755CCFF5D57CC, 0x0C0C7DEE7B65470D, 0x0000500170D34307,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6C01DE0DA6597C52, 0x9B0BC7A02E27D180, 0x08723A90862D6AD6, 0x0538CFC77602658E,
+0x09572FBA5C84A355, 0x6CF3E069DF572B41, 0x32E1EE3437E65F38, 0x150E8552348F45E2,
+0x14153BBB3221E001, 0x3ADB77609D4245CD, 0xA87808206C8B9253, 0x000046946BBAAF4E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE83E6DB641EBA8B2, 0xBD60C92EFAC67AC6, 0x279D7B1E7B0AE3B9, 0xAB247397F9960EC7,
+0xA36DDC25176FDBDD, 0xCC915A368E1F097F, 0x9FCC7895192AB298, 0xEC59875798DD579C,
+0xBFEE9C73B6501E52, 0xEF050E5E495F7D1E, 0x0F3044FA28C092FF, 0x000032B412AF1FDD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBA2C203D30A2D166, 0x2015C47010FA49CE, 0x34D130F98C30AC96, 0x4AE3AC2D259BDF23,
+0x4941F1142F0537BF, 0xBBC820DC1ECE47FC, 0xBC3A5EF6CDAF0BBC, 0xD77EBE8E9F3AAF2E,
+0xA82E20019FE06B00, 0x0D6DE2BE2C7A58EF, 0x361EDD8B995DE51D, 0x0000591B8345DB18,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x44B963152A0DFEA5, 0xF40A3B7096AA8D05, 0xA0FDC42DDD3F940C, 0xA46CE5B1307AE3B3,
+0xC338D1752BF51411, 0x83BAB6739C707CCD, 0x6B5FD794B31FB922, 0x1C532128435C01EB,
+0x9CF244F57FE17057, 0xE285F48DBF85A3B5, 0xC0C34F50F4D96D47, 0x0000301BDBBE1EF4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7E9B5595E314CB71, 0x96B2D755CB1D3406, 0x1EFB7261A68BB170, 0x082574F04DF24B1C,
+0x2675B4C4C9C396F1, 0xD2F0C9196092DE1C, 0x6520A9EBA47FBD52, 0x08A1ED99EDB2228B,
+0xD41BADCBDA153C47, 0x35B7E85BDD14CB30, 0xA0C81775E6F97F69, 0x0000444EDC8FF387,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0238553078D58109, 0x147981BC4995B4AF, 0xCAF708B2A2F912B2, 0x9E76B9D36F4FC0BC,
+0x82D35E23A4F44528, 0x421F186E8E612A22, 0xEA1EEC8CD461E8E7, 0xE065DE41573DF6CC,
+0x41871B46D021AE2E, 0xC147979C15F8666A, 0x53091E13FAFF534B, 0x00001C8E909005F9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x40FDF5DC62403C32, 0x7D12C9385728704A, 0xAFDBFA75709D19B6, 0xD961CFA9599CE4ED,
+0x08E3EF9C0AEC6D89, 0x82785FA190916550, 0xDE8EE0984D7EBE68, 0xD14D1164ABD5A40C,
+0xFBB3F80A974C7EC2, 0x2D49EFDFF8B5ACA9, 0xA82B90F305A1A55E, 0x00006837DE53731E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB2814421D180EA25, 0xD3A81447ED4E6A84, 0x12AC00F28406516E, 0xC4E99A0F96B6B924,
+0x19F01F028715CFE0, 0x1B4DC7D56E2D3CC9, 0xEB8383F06D0E45B0, 0x52E9D4C50FCCE16B,
+0xB001CE13C39B466D, 0xAAFF8BBEA8D4D681, 0xB70EA1D10DEE7350, 0x00002366A09B3547,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0A80CF4F1D415183, 0x780252AF9C0EE3D3, 0x53652571D1995EBE, 0x15FD90F000D599D3,
+0x71409910973BC69E, 0xF80D574EFCF44053, 0xC9FC053D2EE51534, 0x5C3087109A99D377,
+0x482F6E15FE2AF8D2, 0xD0831DAC048F5E31, 0x1A7437A667D72920, 0x000003B4AEBE0B7A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1C5F58C33B6337D9, 0x3655DF929FD2BF94, 0xD649CF8604DD49B9, 0xDE45591B9A0DF1E1,
+0xF733AEBE26470D25, 0xA48D9518F3E05410, 0xF76C09F616421754, 0xB0892E0C49CA3012,
+0xCBD8214C9B047EA5, 0xC6A95AB970DF3FBF, 0x9DD9390FCC4C8DBD, 0x0000020EB6AE5ECD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF59E406DC1B9FDDC, 0xE4EA0692E66AFE61, 0x2A205C3AF2BF919F, 0x54B83CE9AA8D32CF,
+0xD3A111C0CD08D074, 0x8E20AC0EFE899337, 0xB87A4A25F93DDFAE, 0x23DCEB5293228D97,
+0xAD992CA9109ED9F8, 0xB8E09B5C413177EE, 0xA37EA8CC52B75AC0, 0x0000286712AB7F02,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1D7D31CC87B6A85A, 0xA8A129AA13754DFA, 0xD76D46184EB25825, 0x7D71FBFDB88F792E,
+0xAC02E525B18B0BC8, 0x6737364B84906C76, 0x4658713DD06EEBDE, 0x7E9DEC1FF63F897F,
+0x3C89FDCA74EA6E2E, 0x30112A48238F9076, 0xE5D7C4BA0513F989, 0x0000189E2F56F16E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAB680AADBB04760B, 0x65A8CA9AF280DA91, 0x41FB0B411A341FD2, 0xE628A51DF05D8F5A,
+0x1257E6F190F79A59, 0x920915EF97902EBD, 0xD6C15FC4057B71E9, 0x9E8D8EAED2F76792,
+0x5F8101734006D17E, 0x1D50BD3017768A75, 0xC204FFB06547C412, 0x0000495EFEA4CB4B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x382A3B1EA2F7AB81, 0x3CB3DC57D2CFF429, 0x7708090F494C234B, 0x0EF4A5FC15FC7153,
+0xD038A83176331D14, 0xCE39D615ED59DACB, 0x86D009D9131D07EC, 0x0FAFA328CE950F4B,
+0x04ECACC1859351F3, 0xFD7AD6B504775A8F, 0x24ABC4C89285A521, 0x00003D6AFE58233F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x14A9C3D8D2CCE74E, 0x7B204AA382BAA346, 0x817AB948E42A38AA, 0xA6FABB20AFD23929,
+0xA34E105057CCE154, 0xB23AFFC316B7151F, 0x678FCCACC2BEC5B6, 0xFA495BD9D5BD5DDF,
+0x4A2FCA1D8E62DA6A, 0x3D024D0B99F8DF2F, 0x43F5C895BDE45F99, 0x00004D1ED5EDE638,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x55F924F70A791B36, 0x3F747DAE6C40CEF8, 0x3D6FC9F1320F2513, 0xD1749F9ED74E8399,
+0x1D6393A44BA2D6D0, 0xD04C3A7DC6D821CE, 0xC7F1542B09B923D1, 0xA943F94A66AF11F2,
+0x86C9ECCC357ECA15, 0xA6B05BB8F1F36027, 0x7203A1B08331CAE1, 0x0000488A5F7FE2FC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1564E4B9FC3A6451, 0xFD7A2D0A43D7CE46, 0xAE0807D6C6083192, 0x9B1786697E9890EB,
+0x533F1BD941F9587F, 0x08B66D5830B72208, 0x7ABECD9DF3BD95B3, 0xEFF6DA2140C87F72,
+0xDBF6A4397BE24267, 0x75EB8848F866E92C, 0x23AC3EEA6BB64866, 0x0000046E4E5B62B0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x10E9B67B700CB465, 0xA552DEB6FCB59588, 0xA478A52A21C83204, 0x015C4B1B0798768F,
+0xEF8546AF7FDCD227, 0xAD15A427E2564CEF, 0xD7D0973A2C292B3D, 0xDC8B9F506A9E85C0,
+0x49B7845D9F72B502, 0x2608E54518489BA5, 0x4A8F1E031C243BC1, 0x00005E174C02CBA8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFF11E7CE04E88659, 0xB1F8878D561E5C32, 0xEF9DF6C720F64BE6, 0x59123A731DBCD140,
+0xA95BE86451E150BD, 0xF91EFBC5ED35816C, 0x68AE336ED3FBD6A9, 0xC2E24887C5093998,
+0xB818E5275D7FC7DA, 0xA76F2936E117EB11, 0xC23B9776793EA7BB, 0x0000059981F00D7E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBBAA64AFCC469D17, 0x6F4DA61361CDC1D2, 0xCEF9B2A8C2247E19, 0x4AF0AFDCA1FC716D,
+0x3E8D1AC27ED1FAB0, 0x3DEC67E01FF45D86, 0xA16B586A516A4536, 0xA81434A1010E44CE,
+0x43B7B080263AE257, 0x760B2D53E3E0AC76, 0x1F11845B6770ECCF, 0x000039C2E6F96B7E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE31C4623939941D8, 0x3E4D4E5B91F195AC, 0x9E751DD5FFD79B59, 0xF5A76C45B0BB2F3A,
+0x78228F93B1E86406, 0x95F2D9451727C5D7, 0x6016276BC8126C00, 0x68B3660A2FA8320C,
+0x86C8F69657252591, 0xBB6178404F5837EE, 0xF087B784301CE368, 0x00004FD610AD2D51,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8FB02FAEEAB910C6, 0x38B6A990F335832A, 0x7D7CC254CA66CD59, 0x256D56B23F6AC14B,
+0x5E0B18F479A449E1, 0x13851BA12A9B7E59, 0xA1606CB77986C3C1, 0x4A4F639716C7B10A,
+0xE14347A1FEFDAABF, 0x07973F4660820B78, 0xD531A34B14005BE2, 0x0000354FC9485F0B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3051DC8E432CEC55, 0x0C163449924E859C, 0x49BBD8A383ED3ED3, 0xE864876B612C40CC,
+0x5894C874D2B9768A, 0xCCCC8C8CE7D1231C, 0xEB99E48219C070BD, 0x8065BF6C07AE5AD0,
+0x787AF3C5C9D6A073, 0x7EAE6354B4469267, 0x6452C25103A9F11F, 0x000049F9303AC0D7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x91217CC8AAAF5669, 0x3C35629902FDE13B, 0x133E3D9F7A96B07D, 0x4A318B90A4A29851,
+0x7D3D7F1BD0EFE4C6, 0x1EDF8FFCE9282FAC, 0x62F6A50A0ED2B040, 0xBFB10950EDCD5B3A,
+0x9E5A03E1B0A4B5EB, 0x7A6FFA3E21DAAB8D, 0xD44C260FB9F2E5D9, 0x00002F0D15F8D1AB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4CF683A741B07440, 0x7BECDB6EDA0E14A5, 0x5B487F3585062A17, 0x9DE49CA0875EE6D0,
+0xA925E4F46D599EB8, 0x1A0E971D3A0C5A7C, 0x201C63BB62E86F50, 0xD2940B4523C19A61,
+0x94C37D9F9C5943B2, 0xC188308BF6854C59, 0x092BE5779C579769, 0x000004DFC575A8FA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5F7A9247DB1FE9F0, 0x014DB02A9387A9D7, 0x4DFE1B2814246238, 0x77A5B111FD237C06,
+0xFCD6224F7F30C315, 0xDCCD1722C6562E69, 0x717F9F4964A80BCF, 0xFBD697B7122C8D77,
+0x444D2C15EDBF9443, 0x2920B88AE99234B6, 0x0AB65B53C52CC7EF, 0x00005A8FBAB9937F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x576BAB017D83D152, 0xEE5B68C007729864, 0x0464226976482AD0, 0x1B8F99DF4EB3F3D7,
+0x606007774E5F1445, 0xB5C31F2C37E3303F, 0x5605D47E85FEE606, 0x6B4A4E7FD9F61A1C,
+0x7E175264D09A89BD, 0x571E512303DE437D, 0x901FB80B762864C9, 0x00005C4D92AC5909,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x51871E498619CE77, 0xB80BFA75E8874229, 0xA7A071D197049C04, 0xEC1C4BED4D81C828,
+0x5BB341867E5BCF9D, 0xBDA1EC1B6E80DFDE, 0x72F4A2CB6066C6E6, 0x3F08A955C2FACAAD,
+0x243822497ADEC8F3, 0x7BC168B4D9EC58BF, 0x5A0D5257065DC549, 0x00002CB32C432F25,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0791930A1AF53D58, 0x7BBEDF6A2DF4DC8D, 0xF6559D65935EA7B2, 0x9223BA0CEFCC79A7,
+0x40276EEEF9C56F21, 0x2B30E44BB74DAE6A, 0xCA45C14220EBC160, 0xCE45E2EFE8F93543,
+0xAAD2337138D1E945, 0x94CA587EB9B9556B, 0x50008D0D998A2A7D, 0x00000B3371EBCD07,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5893B290F483F338, 0x18958F455864A8F3, 0xE7093BF0DA579D0A, 0x581595B27FD8237B,
+0xAFC0D103E65A5EF1, 0x2C4F96A33C5E713C, 0xC633AFD09276A55C, 0x0FFA4DD6A989CD1E,
+0x04C7FB9204B4C1F6, 0x6D07038CAC6CC591, 0x8EE04FE429377E91, 0x000030E35779B578,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8AB4C8FEF3B50ED5, 0xDDED4721C1DFA7A1, 0x4BE5F2DD43211794, 0x0203D892294B851D,
+0x2F614B77C43DBBCA, 0x8ADE2B180B367D1E, 0x81E7CE5D349514AA, 0x7F55E171AB96BA4D,
+0x3791D38EAA4A72D6, 0x95CBE11D5E1DC952, 0x58757E4F6C54892F, 0x000060C7DCF67AC9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1B03D6D3E8FFB444, 0xA6538FA6E947E8E1, 0x1616E36F1AA27FC6, 0x8A82FDC4A5D5A40F,
+0xA57E6B6A86CF503B, 0xAEB42E286A3A8BF6, 0xAD4B65949339DD0C, 0x51D24616B867E05B,
+0x8377DAEEAA7A1408, 0xFA00F7DA9A000177, 0xD2C309774C1F15CA, 0x000039226CF043A5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0DAF0D6F0087C9C3, 0x0BCBA35E349ADB83, 0x6045FC9BF33AC253, 0x2A55028379869FBC,
+0xEC228CB671B11123, 0x881D5C15A2D47445, 0xC65D787A3DD6F2E3, 0x688081E295F94B8F,
+0xBBA9C069A4428611, 0x638B18D1DCFD38F7, 0x47CAD863995804DD, 0x0000396CDA0DC0E9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEAB320D45D334810, 0x7B53399061318975, 0x25A1118C8D0B7D43, 0x88364839545F0870,
+0x1B323B92C9A7EFF3, 0x6BA91383CB22793A, 0x0C2D4508F0F2E241, 0xA5E9CC2C0A0136A4,
+0x07B353A678EB2ED8, 0x5FC013668EF91654, 0x4C053888EB478791, 0x00005A0022267F5A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3FFDC613C66A9D8B, 0x716BF9861408062A, 0xA895B1CE8C147604, 0x9059983635956D75,
+0x06102DC05367C89F, 0x1D40CDFA76B37BE4, 0xC35F72EEF4B0855E, 0x52275EC3F38CD9D1,
+0x4378FF6FE8C9E359, 0xD824AD47CA1ADD6D, 0xB6FE632FF6B98492, 0x00001FA86DC936E6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA053CA6ECB9E4DB6, 0xFB84EC574467C030, 0x9CE56EFEFFBE9353, 0xF484DC55EF300A48,
+0x1C9B89CC292C1D63, 0x0476E932B1EEBD76, 0x28DCC372011EC136, 0x91517B599AAB3789,
+0xFE53B3126182A9B9, 0x5D957AB4BC7B5023, 0xE9FEDC175F2C1DDB, 0x00002CE89A9BC892,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD8034E241E58DB4F, 0x01D839215D7EC90E, 0x34A21D6B15DBD311, 0x5FEEC15989F6EE26,
+0xAE8AF94E25FBF6C9, 0x7CD40878A4A1BC89, 0xDA9C2C521B9D797B, 0x31E66C7B5E22CDE4,
+0x7030C4C1B7D8C884, 0x586ECFFCB8A34F6C, 0x0F8BCB341F4A4CCE, 0x000045EC79058634,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1298C8FB7326385E, 0x7F5B47D978895A04, 0xE7F3932860800E0B, 0x4206AFAAAB37C4EC,
+0x78398B5B4508B4FB, 0x674968694E4BFC77, 0x01825A88337F805C, 0xA017D186A51A12F2,
+0x218DC83ADD179AE0, 0xA8F1581A31E9EE40, 0xD699E195C022FA23, 0x00006E97876BA3DA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE69FAB6DB2E336BB, 0x419877254242642D, 0x73072A299FD8F4B8, 0xD1F1BDEA37ABD611,
+0x6D7C9BA725662CA7, 0x2C578A45703CC147, 0xE09A9A0C4B6570E1, 0x589826CFDD60D404,
+0xED634E47BDAEE9EC, 0x6FB0E583FA19CA91, 0x98728B622A77A8FF, 0x00006D2039A35456,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7CC741FC17F7C0AD, 0x528CB8B9C3D0C8AC, 0x1360E148485179F9, 0xA808CB539B7C430E,
+0x140C52ACB8EC0F1B, 0x62D170B7B303AFCD, 0x32DC7AE6E94EB850, 0x358B77855D9CC857,
+0x42E68604878A9DE0, 0x0B032B57DF9C0E3D, 0x598453A94E5E4006, 0x00005732ECA5C5A3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBE64B98C857423AE, 0x75DFBFADF367E67C, 0xCCED3A5C40EB427D, 0xB621652547904129,
+0x40CFA76FA21E6357, 0x87E782344EE8CE6F, 0x601E56A517E39DA1, 0x901484724C59AFB7,
+0x3EC54738F3280037, 0x6DD9D27235E2EF71, 0xA67694F12C6DF60E, 0x00001E8D7EA40CF5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x88AD03F3E5DC0F8D, 0x359BB9C87130DECC, 0x85C633331112BD5E, 0xFB3478699A6376E7,
+0xF97BED5C0A131D2D, 0x69A8B550E2E5E6D4, 0x5E5E2CAEABCFCDDE, 0xF8AA4693429ED641,
+0x5D53158AF9BE4104, 0x12A014AC7F2F5158, 0xA662F9882949588D, 0x00004174BA3DE1F8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x073E88B0363150D0, 0x3F155D09694BD02F, 0x7BB138BFC03918D2, 0x89CD9F8C9C19B8CB,
+0xC8275EFF1075BD38, 0x9C64412176014DB8, 0x98CA77F9CBFED510, 0x6ADF6269345DB609,
+0x9890DFAC9AB56CFF, 0x0EA488CBFDF94BE6, 0xD055C650DD01E3B4, 0x00006F351A829859,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x60FD80F3220DDC5C, 0x8DEBF6C1E93D3C35, 0x2661673799A30FAC, 0xC85EE2ED62D8FC84,
+0x90C4FD3A7B6E3C01, 0xEA9D14022E05E612, 0x9ED671B916165684, 0xE336DDB59482FB0E,
+0x227AB39B3CF94164, 0x195768D19BBFB3E3, 0xDA86D29653DE0879, 0x00005A917DFED12F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCF00499286C96BDF, 0x52CA3D5AD5CF1569, 0x514F85F2809EDC3C, 0x3C9630C8831AD299,
+0x124D63E913867125, 0x3B0EAB729635C3F5, 0xCAE150CFE7B99E22, 0x8E9227E4CA7C9366,
+0xCB1946E7493BF3D1, 0xDE7BDDD63EA472EF, 0xFA8AB180DAB16B1C, 0x000050A6E2FF4672,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x209E7DB5DA792306, 0xE197D6B780F6234A, 0xF25DF3E8636EEAD9, 0xE0028E623A464AE0,
+0xC6126F340B490762, 0x8FD94165BD03D792, 0x9FB62C77A4162A88, 0x707B93B6EF18275D,
+0x1060B6E24DFD10FF, 0x77F60F42357046F5, 0x9D29D4604C4CE62D, 0x00005B9C5DE32E88,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4DC33790F41E1C46, 0xAF547C6D6E498F2F, 0x38163DCC7181D743, 0x9327086D773433CE,
+0x545501357D6BB752, 0x101C06655240ABA2, 0x2053B1DEDA827F6D, 0x9551B0E96B1FBADB,
+0xCD6C30C601E6A34D, 0x00FFE099F53F6120, 0xAE4D98BD7D8513BA, 0x000001EFFCF8C970,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFA7CD4ABCDFE4018, 0x8FCD4E1519E6276F, 0x84C2FE07AFA1F1EF, 0x6D28A892A3778D2D,
+0x890B26ED03AF60D6, 0xC6FA84D971A13602, 0x2E738C22AB23C166, 0x8784028C68F2E14A,
+0x4F16E147DB2878DF, 0xA5EB32E60F05FA8D, 0xF9593AA9686F0AE3, 0x00001ADA854ADDA6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x78E62FB5332E8E5E, 0x01F801796C26C806, 0x04810D4182DDA7EE, 0x89426979CF967514,
+0x361297B7B97E4908, 0xDCF0E3F3AC968D9F, 0x616B932D9180AB2E, 0x4A99FD75C942133D,
+0x079E128EFA5DE46A, 0x068C7897901015F8, 0xF175322D0FC0A639, 0x00000F29DD3C05E2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC0F6DCD0CF029430, 0xC91032848A4786E0, 0xFC2C0E5E0C2A7185, 0x939A78A35D8CBDC2,
+0xA74A1A1DBFAEE71A, 0x6F520FE7CE719B84, 0x89DAAD057BF8015F, 0x52B6A844B5360DE5,
+0x2C838D7475CFE6BE, 0xDF25C5066F582C45, 0x4CDAAE0608C2459E, 0x00006DF458878D10,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE33CCF49A6827B20, 0x666DBA8EF0AF89CA, 0x7220030D1BE353F2, 0x0D523E68786B841E,
+0x356A35C38802D9F9, 0x60C8519BE273B350, 0x1734CF4A08AAF61D, 0xAFA5EFE0B1E01279,
+0x0F9BEAD7807F75CE, 0xCE3716B7C64F489B, 0x2D87A83E9BD8E2DD, 0x00003C3E56F7C7BC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB697B6683721B04D, 0xF95D38DC6A52FD2A, 0x9124F215D2C305BA, 0x2F565050648FF73B,
+0x9A908C382D87DE95, 0x3668A5AE05EEC962, 0xE0693030AD7D4307, 0x7B77F59DCF171A70,
+0x28F9B59168D8333A, 0xDE8B6D1AF3D4EC0C, 0x4B2E687771461571, 0x000004E5DEF5B6DA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD7DE99B906DD5D15, 0x37FCB6C3127FAB3F, 0xD71E4FD9800E66BA, 0xBFC788D858897AD0,
+0x431969C3D9DF3216, 0x39D1AC67C136BB8A, 0x2B96E9211E16CDEE, 0x497D928E7FC58E3A,
+0xC6CA86AC82A93F0A, 0x2260EA5C79ABE5DA, 0x72CB2D94CE7112BC, 0x0000287CAD438266,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x05D013F2D40E96D7, 0x871C30ECE118E3B2, 0xC725459966BCE0A3, 0xBF6C6EB9E2B6172E,
+0x06C102F5B52A09C9, 0x09C9765C66211042, 0xF2CDCF1E34ACC0D1, 0x5542F2FF394FD86B,
+0xEC3C44D840F4766E, 0xCB972C4B0D30ACB5, 0xAE419DC05B0A5045, 0x00005A9D763AC487,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x23AE05B8156BA0AE, 0xE0D018F2A318BF47, 0x7414D598EAAFB7AA, 0xD0389B46E13F721C,
+0x7E886CE9FAB3709B, 0x12CD55AC1FCB1F2A, 0xA2E53D9BA9674254, 0xB7C54FC5D13152B5,
+0x3F0FC61F7A288D5B, 0x633A1615910DBADC, 0x31F589B025F2F73A, 0x00000F72483BB167,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2D7A68BB176A2E2C, 0x518D4CC2AB819C23, 0x25D201220A210286, 0x519BD50AEA487A79,
+0xCAA50794DCF09CF3, 0xA122A338C876B99B, 0x8C375E67C71BA250, 0x3F85B0DC570028AE,
+0xFCDD915A6ABEA356, 0xBD0851CBDB8F5D76, 0xADB3115CE4B1D7D1, 0x000028B1E6686384,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF8E1BA35291E3DF9, 0x8A9D11171CEFD81E, 0x5913CE50D8F03810, 0x9842C2B973C376C0,
+0x93C7D2BBBC9498CF, 0x1610A2D8D2F5EA15, 0x7D437FB1BB474E82, 0x769AB5FD87406B9B,
+0xC19687A21473C12D, 0x2F75A0869C74F7AD, 0x004C29005DDABE77, 0x0000645B81A0110F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0AF7146557405465, 0xBF09E4E192F46FFD, 0xBE4B439CFC1F5E0D, 0xDC7F3E25A530AF11,
+0x65DA5DAF59062416, 0xE80468C48FC35862, 0x063BE66B44149E4D, 0x89E695205C2C4754,
+0xB382586E9596037F, 0x926FC5EA7DF68EDD, 0xE77BB01DE7AEE1A8, 0x00003A023705771C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFE15FD776E114BC6, 0xFA4054867E968EAE, 0x7F1D11E8E517B2B1, 0x8DCEFA40479DFF3D,
+0x04B88602AC1EA9A2, 0xDADE72679B952449, 0x8AE58D602A0C0A4C, 0x0C911267227AB39F,
+0x45C298FCD2C71AED, 0xAA26D517F0B13158, 0x2B4504F3CD1F04E0, 0x000016EBC3434F7F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x81F92ED1B7483164, 0xB4165F0891DC5FF1, 0x8AED1DFA3BFA7770, 0x72507611F9C3AB26,
+0xB45C6C95E4A7A29D, 0xD07301F2F69A4233, 0xEEDC25DCC56FFFCF, 0x00247D6E4A3E8D62,
+0x1BA02B2474764D79, 0x90B66EEED97FBC36, 0xD7E14E1560D720B2, 0x00003B4DA4B670CA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8A433F5661F38C05, 0x4292F555F30E64D5, 0xB4C1D4D88A2FE25B, 0x30915FBF7C4C2E42,
+0xCEB03271386832B5, 0x4D8BB11A4546DA92, 0xF4936474983F6039, 0x4D0EE6C8A297D2FB,
+0xA5E12DC3ED53889C, 0x4E5E52F349FCAF22, 0xC4AA2D61111A859D, 0x00005BF8845E4194,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x641C7876BFC6596A, 0xBC017020AD278B6F, 0xF7F9503D1AE13181, 0x0ED584BD0EFEE6B9,
+0xB2F4B7A2BD28D43B, 0xD338FB31FF9FB8A2, 0x175740546EF57CAC, 0x2AB70B345607BCDF,
+0x0FDF1AC45B4C5157, 0x49BD425E38771A66, 0xB220F9689494C379, 0x000007B67080301D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA88E7A482CF2DDFE, 0x9A8752C3BBD7268D, 0x5DF2309237EE0820, 0xE3589F2EDFB0B5F0,
+0x3AA5A6732C694375, 0xC20A8B77290D5859, 0xCEAB1F1BE4A7758F, 0x0BD68F6DCEBF422B,
+0x7AFA611F1C667361, 0x8C0039EE6634CD81, 0x7FB62D29E9DBA3E1, 0x00000E8B6E199EC9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x01119772B84F5E42, 0x031DA79F14D29FCB, 0xF9DA9E1760CCF15B, 0x230B1C6535A25330,
+0xA2B34277EBA15D08, 0xD3ED5773690BC5F2, 0xD5F1BAB48C9372D7, 0xEAAE66569F4E9F95,
+0xD5DB1AD3C1CD8F3F, 0x37BCE75998F6F278, 0x4296E8D24AB0D423, 0x00003D849C0D73A0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3DC2FB53C659D6F8, 0x2C6D032B6C9AF05C, 0xC258E33EACA06505, 0x7D9BA0DC22E531AF,
+0x24B0B87D3D55645C, 0xDBBADA5F4865CFD5, 0xEA9E0942EAA8DC60, 0xE0C6EEFC5D3A2BD2,
+0xC116A1408746E835, 0x6E97D952F67FE205, 0x2A508BFA8A221378, 0x000012DC15DF2614,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8F79C7949E5C7550, 0xF8361A1FB3436647, 0xECACD685FCFE6E38, 0xFD593B233DAED3CF,
+0x307C7E65ED95FED4, 0xDD1C48FC2BD39F15, 0xC2EFFFE9D3F881EE, 0xECCA6C2C2C70E594,
+0x14E9AA9A472888D0, 0xB91D64D33D879B54, 0x9EC63C05482BF713, 0x000051239FD49419,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBB415AA7516F036C, 0xC0F55847D19031DB, 0x7995D5B555A5EF30, 0xA4C027ABD4F74807,
+0x6DCC873939B48337, 0x15DDA61751737D0E, 0x7191C7E4681B7FCF, 0x004CAB29B8ED72A5,
+0x1032C19F182F0CE4, 0x6D32593B34C02EB3, 0xB2B1DDD5823463F9, 0x00000AD30E7438BC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x108A179FDDBFA180, 0x148D72D4F6F60DCB, 0x0F9D50C8880A3E30, 0xE98E3C15C3AF03DC,
+0x69BCABA7257389D3, 0x8ED9967C8CFDDF6F, 0xC770A02546E6BF79, 0xC48E0FE444984B04,
+0x45770EC6AA6AA02D, 0x447D436A88B49339, 0x70F525B74E5F7EEC, 0x00005C174CD547F0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE90A16D427C3662F, 0xC69B70BE90E196E3, 0x6BFEF10771445260, 0x03E3BCF9EE0E1883,
+0x01505F173C0982B5, 0x32DC4D30781C8EB0, 0x453CEFE9ECD8622C, 0x72C2677E22161C35,
+0x9D99FF0198E4489B, 0xC6F1537333581CA4, 0x5D8DA5DB59E17BD0, 0x0000135E37B3A519,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x547FACD55175891C, 0x7981D271E5E624C5, 0x86A3D777C1A113B4, 0xE33636E63DC51ADD,
+0xEF67883B8178BBCF, 0xACE27D9E48D1ACF3, 0xD6A1420F0FC43DDA, 0xF916BF3EC7E34F26,
+0x5CD5A4AA57693072, 0xE313B169A89EFD62, 0xBA578FC3D93BE1A6, 0x000029385A3E968D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6B35ABFD913F6A22, 0xC3F2E4C1FA1DE03F, 0x178F8531CB2FF7EF, 0xA0D5C3535DA56F7F,
+0xBC66C615C67036FD, 0xA7B9EF7F86B0C623, 0xFB94CFF36F03FE86, 0xCDC9F45C4AE5A65B,
+0xCE3FEFD9B54A6F7E, 0x77B15A676F87AA0A, 0xD2562F9CF238EFC9, 0x000035A65EDAE4BE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6671326CA0DEAB57, 0x6B6720ECBD496D24, 0x5BBD5C14B09A396A, 0x171DB2F438E04BE1,
+0x80B7367F35E3898C, 0xF7AFB266C7580CA8, 0x2F655FA0A058E748, 0x20AA7B89B462AB0A,
+0x23EB4A17974B6BBC, 0x21935504F84C4ED1, 0x3C8DF9C88C85AD51, 0x0000328A2C9C77B9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0423326F596A18A5, 0xB1991183191E5714, 0x9805EC5CDBAE56B6, 0x9B803C3F46642045,
+0x86BAC0181FBA5C56, 0x4B73D0BF34DE4508, 0xB33219431D7FF93C, 0x849D72754F7302D5,
+0x55FA50B045717D5F, 0x4743EF9BD99B87E6, 0x3407ABC7B94D9220, 0x00006B4054DA6BAB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF03C55B625BCC31A, 0xA8C54AE381EE2907, 0xFB54D6B848AB4580, 0x43D1480E6F6580A9,
+0xBE9B2063E97C2D26, 0x7CFDA6958181BE76, 0x5E4E4DA46107BB7A, 0x4F446EC34732281C,
+0x1083954CDD9F23E4, 0x42B3B2630CB518BB, 0xBE3BC7BB02A5DA7E, 0x0000510A8E3C8B75,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDFC208AB8FC4AD24, 0xB1F6A0F023B0EEAF, 0x531057C3B03E5701, 0x85AF605328AC615E,
+0x9227316D888B4EA9, 0x669BB2B248BF72B9, 0xA01F6D96841F1567, 0x28BEEEDC71476C32,
+0xF62796B355DF5F12, 0xFC8019C92E4C8FDC, 0x922F6621D5CF8146, 0x00001EC4821DFB69,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x43F4FEC69343ED40, 0x63C2E6DE5B0C82FD, 0x17B1EE6888AE6BDF, 0xF2E3196BF9F8FBFB,
+0xB01CC90E63976886, 0xB730BD76E63B1B26, 0xF9E934DF07CA1BA5, 0x626D8967B8E1F296,
+0x7DCC5724263CB945, 0x716D3BAFAC0E7292, 0x176E5781EDBE3D9A, 0x00002C96F791AFE9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x090D5A66C3855F92, 0xA9F2F072D9C59432, 0x312A33D976EED97D, 0x627082DDEDBB3DBF,
+0x05D0E9500CB1A052, 0x33D194D419BDF730, 0x8531DEDB02730C37, 0x74C2DADA64894747,
+0xE68A1ED0FB7511A4, 0x774E78419A16E796, 0x02A6994F6CAF8486, 0x000010FDCA3B60FE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x150B9035CEACF422, 0x3487D24D636D97DE, 0x6AF0509B7E64E8E9, 0x53869E67F01D3EEC,
+0x429722B73669D88A, 0xD95D95E4EA6170D8, 0xDC6CBCC4EBE84371, 0x16F7F794516D9D5D,
+0xFEA6DEA44EACBCDE, 0xFE3597187AE90083, 0x9A7E4FD037647464, 0x000020ACEE1A5DC0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x19ABDD548895029C, 0x8C0BC21EB1403A59, 0x5AC857E8ADD10C7F, 0x7720F16DEC8B17A3,
+0x26C921FDF779FEB9, 0x99A45D69CB1FFCD6, 0x0EDD452697A6D456, 0x96C8C3D7700264A9,
+0xAABEDCE7B0CBB78C, 0x9EFCB054CCDF3118, 0xF9129E8CE7073C76, 0x00002C17DC5ED95F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF6F816EDFAB99EB0, 0x4C010003C7888408, 0x448DB98D6FD15F35, 0x81B76D5FF5D7AD3A,
+0xBBC36B50725DDD12, 0xD035A0EB0B3B4C13, 0xA5CD175A941D13C9, 0x0F48E2DB75A9A812,
+0x17BA7A2CEC654479, 0x15224E5ED2FF6A2F, 0x4CC932BE096AA6F2, 0x00000088DDCC98DD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x60E4BACA7D559429, 0xF1D90F6BE4E54D3E, 0x7E0379EC3AB8ADF6, 0x2C57F68D2BA2F550,
+0x0414D06ADCAFB4A1, 0x7C774751718A6047, 0x4ACF253F7386D77E, 0x04B3A469E4C216B8,
+0x73A160D914C4F7FC, 0x3053952E47D3DE50, 0x605AE4917FF5498E, 0x000012D00FAC2A03,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8D1E128C06CC2876, 0xCEBDB78993C0BB6F, 0xCC1B6EA3526F507A, 0x345AB81155BEEA14,
+0xCE05772FF421D7FF, 0x02A177D481AEE3EB, 0xA264F70642817D92, 0xD4ED40C9CF3B0D7F,
+0x40DD0C456FABF455, 0x2797B5635F7160C7, 0xB661D76C0AB8CED0, 0x000035B04A928401,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x166853650DBC67FF, 0x370E900ADB4DB52C, 0x4BFDF8B830693277, 0xE7D14029D33EE9B9,
+0xDB4ADB3EBF2A675E, 0x5C8D2D4C740E063B, 0x98413D97FF702E82, 0x8CE4106FF91C0CD8,
+0x04ADB70538E11144, 0xAE94CB9FA926201D, 0x22A5CD431A1A1F59, 0x00002563E023132D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x416E1E61E5710E5A, 0x99FCA1169E81CB10, 0x3205E0EFF81D6683, 0x712F8764E398D3D6,
+0x1AAFB45A7A66273E, 0x62B87EDF6D4A4CD8, 0x22D2DC47D5128A4A, 0xA812A9CA9216DB98,
+0xE5D5766BD33BEDB7, 0x22609D0328032686, 0x12CAAC24AF510FC1, 0x0000451D73704EFB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x46558949FBCC5D34, 0x0E0089D45B7F2B83, 0xA928914E859F8F6E, 0xEF0081403B720556,
+0x00881255C4E804E6, 0x5DFC1A435E8F8C6C, 0x3A8CA59240594CC7, 0xA526699ECECC63A6,
+0x416BB2C3E891679B, 0x535193544FED2F4F, 0xE0315CE4B8B36E58, 0x00005513A8CB7E8E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4CEA379E3D6AAAEC, 0xDC0252E6B041DB7E, 0xEB69B35AAA3BEDDB, 0x8799E5BBE58A80F6,
+0x6C90A9C4D59A8038, 0x5A635DDF57B153C1, 0xD2BC4EFED709D351, 0x541C498EA5D4CA58,
+0xA48483CD99B947F0, 0xA39EA8C4121620E5, 0xB8AEAE3E46D9F644, 0x00004B55C3B8F0F0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9AB8AD6392CFC8B7, 0x7EE687C03DD469CB, 0x68C0DCAE0CBF7490, 0x5E364FE5AB82F3D1,
+0xDD9BD1BEC68DF1A7, 0x6EB0DEA078B2E74E, 0x066E3E01FE1C602F, 0x4D97807F1B74BEBE,
+0xA47CCFAB559FDC06, 0xED0DF90A3AB57B15, 0xE0E6C286455B5B93, 0x00000AB6D3F7C0CF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1828440434F8D9D9, 0xCDDE722E8CB56AD9, 0x3D05577990B65846, 0xB41B9BC68825DD54,
+0xEF0687FBF5B91540, 0x639197BF458355C2, 0x412E3579591F4BCA, 0x0A12208D2175258A,
+0x4520E51AE22754F8, 0x567C19C6714BD595, 0x8F2916C84458E2E4, 0x0000186059F21945,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x554531CC6F0026E1, 0x49B8D24FBE20AF19, 0x1BDCA782B68D438E, 0x394D621E7314FE19,
+0xC0D37CF80650E696, 0x58403042530FF5DD, 0xC30EA2223E4220C9, 0x6876E6A30F4A65DB,
+0x18D861B00BF598C1, 0xD652EE74AD2E6B2E, 0xCE64605DD0B327F7, 0x00004AC627A1C9D8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8AD1FE382C72B7AA, 0x7B52C33C86C3B24B, 0xBB70B5258F360162, 0xADA7C3FAFA975B55,
+0x2D4761FEA142C32B, 0xCD38EAD18302AAD9, 0x5F18828F5313F47C, 0x249D5D69CF66A288,
+0x85ECCF74FDFEA391, 0xD2A8982BB4FF74E3, 0x8972AAE7184A755E, 0x000028535DB4C4B5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBC424DB60F0B1B7F, 0x9DF3E7B4A7C0B61A, 0xE6E63F411DBF72D0, 0x99160BA8442A1A7B,
+0xD0098494B9100D9E, 0x213AB10910F2A9B7, 0x134E9436F219F3B7, 0xFC2ABDFA39A23D51,
+0x44642B30F5A50633, 0xF8FAA9BF58CF0582, 0x2BDE8DE7F1AAD62B, 0x0000671695F0F8F6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFD42D9F8DFAA97FA, 0x27E4B9E261EBD9BB, 0x12E53F1A1788902D, 0x614BF3AB893EF060,
+0x9284168A1F4C33BA, 0x1E927D6CD1C82F80, 0xF90108151C698A56, 0x598DE4F49E26390D,
+0x5140BB582882434E, 0x348E3164DE72CFA2, 0x35C3397B950B377C, 0x0000013CD56E007C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x58B229474906F52C, 0x4B10647E1F376725, 0x471EDF1C9A4E284E, 0xA726244CC3876322,
+0x72FD1A14B2CD6FD2, 0xE27F896D3DEE2725, 0xD3C60BC1037A7E70, 0x22A52730CEA9D9ED,
+0x93212DEC96BDB1A3, 0x75CBCAF78C6E12AE, 0x54D8AC49C674BB41, 0x0000168E9F3F0473,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x706324FC10936CC5, 0xB323960F621EEFDC, 0xA45A0C708DD07CE3, 0x2BE4297B3C3599BD,
+0xB671A6B69F3AAF6E, 0xF47B5CF5180B1E19, 0xB69CDF62E4551526, 0x37F223396741E680,
+0xD6051EB9268F9884, 0x6BBF223DBF4F8CFC, 0x62988BA35208451D, 0x0000532D3618C28D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC60103FF552EBA2A, 0x986966A33D6517FF, 0x84EAF8A60493A34C, 0xFA9E8D8E03B9A1D0,
+0x654E25A495BEA1FC, 0x345D540BFD46B575, 0x96C06B97256B5D37, 0x829C182229919548,
+0xB3A1055EF796194F, 0x750D7CA7097B20E8, 0xC6B4F9994BDC05A1, 0x0000483565EE60C5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE086C97DF52555BE, 0x1C1C275E695F00ED, 0x456E26CF17BCDD9B, 0x204C75673CE8ABE8,
+0x77FF4D6235CD70E4, 0x27E230C0ED2FBC55, 0x375C8D32DFA2F683, 0xF07A5FCA59BC392A,
+0xDD0F8475209F4A1B, 0x45079E5305ACB8A5, 0x3D4CD6FA2E1F8BC5, 0x00004FF312A2E164,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4659FB281517FA89, 0x39A7FA767E6FA3C5, 0x1F333A51A592861C, 0xC24D9F7725CFBC89,
+0x5EDD8B4B0BFE8E08, 0x01B5C4979A2E9A19, 0xB0A21B3E29541457, 0x1D2D0DB0563BD4E0,
+0xCCB6527D999FDFC5, 0xBAF7791AA634CDC6, 0x9F936E3084C6BE39, 0x000066AAF77C0BA5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1E0A16D78C5DCFE9, 0x226AB76C19AE111D, 0x21CBAD5C4FA21FBA, 0x1526DA66F753BEC2,
+0x3E40CFBA1578A898, 0x82F82A0058EC6166, 0x223D75FAEE988F84, 0xF9E6F10AA0A30256,
+0x46C07A27A0908819, 0xB2AB018BFEE16C81, 0x7CE64A85EF71B9F3, 0x0000272C768D3F36,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0F87B3774C4C6A84, 0xCC673CFE8F68D09E, 0x1C20CCB31926F562, 0xB5C1C7542B1A7ED4,
+0x15B5CEC813F1C297, 0xBAE1D5B76AD0F30D, 0x320B67D6B1F03BFC, 0x8D1ED607B4923C8A,
+0x10E7D146DD311AAD, 0x5FAABD4954F31435, 0x57152E0F5E27B3A4, 0x0000129D50FA41E1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5F36AF1C6F0A0701, 0xD9EB532CA7C44C4C, 0xBE00EF63820E3FE9, 0x3228406BD0EE879E,
+0x65086D9937814A91, 0x6730C2B2BB985EC8, 0xEEC2B28D7C13B463, 0x95394508AAB4903E,
+0x0DBBB5CAB4553B66, 0xAA76F6E0E2A300D9, 0x87AEBFEDED79A546, 0x000009428FB0A9AD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1514525367B83D8A, 0x2B22BAB04D11B869, 0xA68B5BA67A2C0227, 0x12928C65959A6E72,
+0x6D75FF5512A6FDE5, 0x12CF9D2021AEE65B, 0xC6F82085D351F56C, 0xCC7FC47873515DDC,
+0x5AA67AED13C57078, 0x0AF9F85FC873D520, 0x619D4A421FB4D9D3, 0x00001A120BD9543C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC3E0C2B6BAB2F95C, 0xB903667D4558326B, 0x54E4AE2B85F23911, 0x5649D99D06BB61FF,
+0xD09785C64F1B4029, 0x74426D1292D78CAB, 0xF667C7D12F48B5B3, 0x7E64EA3B8A1D6115,
+0xE9F7D671FA134C65, 0xED0C30CA66F6F2C8, 0xABE9DAFD2D1D31EB, 0x00005DC45503465B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9DD99D1609DD3B68, 0xEB58F112EA33D47F, 0x57C51C69E8A419D2, 0x8169F935EDF95AD6,
+0xB85B11F27B15D1D0, 0x6B6C90C4DB2E1257, 0xCDBD63E66E760C75, 0x98B5E2E7AF05B76A,
+0xCAF3F99BC0ADDD05, 0xAA3661CC319FFDD6, 0x99849B87D6AB7E3E, 0x00006C0B0591D1D5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x00000000000249AD, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x8310000000000000, 0x5527B1E4375C6C66, 0x697797BF3F4F24D0,
+0xC89DB7B2AC5C4E2E, 0x4CA4B439D2076956, 0x10F7926C7512C7E9, 0x00002D5B24BCE5E2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 };
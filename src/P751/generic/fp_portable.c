@@ -0,0 +1,610 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: fully unrolled multiplication, squaring and Montgomery reduction for P751
+*           (OPT_LEVEL=PORTABLE_FAST), generated by tools/gen_fp_portable.py
+*********************************************************************************************/
+
+#include "../P751_internal.h"
+#include "../../internal.h"
+
+
+// Column accumulation (t,u,v) += a*b
+#define MULACC(a, b)                                                                               \
+    { digit_t hi, lo; unsigned int cy;                                                             \
+      MUL((a), (b), &hi, lo);                                                                      \
+      ADDC(0, lo, v, cy, v);                                                                       \
+      ADDC(cy, hi, u, cy, u);                                                                      \
+      ADDC(cy, t, 0, cy, t); }
+
+// Cross product accumulation (st,su,sv) += a*b
+#define MULACC_CROSS(a, b)                                                                         \
+    { digit_t hi, lo; unsigned int cy;                                                             \
+      MUL((a), (b), &hi, lo);                                                                      \
+      ADDC(0, lo, sv, cy, sv);                                                                     \
+      ADDC(cy, hi, su, cy, su);                                                                    \
+      ADDC(cy, st, 0, cy, st); }
+
+// Column accumulation (t,u,v) += 2*(st,su,sv)
+#define ADD_CROSS_X2()                                                                             \
+    { unsigned int cy;                                                                             \
+      st = (st << 1) | (su >> (RADIX-1));                                                          \
+      su = (su << 1) | (sv >> (RADIX-1));                                                          \
+      sv = sv << 1;                                                                                \
+      ADDC(0, sv, v, cy, v);                                                                       \
+      ADDC(cy, su, u, cy, u);                                                                      \
+      ADDC(cy, st, t, cy, t); }
+
+
+void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
+{ // Multiprecision multiply, c = a*b, where lng(a) = lng(b) = NWORDS_FIELD.
+  // One level of Karatsuba on the halves of 6 and 6 words, with comba products.
+    unsigned int carry, borrow, ca, cb;
+    digit_t t, u, v, mask_a, mask_b, ta[6], tb[6], tt[13];
+    UNREFERENCED_PARAMETER(nwords);
+
+    ADDC(0, a[0], a[6], carry, ta[0]);
+    ADDC(carry, a[1], a[7], carry, ta[1]);
+    ADDC(carry, a[2], a[8], carry, ta[2]);
+    ADDC(carry, a[3], a[9], carry, ta[3]);
+    ADDC(carry, a[4], a[10], carry, ta[4]);
+    ADDC(carry, a[5], a[11], carry, ta[5]);
+    ca = carry;
+    ADDC(0, b[0], b[6], carry, tb[0]);
+    ADDC(carry, b[1], b[7], carry, tb[1]);
+    ADDC(carry, b[2], b[8], carry, tb[2]);
+    ADDC(carry, b[3], b[9], carry, tb[3]);
+    ADDC(carry, b[4], b[10], carry, tb[4]);
+    ADDC(carry, b[5], b[11], carry, tb[5]);
+    cb = carry;
+    mask_a = 0 - (digit_t)ca;
+    mask_b = 0 - (digit_t)cb;
+
+    // c = a1*b1*2^768 + a0*b0
+    t = 0; u = 0; v = 0;
+    MULACC(a[0], b[0]);
+    c[0] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[1]);
+    MULACC(a[1], b[0]);
+    c[1] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[2]);
+    MULACC(a[1], b[1]);
+    MULACC(a[2], b[0]);
+    c[2] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[3]);
+    MULACC(a[1], b[2]);
+    MULACC(a[2], b[1]);
+    MULACC(a[3], b[0]);
+    c[3] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[4]);
+    MULACC(a[1], b[3]);
+    MULACC(a[2], b[2]);
+    MULACC(a[3], b[1]);
+    MULACC(a[4], b[0]);
+    c[4] = v; v = u; u = t; t = 0;
+    MULACC(a[0], b[5]);
+    MULACC(a[1], b[4]);
+    MULACC(a[2], b[3]);
+    MULACC(a[3], b[2]);
+    MULACC(a[4], b[1]);
+    MULACC(a[5], b[0]);
+    c[5] = v; v = u; u = t; t = 0;
+    MULACC(a[1], b[5]);
+    MULACC(a[2], b[4]);
+    MULACC(a[3], b[3]);
+    MULACC(a[4], b[2]);
+    MULACC(a[5], b[1]);
+    c[6] = v; v = u; u = t; t = 0;
+    MULACC(a[2], b[5]);
+    MULACC(a[3], b[4]);
+    MULACC(a[4], b[3]);
+    MULACC(a[5], b[2]);
+    c[7] = v; v = u; u = t; t = 0;
+    MULACC(a[3], b[5]);
+    MULACC(a[4], b[4]);
+    MULACC(a[5], b[3]);
+    c[8] = v; v = u; u = t; t = 0;
+    MULACC(a[4], b[5]);
+    MULACC(a[5], b[4]);
+    c[9] = v; v = u; u = t; t = 0;
+    MULACC(a[5], b[5]);
+    c[10] = v; v = u; u = t; t = 0;
+    c[11] = v;
+    t = 0; u = 0; v = 0;
+    MULACC(a[6], b[6]);
+    c[12] = v; v = u; u = t; t = 0;
+    MULACC(a[6], b[7]);
+    MULACC(a[7], b[6]);
+    c[13] = v; v = u; u = t; t = 0;
+    MULACC(a[6], b[8]);
+    MULACC(a[7], b[7]);
+    MULACC(a[8], b[6]);
+    c[14] = v; v = u; u = t; t = 0;
+    MULACC(a[6], b[9]);
+    MULACC(a[7], b[8]);
+    MULACC(a[8], b[7]);
+    MULACC(a[9], b[6]);
+    c[15] = v; v = u; u = t; t = 0;
+    MULACC(a[6], b[10]);
+    MULACC(a[7], b[9]);
+    MULACC(a[8], b[8]);
+    MULACC(a[9], b[7]);
+    MULACC(a[10], b[6]);
+    c[16] = v; v = u; u = t; t = 0;
+    MULACC(a[6], b[11]);
+    MULACC(a[7], b[10]);
+    MULACC(a[8], b[9]);
+    MULACC(a[9], b[8]);
+    MULACC(a[10], b[7]);
+    MULACC(a[11], b[6]);
+    c[17] = v; v = u; u = t; t = 0;
+    MULACC(a[7], b[11]);
+    MULACC(a[8], b[10]);
+    MULACC(a[9], b[9]);
+    MULACC(a[10], b[8]);
+    MULACC(a[11], b[7]);
+    c[18] = v; v = u; u = t; t = 0;
+    MULACC(a[8], b[11]);
+    MULACC(a[9], b[10]);
+    MULACC(a[10], b[9]);
+    MULACC(a[11], b[8]);
+    c[19] = v; v = u; u = t; t = 0;
+    MULACC(a[9], b[11]);
+    MULACC(a[10], b[10]);
+    MULACC(a[11], b[9]);
+    c[20] = v; v = u; u = t; t = 0;
+    MULACC(a[10], b[11]);
+    MULACC(a[11], b[10]);
+    c[21] = v; v = u; u = t; t = 0;
+    MULACC(a[11], b[11]);
+    c[22] = v; v = u; u = t; t = 0;
+    c[23] = v;
+
+    // tt = (a0+a1)*(b0+b1) - a0*b0 - a1*b1
+    t = 0; u = 0; v = 0;
+    MULACC(ta[0], tb[0]);
+    tt[0] = v; v = u; u = t; t = 0;
+    MULACC(ta[0], tb[1]);
+    MULACC(ta[1], tb[0]);
+    tt[1] = v; v = u; u = t; t = 0;
+    MULACC(ta[0], tb[2]);
+    MULACC(ta[1], tb[1]);
+    MULACC(ta[2], tb[0]);
+    tt[2] = v; v = u; u = t; t = 0;
+    MULACC(ta[0], tb[3]);
+    MULACC(ta[1], tb[2]);
+    MULACC(ta[2], tb[1]);
+    MULACC(ta[3], tb[0]);
+    tt[3] = v; v = u; u = t; t = 0;
+    MULACC(ta[0], tb[4]);
+    MULACC(ta[1], tb[3]);
+    MULACC(ta[2], tb[2]);
+    MULACC(ta[3], tb[1]);
+    MULACC(ta[4], tb[0]);
+    tt[4] = v; v = u; u = t; t = 0;
+    MULACC(ta[0], tb[5]);
+    MULACC(ta[1], tb[4]);
+    MULACC(ta[2], tb[3]);
+    MULACC(ta[3], tb[2]);
+    MULACC(ta[4], tb[1]);
+    MULACC(ta[5], tb[0]);
+    tt[5] = v; v = u; u = t; t = 0;
+    MULACC(ta[1], tb[5]);
+    MULACC(ta[2], tb[4]);
+    MULACC(ta[3], tb[3]);
+    MULACC(ta[4], tb[2]);
+    MULACC(ta[5], tb[1]);
+    tt[6] = v; v = u; u = t; t = 0;
+    MULACC(ta[2], tb[5]);
+    MULACC(ta[3], tb[4]);
+    MULACC(ta[4], tb[3]);
+    MULACC(ta[5], tb[2]);
+    tt[7] = v; v = u; u = t; t = 0;
+    MULACC(ta[3], tb[5]);
+    MULACC(ta[4], tb[4]);
+    MULACC(ta[5], tb[3]);
+    tt[8] = v; v = u; u = t; t = 0;
+    MULACC(ta[4], tb[5]);
+    MULACC(ta[5], tb[4]);
+    tt[9] = v; v = u; u = t; t = 0;
+    MULACC(ta[5], tb[5]);
+    tt[10] = v; v = u; u = t; t = 0;
+    tt[11] = v;
+    tt[12] = (digit_t)(ca & cb);
+    ADDC(0, tt[6], (ta[0] & mask_b), carry, tt[6]);
+    ADDC(carry, tt[7], (ta[1] & mask_b), carry, tt[7]);
+    ADDC(carry, tt[8], (ta[2] & mask_b), carry, tt[8]);
+    ADDC(carry, tt[9], (ta[3] & mask_b), carry, tt[9]);
+    ADDC(carry, tt[10], (ta[4] & mask_b), carry, tt[10]);
+    ADDC(carry, tt[11], (ta[5] & mask_b), carry, tt[11]);
+    ADDC(carry, tt[12], 0, carry, tt[12]);
+    ADDC(0, tt[6], (tb[0] & mask_a), carry, tt[6]);
+    ADDC(carry, tt[7], (tb[1] & mask_a), carry, tt[7]);
+    ADDC(carry, tt[8], (tb[2] & mask_a), carry, tt[8]);
+    ADDC(carry, tt[9], (tb[3] & mask_a), carry, tt[9]);
+    ADDC(carry, tt[10], (tb[4] & mask_a), carry, tt[10]);
+    ADDC(carry, tt[11], (tb[5] & mask_a), carry, tt[11]);
+    ADDC(carry, tt[12], 0, carry, tt[12]);
+    SUBC(0, tt[0], c[0], borrow, tt[0]);
+    SUBC(borrow, tt[1], c[1], borrow, tt[1]);
+    SUBC(borrow, tt[2], c[2], borrow, tt[2]);
+    SUBC(borrow, tt[3], c[3], borrow, tt[3]);
+    SUBC(borrow, tt[4], c[4], borrow, tt[4]);
+    SUBC(borrow, tt[5], c[5], borrow, tt[5]);
+    SUBC(borrow, tt[6], c[6], borrow, tt[6]);
+    SUBC(borrow, tt[7], c[7], borrow, tt[7]);
+    SUBC(borrow, tt[8], c[8], borrow, tt[8]);
+    SUBC(borrow, tt[9], c[9], borrow, tt[9]);
+    SUBC(borrow, tt[10], c[10], borrow, tt[10]);
+    SUBC(borrow, tt[11], c[11], borrow, tt[11]);
+    SUBC(borrow, tt[12], 0, borrow, tt[12]);
+    SUBC(0, tt[0], c[12], borrow, tt[0]);
+    SUBC(borrow, tt[1], c[13], borrow, tt[1]);
+    SUBC(borrow, tt[2], c[14], borrow, tt[2]);
+    SUBC(borrow, tt[3], c[15], borrow, tt[3]);
+    SUBC(borrow, tt[4], c[16], borrow, tt[4]);
+    SUBC(borrow, tt[5], c[17], borrow, tt[5]);
+    SUBC(borrow, tt[6], c[18], borrow, tt[6]);
+    SUBC(borrow, tt[7], c[19], borrow, tt[7]);
+    SUBC(borrow, tt[8], c[20], borrow, tt[8]);
+    SUBC(borrow, tt[9], c[21], borrow, tt[9]);
+    SUBC(borrow, tt[10], c[22], borrow, tt[10]);
+    SUBC(borrow, tt[11], c[23], borrow, tt[11]);
+    SUBC(borrow, tt[12], 0, borrow, tt[12]);
+
+    // c = c + tt*2^384
+    ADDC(0, c[6], tt[0], carry, c[6]);
+    ADDC(carry, c[7], tt[1], carry, c[7]);
+    ADDC(carry, c[8], tt[2], carry, c[8]);
+    ADDC(carry, c[9], tt[3], carry, c[9]);
+    ADDC(carry, c[10], tt[4], carry, c[10]);
+    ADDC(carry, c[11], tt[5], carry, c[11]);
+    ADDC(carry, c[12], tt[6], carry, c[12]);
+    ADDC(carry, c[13], tt[7], carry, c[13]);
+    ADDC(carry, c[14], tt[8], carry, c[14]);
+    ADDC(carry, c[15], tt[9], carry, c[15]);
+    ADDC(carry, c[16], tt[10], carry, c[16]);
+    ADDC(carry, c[17], tt[11], carry, c[17]);
+    ADDC(carry, c[18], tt[12], carry, c[18]);
+    ADDC(carry, c[19], 0, carry, c[19]);
+    ADDC(carry, c[20], 0, carry, c[20]);
+    ADDC(carry, c[21], 0, carry, c[21]);
+    ADDC(carry, c[22], 0, carry, c[22]);
+    ADDC(carry, c[23], 0, carry, c[23]);
+}
+
+
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)
+{ // Multiprecision comba squaring, c = a^2, where lng(a) = NWORDS_FIELD.
+  // The cross products a[i]*a[j], i < j, of each column are accumulated once and doubled.
+    digit_t t = 0, u = 0, v = 0, st, su, sv;
+    UNREFERENCED_PARAMETER(nwords);
+
+    MULACC(a[0], a[0]);
+    c[0] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[1]);
+    ADD_CROSS_X2();
+    c[1] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[2]);
+    ADD_CROSS_X2();
+    MULACC(a[1], a[1]);
+    c[2] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[3]);
+    MULACC_CROSS(a[1], a[2]);
+    ADD_CROSS_X2();
+    c[3] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[4]);
+    MULACC_CROSS(a[1], a[3]);
+    ADD_CROSS_X2();
+    MULACC(a[2], a[2]);
+    c[4] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[5]);
+    MULACC_CROSS(a[1], a[4]);
+    MULACC_CROSS(a[2], a[3]);
+    ADD_CROSS_X2();
+    c[5] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[6]);
+    MULACC_CROSS(a[1], a[5]);
+    MULACC_CROSS(a[2], a[4]);
+    ADD_CROSS_X2();
+    MULACC(a[3], a[3]);
+    c[6] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[7]);
+    MULACC_CROSS(a[1], a[6]);
+    MULACC_CROSS(a[2], a[5]);
+    MULACC_CROSS(a[3], a[4]);
+    ADD_CROSS_X2();
+    c[7] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[8]);
+    MULACC_CROSS(a[1], a[7]);
+    MULACC_CROSS(a[2], a[6]);
+    MULACC_CROSS(a[3], a[5]);
+    ADD_CROSS_X2();
+    MULACC(a[4], a[4]);
+    c[8] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[9]);
+    MULACC_CROSS(a[1], a[8]);
+    MULACC_CROSS(a[2], a[7]);
+    MULACC_CROSS(a[3], a[6]);
+    MULACC_CROSS(a[4], a[5]);
+    ADD_CROSS_X2();
+    c[9] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[10]);
+    MULACC_CROSS(a[1], a[9]);
+    MULACC_CROSS(a[2], a[8]);
+    MULACC_CROSS(a[3], a[7]);
+    MULACC_CROSS(a[4], a[6]);
+    ADD_CROSS_X2();
+    MULACC(a[5], a[5]);
+    c[10] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[0], a[11]);
+    MULACC_CROSS(a[1], a[10]);
+    MULACC_CROSS(a[2], a[9]);
+    MULACC_CROSS(a[3], a[8]);
+    MULACC_CROSS(a[4], a[7]);
+    MULACC_CROSS(a[5], a[6]);
+    ADD_CROSS_X2();
+    c[11] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[1], a[11]);
+    MULACC_CROSS(a[2], a[10]);
+    MULACC_CROSS(a[3], a[9]);
+    MULACC_CROSS(a[4], a[8]);
+    MULACC_CROSS(a[5], a[7]);
+    ADD_CROSS_X2();
+    MULACC(a[6], a[6]);
+    c[12] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[2], a[11]);
+    MULACC_CROSS(a[3], a[10]);
+    MULACC_CROSS(a[4], a[9]);
+    MULACC_CROSS(a[5], a[8]);
+    MULACC_CROSS(a[6], a[7]);
+    ADD_CROSS_X2();
+    c[13] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[3], a[11]);
+    MULACC_CROSS(a[4], a[10]);
+    MULACC_CROSS(a[5], a[9]);
+    MULACC_CROSS(a[6], a[8]);
+    ADD_CROSS_X2();
+    MULACC(a[7], a[7]);
+    c[14] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[4], a[11]);
+    MULACC_CROSS(a[5], a[10]);
+    MULACC_CROSS(a[6], a[9]);
+    MULACC_CROSS(a[7], a[8]);
+    ADD_CROSS_X2();
+    c[15] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[5], a[11]);
+    MULACC_CROSS(a[6], a[10]);
+    MULACC_CROSS(a[7], a[9]);
+    ADD_CROSS_X2();
+    MULACC(a[8], a[8]);
+    c[16] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[6], a[11]);
+    MULACC_CROSS(a[7], a[10]);
+    MULACC_CROSS(a[8], a[9]);
+    ADD_CROSS_X2();
+    c[17] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[7], a[11]);
+    MULACC_CROSS(a[8], a[10]);
+    ADD_CROSS_X2();
+    MULACC(a[9], a[9]);
+    c[18] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[8], a[11]);
+    MULACC_CROSS(a[9], a[10]);
+    ADD_CROSS_X2();
+    c[19] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[9], a[11]);
+    ADD_CROSS_X2();
+    MULACC(a[10], a[10]);
+    c[20] = v; v = u; u = t; t = 0;
+    st = 0; su = 0; sv = 0;
+    MULACC_CROSS(a[10], a[11]);
+    ADD_CROSS_X2();
+    c[21] = v; v = u; u = t; t = 0;
+    MULACC(a[11], a[11]);
+    c[22] = v; v = u; u = t; t = 0;
+    c[23] = v;
+}
+
+
+void rdc_mont(digit_t* ma, digit_t* mc)
+{ // Montgomery reduction exploiting the special form of the prime p751, mc = ma*R^-1 mod p751x2, where R = 2^768.
+  // If ma < 2^768*p751, the output mc is in the range [0, 2*p751-1].
+  // Since p751+1 = 2^320*p', p751 = -1 mod 2^320: the reduction adds Q*p'*2^320 for each block Q of 5 words of ma, from the least
+  // significant one, which leaves Q in place and clears Q*p751. The words of p' are multiplied as constants.
+    unsigned int i, carry;
+    digit_t t, u, v, r[2*NWORDS_FIELD], s[NWORDS_FIELD];
+
+    for (i = 0; i < 2*NWORDS_FIELD; i++) {
+        r[i] = ma[i];
+    }
+
+    t = 0; u = 0; v = 0;
+    MULACC(r[0], 0xEEB0000000000000ULL);
+    s[0] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0xE3EC968549F878A8ULL);
+    MULACC(r[1], 0xEEB0000000000000ULL);
+    s[1] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0xDA959B1A13F7CC76ULL);
+    MULACC(r[1], 0xE3EC968549F878A8ULL);
+    MULACC(r[2], 0xEEB0000000000000ULL);
+    s[2] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0x084E9867D6EBE876ULL);
+    MULACC(r[1], 0xDA959B1A13F7CC76ULL);
+    MULACC(r[2], 0xE3EC968549F878A8ULL);
+    MULACC(r[3], 0xEEB0000000000000ULL);
+    s[3] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0x8562B5045CB25748ULL);
+    MULACC(r[1], 0x084E9867D6EBE876ULL);
+    MULACC(r[2], 0xDA959B1A13F7CC76ULL);
+    MULACC(r[3], 0xE3EC968549F878A8ULL);
+    MULACC(r[4], 0xEEB0000000000000ULL);
+    s[4] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0x0E12909F97BADC66ULL);
+    MULACC(r[1], 0x8562B5045CB25748ULL);
+    MULACC(r[2], 0x084E9867D6EBE876ULL);
+    MULACC(r[3], 0xDA959B1A13F7CC76ULL);
+    MULACC(r[4], 0xE3EC968549F878A8ULL);
+    s[5] = v; v = u; u = t; t = 0;
+    MULACC(r[0], 0x00006FE5D541F71CULL);
+    MULACC(r[1], 0x0E12909F97BADC66ULL);
+    MULACC(r[2], 0x8562B5045CB25748ULL);
+    MULACC(r[3], 0x084E9867D6EBE876ULL);
+    MULACC(r[4], 0xDA959B1A13F7CC76ULL);
+    s[6] = v; v = u; u = t; t = 0;
+    MULACC(r[1], 0x00006FE5D541F71CULL);
+    MULACC(r[2], 0x0E12909F97BADC66ULL);
+    MULACC(r[3], 0x8562B5045CB25748ULL);
+    MULACC(r[4], 0x084E9867D6EBE876ULL);
+    s[7] = v; v = u; u = t; t = 0;
+    MULACC(r[2], 0x00006FE5D541F71CULL);
+    MULACC(r[3], 0x0E12909F97BADC66ULL);
+    MULACC(r[4], 0x8562B5045CB25748ULL);
+    s[8] = v; v = u; u = t; t = 0;
+    MULACC(r[3], 0x00006FE5D541F71CULL);
+    MULACC(r[4], 0x0E12909F97BADC66ULL);
+    s[9] = v; v = u; u = t; t = 0;
+    MULACC(r[4], 0x00006FE5D541F71CULL);
+    s[10] = v; v = u; u = t; t = 0;
+    s[11] = v;
+    ADDC(0, r[5], s[0], carry, r[5]);
+    ADDC(carry, r[6], s[1], carry, r[6]);
+    ADDC(carry, r[7], s[2], carry, r[7]);
+    ADDC(carry, r[8], s[3], carry, r[8]);
+    ADDC(carry, r[9], s[4], carry, r[9]);
+    ADDC(carry, r[10], s[5], carry, r[10]);
+    ADDC(carry, r[11], s[6], carry, r[11]);
+    ADDC(carry, r[12], s[7], carry, r[12]);
+    ADDC(carry, r[13], s[8], carry, r[13]);
+    ADDC(carry, r[14], s[9], carry, r[14]);
+    ADDC(carry, r[15], s[10], carry, r[15]);
+    ADDC(carry, r[16], s[11], carry, r[16]);
+    ADDC(carry, r[17], 0, carry, r[17]);
+    ADDC(carry, r[18], 0, carry, r[18]);
+    ADDC(carry, r[19], 0, carry, r[19]);
+    ADDC(carry, r[20], 0, carry, r[20]);
+    ADDC(carry, r[21], 0, carry, r[21]);
+    ADDC(carry, r[22], 0, carry, r[22]);
+    ADDC(carry, r[23], 0, carry, r[23]);
+
+    t = 0; u = 0; v = 0;
+    MULACC(r[5], 0xEEB0000000000000ULL);
+    s[0] = v; v = u; u = t; t = 0;
+    MULACC(r[5], 0xE3EC968549F878A8ULL);
+    MULACC(r[6], 0xEEB0000000000000ULL);
+    s[1] = v; v = u; u = t; t = 0;
+    MULACC(r[5], 0xDA959B1A13F7CC76ULL);
+    MULACC(r[6], 0xE3EC968549F878A8ULL);
+    MULACC(r[7], 0xEEB0000000000000ULL);
+    s[2] = v; v = u; u = t; t = 0;
+    MULACC(r[5], 0x084E9867D6EBE876ULL);
+    MULACC(r[6], 0xDA959B1A13F7CC76ULL);
+    MULACC(r[7], 0xE3EC968549F878A8ULL);
+    MULACC(r[8], 0xEEB0000000000000ULL);
+    s[3] = v; v = u; u = t; t = 0;
+    MULACC(r[5], 0x8562B5045CB25748ULL);
+    MULACC(r[6], 0x084E9867D6EBE876ULL);
+    MULACC(r[7], 0xDA959B1A13F7CC76ULL);
+    MULACC(r[8], 0xE3EC968549F878A8ULL);
+    MULACC(r[9], 0xEEB0000000000000ULL);
+    s[4] = v; v = u; u = t; t = 0;
+    MULACC(r[5], 0x0E12909F97BADC66ULL);
+    MULACC(r[6], 0x8562B5045CB25748ULL);
+    MULACC(r[7], 0x084E9867D6EBE876ULL);
+    MULACC(r[8], 0xDA959B1A13F7CC76ULL);
+    MULACC(r[9], 0xE3EC968549F878A8ULL);
+    s[5] = v; v = u; u = t; t = 0;
+    MULACC(r[5], 0x00006FE5D541F71CULL);
+    MULACC(r[6], 0x0E12909F97BADC66ULL);
+    MULACC(r[7], 0x8562B5045CB25748ULL);
+    MULACC(r[8], 0x084E9867D6EBE876ULL);
+    MULACC(r[9], 0xDA959B1A13F7CC76ULL);
+    s[6] = v; v = u; u = t; t = 0;
+    MULACC(r[6], 0x00006FE5D541F71CULL);
+    MULACC(r[7], 0x0E12909F97BADC66ULL);
+    MULACC(r[8], 0x8562B5045CB25748ULL);
+    MULACC(r[9], 0x084E9867D6EBE876ULL);
+    s[7] = v; v = u; u = t; t = 0;
+    MULACC(r[7], 0x00006FE5D541F71CULL);
+    MULACC(r[8], 0x0E12909F97BADC66ULL);
+    MULACC(r[9], 0x8562B5045CB25748ULL);
+    s[8] = v; v = u; u = t; t = 0;
+    MULACC(r[8], 0x00006FE5D541F71CULL);
+    MULACC(r[9], 0x0E12909F97BADC66ULL);
+    s[9] = v; v = u; u = t; t = 0;
+    MULACC(r[9], 0x00006FE5D541F71CULL);
+    s[10] = v; v = u; u = t; t = 0;
+    s[11] = v;
+    ADDC(0, r[10], s[0], carry, r[10]);
+    ADDC(carry, r[11], s[1], carry, r[11]);
+    ADDC(carry, r[12], s[2], carry, r[12]);
+    ADDC(carry, r[13], s[3], carry, r[13]);
+    ADDC(carry, r[14], s[4], carry, r[14]);
+    ADDC(carry, r[15], s[5], carry, r[15]);
+    ADDC(carry, r[16], s[6], carry, r[16]);
+    ADDC(carry, r[17], s[7], carry, r[17]);
+    ADDC(carry, r[18], s[8], carry, r[18]);
+    ADDC(carry, r[19], s[9], carry, r[19]);
+    ADDC(carry, r[20], s[10], carry, r[20]);
+    ADDC(carry, r[21], s[11], carry, r[21]);
+    ADDC(carry, r[22], 0, carry, r[22]);
+    ADDC(carry, r[23], 0, carry, r[23]);
+
+    t = 0; u = 0; v = 0;
+    MULACC(r[10], 0xEEB0000000000000ULL);
+    s[0] = v; v = u; u = t; t = 0;
+    MULACC(r[10], 0xE3EC968549F878A8ULL);
+    MULACC(r[11], 0xEEB0000000000000ULL);
+    s[1] = v; v = u; u = t; t = 0;
+    MULACC(r[10], 0xDA959B1A13F7CC76ULL);
+    MULACC(r[11], 0xE3EC968549F878A8ULL);
+    s[2] = v; v = u; u = t; t = 0;
+    MULACC(r[10], 0x084E9867D6EBE876ULL);
+    MULACC(r[11], 0xDA959B1A13F7CC76ULL);
+    s[3] = v; v = u; u = t; t = 0;
+    MULACC(r[10], 0x8562B5045CB25748ULL);
+    MULACC(r[11], 0x084E9867D6EBE876ULL);
+    s[4] = v; v = u; u = t; t = 0;
+    MULACC(r[10], 0x0E12909F97BADC66ULL);
+    MULACC(r[11], 0x8562B5045CB25748ULL);
+    s[5] = v; v = u; u = t; t = 0;
+    MULACC(r[10], 0x00006FE5D541F71CULL);
+    MULACC(r[11], 0x0E12909F97BADC66ULL);
+    s[6] = v; v = u; u = t; t = 0;
+    MULACC(r[11], 0x00006FE5D541F71CULL);
+    s[7] = v; v = u; u = t; t = 0;
+    s[8] = v;
+    ADDC(0, r[15], s[0], carry, r[15]);
+    ADDC(carry, r[16], s[1], carry, r[16]);
+    ADDC(carry, r[17], s[2], carry, r[17]);
+    ADDC(carry, r[18], s[3], carry, r[18]);
+    ADDC(carry, r[19], s[4], carry, r[19]);
+    ADDC(carry, r[20], s[5], carry, r[20]);
+    ADDC(carry, r[21], s[6], carry, r[21]);
+    ADDC(carry, r[22], s[7], carry, r[22]);
+    ADDC(carry, r[23], s[8], carry, r[23]);
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        mc[i] = r[NWORDS_FIELD+i];
+    }
+}
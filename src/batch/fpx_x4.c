@@ -0,0 +1,255 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: 4-way vectorized arithmetic over GF(p) and GF(p^2) using AVX2
+*********************************************************************************************/
+
+// Four field elements are stored lane-interleaved: limb i of the element in lane j is held in the 64-bit lane j
+// of the i-th 256-bit word. Limbs are in radix 2^28, which allows the use of the 32x32-bit vector multiplier
+// (vpmuludq) and leaves enough room in each 64-bit lane to accumulate the columns of a full product.
+// Elements are kept in Montgomery representation with respect to Rv = 2^(VRADIX*VNWORDS_FIELD), in the range
+// [0, 2p-1] and with normalized limbs, unless stated otherwise. Since Rv > 16p, products of values in [0, 4p-1]
+// are reduced back to [0, 2p-1] by the Montgomery multiplication.
+
+#define VMASK    (((uint64_t)1 << VRADIX) - 1)
+#define VBIAS    40                                 // Bias used to emulate arithmetic shifts of signed limbs
+
+
+static void fp2_to_x4(const f2elm_t* a, f2elm_x4_t c)
+{ // Conversion of four GF(p^2) elements in Montgomery representation to the 4-way representation
+  // Input:  a[0],...,a[3] in [0, 2p-1]
+  // Output: c in [0, 2p-1], with lane j holding a[j]
+    uint64_t limbs[2][4][VNWORDS_FIELD];
+    felm_t t;
+    unsigned int i, j, k, bit, word, shift;
+
+    for (j = 0; j < 4; j++) {
+        for (k = 0; k < 2; k++) {
+            fpmul_mont(a[j][k], (digit_t*)&Montgomery_Rv, t);    // t = a*Rv/R mod p
+            for (i = 0; i < VNWORDS_FIELD; i++) {
+                bit = i*VRADIX; word = bit >> LOG2RADIX; shift = bit & (RADIX-1);
+                limbs[k][j][i] = 0;
+                if (word < NWORDS_FIELD) {
+                    limbs[k][j][i] = t[word] >> shift;
+                    if ((shift + VRADIX > RADIX) && (word + 1 < NWORDS_FIELD)) {
+                        limbs[k][j][i] |= t[word+1] << (RADIX - shift);
+                    }
+                    limbs[k][j][i] &= VMASK;
+                }
+            }
+        }
+    }
+    for (k = 0; k < 2; k++) {
+        for (i = 0; i < VNWORDS_FIELD; i++) {
+            c[k][i] = _mm256_set_epi64x((long long)limbs[k][3][i], (long long)limbs[k][2][i], (long long)limbs[k][1][i], (long long)limbs[k][0][i]);
+        }
+    }
+}
+
+
+static void fp2_from_x4(const f2elm_x4_t a, f2elm_t* c)
+{ // Conversion of four GF(p^2) elements from the 4-way representation to Montgomery representation
+  // Input:  a in [0, 2p-1]
+  // Output: c[0],...,c[3] in [0, 2p-1], where c[j] is the element in lane j of a
+    uint64_t limbs[2][VNWORDS_FIELD][4];
+    felm_t t;
+    unsigned int i, j, k, bit, word, shift;
+
+    for (k = 0; k < 2; k++) {
+        for (i = 0; i < VNWORDS_FIELD; i++) {
+            _mm256_storeu_si256((__m256i*)limbs[k][i], a[k][i]);
+        }
+    }
+    for (j = 0; j < 4; j++) {
+        for (k = 0; k < 2; k++) {
+            fpzero(t);
+            for (i = 0; i < VNWORDS_FIELD; i++) {
+                bit = i*VRADIX; word = bit >> LOG2RADIX; shift = bit & (RADIX-1);
+                if (word < NWORDS_FIELD) {
+                    t[word] |= limbs[k][i][j] << shift;
+                    if ((shift + VRADIX > RADIX) && (word + 1 < NWORDS_FIELD)) {
+                        t[word+1] |= limbs[k][i][j] >> (RADIX - shift);
+                    }
+                }
+            }
+            fpmul_mont(t, (digit_t*)&Montgomery_RRv, c[j][k]);   // c = t*R^2/Rv/R mod p
+        }
+    }
+}
+
+
+static void fp2_set_x4(const f2elm_t a, f2elm_x4_t c)
+{ // Broadcast of a GF(p^2) element in Montgomery representation to the four lanes of c
+    f2elm_t t[4];
+    unsigned int j;
+
+    for (j = 0; j < 4; j++) {
+        fp2copy(a, t[j]);
+    }
+    fp2_to_x4((const f2elm_t*)t, c);
+}
+
+
+static inline void fpcopy_x4(const felm_x4_t a, felm_x4_t c)
+{ // Copy of four field elements, c = a
+    unsigned int i;
+
+    for (i = 0; i < VNWORDS_FIELD; i++) {
+        c[i] = a[i];
+    }
+}
+
+
+static inline void fp2copy_x4(const f2elm_x4_t a, f2elm_x4_t c)
+{ // Copy of four GF(p^2) elements, c = a
+
+    fpcopy_x4(a[0], c[0]);
+    fpcopy_x4(a[1], c[1]);
+}
+
+
+static inline void fpcorrection_x4(__m256i* t, felm_x4_t c)
+{ // Carry propagation and modular correction, c = t mod 2p
+  // Input:  t in [-2p, 2p-1], given as signed limbs in [-2^(VRADIX+1), 2^(VRADIX+1)]
+  // Output: c in [0, 2p-1] with normalized limbs
+    const __m256i mask = _mm256_set1_epi64x(VMASK), bias = _mm256_set1_epi64x((long long)1 << VBIAS);
+    const __m256i bias_shifted = _mm256_set1_epi64x((long long)1 << (VBIAS-VRADIX));
+    __m256i carry, sign;
+    unsigned int i;
+
+    for (i = 0; i < VNWORDS_FIELD-1; i++) {
+        carry = _mm256_sub_epi64(_mm256_srli_epi64(_mm256_add_epi64(t[i], bias), VRADIX), bias_shifted);   // carry = t[i] >> VRADIX (arithmetic)
+        t[i] = _mm256_and_si256(t[i], mask);
+        t[i+1] = _mm256_add_epi64(t[i+1], carry);
+    }
+    sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), t[VNWORDS_FIELD-1]);             // sign = 0xFF...FF if t < 0, 0 otherwise
+
+    for (i = 0; i < VNWORDS_FIELD; i++) {
+        t[i] = _mm256_add_epi64(t[i], _mm256_and_si256(_mm256_set1_epi64x((long long)PRIMEx2_X4[i]), sign));
+    }
+    for (i = 0; i < VNWORDS_FIELD-1; i++) {
+        t[i+1] = _mm256_add_epi64(t[i+1], _mm256_srli_epi64(t[i], VRADIX));
+        c[i] = _mm256_and_si256(t[i], mask);
+    }
+    c[VNWORDS_FIELD-1] = t[VNWORDS_FIELD-1];
+}
+
+
+static inline void fpadd_x4(const felm_x4_t a, const felm_x4_t b, felm_x4_t c)
+{ // 4-way modular addition, c = a+b mod p
+  // Inputs: a, b in [0, 2p-1]
+  // Output: c in [0, 2p-1]
+    __m256i t[VNWORDS_FIELD];
+    unsigned int i;
+
+    for (i = 0; i < VNWORDS_FIELD; i++) {
+        t[i] = _mm256_sub_epi64(_mm256_add_epi64(a[i], b[i]), _mm256_set1_epi64x((long long)PRIMEx2_X4[i]));
+    }
+    fpcorrection_x4(t, c);
+}
+
+
+static inline void fpsub_x4(const felm_x4_t a, const felm_x4_t b, felm_x4_t c)
+{ // 4-way modular subtraction, c = a-b mod p
+  // Inputs: a, b in [0, 2p-1]
+  // Output: c in [0, 2p-1]
+    __m256i t[VNWORDS_FIELD];
+    unsigned int i;
+
+    for (i = 0; i < VNWORDS_FIELD; i++) {
+        t[i] = _mm256_sub_epi64(a[i], b[i]);
+    }
+    fpcorrection_x4(t, c);
+}
+
+
+static inline void mp_add_x4(const felm_x4_t a, const felm_x4_t b, felm_x4_t c)
+{ // 4-way lazy addition without carry propagation, c = a+b
+  // Inputs: a, b in [0, 2p-1]
+  // Output: c in [0, 4p-1] with limbs in [0, 2^(VRADIX+1)-1], only to be used as input to a multiplication
+
+    for (unsigned int i = 0; i < VNWORDS_FIELD; i++) {
+        c[i] = _mm256_add_epi64(a[i], b[i]);
+    }
+}
+
+
+static void fpmul_mont_x4(const felm_x4_t a, const felm_x4_t b, felm_x4_t c)
+{ // 4-way Montgomery multiplication, c = a*b*Rv^-1 mod p, where Rv = 2^(VRADIX*VNWORDS_FIELD)
+  // The product is computed column-wise and interleaved with the reduction, which exploits that -p^-1 mod 2^VRADIX = 1
+  // and that the VZERO_WORDS least significant limbs of p+1 are zero.
+  // Inputs: a, b in [0, 4p-1] with limbs in [0, 2^(VRADIX+1)-1]
+  // Output: c in [0, 2p-1]
+    const __m256i mask = _mm256_set1_epi64x(VMASK);
+    __m256i acc = _mm256_setzero_si256(), q[VNWORDS_FIELD];
+    unsigned int i, k;
+
+    for (k = 0; k < VNWORDS_FIELD; k++) {
+        for (i = 0; i <= k; i++) {
+            acc = _mm256_add_epi64(acc, _mm256_mul_epu32(a[i], b[k-i]));
+        }
+        for (i = 0; i + VZERO_WORDS <= k; i++) {
+            acc = _mm256_add_epi64(acc, _mm256_mul_epu32(q[i], _mm256_set1_epi64x((long long)PRIMEp1_X4[k-i])));
+        }
+        q[k] = _mm256_and_si256(acc, mask);
+        acc = _mm256_srli_epi64(acc, VRADIX);
+    }
+    for (k = VNWORDS_FIELD; k < 2*VNWORDS_FIELD-1; k++) {
+        for (i = k-VNWORDS_FIELD+1; i < VNWORDS_FIELD; i++) {
+            acc = _mm256_add_epi64(acc, _mm256_mul_epu32(a[i], b[k-i]));
+        }
+        for (i = k-VNWORDS_FIELD+1; i < VNWORDS_FIELD && i + VZERO_WORDS <= k; i++) {
+            acc = _mm256_add_epi64(acc, _mm256_mul_epu32(q[i], _mm256_set1_epi64x((long long)PRIMEp1_X4[k-i])));
+        }
+        c[k-VNWORDS_FIELD] = _mm256_and_si256(acc, mask);
+        acc = _mm256_srli_epi64(acc, VRADIX);
+    }
+    c[VNWORDS_FIELD-1] = acc;
+}
+
+
+static inline void fp2add_x4(const f2elm_x4_t a, const f2elm_x4_t b, f2elm_x4_t c)
+{ // 4-way GF(p^2) addition, c = a+b in GF(p^2)
+
+    fpadd_x4(a[0], b[0], c[0]);
+    fpadd_x4(a[1], b[1], c[1]);
+}
+
+
+static inline void fp2sub_x4(const f2elm_x4_t a, const f2elm_x4_t b, f2elm_x4_t c)
+{ // 4-way GF(p^2) subtraction, c = a-b in GF(p^2)
+
+    fpsub_x4(a[0], b[0], c[0]);
+    fpsub_x4(a[1], b[1], c[1]);
+}
+
+
+static void fp2mul_mont_x4(const f2elm_x4_t a, const f2elm_x4_t b, f2elm_x4_t c)
+{ // 4-way GF(p^2) multiplication using Montgomery arithmetic, c = a*b in GF(p^2)
+  // Inputs: a = a0+a1*i and b = b0+b1*i, where a0, a1, b0, b1 are in [0, 2p-1]
+  // Output: c = c0+c1*i, where c0, c1 are in [0, 2p-1]
+    felm_x4_t t0, t1, t2, t3;
+
+    mp_add_x4(a[0], a[1], t2);                  // t2 = a0+a1
+    mp_add_x4(b[0], b[1], t3);                  // t3 = b0+b1
+    fpmul_mont_x4(a[0], b[0], t0);              // t0 = a0*b0
+    fpmul_mont_x4(a[1], b[1], t1);              // t1 = a1*b1
+    fpmul_mont_x4(t2, t3, t2);                  // t2 = (a0+a1)*(b0+b1)
+    fpsub_x4(t2, t0, t2);                       // t2 = (a0+a1)*(b0+b1) - a0*b0
+    fpsub_x4(t2, t1, c[1]);                     // c1 = a0*b1 + a1*b0
+    fpsub_x4(t0, t1, c[0]);                     // c0 = a0*b0 - a1*b1
+}
+
+
+static void fp2sqr_mont_x4(const f2elm_x4_t a, f2elm_x4_t c)
+{ // 4-way GF(p^2) squaring using Montgomery arithmetic, c = a^2 in GF(p^2)
+  // Input:  a = a0+a1*i, where a0, a1 are in [0, 2p-1]
+  // Output: c = c0+c1*i, where c0, c1 are in [0, 2p-1]
+    felm_x4_t t0, t1, t2;
+
+    mp_add_x4(a[0], a[1], t0);                  // t0 = a0+a1
+    fpsub_x4(a[0], a[1], t1);                   // t1 = a0-a1
+    mp_add_x4(a[0], a[0], t2);                  // t2 = 2*a0
+    fpmul_mont_x4(t0, t1, c[0]);                // c0 = (a0+a1)(a0-a1)
+    fpmul_mont_x4(t2, a[1], c[1]);              // c1 = 2*a0*a1
+}
@@ -0,0 +1,282 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: 4-way vectorized ephemeral SIDH functions used by the batched SIKE protocol
+*********************************************************************************************/
+
+// Each function processes four independent instances, one per AVX2 lane. Keys are passed as arrays of four pointers.
+// The ladders and the isogeny tree traversals are vectorized; the curve recovery (get_A) and the j-invariant computations
+// are computed per lane with the scalar field arithmetic, and the final inversions are shared across the four lanes.
+
+
+static void fp2_decode_x4(const unsigned char* const* enc, const unsigned int offset, f2elm_t* x)
+{ // Decoding of the GF(p^2) element located at enc[j] + offset, for j = 0,...,3
+
+    for (unsigned int j = 0; j < 4; j++) {
+        fp2_decode(enc[j] + offset, x[j]);
+    }
+}
+
+
+static int EphemeralKeyGeneration_A_x4(const unsigned char* const* PrivateKeyA, unsigned char* const* PublicKeyA)
+{ // Alice's ephemeral public key generation for four private keys
+  // Input:  private keys PrivateKeyA[j] in the range [0, 2^eA - 1], for j = 0,...,3.
+  // Output: the public keys PublicKeyA[j] consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    point_proj_x4_t R, phiP, phiQ, phiR, pts[MAX_INT_POINTS_ALICE];
+    f2elm_x4_t coeff[3], A24plus, C24;
+    f2elm_t XPA[4], XQA[4], XRA[4], XP, XQ, XR, A[4], one = {0}, cte = {0};
+    f2elm_t X[3][4], Z[3][4], Zinv[3][4];
+    unsigned int i, j, k, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+    digit_t SecretKeyA[4][NWORDS_ORDER] = {0};
+
+    // Initialize basis points
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    init_basis((digit_t*)A_gen, XP, XQ, XR);
+    for (j = 0; j < 4; j++) {
+        fp2copy(XP, XPA[j]);
+        fp2copy(XQ, XQA[j]);
+        fp2copy(XR, XRA[j]);
+    }
+    init_basis((digit_t*)B_gen, XP, XQ, XR);
+    fp2_set_x4(XP, phiP->X);
+    fp2_set_x4(XQ, phiQ->X);
+    fp2_set_x4(XR, phiR->X);
+    fp2_set_x4(one, phiP->Z);
+    fp2_set_x4(one, phiQ->Z);
+    fp2_set_x4(one, phiR->Z);
+
+    // Initialize constants: A24plus = A+2C, C24 = 4C, where A=6, C=1
+    fp2copy(one, cte);
+    mp2_add(cte, cte, cte);
+    mp2_add(cte, cte, XP);
+    fp2_set_x4(XP, C24);
+    mp2_add(cte, XP, A[0]);
+    mp2_add(XP, XP, XQ);
+    fp2_set_x4(XQ, A24plus);
+    for (j = 1; j < 4; j++) {
+        fp2copy(A[0], A[j]);
+    }
+
+    // Retrieve kernel points
+    for (j = 0; j < 4; j++) {
+        decode_to_digits(PrivateKeyA[j], SecretKeyA[j], SECRETKEY_A_BYTES, NWORDS_ORDER);
+    }
+    LADDER3PT_x4((const f2elm_t*)XPA, (const f2elm_t*)XQA, (const f2elm_t*)XRA, SecretKeyA, ALICE, R, (const f2elm_t*)A);
+
+#if (OALICE_BITS % 2 == 1)
+    point_proj_x4_t S;
+
+    xDBLe_x4(R, S, A24plus, C24, (int)(OALICE_BITS-1));
+    get_2_isog_x4(S, A24plus, C24);
+    eval_2_isog_x4(phiP, S);
+    eval_2_isog_x4(phiQ, S);
+    eval_2_isog_x4(phiR, S);
+    eval_2_isog_x4(R, S);
+#endif
+
+    // Traverse tree
+    index = 0;
+    for (row = 1; row < MAX_Alice; row++) {
+        while (index < MAX_Alice-row) {
+            fp2copy_x4(R->X, pts[npts]->X);
+            fp2copy_x4(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            m = strat_Alice[ii++];
+            xDBLe_x4(R, R, A24plus, C24, (int)(2*m));
+            index += m;
+        }
+        get_4_isog_x4(R, A24plus, C24, coeff);
+
+        for (i = 0; i < npts; i++) {
+            eval_4_isog_x4(pts[i], coeff);
+        }
+        eval_4_isog_x4(phiP, coeff);
+        eval_4_isog_x4(phiQ, coeff);
+        eval_4_isog_x4(phiR, coeff);
+
+        fp2copy_x4(pts[npts-1]->X, R->X);
+        fp2copy_x4(pts[npts-1]->Z, R->Z);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+
+    get_4_isog_x4(R, A24plus, C24, coeff);
+    eval_4_isog_x4(phiP, coeff);
+    eval_4_isog_x4(phiQ, coeff);
+    eval_4_isog_x4(phiR, coeff);
+
+    fp2_from_x4(phiP->X, X[0]); fp2_from_x4(phiP->Z, Z[0]);
+    fp2_from_x4(phiQ->X, X[1]); fp2_from_x4(phiQ->Z, Z[1]);
+    fp2_from_x4(phiR->X, X[2]); fp2_from_x4(phiR->Z, Z[2]);
+    mont_n_way_inv_ct((const f2elm_t*)Z, 12, (f2elm_t*)Zinv);
+
+    // Format public keys
+    for (j = 0; j < 4; j++) {
+        for (k = 0; k < 3; k++) {
+            fp2mul_mont(X[k][j], Zinv[k][j], X[k][j]);
+            fp2_encode(X[k][j], PublicKeyA[j] + k*FP2_ENCODED_BYTES);
+        }
+    }
+
+    return 0;
+}
+
+
+static int EphemeralSecretAgreement_A_x4(const unsigned char* const* PrivateKeyA, const unsigned char* const* PublicKeyB, unsigned char* const* SharedSecretA)
+{ // Alice's ephemeral shared secret computation for four pairs of keys
+  // Inputs: Alice's PrivateKeyA[j] is an integer in the range [0, oA-1], for j = 0,...,3.
+  //         Bob's PublicKeyB[j] consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: shared secrets SharedSecretA[j] that consist of one element in GF(p^2) encoded by removing leading 0 bytes.
+    point_proj_x4_t R, pts[MAX_INT_POINTS_ALICE];
+    f2elm_x4_t coeff[3], A24plus, C24;
+    f2elm_t PKB0[4], PKB1[4], PKB2[4], A[4], A24[4], C[4], jnum[4], jden[4], jinv[4];
+    unsigned int i, j, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+    digit_t SecretKeyA[4][NWORDS_ORDER] = {0};
+
+    // Initialize images of Bob's basis
+    fp2_decode_x4(PublicKeyB, 0, PKB0);
+    fp2_decode_x4(PublicKeyB, FP2_ENCODED_BYTES, PKB1);
+    fp2_decode_x4(PublicKeyB, 2*FP2_ENCODED_BYTES, PKB2);
+
+    // Initialize constants: A24plus = A+2C, C24 = 4C, where C=1
+    for (j = 0; j < 4; j++) {
+        get_A(PKB0[j], PKB1[j], PKB2[j], A[j]);
+        fp2zero(C[j]);
+        mp_add((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, C[j][0], NWORDS_FIELD);
+        mp2_add(A[j], C[j], A24[j]);
+        mp_add(C[j][0], C[j][0], C[j][0], NWORDS_FIELD);
+    }
+    fp2_to_x4((const f2elm_t*)A24, A24plus);
+    fp2_to_x4((const f2elm_t*)C, C24);
+
+    // Retrieve kernel points
+    for (j = 0; j < 4; j++) {
+        decode_to_digits(PrivateKeyA[j], SecretKeyA[j], SECRETKEY_A_BYTES, NWORDS_ORDER);
+    }
+    LADDER3PT_x4((const f2elm_t*)PKB0, (const f2elm_t*)PKB1, (const f2elm_t*)PKB2, SecretKeyA, ALICE, R, (const f2elm_t*)A);
+
+#if (OALICE_BITS % 2 == 1)
+    point_proj_x4_t S;
+
+    xDBLe_x4(R, S, A24plus, C24, (int)(OALICE_BITS-1));
+    get_2_isog_x4(S, A24plus, C24);
+    eval_2_isog_x4(R, S);
+#endif
+
+    // Traverse tree
+    index = 0;
+    for (row = 1; row < MAX_Alice; row++) {
+        while (index < MAX_Alice-row) {
+            fp2copy_x4(R->X, pts[npts]->X);
+            fp2copy_x4(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            m = strat_Alice[ii++];
+            xDBLe_x4(R, R, A24plus, C24, (int)(2*m));
+            index += m;
+        }
+        get_4_isog_x4(R, A24plus, C24, coeff);
+
+        for (i = 0; i < npts; i++) {
+            eval_4_isog_x4(pts[i], coeff);
+        }
+
+        fp2copy_x4(pts[npts-1]->X, R->X);
+        fp2copy_x4(pts[npts-1]->Z, R->Z);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+
+    get_4_isog_x4(R, A24plus, C24, coeff);
+    fp2_from_x4(A24plus, A24);
+    fp2_from_x4(C24, C);
+
+    for (j = 0; j < 4; j++) {
+        mp2_add(A24[j], A24[j], A24[j]);
+        fp2sub(A24[j], C[j], A24[j]);
+        fp2add(A24[j], A24[j], A24[j]);
+        j_inv_proj(A24[j], C[j], jnum[j], jden[j]);
+    }
+    mont_n_way_inv_ct((const f2elm_t*)jden, 4, jinv);
+    for (j = 0; j < 4; j++) {
+        fp2mul_mont(jinv[j], jnum[j], jinv[j]);
+        fp2_encode(jinv[j], SharedSecretA[j]);    // Format shared secret
+    }
+
+    return 0;
+}
+
+
+static int EphemeralSecretAgreement_B_x4(const unsigned char* const* PrivateKeyB, const unsigned char* const* PublicKeyA, unsigned char* const* SharedSecretB)
+{ // Bob's ephemeral shared secret computation for four pairs of keys
+  // Inputs: Bob's PrivateKeyB[j] is an integer in the range [0, 2^Floor(Log(2,oB)) - 1], for j = 0,...,3.
+  //         Alice's PublicKeyA[j] consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: shared secrets SharedSecretB[j] that consist of one element in GF(p^2) encoded by removing leading 0 bytes.
+    point_proj_x4_t R, pts[MAX_INT_POINTS_BOB];
+    f2elm_x4_t coeff[3], A24plus, A24minus;
+    f2elm_t PKB0[4], PKB1[4], PKB2[4], A[4], Ap[4], Am[4], jnum[4], jden[4], jinv[4];
+    unsigned int i, j, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
+    digit_t SecretKeyB[4][NWORDS_ORDER] = {0};
+
+    // Initialize images of Alice's basis
+    fp2_decode_x4(PublicKeyA, 0, PKB0);
+    fp2_decode_x4(PublicKeyA, FP2_ENCODED_BYTES, PKB1);
+    fp2_decode_x4(PublicKeyA, 2*FP2_ENCODED_BYTES, PKB2);
+
+    // Initialize constants: A24plus = A+2C, A24minus = A-2C, where C=1
+    for (j = 0; j < 4; j++) {
+        get_A(PKB0[j], PKB1[j], PKB2[j], A[j]);
+        fp2zero(Am[j]);
+        mp_add((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, Am[j][0], NWORDS_FIELD);
+        mp2_add(A[j], Am[j], Ap[j]);
+        mp2_sub_p2(A[j], Am[j], Am[j]);
+    }
+    fp2_to_x4((const f2elm_t*)Ap, A24plus);
+    fp2_to_x4((const f2elm_t*)Am, A24minus);
+
+    // Retrieve kernel points
+    for (j = 0; j < 4; j++) {
+        decode_to_digits(PrivateKeyB[j], SecretKeyB[j], SECRETKEY_B_BYTES, NWORDS_ORDER);
+    }
+    LADDER3PT_x4((const f2elm_t*)PKB0, (const f2elm_t*)PKB1, (const f2elm_t*)PKB2, SecretKeyB, BOB, R, (const f2elm_t*)A);
+
+    // Traverse tree
+    index = 0;
+    for (row = 1; row < MAX_Bob; row++) {
+        while (index < MAX_Bob-row) {
+            fp2copy_x4(R->X, pts[npts]->X);
+            fp2copy_x4(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            m = strat_Bob[ii++];
+            xTPLe_x4(R, R, A24minus, A24plus, (int)m);
+            index += m;
+        }
+        get_3_isog_x4(R, A24minus, A24plus, coeff);
+
+        for (i = 0; i < npts; i++) {
+            eval_3_isog_x4(pts[i], coeff);
+        }
+
+        fp2copy_x4(pts[npts-1]->X, R->X);
+        fp2copy_x4(pts[npts-1]->Z, R->Z);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+
+    get_3_isog_x4(R, A24minus, A24plus, coeff);
+    fp2_from_x4(A24plus, Ap);
+    fp2_from_x4(A24minus, Am);
+
+    for (j = 0; j < 4; j++) {
+        fp2add(Ap[j], Am[j], A[j]);
+        fp2add(A[j], A[j], A[j]);
+        fp2sub(Ap[j], Am[j], Ap[j]);
+        j_inv_proj(A[j], Ap[j], jnum[j], jden[j]);
+    }
+    mont_n_way_inv_ct((const f2elm_t*)jden, 4, jinv);
+    for (j = 0; j < 4; j++) {
+        fp2mul_mont(jinv[j], jnum[j], jinv[j]);
+        fp2_encode(jinv[j], SharedSecretB[j]);    // Format shared secret
+    }
+
+    return 0;
+}
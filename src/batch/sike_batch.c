@@ -0,0 +1,210 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: batched supersingular isogeny key encapsulation (SIKE) protocol with shared inversions
+*********************************************************************************************/
+
+// The batched functions run the projective part of each operation and then invert all the denominators of a
+// group of operations (the Z-coordinates of the public keys and the j-invariants) with a single constant-time
+// inversion using Montgomery's trick. Batches are processed in groups of at most SIKE_BATCH_GROUP operations,
+// which bounds the stack usage independently of the batch size.
+// A single operation spends two inversions, well under 1% of an encapsulation, and a group of 8 already brings their
+// per-operation cost down to a quarter of one inversion plus a few multiplications;
+// larger groups only grow the stack (see the sweep in README.md).
+
+#if !defined(SIKE_BATCH_GROUP)
+    #define SIKE_BATCH_GROUP    8
+#endif
+
+
+static void encode_public_keys(point_proj_t (*phi)[3], const unsigned int n, unsigned char* PublicKey, const unsigned int stride)
+{ // Encoding of n public keys given in projective form, sharing the inversion of the 3*n Z-coordinates
+  // The i-th public key is written to PublicKey + i*stride.
+    f2elm_t Z[3*SIKE_BATCH_GROUP], Zinv[3*SIKE_BATCH_GROUP];
+    unsigned int i, k;
+
+    for (i = 0; i < n; i++) {
+        for (k = 0; k < 3; k++) {
+            fp2copy(phi[i][k]->Z, Z[3*i+k]);
+        }
+    }
+    mont_n_way_inv_ct((const f2elm_t*)Z, (int)(3*n), Zinv);
+    for (i = 0; i < n; i++) {
+        for (k = 0; k < 3; k++) {
+            fp2copy(Zinv[3*i+k], phi[i][k]->Z);
+        }
+        encode_public_key(phi[i][0], phi[i][1], phi[i][2], PublicKey + i*stride);
+    }
+}
+
+
+static void encode_j_invariants(f2elm_t* jnum, const f2elm_t* jden, const unsigned int n, unsigned char* jinvariant)
+{ // Encoding of n j-invariants given as fractions jnum/jden, sharing the inversion of the n denominators
+  // The i-th j-invariant is written to jinvariant + i*FP2_ENCODED_BYTES.
+    f2elm_t jinv[SIKE_BATCH_GROUP];
+    unsigned int i;
+
+    mont_n_way_inv_ct(jden, (int)n, jinv);
+    for (i = 0; i < n; i++) {
+        fp2mul_mont(jinv[i], jnum[i], jinv[i]);
+        fp2_encode(jinv[i], jinvariant + i*FP2_ENCODED_BYTES);
+    }
+}
+
+
+static void crypto_kem_keypair_group(const unsigned int n, unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation for a group of n <= SIKE_BATCH_GROUP key pairs
+    point_proj_t phi[SIKE_BATCH_GROUP][3];
+    unsigned int i;
+
+    for (i = 0; i < n; i++) {
+        // Generate lower portion of secret key sk <- s||SK
+        randombytes(sk + i*CRYPTO_SECRETKEYBYTES, MSG_BYTES);
+        random_mod_order_B(sk + i*CRYPTO_SECRETKEYBYTES + MSG_BYTES);
+#ifdef DO_VALGRIND_CHECK
+        VALGRIND_MAKE_MEM_UNDEFINED(sk + i*CRYPTO_SECRETKEYBYTES, MSG_BYTES + SECRETKEY_B_BYTES);
+#endif
+        KeyGeneration_B_proj(sk + i*CRYPTO_SECRETKEYBYTES + MSG_BYTES, phi[i][0], phi[i][1], phi[i][2]);
+    }
+
+    // Generate public keys pk and append them to the secret keys sk
+    encode_public_keys(phi, n, pk, CRYPTO_PUBLICKEYBYTES);
+    for (i = 0; i < n; i++) {
+        memcpy(sk + i*CRYPTO_SECRETKEYBYTES + MSG_BYTES + SECRETKEY_B_BYTES, pk + i*CRYPTO_PUBLICKEYBYTES, CRYPTO_PUBLICKEYBYTES);
+#ifdef DO_VALGRIND_CHECK
+        VALGRIND_MAKE_MEM_DEFINED(sk + i*CRYPTO_SECRETKEYBYTES, MSG_BYTES + SECRETKEY_B_BYTES);
+#endif
+    }
+}
+
+
+static void crypto_kem_enc_group(const unsigned int n, unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation for a group of n <= SIKE_BATCH_GROUP public keys
+    point_proj_t phi[SIKE_BATCH_GROUP][3];
+    f2elm_t jnum[SIKE_BATCH_GROUP], jden[SIKE_BATCH_GROUP];
+    unsigned char ephemeralsk[SECRETKEY_A_BYTES];
+    unsigned char jinvariant[SIKE_BATCH_GROUP*FP2_ENCODED_BYTES];
+    unsigned char h[MSG_BYTES];
+    unsigned char m[SIKE_BATCH_GROUP][MSG_BYTES];
+    unsigned int i, j;
+
+    for (i = 0; i < n; i++) {
+        // Generate ephemeralsk <- G(m||pk) mod oA
+        randombytes(m[i], MSG_BYTES);
+#ifdef DO_VALGRIND_CHECK
+        VALGRIND_MAKE_MEM_UNDEFINED(m[i], MSG_BYTES);
+#endif
+        shake256_concat(ephemeralsk, SECRETKEY_A_BYTES, m[i], MSG_BYTES, pk + i*CRYPTO_PUBLICKEYBYTES, CRYPTO_PUBLICKEYBYTES);
+        ephemeralsk[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+
+        // Encrypt
+        KeyGeneration_A_proj(ephemeralsk, phi[i][0], phi[i][1], phi[i][2]);
+        SecretAgreement_A_proj(ephemeralsk, pk + i*CRYPTO_PUBLICKEYBYTES, jnum[i], jden[i]);
+    }
+    encode_public_keys(phi, n, ct, CRYPTO_CIPHERTEXTBYTES);
+    encode_j_invariants(jnum, (const f2elm_t*)jden, n, jinvariant);
+
+    for (i = 0; i < n; i++) {
+        shake256(h, MSG_BYTES, jinvariant + i*FP2_ENCODED_BYTES, FP2_ENCODED_BYTES);
+        for (j = 0; j < MSG_BYTES; j++) {
+            ct[i*CRYPTO_CIPHERTEXTBYTES + CRYPTO_PUBLICKEYBYTES + j] = m[i][j] ^ h[j];
+        }
+
+        // Generate shared secret ss <- H(m||ct)
+        shake256_concat(ss + i*CRYPTO_BYTES, CRYPTO_BYTES, m[i], MSG_BYTES, ct + i*CRYPTO_CIPHERTEXTBYTES, CRYPTO_CIPHERTEXTBYTES);
+#ifdef DO_VALGRIND_CHECK
+        VALGRIND_MAKE_MEM_DEFINED(m[i], MSG_BYTES);
+#endif
+    }
+}
+
+
+static void crypto_kem_dec_group(const unsigned int n, unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // SIKE's decapsulation of a group of n <= SIKE_BATCH_GROUP ciphertexts under the same secret key
+    point_proj_t phi[SIKE_BATCH_GROUP][3];
+    f2elm_t jnum[SIKE_BATCH_GROUP], jden[SIKE_BATCH_GROUP];
+    unsigned char ephemeralsk_[SECRETKEY_A_BYTES];
+    unsigned char jinvariant_[SIKE_BATCH_GROUP*FP2_ENCODED_BYTES];
+    unsigned char h_[MSG_BYTES];
+    unsigned char c0_[SIKE_BATCH_GROUP*CRYPTO_PUBLICKEYBYTES];
+    unsigned char m[SIKE_BATCH_GROUP][MSG_BYTES];
+    unsigned int i, j;
+
+    // Decrypt
+    for (i = 0; i < n; i++) {
+        SecretAgreement_B_proj(sk + MSG_BYTES, ct + i*CRYPTO_CIPHERTEXTBYTES, jnum[i], jden[i]);
+    }
+    encode_j_invariants(jnum, (const f2elm_t*)jden, n, jinvariant_);
+
+    for (i = 0; i < n; i++) {
+        shake256(h_, MSG_BYTES, jinvariant_ + i*FP2_ENCODED_BYTES, FP2_ENCODED_BYTES);
+        for (j = 0; j < MSG_BYTES; j++) {
+            m[i][j] = ct[i*CRYPTO_CIPHERTEXTBYTES + CRYPTO_PUBLICKEYBYTES + j] ^ h_[j];
+        }
+
+        // Generate ephemeralsk_ <- G(m||pk) mod oA
+        shake256_concat(ephemeralsk_, SECRETKEY_A_BYTES, m[i], MSG_BYTES, &sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
+        ephemeralsk_[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+        KeyGeneration_A_proj(ephemeralsk_, phi[i][0], phi[i][1], phi[i][2]);
+    }
+    encode_public_keys(phi, n, c0_, CRYPTO_PUBLICKEYBYTES);
+
+    // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
+    for (i = 0; i < n; i++) {
+        // If selector = 0 then do ss = H(m||ct), else if selector = -1 load s to do ss = H(s||ct)
+        int8_t selector = ct_compare(c0_ + i*CRYPTO_PUBLICKEYBYTES, ct + i*CRYPTO_CIPHERTEXTBYTES, CRYPTO_PUBLICKEYBYTES);
+        ct_cmov(m[i], sk, MSG_BYTES, selector);
+        shake256_concat(ss + i*CRYPTO_BYTES, CRYPTO_BYTES, m[i], MSG_BYTES, ct + i*CRYPTO_CIPHERTEXTBYTES, CRYPTO_CIPHERTEXTBYTES);
+    }
+}
+
+
+int crypto_kem_keypair_batch(const unsigned int n, unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation for n key pairs
+  // Outputs: secret keys sk (n*CRYPTO_SECRETKEYBYTES bytes, the i-th key is located at sk + i*CRYPTO_SECRETKEYBYTES)
+  //          public keys pk (n*CRYPTO_PUBLICKEYBYTES bytes, the i-th key is located at pk + i*CRYPTO_PUBLICKEYBYTES)
+    unsigned int i, m;
+
+    for (i = 0; i < n; i += m) {
+        m = (n - i < SIKE_BATCH_GROUP) ? (n - i) : SIKE_BATCH_GROUP;
+        crypto_kem_keypair_group(m, pk + i*CRYPTO_PUBLICKEYBYTES, sk + i*CRYPTO_SECRETKEYBYTES);
+    }
+    return 0;
+}
+
+
+int crypto_kem_enc_batch(const unsigned int n, unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation for n public keys
+  // Input:   public keys pk         (n*CRYPTO_PUBLICKEYBYTES bytes, the i-th key is located at pk + i*CRYPTO_PUBLICKEYBYTES)
+  // Outputs: shared secrets ss      (n*CRYPTO_BYTES bytes, the i-th secret is located at ss + i*CRYPTO_BYTES)
+  //          ciphertext messages ct (n*CRYPTO_CIPHERTEXTBYTES bytes, the i-th ciphertext is located at ct + i*CRYPTO_CIPHERTEXTBYTES)
+    unsigned int i, m;
+
+    for (i = 0; i < n; i += m) {
+        m = (n - i < SIKE_BATCH_GROUP) ? (n - i) : SIKE_BATCH_GROUP;
+        crypto_kem_enc_group(m, ct + i*CRYPTO_CIPHERTEXTBYTES, ss + i*CRYPTO_BYTES, pk + i*CRYPTO_PUBLICKEYBYTES);
+    }
+    return 0;
+}
+
+
+int crypto_kem_dec_batch(const unsigned int n, unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // SIKE's decapsulation of n ciphertexts under the same secret key
+  // Input:   secret key sk          (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
+  //          ciphertext messages ct (n*CRYPTO_CIPHERTEXTBYTES bytes, the i-th ciphertext is located at ct + i*CRYPTO_CIPHERTEXTBYTES)
+  // Outputs: shared secrets ss      (n*CRYPTO_BYTES bytes, the i-th secret is located at ss + i*CRYPTO_BYTES)
+    unsigned int i, m;
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_UNDEFINED(sk, CRYPTO_SECRETKEYBYTES);
+#endif
+
+    for (i = 0; i < n; i += m) {
+        m = (n - i < SIKE_BATCH_GROUP) ? (n - i) : SIKE_BATCH_GROUP;
+        crypto_kem_dec_group(m, ss + i*CRYPTO_BYTES, ct + i*CRYPTO_CIPHERTEXTBYTES, sk);
+    }
+
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_DEFINED(sk, CRYPTO_SECRETKEYBYTES);
+#endif
+    return 0;
+}
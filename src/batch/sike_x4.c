@@ -0,0 +1,134 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: batched supersingular isogeny key encapsulation (SIKE) protocol, four operations per call
+*********************************************************************************************/
+
+
+int crypto_kem_enc_batch4(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation for four public keys
+  // Input:   public keys pk         (4*CRYPTO_PUBLICKEYBYTES bytes, the j-th key is located at pk + j*CRYPTO_PUBLICKEYBYTES)
+  // Outputs: shared secrets ss      (4*CRYPTO_BYTES bytes, the j-th secret is located at ss + j*CRYPTO_BYTES)
+  //          ciphertext messages ct (4*CRYPTO_CIPHERTEXTBYTES bytes, the j-th ciphertext is located at ct + j*CRYPTO_CIPHERTEXTBYTES)
+#if defined(AVX2_X4_IMPLEMENTATION)
+    unsigned char ephemeralsk[4][SECRETKEY_A_BYTES];
+    unsigned char jinvariant[4][FP2_ENCODED_BYTES];
+    unsigned char h[4][MSG_BYTES];
+    unsigned char m[4][MSG_BYTES];
+    const unsigned char *sk_ptr[4], *pk_ptr[4], *m_ptr[4];
+    unsigned char *ct_ptr[4], *jinv_ptr[4], *esk_ptr[4], *h_ptr[4], *ss_ptr[4];
+    unsigned int i, j;
+
+    for (j = 0; j < 4; j++) {
+        sk_ptr[j] = ephemeralsk[j];
+        esk_ptr[j] = ephemeralsk[j];
+        pk_ptr[j] = pk + j*CRYPTO_PUBLICKEYBYTES;
+        m_ptr[j] = m[j];
+        ct_ptr[j] = ct + j*CRYPTO_CIPHERTEXTBYTES;
+        jinv_ptr[j] = jinvariant[j];
+        h_ptr[j] = h[j];
+        ss_ptr[j] = ss + j*CRYPTO_BYTES;
+
+        randombytes(m[j], MSG_BYTES);
+#ifdef DO_VALGRIND_CHECK
+        VALGRIND_MAKE_MEM_UNDEFINED(m[j], MSG_BYTES);
+#endif
+    }
+
+    // Generate ephemeralsk <- G(m||pk) mod oA, the four hashes are computed with the 4-way SHAKE256
+    shake256x4_concat(esk_ptr, SECRETKEY_A_BYTES, m_ptr, MSG_BYTES, pk_ptr, CRYPTO_PUBLICKEYBYTES);
+    for (j = 0; j < 4; j++) {
+        ephemeralsk[j][SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+    }
+
+    // Encrypt
+    EphemeralKeyGeneration_A_x4(sk_ptr, ct_ptr);
+    EphemeralSecretAgreement_A_x4(sk_ptr, pk_ptr, jinv_ptr);
+    shake256x4(h_ptr, MSG_BYTES, (const unsigned char* const*)jinv_ptr, FP2_ENCODED_BYTES);
+    for (j = 0; j < 4; j++) {
+        for (i = 0; i < MSG_BYTES; i++) {
+            ct_ptr[j][i + CRYPTO_PUBLICKEYBYTES] = m[j][i] ^ h[j][i];
+        }
+    }
+
+    // Generate shared secret ss <- H(m||ct)
+    shake256x4_concat(ss_ptr, CRYPTO_BYTES, m_ptr, MSG_BYTES, (const unsigned char* const*)ct_ptr, CRYPTO_CIPHERTEXTBYTES);
+#ifdef DO_VALGRIND_CHECK
+    for (j = 0; j < 4; j++) {
+        VALGRIND_MAKE_MEM_DEFINED(m[j], MSG_BYTES);
+    }
+#endif
+#else
+    for (unsigned int j = 0; j < 4; j++) {
+        crypto_kem_enc(ct + j*CRYPTO_CIPHERTEXTBYTES, ss + j*CRYPTO_BYTES, pk + j*CRYPTO_PUBLICKEYBYTES);
+    }
+#endif
+    return 0;
+}
+
+
+int crypto_kem_dec_batch4(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // SIKE's decapsulation of four ciphertexts under the same secret key
+  // Input:   secret key sk          (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
+  //          ciphertext messages ct (4*CRYPTO_CIPHERTEXTBYTES bytes, the j-th ciphertext is located at ct + j*CRYPTO_CIPHERTEXTBYTES)
+  // Outputs: shared secrets ss      (4*CRYPTO_BYTES bytes, the j-th secret is located at ss + j*CRYPTO_BYTES)
+#if defined(AVX2_X4_IMPLEMENTATION)
+    unsigned char ephemeralsk_[4][SECRETKEY_A_BYTES];
+    unsigned char jinvariant_[4][FP2_ENCODED_BYTES];
+    unsigned char h_[4][MSG_BYTES];
+    unsigned char c0_[4][CRYPTO_PUBLICKEYBYTES];
+    unsigned char m[4][MSG_BYTES];
+    const unsigned char *skB_ptr[4], *skA_ptr[4], *pkB_ptr[4], *ct_ptr[4], *m_ptr[4];
+    unsigned char *c0_ptr[4], *jinv_ptr[4], *esk_ptr[4], *h_ptr[4], *ss_ptr[4];
+    unsigned int i, j;
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_UNDEFINED(sk, CRYPTO_SECRETKEYBYTES);
+#endif
+
+    for (j = 0; j < 4; j++) {
+        skB_ptr[j] = sk + MSG_BYTES;
+        skA_ptr[j] = ephemeralsk_[j];
+        pkB_ptr[j] = &sk[MSG_BYTES + SECRETKEY_B_BYTES];
+        ct_ptr[j] = ct + j*CRYPTO_CIPHERTEXTBYTES;
+        m_ptr[j] = m[j];
+        c0_ptr[j] = c0_[j];
+        jinv_ptr[j] = jinvariant_[j];
+        esk_ptr[j] = ephemeralsk_[j];
+        h_ptr[j] = h_[j];
+        ss_ptr[j] = ss + j*CRYPTO_BYTES;
+    }
+
+    // Decrypt
+    EphemeralSecretAgreement_B_x4(skB_ptr, ct_ptr, jinv_ptr);
+    shake256x4(h_ptr, MSG_BYTES, (const unsigned char* const*)jinv_ptr, FP2_ENCODED_BYTES);
+    for (j = 0; j < 4; j++) {
+        for (i = 0; i < MSG_BYTES; i++) {
+            m[j][i] = ct_ptr[j][i + CRYPTO_PUBLICKEYBYTES] ^ h_[j][i];
+        }
+    }
+
+    // Generate ephemeralsk_ <- G(m||pk) mod oA
+    shake256x4_concat(esk_ptr, SECRETKEY_A_BYTES, m_ptr, MSG_BYTES, pkB_ptr, CRYPTO_PUBLICKEYBYTES);
+    for (j = 0; j < 4; j++) {
+        ephemeralsk_[j][SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+    }
+
+    // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
+    EphemeralKeyGeneration_A_x4(skA_ptr, c0_ptr);
+    for (j = 0; j < 4; j++) {
+        // If selector = 0 then do ss = H(m||ct), else if selector = -1 load s to do ss = H(s||ct)
+        int8_t selector = ct_compare(c0_[j], ct_ptr[j], CRYPTO_PUBLICKEYBYTES);
+        ct_cmov(m[j], sk, MSG_BYTES, selector);
+    }
+    shake256x4_concat(ss_ptr, CRYPTO_BYTES, m_ptr, MSG_BYTES, ct_ptr, CRYPTO_CIPHERTEXTBYTES);
+
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_DEFINED(sk, CRYPTO_SECRETKEYBYTES);
+#endif
+#else
+    for (unsigned int j = 0; j < 4; j++) {
+        crypto_kem_dec(ss + j*CRYPTO_BYTES, ct + j*CRYPTO_CIPHERTEXTBYTES, sk);
+    }
+#endif
+    return 0;
+}
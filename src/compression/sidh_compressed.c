@@ -50,11 +50,36 @@ void random_mod_order_B(unsigned char* random_digits)
 }
 
 
-static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2elm_t a24, unsigned int sike)
+#define MAX_INT_POINTS ((MAX_INT_POINTS_ALICE > MAX_INT_POINTS_BOB) ? MAX_INT_POINTS_ALICE : MAX_INT_POINTS_BOB)
+
+typedef struct {
+    union {
+        f2elm_t As[MAX_Alice+1][5];    // Alice's key generation: curve constants and dual 4-isogeny data of every row of the tree
+        f2elm_t Ds[MAX_Bob][2];        // Bob's key generation: kernels of the dual 3-isogenies
+    } dual;
+    point_proj_t pts[MAX_INT_POINTS];  // Intermediate points of the tree traversals
+} sidh_workspace_t;                    // Layout of the caller-provided workspace of the _ws functions
+
+// The public bound SIKE_WORKSPACE_BYTES must be large enough to hold sidh_workspace_t
+typedef char sidh_workspace_size_check[(sizeof(sidh_workspace_t) <= SIKE_WORKSPACE_BYTES) ? 1 : -1];
+
+
+static sidh_workspace_t* get_workspace(void* workspace, size_t workspace_bytes)
+{ // Returns the caller-provided workspace, or NULL if it is too small or is not 8-byte aligned
+
+    if ((workspace == NULL) || (workspace_bytes < sizeof(sidh_workspace_t)) || (((uintptr_t)workspace & 7) != 0)) {
+        return NULL;
+    }
+    return (sidh_workspace_t*)workspace;
+}
+
+
+static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2elm_t a24, unsigned int sike, point_proj_t* pts)
 {
   // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
   // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
-    point_proj_t R, pts[MAX_INT_POINTS_ALICE];
+  // The intermediate points of the tree traversal are stored in pts, with room for MAX_INT_POINTS_ALICE points.
+    point_proj_t R;
     f2elm_t XPA, XQA, XRA, coeff[5], A24 = {0}, C24 = {0}, A = {0};
     unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
     digit_t SecretKeyA[NWORDS_ORDER] = {0};
@@ -71,7 +96,11 @@ static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2el
     
     // Retrieve kernel point
     decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
+#if defined(FIXED_BASIS_LADDER)
+    LADDER3PT_fixed(XPA, XRA, A_ladder_table, SecretKeyA, ALICE, R);
+#else
     LADDER3PT(XPA, XQA, XRA, SecretKeyA, ALICE, R, A);
+#endif
     fp2inv_mont(R->Z);
     fp2mul_mont(R->X,R->Z,R->X);
     fpcopy((digit_t*)&Montgomery_one, R->Z[0]);
@@ -175,7 +204,7 @@ static void PKADecompression_dual(const unsigned char* SecretKeyB, const unsigne
     if (bit == 0) {    
         Montgomery_multiply_mod_order(t1, t3, t3, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
         mp_add(t3, vone, t3, NWORDS_ORDER);
-        Montgomery_inversion_mod_order_bingcd(t3, t3, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
+        Montgomery_inversion_mod_order_ct(t3, t3, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
         Montgomery_multiply_mod_order(t1, t4, t4, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
         mp_add(t2, t4, t4, NWORDS_ORDER);
         Montgomery_multiply_mod_order(t3, t4, t3, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
@@ -184,7 +213,7 @@ static void PKADecompression_dual(const unsigned char* SecretKeyB, const unsigne
     } else {   
         Montgomery_multiply_mod_order(t1, t4, t4, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
         mp_add(t4, vone, t4, NWORDS_ORDER);
-        Montgomery_inversion_mod_order_bingcd(t4, t4, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
+        Montgomery_inversion_mod_order_ct(t4, t4, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
         Montgomery_multiply_mod_order(t1, t3, t3, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
         mp_add(t2, t3, t3, NWORDS_ORDER);
         Montgomery_multiply_mod_order(t3, t4, t3, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
@@ -213,7 +242,7 @@ static void Compress_PKA_dual(digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1
     to_Montgomery_mod_order(d1, d1, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
     
     if (bit != 0) {  // Storing [d1*c0inv, c1*c0inv, d0*c0inv] and setting bit "NBITS_ORDER" to 0   
-        Montgomery_inversion_mod_order_bingcd(d1, inv, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
+        Montgomery_inversion_mod_order_ct(d1, inv, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
         Montgomery_neg(d0, (digit_t*)&Bob_order);
         Montgomery_multiply_mod_order(d0, inv, temp, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
         from_Montgomery_mod_order(temp, temp, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);                    // Converting back from Montgomery representation
@@ -227,7 +256,7 @@ static void Compress_PKA_dual(digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1
         encode_to_bytes(temp, &CompressedPKA[2*ORDER_B_ENCODED_BYTES], ORDER_B_ENCODED_BYTES);
         CompressedPKA[3*ORDER_B_ENCODED_BYTES + FP2_ENCODED_BYTES] = 0x00;
     } else {  // Storing [d1*d0inv, c1*d0inv, c0*d0inv] and setting bit "NBITS_ORDER" to 1
-        Montgomery_inversion_mod_order_bingcd(d0, inv, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
+        Montgomery_inversion_mod_order_ct(d0, inv, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2, (digit_t*)&Montgomery_RB1);
         Montgomery_neg(d1, (digit_t*)&Bob_order);
         Montgomery_multiply_mod_order(d1, inv, temp, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);
         from_Montgomery_mod_order(temp, temp, (digit_t*)Bob_order, (digit_t*)&Montgomery_RB2);                     // Converting back from Montgomery representation         
@@ -249,16 +278,17 @@ static void Compress_PKA_dual(digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1
 }
 
 
-static int EphemeralKeyGeneration_A_extended(unsigned char* PrivateKeyA, unsigned char* CompressedPKA)
-{ // Alice's ephemeral public key generation using compression -- SIKE protocol
-  // Output: PrivateKeyA[MSG_BYTES + SECRETKEY_A_BYTES] <- x(K_A) where K_A = PA + sk_A*Q_A 
+static int EphemeralKeyGeneration_A_extended(unsigned char* PrivateKeyA, unsigned char* CompressedPKA, unsigned int sike, f2elm_t As[][5], point_proj_t* pts)
+{ // Alice's ephemeral public key generation using compression
+  // If sike = 1 (SIKE protocol), it outputs PrivateKeyA[MSG_BYTES + SECRETKEY_A_BYTES] <- x(K_A) where K_A = PA + sk_A*Q_A 
+  // Temporaries: As with MAX_Alice+1 rows and pts with room for MAX_INT_POINTS_ALICE points
     unsigned int rs[3];
     int D[DLEN_3];
-    f2elm_t a24, As[MAX_Alice+1][5], f[4];
+    f2elm_t a24, f[4];
     digit_t c0[NWORDS_ORDER] = {0}, d0[NWORDS_ORDER] = {0}, c1[NWORDS_ORDER] = {0}, d1[NWORDS_ORDER] = {0}; 
     point_full_proj_t Rs[2];
 
-    FullIsogeny_A_dual(PrivateKeyA, As, a24, 1);
+    FullIsogeny_A_dual(PrivateKeyA, As, a24, sike, pts);
     BuildOrdinary3nBasis_dual(a24, As, Rs, rs, &rs[2]);
     Tate3_pairings(Rs, f);
     Dlogs3_dual(f, D, d0, c0, d1, c1);
@@ -267,33 +297,39 @@ static int EphemeralKeyGeneration_A_extended(unsigned char* PrivateKeyA, unsigne
 }
 
 
+int EphemeralKeyGeneration_A_ws(const unsigned char* PrivateKeyA, unsigned char* CompressedPKA, void* workspace, size_t workspace_bytes)
+{ // Alice's ephemeral public key generation using compression and a caller-provided workspace -- SIDH protocol
+  // Returns -1 if the workspace is too small or is not 8-byte aligned
+    sidh_workspace_t* ws = get_workspace(workspace, workspace_bytes);
+
+    if (ws == NULL) {
+        return -1;
+    }
+    EphemeralKeyGeneration_A_extended((unsigned char*)PrivateKeyA, CompressedPKA, 0, ws->dual.As, ws->pts);
+    clear_words((void*)ws, sizeof(sidh_workspace_t)/sizeof(digit_t));
+    return 0;
+}
+
+
 int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* CompressedPKA)
 { // Alice's ephemeral public key generation using compression -- SIDH protocol
-  // Output: PrivateKeyA[MSG_BYTES + SECRETKEY_A_BYTES] <- x(K_A) where K_A = PA + sk_A*Q_A 
-    unsigned int rs[3];
-    int D[DLEN_3];
-    f2elm_t a24, As[MAX_Alice+1][5], f[4];
-    digit_t c0[NWORDS_ORDER] = {0}, d0[NWORDS_ORDER] = {0}, c1[NWORDS_ORDER] = {0}, d1[NWORDS_ORDER] = {0}; 
-    point_full_proj_t Rs[2];
+    f2elm_t As[MAX_Alice+1][5];
+    point_proj_t pts[MAX_INT_POINTS_ALICE];
 
-    FullIsogeny_A_dual((unsigned char*)PrivateKeyA, As, a24, 0);
-    BuildOrdinary3nBasis_dual(a24, As, Rs, rs, &rs[2]);
-    Tate3_pairings(Rs, f);
-    Dlogs3_dual(f, D, d0, c0, d1, c1);
-    Compress_PKA_dual(d0, c0, d1, c1, a24, rs, CompressedPKA);
-    return 0;
+    return EphemeralKeyGeneration_A_extended((unsigned char*)PrivateKeyA, CompressedPKA, 0, As, pts);
 }
 
 
-int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PKA, unsigned char* SharedSecretB)
+static int EphemeralSecretAgreement_B_extended(const unsigned char* PrivateKeyB, const unsigned char* PKA, unsigned char* SharedSecretB, point_proj_t* pts)
 { // Bob's ephemeral shared secret computation using compression
   // It produces a shared secret key SharedSecretB using his secret key PrivateKeyB and Alice's decompressed data point_R and param_A
   // Inputs: Bob's PrivateKeyB is an integer in the range [1, oB-1], where oB = 3^OBOB_EXP. 
   //         Alice's decompressed data consists of point_R in (X:Z) coordinates and the curve parameter param_A in GF(p^2).
   // Output: a shared secret SharedSecretB that consists of one element in GF(p^2). 
+  // The intermediate points of the tree traversal are stored in pts, with room for MAX_INT_POINTS_BOB points.
     unsigned int i, ii = 0, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0;
     f2elm_t A24plus = {0}, A24minus = {0};
-    point_proj_t R, pts[MAX_INT_POINTS_BOB];
+    point_proj_t R;
     f2elm_t jinv, A, coeff[3];
     f2elm_t param_A = {0};
 
@@ -338,11 +374,34 @@ int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
 }
 
 
-static void FullIsogeny_B_dual(const unsigned char* PrivateKeyB, f2elm_t Ds[][2], f2elm_t A)
+int EphemeralSecretAgreement_B_ws(const unsigned char* PrivateKeyB, const unsigned char* PKA, unsigned char* SharedSecretB, void* workspace, size_t workspace_bytes)
+{ // Bob's ephemeral shared secret computation using compression and a caller-provided workspace
+  // Returns -1 if the workspace is too small or is not 8-byte aligned
+    sidh_workspace_t* ws = get_workspace(workspace, workspace_bytes);
+
+    if (ws == NULL) {
+        return -1;
+    }
+    EphemeralSecretAgreement_B_extended(PrivateKeyB, PKA, SharedSecretB, ws->pts);
+    clear_words((void*)ws, sizeof(sidh_workspace_t)/sizeof(digit_t));
+    return 0;
+}
+
+
+int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PKA, unsigned char* SharedSecretB)
+{ // Bob's ephemeral shared secret computation using compression
+    point_proj_t pts[MAX_INT_POINTS_BOB];
+
+    return EphemeralSecretAgreement_B_extended(PrivateKeyB, PKA, SharedSecretB, pts);
+}
+
+
+static void FullIsogeny_B_dual(const unsigned char* PrivateKeyB, f2elm_t Ds[][2], f2elm_t A, point_proj_t* pts)
 { // Bob's ephemeral public key generation
   // Input:  a private key PrivateKeyB in the range [0, 2^Floor(Log(2,oB)) - 1]. 
   // Output: the public key PublicKeyB consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
-    point_proj_t R = {0}, Q3 = {0}, pts[MAX_INT_POINTS_BOB];
+  // The intermediate points of the tree traversal are stored in pts, with room for MAX_INT_POINTS_BOB points.
+    point_proj_t R = {0}, Q3 = {0};
     f2elm_t XPB, XQB, XRB, coeff[3], A24plus = {0}, A24minus = {0};
     unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
     digit_t SecretKeyB[NWORDS_ORDER] = {0};
@@ -617,16 +676,18 @@ static void Compress_PKB_dual(digit_t *d0, digit_t *c0, digit_t *d1, digit_t *c1
 }
 
 
-static int EphemeralKeyGeneration_B_extended(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB, unsigned int sike)
+static int EphemeralKeyGeneration_B_extended(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB, unsigned int sike, f2elm_t Ds[][2], point_proj_t* pts)
 { // Bob's ephemeral public key generation using compression -- SIKE protocol
+  // Temporaries: Ds with MAX_Bob rows and pts with room for MAX_INT_POINTS_BOB points
     unsigned char qnr, ind;
     int D[DLEN_2] = {0};
     digit_t c0[NWORDS_ORDER] = {0}, d0[NWORDS_ORDER] = {0}, c1[NWORDS_ORDER] = {0}, d1[NWORDS_ORDER] = {0}; 
-    f2elm_t Ds[MAX_Bob][2] = {0}, f[4] = {0}, A = {0};
+    f2elm_t f[4] = {0}, A = {0};
     point_full_proj_t Rs[2] = {0};
     point_t Pw, Qw;
 
-    FullIsogeny_B_dual(PrivateKeyB, Ds, A);
+    memset(Ds, 0, MAX_Bob*sizeof(Ds[0]));
+    FullIsogeny_B_dual(PrivateKeyB, Ds, A, pts);
     BuildOrdinary2nBasis_dual(A, Ds, Rs, &qnr, &ind);  // Generate a basis in E_A and pulls it back to E_A6. Rs[0] and Rs[1] affinized.
 
     // Maps from y^2 = x^3 + 6x^2 + x into y^2 = x^3 -11x + 14
@@ -659,18 +720,35 @@ static int EphemeralKeyGeneration_B_extended(const unsigned char* PrivateKeyB, u
 }
 
 
+int EphemeralKeyGeneration_B_ws(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB, void* workspace, size_t workspace_bytes)
+{ // Bob's ephemeral public key generation using compression and a caller-provided workspace -- SIDH protocol
+  // Returns -1 if the workspace is too small or is not 8-byte aligned
+    sidh_workspace_t* ws = get_workspace(workspace, workspace_bytes);
+
+    if (ws == NULL) {
+        return -1;
+    }
+    EphemeralKeyGeneration_B_extended(PrivateKeyB, CompressedPKB, 0, ws->dual.Ds, ws->pts);
+    clear_words((void*)ws, sizeof(sidh_workspace_t)/sizeof(digit_t));
+    return 0;
+}
+
+
 int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* CompressedPKB)
 { // Bob's ephemeral public key generation using compression -- SIDH protocol
+    f2elm_t Ds[MAX_Bob][2];
+    point_proj_t pts[MAX_INT_POINTS_BOB];
 
-    return EphemeralKeyGeneration_B_extended(PrivateKeyB, CompressedPKB, 0);
+    return EphemeralKeyGeneration_B_extended(PrivateKeyB, CompressedPKB, 0, Ds, pts);
 }
 
 
-static int EphemeralSecretAgreement_A_extended(const unsigned char* PrivateKeyA, const unsigned char* PKB, unsigned char* SharedSecretA, unsigned int sike)
+static int EphemeralSecretAgreement_A_extended(const unsigned char* PrivateKeyA, const unsigned char* PKB, unsigned char* SharedSecretA, unsigned int sike, point_proj_t* pts)
 { // Alice's ephemeral shared secret computation using compression -- SIKE protocol
+  // The intermediate points of the tree traversal are stored in pts, with room for MAX_INT_POINTS_ALICE points.
     unsigned int i, ii = 0, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0;
     f2elm_t A24plus = {0}, C24 = {0};
-    point_proj_t R, pts[MAX_INT_POINTS_ALICE];
+    point_proj_t R;
     f2elm_t jinv, coeff[5], A;
     f2elm_t param_A = {0};
 
@@ -726,20 +804,36 @@ static int EphemeralSecretAgreement_A_extended(const unsigned char* PrivateKeyA,
 }
 
 
+int EphemeralSecretAgreement_A_ws(const unsigned char* PrivateKeyA, const unsigned char* PKB, unsigned char* SharedSecretA, void* workspace, size_t workspace_bytes)
+{ // Alice's ephemeral shared secret computation using compression and a caller-provided workspace -- SIDH protocol
+  // Returns -1 if the workspace is too small or is not 8-byte aligned
+    sidh_workspace_t* ws = get_workspace(workspace, workspace_bytes);
+
+    if (ws == NULL) {
+        return -1;
+    }
+    EphemeralSecretAgreement_A_extended(PrivateKeyA, PKB, SharedSecretA, 0, ws->pts);
+    clear_words((void*)ws, sizeof(sidh_workspace_t)/sizeof(digit_t));
+    return 0;
+}
+
+
 int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned char* PKB, unsigned char* SharedSecretA)
 { // Alice's ephemeral shared secret computation using compression -- SIDH protocol
   // It produces a shared secret key SharedSecretA using her secret key PrivateKeyA and Bob's decompressed data point_R and param_A
   // Inputs: Alice's PrivateKeyA is an even integer in the range [2, oA-2], where oA = 2^OALICE_BITS. 
   //         Bob's decompressed data consists of point_R in (X:Z) coordinates and the curve parameter param_A in GF(p^2).
   // Output: a shared secret SharedSecretA that consists of one element in GF(p^2).
+    point_proj_t pts[MAX_INT_POINTS_ALICE];
 
-    return EphemeralSecretAgreement_A_extended(PrivateKeyA, PKB, SharedSecretA, 0);
+    return EphemeralSecretAgreement_A_extended(PrivateKeyA, PKB, SharedSecretA, 0, pts);
 }
 
 
-int8_t validate_ciphertext(const unsigned char* ephemeralsk_, const unsigned char* CompressedPKB, const unsigned char* xKA, const unsigned char* tphiBKA_t)
+int8_t validate_ciphertext(const unsigned char* ephemeralsk_, const unsigned char* CompressedPKB, const unsigned char* xKA, const unsigned char* tphiBKA_t, point_proj_t* pts)
 { // If ct validation passes returns 0, otherwise returns -1.
-    point_proj_t phis[3] = {0}, R, S, pts[MAX_INT_POINTS_BOB];
+  // The intermediate points of the tree traversal are stored in pts, with room for MAX_INT_POINTS_BOB points.
+    point_proj_t phis[3] = {0}, R, S;
     f2elm_t XPB, XQB, XRB, coeff[3], A24plus = {0}, A24minus = {0}, A = {0}, comp1 = {0}, comp2 = {0}, one = {0};
     digit_t temp[NWORDS_ORDER] = {0}, sk[NWORDS_ORDER] = {0};
     unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
@@ -6,9 +6,10 @@
 
 #include <string.h>
 #include "../sha3/fips202.h"
+#include "../threads/threadpool.h"
 
 
-int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
+static void kem_keypair(unsigned char *pk, unsigned char *sk, f2elm_t As[][5], point_proj_t* pts)
 { // SIKE's key generation using compression
   // Outputs: secret key sk (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES + FP2_ENCODED_BYTES bytes)
   //          public key pk_comp (CRYPTO_PUBLICKEYBYTES bytes) 
@@ -18,16 +19,38 @@ int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
     random_mod_order_A(sk + MSG_BYTES);    // Even random number
 
     // Generate public key pk
-    EphemeralKeyGeneration_A_extended(sk + MSG_BYTES, pk);
+    EphemeralKeyGeneration_A_extended(sk + MSG_BYTES, pk, 1, As, pts);
 
     // Append public key pk to secret key sk
     memcpy(&sk[MSG_BYTES + SECRETKEY_A_BYTES], pk, CRYPTO_PUBLICKEYBYTES);
+}
+
+
+int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation using compression
+    f2elm_t As[MAX_Alice+1][5];
+    point_proj_t pts[MAX_INT_POINTS_ALICE];
 
+    kem_keypair(pk, sk, As, pts);
     return 0;
 }
 
 
-int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+int crypto_kem_keypair_ws(unsigned char *pk, unsigned char *sk, void *workspace, size_t workspace_bytes)
+{ // SIKE's key generation using compression and a caller-provided workspace of at least SIKE_WORKSPACE_BYTES bytes, aligned to 8 bytes
+  // Returns -1 if the workspace is too small or is not 8-byte aligned
+    sidh_workspace_t* ws = get_workspace(workspace, workspace_bytes);
+
+    if (ws == NULL) {
+        return -1;
+    }
+    kem_keypair(pk, sk, ws->dual.As, ws->pts);
+    clear_words((void*)ws, sizeof(sidh_workspace_t)/sizeof(digit_t));
+    return 0;
+}
+
+
+static void kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk, f2elm_t Ds[][2], point_proj_t* pts)
 { // SIKE's encapsulation using compression
   // Input:   public key pk              (CRYPTO_PUBLICKEYBYTES bytes)
   // Outputs: shared secret ss           (CRYPTO_BYTES bytes)
@@ -35,61 +58,152 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
     unsigned char ephemeralsk[SECRETKEY_B_BYTES] = {0};
     unsigned char jinvariant[FP2_ENCODED_BYTES] = {0};
     unsigned char h[MSG_BYTES];
-    unsigned char temp[CRYPTO_CIPHERTEXTBYTES + MSG_BYTES] = {0};
+    unsigned char m[MSG_BYTES] = {0};
 
     // Generate ephemeralsk <- G(m||pk) mod oB 
-    randombytes(temp, MSG_BYTES);    
-    memcpy(&temp[MSG_BYTES], pk, CRYPTO_PUBLICKEYBYTES);        
-    shake256(ephemeralsk, SECRETKEY_B_BYTES, temp, MSG_BYTES + CRYPTO_PUBLICKEYBYTES);
+    randombytes(m, MSG_BYTES);    
+    shake256_concat(ephemeralsk, SECRETKEY_B_BYTES, m, MSG_BYTES, pk, CRYPTO_PUBLICKEYBYTES);
     FormatPrivKey_B(ephemeralsk);
     
     // Encrypt
-    EphemeralKeyGeneration_B_extended(ephemeralsk, ct, 1); 
+    EphemeralKeyGeneration_B_extended(ephemeralsk, ct, 1, Ds, pts); 
+    EphemeralSecretAgreement_B_extended(ephemeralsk, pk, jinvariant, pts);  
+    shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);          
+    for (int i = 0; i < MSG_BYTES; i++) {
+        ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] = m[i] ^ h[i];
+    }
+
+    // Generate shared secret ss <- H(m||ct)
+    shake256_concat(ss, CRYPTO_BYTES, m, MSG_BYTES, ct, CRYPTO_CIPHERTEXTBYTES);
+}
+
+
+int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation using compression
+    f2elm_t Ds[MAX_Bob][2];
+    point_proj_t pts[MAX_INT_POINTS_BOB];
+
+    kem_enc(ct, ss, pk, Ds, pts);
+    return 0;
+}
+
+
+int crypto_kem_enc_ws(unsigned char *ct, unsigned char *ss, const unsigned char *pk, void *workspace, size_t workspace_bytes)
+{ // SIKE's encapsulation using compression and a caller-provided workspace of at least SIKE_WORKSPACE_BYTES bytes, aligned to 8 bytes
+  // Returns -1 if the workspace is too small or is not 8-byte aligned
+    sidh_workspace_t* ws = get_workspace(workspace, workspace_bytes);
+
+    if (ws == NULL) {
+        return -1;
+    }
+    kem_enc(ct, ss, pk, ws->dual.Ds, ws->pts);
+    clear_words((void*)ws, sizeof(sidh_workspace_t)/sizeof(digit_t));
+    return 0;
+}
+
+
+typedef struct {
+    const unsigned char *ephemeralsk;
+    unsigned char *ct;
+} kem_enc_keygen_t;
+
+
+static void kem_enc_keygen_task(void *arg)
+{ // Ephemeral key generation half of crypto_kem_enc_parallel, run on the thread pool
+    kem_enc_keygen_t *t = (kem_enc_keygen_t*)arg;
+    f2elm_t Ds[MAX_Bob][2];
+    point_proj_t pts[MAX_INT_POINTS_BOB];
+
+    EphemeralKeyGeneration_B_extended(t->ephemeralsk, t->ct, 1, Ds, pts);
+}
+
+
+int crypto_kem_enc_parallel(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation using compression and two threads
+  // The ephemeral key generation runs on the library's thread pool while the calling thread computes the shared secret.
+  // Input:   public key pk              (CRYPTO_PUBLICKEYBYTES bytes)
+  // Outputs: shared secret ss           (CRYPTO_BYTES bytes)
+  //          ciphertext message ct      (CRYPTO_CIPHERTEXTBYTES = PARTIALLY_COMPRESSED_CHUNK_CT + MSG_BYTES bytes)
+    unsigned char ephemeralsk[SECRETKEY_B_BYTES] = {0};
+    unsigned char jinvariant[FP2_ENCODED_BYTES] = {0};
+    unsigned char h[MSG_BYTES];
+    unsigned char m[MSG_BYTES] = {0};
+    kem_enc_keygen_t keygen;
+    threadpool_job_t job;
+
+    // Generate ephemeralsk <- G(m||pk) mod oB 
+    randombytes(m, MSG_BYTES);    
+    shake256_concat(ephemeralsk, SECRETKEY_B_BYTES, m, MSG_BYTES, pk, CRYPTO_PUBLICKEYBYTES);
+    FormatPrivKey_B(ephemeralsk);
+    
+    // Encrypt, both halves only depend on ephemeralsk
+    keygen.ephemeralsk = ephemeralsk;
+    keygen.ct = ct;
+    threadpool_submit(&job, kem_enc_keygen_task, &keygen);
     EphemeralSecretAgreement_B(ephemeralsk, pk, jinvariant);  
+    threadpool_wait(&job);
     shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);          
     for (int i = 0; i < MSG_BYTES; i++) {
-        ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] = temp[i] ^ h[i];
+        ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] = m[i] ^ h[i];
     }
 
     // Generate shared secret ss <- H(m||ct)
-    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);      
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES + MSG_BYTES);
+    shake256_concat(ss, CRYPTO_BYTES, m, MSG_BYTES, ct, CRYPTO_CIPHERTEXTBYTES);
 
     return 0;
 }
 
 
-int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+static void kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, point_proj_t* pts)
 { // SIKE's decapsulation using compression 
   // Input:   secret key sk                         (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES + FP2_ENCODED_BYTES bytes)
   //          compressed ciphertext message ct      (CRYPTO_CIPHERTEXTBYTES = PARTIALLY_COMPRESSED_CHUNK_CT + MSG_BYTES bytes) 
   // Outputs: shared secret ss                      (CRYPTO_BYTES bytes)
     unsigned char ephemeralsk_[SECRETKEY_B_BYTES] = {0};
     unsigned char jinvariant_[FP2_ENCODED_BYTES + 2*FP2_ENCODED_BYTES + SECRETKEY_A_BYTES] = {0}, h_[MSG_BYTES];
-    unsigned char temp[CRYPTO_CIPHERTEXTBYTES + MSG_BYTES] = {0};   
+    unsigned char m[MSG_BYTES] = {0};   
     unsigned char* tphiBKA_t = &jinvariant_[FP2_ENCODED_BYTES];
     
     // Decrypt 
-    EphemeralSecretAgreement_A_extended(sk + MSG_BYTES, ct, jinvariant_, 1);  
+    EphemeralSecretAgreement_A_extended(sk + MSG_BYTES, ct, jinvariant_, 1, pts);  
     shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);   
     
     for (int i = 0; i < MSG_BYTES; i++) {
-        temp[i] = ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] ^ h_[i];                         
+        m[i] = ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] ^ h_[i];                         
     }     
     
     // Generate ephemeralsk_ <- G(m||pk) mod oB
-    memcpy(&temp[MSG_BYTES], &sk[MSG_BYTES + SECRETKEY_A_BYTES], CRYPTO_PUBLICKEYBYTES);            
-    shake256(ephemeralsk_, SECRETKEY_B_BYTES, temp, MSG_BYTES + CRYPTO_PUBLICKEYBYTES);
+    shake256_concat(ephemeralsk_, SECRETKEY_B_BYTES, m, MSG_BYTES, &sk[MSG_BYTES + SECRETKEY_A_BYTES], CRYPTO_PUBLICKEYBYTES);
     FormatPrivKey_B(ephemeralsk_);
     
     // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
     // No need to recompress, just check if x(phi(P) + t*phi(Q)) == x((a0 + t*a1)*R1 + (b0 + t*b1)*R2)    
-    int8_t selector = validate_ciphertext(ephemeralsk_, ct, &sk[MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES], tphiBKA_t);
+    int8_t selector = validate_ciphertext(ephemeralsk_, ct, &sk[MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES], tphiBKA_t, pts);
     // If ct validation passes (selector = 0) then do ss = H(m||ct), otherwise (selector = -1) load s to do ss = H(s||ct)
-    ct_cmov(temp, sk, MSG_BYTES, selector);
-    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);  
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES + MSG_BYTES);
+    ct_cmov(m, sk, MSG_BYTES, selector);
+    shake256_concat(ss, CRYPTO_BYTES, m, MSG_BYTES, ct, CRYPTO_CIPHERTEXTBYTES);
+}
+
 
+int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // SIKE's decapsulation using compression 
+    point_proj_t pts[MAX_INT_POINTS];
+
+    kem_dec(ss, ct, sk, pts);
+    return 0;
+}
+
+
+int crypto_kem_dec_ws(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, void *workspace, size_t workspace_bytes)
+{ // SIKE's decapsulation using compression and a caller-provided workspace of at least SIKE_WORKSPACE_BYTES bytes, aligned to 8 bytes
+  // Returns -1 if the workspace is too small or is not 8-byte aligned
+    sidh_workspace_t* ws = get_workspace(workspace, workspace_bytes);
+
+    if (ws == NULL) {
+        return -1;
+    }
+    kem_dec(ss, ct, sk, ws->pts);
+    clear_words((void*)ws, sizeof(sidh_workspace_t)/sizeof(digit_t));
     return 0;
 }
 
@@ -92,10 +92,104 @@
 
 #if defined(_GENERIC_)                      
     #define GENERIC_IMPLEMENTATION
+#elif defined(_PORTABLE_FAST_)
+    #define PORTABLE_FAST_IMPLEMENTATION
 #elif defined(_FAST_)                      
     #define FAST_IMPLEMENTATION
 #endif
 
+// The portable fast implementation is written in C with 64-bit digits, 128-bit products and carry intrinsics
+#if defined(PORTABLE_FAST_IMPLEMENTATION) && ((RADIX != 64) || !defined(__SIZEOF_INT128__))
+    #error -- "OPT_LEVEL=PORTABLE_FAST requires a 64-bit target and a compiler supporting unsigned __int128"
+#endif
+
+
+// Selection of run-time dispatch between the x64 kernel variants (USE_DISPATCH=TRUE)
+
+#if (TARGET == TARGET_AMD64) && (OS_TARGET == OS_NIX) && defined(FAST_IMPLEMENTATION) && defined(_DISPATCH_)
+    #define X64_DISPATCH_IMPLEMENTATION
+
+    #define X64_KERNELS_PLAIN   0           // Baseline x64 instructions only
+    #define X64_KERNELS_MULX    1           // Requires BMI2 (MULX)
+    #define X64_KERNELS_ADX     2           // Requires BMI2 and ADX (MULX, ADCX, ADOX)
+
+    typedef struct {                        // Field arithmetic kernels of one variant, selected once at load time
+        void (*modadd)(const digit_t* a, const digit_t* b, digit_t* c);
+        void (*modsub)(const digit_t* a, const digit_t* b, digit_t* c);
+        void (*mpadd)(const digit_t* a, const digit_t* b, digit_t* c);
+        void (*mpsub_p2)(const digit_t* a, const digit_t* b, digit_t* c);
+        void (*mpsub_p4)(const digit_t* a, const digit_t* b, digit_t* c);
+        void (*mpsubaddx2)(const digit_t* a, const digit_t* b, digit_t* c);
+        void (*mpdblsubx2)(const digit_t* a, const digit_t* b, digit_t* c);
+        void (*mul)(const digit_t* a, const digit_t* b, digit_t* c);
+        void (*sqr)(const digit_t* a, digit_t* c);
+        void (*rdc)(digit_t* ma, digit_t* mc);
+        unsigned int variant;
+    } x64_kernels_t;
+#endif
+
+
+// Selection of the 4-way AVX2 implementations: the 4-way Keccak-f[1600] used by shake256x4, and the 4-way field, curve and
+// isogeny functions used by the batched SIKE functions. The latter are slower per operation than the scalar x64 assembly kernels
+// (MULX and ADX) of OPT_LEVEL=FAST and than the unrolled C kernels of OPT_LEVEL=PORTABLE_FAST, so in these cases the batched functions
+// run the scalar KEM four times unless _AVX2_X4_ is defined
+
+#if (TARGET == TARGET_AMD64) && defined(__AVX2__) && !defined(_NO_AVX2_)
+    #define AVX2_KECCAK_X4_IMPLEMENTATION
+    #if defined(_AVX2_X4_) || defined(GENERIC_IMPLEMENTATION)
+        #define AVX2_X4_IMPLEMENTATION
+    #endif
+#endif
+
+
+// Selection of the fused elliptic curve and isogeny kernels in x64 assembly (xDBLADD, xDBL, xTPL, eval_4_isog and eval_3_isog).
+// They call the field kernels directly, so they are not used with the run-time kernel dispatch. The kernels are not faster than
+// the C versions for every function (xTPL and eval_3_isog are slower), so they are only used for the parameter sets XXX
+// requested with _CURVE_ASM_XXX_
+
+#if (TARGET == TARGET_AMD64) && (OS_TARGET == OS_NIX) && defined(FAST_IMPLEMENTATION) && !defined(X64_DISPATCH_IMPLEMENTATION)
+    #define X64_CURVE_ASM_IMPLEMENTATION
+#endif
+
+
+// Selection of the scalar Keccak-f[1600] permutation used by SHAKE256. The lane-complementing implementation replaces most of 
+// the NOT operations of chi by ORs, which pays off on x64 processors that lack the and-not instruction ANDN (BMI1). Otherwise
+// the compiler's code for the reference implementation is faster. _KECCAK_REF_, _KECCAK_LC_ and _KECCAK_ASM_ force a choice.
+
+#if defined(_KECCAK_ASM_) && (TARGET == TARGET_AMD64) && (OS_TARGET == OS_NIX)
+    #define KECCAK_X64_ASM
+#elif defined(_KECCAK_LC_)
+    #define KECCAK_LANE_COMPLEMENTING
+#elif !defined(_KECCAK_REF_) && defined(FAST_IMPLEMENTATION) && (TARGET == TARGET_AMD64) && !defined(__BMI__)
+    #if (OS_TARGET == OS_NIX)
+        #define KECCAK_X64_ASM
+    #else
+        #define KECCAK_LANE_COMPLEMENTING
+    #endif
+#endif
+
+
+// Selection of the fixed-basis three-point ladder for key generation, which uses precomputed tables of the multiples [2^i]Q of the public basis
+
+#if !defined(_NO_FIXED_BASIS_)
+    #define FIXED_BASIS_LADDER
+#endif
+
+
+// Selection of the parallel traversal of the isogeny trees, in which workers of the thread pool evaluate the isogenies at the stored
+// points and at the images of the basis points while the calling thread walks the strategy. It requires POSIX threads and the __atomic builtins
+
+#if defined(_PARALLEL_WALK_) && (OS_TARGET == OS_NIX) && !defined(_NO_THREADS_) && (COMPILER == COMPILER_GCC || COMPILER == COMPILER_CLANG)
+    #define PARALLEL_WALK
+#endif
+
+
+// Selection of the constant-time safegcd inversion, which requires a signed double-length datatype
+
+#if (RADIX == 32) || ((COMPILER == COMPILER_GCC || COMPILER == COMPILER_CLANG) && defined(__SIZEOF_INT128__))
+    #define SAFEGCD_INVERSION
+#endif
+
 
 // Extended datatype support
 
@@ -175,7 +269,74 @@ static inline unsigned int is_digit_lessthan_ct(digit_t x, digit_t y)
 
 /********************** Macros for platform-dependent operations **********************/
 
-#if defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+#if defined(PORTABLE_FAST_IMPLEMENTATION)
+
+// Digit multiplication
+#define MUL(multiplier, multiplicand, hi, lo)                                                     \
+    { unsigned __int128 tempReg = (unsigned __int128)(multiplier) * (unsigned __int128)(multiplicand); \
+    *(hi) = (digit_t)(tempReg >> RADIX);                                                          \
+    (lo) = (digit_t)tempReg; }
+
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_addcll) && __has_builtin(__builtin_subcll)
+        #define PORTABLE_FAST_ADDCLL
+    #endif
+#endif
+
+#if defined(PORTABLE_FAST_ADDCLL)
+
+// Digit addition with carry
+#define ADDC(carryIn, addend1, addend2, carryOut, sumOut)                                         \
+    { unsigned long long carryReg;                                                                \
+    (sumOut) = (digit_t)__builtin_addcll((addend1), (addend2), (carryIn), &carryReg);             \
+    (carryOut) = carryReg; }
+
+// Digit subtraction with borrow
+#define SUBC(borrowIn, minuend, subtrahend, borrowOut, differenceOut)                             \
+    { unsigned long long borrowReg;                                                               \
+    (differenceOut) = (digit_t)__builtin_subcll((minuend), (subtrahend), (borrowIn), &borrowReg); \
+    (borrowOut) = borrowReg; }
+
+#elif (TARGET == TARGET_AMD64)
+    #include <x86intrin.h>
+
+// Digit addition with carry
+#define ADDC(carryIn, addend1, addend2, carryOut, sumOut)                                         \
+    { unsigned long long sumReg;                                                                  \
+    (carryOut) = _addcarry_u64((unsigned char)(carryIn), (addend1), (addend2), &sumReg);          \
+    (sumOut) = (digit_t)sumReg; }
+
+// Digit subtraction with borrow
+#define SUBC(borrowIn, minuend, subtrahend, borrowOut, differenceOut)                             \
+    { unsigned long long differenceReg;                                                           \
+    (borrowOut) = _subborrow_u64((unsigned char)(borrowIn), (minuend), (subtrahend), &differenceReg); \
+    (differenceOut) = (digit_t)differenceReg; }
+
+#else
+
+// Digit addition with carry
+#define ADDC(carryIn, addend1, addend2, carryOut, sumOut)                                         \
+    { unsigned __int128 tempReg = (unsigned __int128)(addend1) + (unsigned __int128)(addend2) + (unsigned __int128)(carryIn); \
+    (carryOut) = (digit_t)(tempReg >> RADIX);                                                     \
+    (sumOut) = (digit_t)tempReg; }  
+    
+// Digit subtraction with borrow
+#define SUBC(borrowIn, minuend, subtrahend, borrowOut, differenceOut)                             \
+    { unsigned __int128 tempReg = (unsigned __int128)(minuend) - (unsigned __int128)(subtrahend) - (unsigned __int128)(borrowIn); \
+    (borrowOut) = (digit_t)(tempReg >> (sizeof(unsigned __int128)*8 - 1));                        \
+    (differenceOut) = (digit_t)tempReg; }
+
+#endif
+
+// Digit shift right
+#define SHIFTR(highIn, lowIn, shift, shiftOut, DigitSize)                                         \
+    (shiftOut) = ((lowIn) >> (shift)) ^ ((highIn) << (RADIX - (shift)));
+
+// Digit shift left
+#define SHIFTL(highIn, lowIn, shift, shiftOut, DigitSize)                                         \
+    (shiftOut) = ((highIn) << (shift)) ^ ((lowIn) >> (RADIX - (shift)));
+
+#elif defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
 
 // Digit multiplication
 #define MUL(multiplier, multiplicand, hi, lo)                                                     \
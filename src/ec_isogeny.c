@@ -5,7 +5,45 @@
 *********************************************************************************************/
 
 
+#if defined(X64_CURVE_ASM)
+// xDBLADD, xDBL, xTPL, eval_4_isog and eval_3_isog run the fused x64 kernels. Their C versions are compiled with the suffix _c
+// and are the reference for the tests
+    #define CURVE_C(f)    f##_c
+
 void xDBL(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2elm_t C24)
+{ // Doubling of a Montgomery point in projective coordinates (X:Z), see xDBL_c
+    xDBL_asm(P, Q, A24plus, C24);
+}
+
+
+void eval_4_isog(point_proj_t P, f2elm_t* coeff)
+{ // Evaluates the 4-isogeny at the point (X:Z), see eval_4_isog_c
+    eval_4_isog_asm(P, coeff);
+}
+
+
+void xTPL(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus)
+{ // Tripling of a Montgomery point in projective coordinates (X:Z), see xTPL_c
+    xTPL_asm(P, Q, A24minus, A24plus);
+}
+
+
+void eval_3_isog(point_proj_t Q, const f2elm_t* coeff)
+{ // Evaluates the 3-isogeny at the point (X:Z), see eval_3_isog_c
+    eval_3_isog_asm(Q, coeff);
+}
+
+
+void xDBLADD(point_proj_t P, point_proj_t Q, const f2elm_t XPQ, const f2elm_t ZPQ, const f2elm_t A24)
+{ // Simultaneous doubling and differential addition, see xDBLADD_c
+    xDBLADD_asm(P, Q, XPQ, ZPQ, A24);
+}
+#else
+    #define CURVE_C(f)    f
+#endif
+
+
+void CURVE_C(xDBL)(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2elm_t C24)
 { // Doubling of a Montgomery point in projective coordinates (X:Z).
   // Input: projective Montgomery x-coordinates P = (X1:Z1), where x1=X1/Z1 and Montgomery curve constants A+2C and 4C.
   // Output: projective Montgomery x-coordinates Q = 2*P = (X2:Z2).
@@ -88,7 +126,7 @@ void get_4_isog(const point_proj_t P, f2elm_t A24plus, f2elm_t C24, f2elm_t* coe
 }
 
 
-void eval_4_isog(point_proj_t P, f2elm_t* coeff)
+void CURVE_C(eval_4_isog)(point_proj_t P, f2elm_t* coeff)
 { // Evaluates the isogeny at the point (X:Z) in the domain of the isogeny, given a 4-isogeny phi defined 
   // by the 3 coefficients in coeff (computed in the function get_4_isog()).
   // Inputs: the coefficients defining the isogeny, and the projective point P = (X:Z).
@@ -112,7 +150,7 @@ void eval_4_isog(point_proj_t P, f2elm_t* coeff)
 }
 
 
-void xTPL(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus)              
+void CURVE_C(xTPL)(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus)              
 { // Tripling of a Montgomery point in projective coordinates (X:Z).
   // Input: projective Montgomery x-coordinates P = (X:Z), where x=X/Z and Montgomery curve constants A24plus = A+2C and A24minus = A-2C.
   // Output: projective Montgomery x-coordinates Q = 3*P = (X3:Z3).
@@ -182,7 +220,7 @@ void get_3_isog(const point_proj_t P, f2elm_t A24minus, f2elm_t A24plus, f2elm_t
 }
 
 
-void eval_3_isog(point_proj_t Q, const f2elm_t* coeff)
+void CURVE_C(eval_3_isog)(point_proj_t Q, const f2elm_t* coeff)
 { // Computes the 3-isogeny R=phi(X:Z), given projective point (X3:Z3) of order 3 on a Montgomery curve and 
   // a point P with 2 coefficients in coeff (computed in the function get_3_isog()).
   // Inputs: projective points P = (X3:Z3) and Q = (X:Z).
@@ -242,32 +280,42 @@ void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A)
 }
 
 
+static void j_inv_proj(const f2elm_t A, const f2elm_t C, f2elm_t jnum, f2elm_t jden)
+{ // Computes the j-invariant of a Montgomery curve with projective constant as a fraction jnum/jden.
+  // Input: A,C in GF(p^2).
+  // Output: jnum=256*(A^2-3*C^2)^3 and jden=C^4*(A^2-4*C^2), such that j=jnum/jden is the j-invariant of the Montgomery curve B*y^2=x^3+(A/C)*x^2+x.
+    f2elm_t t1;
+    
+    fp2sqr_mont(A, jden);                           // jden = A^2        
+    fp2sqr_mont(C, t1);                             // t1 = C^2
+    fp2add(t1, t1, jnum);                           // jnum = t1+t1
+    fp2sub(jden, jnum, jnum);                       // jnum = jden-jnum
+    fp2sub(jnum, t1, jnum);                         // jnum = jnum-t1
+    fp2sub(jnum, t1, jden);                         // jden = jnum-t1
+    fp2sqr_mont(t1, t1);                            // t1 = t1^2
+    fp2mul_mont(jden, t1, jden);                    // jden = jden*t1
+    fp2add(jnum, jnum, jnum);                       // jnum = jnum+jnum
+    fp2add(jnum, jnum, jnum);                       // jnum = jnum+jnum
+    fp2sqr_mont(jnum, t1);                          // t1 = jnum^2
+    fp2mul_mont(jnum, t1, jnum);                    // jnum = jnum*t1
+    fp2add(jnum, jnum, jnum);                       // jnum = jnum+jnum
+    fp2add(jnum, jnum, jnum);                       // jnum = jnum+jnum
+}
+
+
 void j_inv(const f2elm_t A, const f2elm_t C, f2elm_t jinv)
 { // Computes the j-invariant of a Montgomery curve with projective constant.
   // Input: A,C in GF(p^2).
   // Output: j=256*(A^2-3*C^2)^3/(C^4*(A^2-4*C^2)), which is the j-invariant of the Montgomery curve B*y^2=x^3+(A/C)*x^2+x or (equivalently) j-invariant of B'*y^2=C*x^3+A*x^2+C*x.
-    f2elm_t t0, t1;
+    f2elm_t t0;
     
-    fp2sqr_mont(A, jinv);                           // jinv = A^2        
-    fp2sqr_mont(C, t1);                             // t1 = C^2
-    fp2add(t1, t1, t0);                             // t0 = t1+t1
-    fp2sub(jinv, t0, t0);                           // t0 = jinv-t0
-    fp2sub(t0, t1, t0);                             // t0 = t0-t1
-    fp2sub(t0, t1, jinv);                           // jinv = t0-t1
-    fp2sqr_mont(t1, t1);                            // t1 = t1^2
-    fp2mul_mont(jinv, t1, jinv);                    // jinv = jinv*t1
-    fp2add(t0, t0, t0);                             // t0 = t0+t0
-    fp2add(t0, t0, t0);                             // t0 = t0+t0
-    fp2sqr_mont(t0, t1);                            // t1 = t0^2
-    fp2mul_mont(t0, t1, t0);                        // t0 = t0*t1
-    fp2add(t0, t0, t0);                             // t0 = t0+t0
-    fp2add(t0, t0, t0);                             // t0 = t0+t0
+    j_inv_proj(A, C, t0, jinv);                     // j = t0/jinv
     fp2inv_mont(jinv);                              // jinv = 1/jinv 
     fp2mul_mont(jinv, t0, jinv);                    // jinv = t0*jinv
 }
 
 
-void xDBLADD(point_proj_t P, point_proj_t Q, const f2elm_t XPQ, const f2elm_t ZPQ, const f2elm_t A24)
+void CURVE_C(xDBLADD)(point_proj_t P, point_proj_t Q, const f2elm_t XPQ, const f2elm_t ZPQ, const f2elm_t A24)
 { // Simultaneous doubling and differential addition.
   // Input: projective Montgomery points P=(XP:ZP) and Q=(XQ:ZQ) such that xP=XP/ZP and xQ=XQ/ZQ, affine difference xPQ=x(P-Q) and Montgomery curve constant A24=(A+2)/4.
   // Output: projective Montgomery points P <- 2*P = (X2P:Z2P) such that x(2P)=X2P/Z2P, and Q <- P+Q = (XQP:ZQP) such that = x(Q+P)=XQP/ZQP. 
@@ -318,50 +366,155 @@ static void swap_points(point_proj_t P, point_proj_t Q, const digit_t option)
 }
 
 
-static void LADDER3PT(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const digit_t* m, const unsigned int AliceOrBob, point_proj_t R, const f2elm_t A)
-{
-    point_proj_t R0 = {0}, R2 = {0};
-    f2elm_t A24 = {0};
-    digit_t mask;
-    int i, nbits, bit, swap, prevbit = 0;
+typedef struct {
+    point_proj_t R, R0, R2;
+    f2elm_t A24;
+    digit_t m[NWORDS_ORDER];
+    const uint64_t* table;         // Table {x([2^i]Q)} of the fixed-basis ladder, or NULL
+    int i, nbits, prevbit;
+} ladder3pt_t;                     // State of a resumable three-point ladder
 
+
+static void LADDER3PT_start(ladder3pt_t* L, const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const digit_t* m, const unsigned int AliceOrBob, const f2elm_t A)
+{ // Initialization of the three-point ladder computing x(P+[m]Q), which is run with LADDER3PT_resume.
+  // Input: affine x-coordinates xP=x(P), xQ=x(Q) and xPQ=x(P-Q), scalar m and Montgomery curve constant A.
+    
     if (AliceOrBob == ALICE) {
-        nbits = OALICE_BITS;
+        L->nbits = OALICE_BITS;
     } else {
-        nbits = OBOB_BITS - 1;
+        L->nbits = OBOB_BITS - 1;
     }
+    L->i = 0;
+    L->prevbit = 0;
+    L->table = NULL;
+    memcpy(L->m, m, NWORDS_ORDER*sizeof(digit_t));
 
     // Initializing constant
-    fpcopy((digit_t*)&Montgomery_one, A24[0]);
-    mp2_add(A24, A24, A24);
-    mp2_add(A, A24, A24);
-    fp2div2(A24, A24);  
-    fp2div2(A24, A24);  // A24 = (A+2)/4
+    fp2zero(L->A24);
+    fpcopy((digit_t*)&Montgomery_one, L->A24[0]);
+    mp2_add(L->A24, L->A24, L->A24);
+    mp2_add(A, L->A24, L->A24);
+    fp2div2(L->A24, L->A24);  
+    fp2div2(L->A24, L->A24);  // A24 = (A+2)/4
 
     // Initializing points
-    fp2copy(xQ, R0->X);
-    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R0->Z);
-    fp2copy(xPQ, R2->X);
-    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R2->Z);
-    fp2copy(xP, R->X);
-    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R->Z);
-    fpzero((digit_t*)(R->Z)[1]);
+    fp2copy(xQ, L->R0->X);
+    fp2zero(L->R0->Z);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)L->R0->Z);
+    fp2copy(xPQ, L->R2->X);
+    fp2zero(L->R2->Z);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)L->R2->Z);
+    fp2copy(xP, L->R->X);
+    fp2zero(L->R->Z);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)L->R->Z);
+}
 
-    // Main loop
-    for (i = 0; i < nbits; i++) {
-        bit = (m[i >> LOG2RADIX] >> (i & (RADIX-1))) & 1;
-        swap = bit ^ prevbit;
-        prevbit = bit;
+
+static void xADD_affine(point_proj_t P, const digit_t* xQ, const point_proj_t PQ)
+{ // Differential addition with an affine second point.
+  // Input: projective Montgomery point P=(XP:ZP) such that xP=XP/ZP, affine x-coordinate xQ of Q in GF(p^2) and projective difference x(P-Q)=XPQ/ZPQ.
+  // Output: projective Montgomery point P <- P+Q = (XQP:ZQP) such that x(P+Q)=XQP/ZQP.
+    f2elm_t t0, t1, t2;
+
+    fpcopy((digit_t*)&Montgomery_one, t2[0]);
+    fpzero(t2[1]);
+    fp2add((felm_t*)xQ, t2, t0);                    // t0 = xQ+1
+    fp2sub((felm_t*)xQ, t2, t1);                    // t1 = xQ-1
+    mp2_sub_p2(P->X, P->Z, t2);                     // t2 = XP-ZP
+    mp2_add(P->X, P->Z, P->X);                      // XP = XP+ZP
+    fp2mul_mont(t0, t2, t0);                        // t0 = (xQ+1)*(XP-ZP)
+    fp2mul_mont(t1, P->X, t1);                      // t1 = (xQ-1)*(XP+ZP)
+    mp2_sub_p2(t0, t1, P->Z);                       // ZP = (xQ+1)*(XP-ZP)-(xQ-1)*(XP+ZP)
+    mp2_add(t0, t1, P->X);                          // XP = (xQ+1)*(XP-ZP)+(xQ-1)*(XP+ZP)
+    fp2sqr_mont(P->Z, P->Z);                        // ZP = [(xQ+1)*(XP-ZP)-(xQ-1)*(XP+ZP)]^2
+    fp2sqr_mont(P->X, P->X);                        // XP = [(xQ+1)*(XP-ZP)+(xQ-1)*(XP+ZP)]^2
+    fp2mul_mont(P->Z, PQ->X, P->Z);                 // ZP = XPQ*[(xQ+1)*(XP-ZP)-(xQ-1)*(XP+ZP)]^2
+    fp2mul_mont(P->X, PQ->Z, P->X);                 // XP = ZPQ*[(xQ+1)*(XP-ZP)+(xQ-1)*(XP+ZP)]^2
+}
+
+
+static int LADDER3PT_resume(ladder3pt_t* L, const int nsteps)
+{ // Runs at most nsteps steps of a three-point ladder initialized with LADDER3PT_start or LADDER3PT_fixed_start.
+  // Output: the number of steps that were run. Once the last step has run, L->R = (X:Z) such that x(P+[m]Q) = X/Z.
+  // The fixed-basis ladder replaces the doubling-and-addition by a single differential addition with the affine point x([2^i]Q) from its table.
+    digit_t mask;
+    int bit, swap, steps = 0;
+
+    for (; (L->i < L->nbits) && (steps < nsteps); L->i++, steps++) {
+        bit = (L->m[L->i >> LOG2RADIX] >> (L->i & (RADIX-1))) & 1;
+        swap = bit ^ L->prevbit;
+        L->prevbit = bit;
         mask = 0 - (digit_t)swap;
 
-        swap_points(R, R2, mask);
-        xDBLADD(R0, R2, R->X, R->Z, A24);
+        swap_points(L->R, L->R2, mask);
+        if (L->table != NULL) {
+            xADD_affine(L->R2, (digit_t*)L->table + 2*L->i*NWORDS_FIELD, L->R);
+        } else {
+            xDBLADD(L->R0, L->R2, L->R->X, L->R->Z, L->A24);
+        }
     }
-    swap = 0 ^ prevbit;
-    mask = 0 - (digit_t)swap;
-    swap_points(R, R2, mask);
+    if ((steps > 0) && (L->i == L->nbits)) {
+        swap = 0 ^ L->prevbit;
+        mask = 0 - (digit_t)swap;
+        swap_points(L->R, L->R2, mask);
+    }
+    return steps;
+}
+
+
+static void LADDER3PT(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const digit_t* m, const unsigned int AliceOrBob, point_proj_t R, const f2elm_t A)
+{
+    ladder3pt_t L;
+
+    LADDER3PT_start(&L, xP, xQ, xPQ, m, AliceOrBob, A);
+    LADDER3PT_resume(&L, L.nbits);
+    fp2copy(L.R->X, R->X);
+    fp2copy(L.R->Z, R->Z);
+}
+
+
+#if defined(FIXED_BASIS_LADDER)
+
+static void LADDER3PT_fixed_start(ladder3pt_t* L, const f2elm_t xP, const f2elm_t xPQ, const uint64_t* table, const digit_t* m, const unsigned int AliceOrBob)
+{ // Initialization of the fixed-basis variant of the three-point ladder, where the points x([2^i]Q) are read from a precomputed table.
+  // Input: affine x-coordinates xP=x(P) and xPQ=x(P-Q), table {x([2^i]Q)} of affine x-coordinates in Montgomery representation and scalar m.
+  // The curve constant is not needed since no doublings are computed.
+    
+    if (AliceOrBob == ALICE) {
+        L->nbits = OALICE_BITS;
+    } else {
+        L->nbits = OBOB_BITS - 1;
+    }
+    L->i = 0;
+    L->prevbit = 0;
+    L->table = table;
+    memcpy(L->m, m, NWORDS_ORDER*sizeof(digit_t));
+
+    // Initializing points
+    fp2copy(xPQ, L->R2->X);
+    fp2zero(L->R2->Z);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)L->R2->Z);
+    fp2copy(xP, L->R->X);
+    fp2zero(L->R->Z);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)L->R->Z);
 }
 
+
+static void LADDER3PT_fixed(const f2elm_t xP, const f2elm_t xPQ, const uint64_t* table, const digit_t* m, const unsigned int AliceOrBob, point_proj_t R)
+{ // Fixed-basis variant of LADDER3PT computing x(P+[m]Q), where the points x([2^i]Q) of the ladder are read from a precomputed table.
+  // Input: affine x-coordinates xP=x(P) and xPQ=x(P-Q), table {x([2^i]Q)} of affine x-coordinates in Montgomery representation and scalar m.
+  // Output: R = (X:Z) such that x(P+[m]Q) = X/Z.
+    ladder3pt_t L;
+
+    LADDER3PT_fixed_start(&L, xP, xPQ, table, m, AliceOrBob);
+    LADDER3PT_resume(&L, L.nbits);
+    fp2copy(L.R->X, R->X);
+    fp2copy(L.R->Z, R->Z);
+}
+
+#endif
+
+
 #ifdef COMPRESS
 
 
@@ -147,20 +147,29 @@ void fpsqr_mont(const digit_t* ma, digit_t* mc)
 { // Multiprecision squaring, c = a^2 mod p.
     dfelm_t temp = {0};
 
-    mp_mul(ma, ma, temp, NWORDS_FIELD);
+    mp_sqr(ma, temp, NWORDS_FIELD);
     rdc_mont(temp, mc);
 }
 
 
 void fpinv_mont(digit_t* a)
 { // Field inversion using Montgomery arithmetic, a = a^(-1)*R mod p.
+  // Uses the constant-time safegcd algorithm if supported, otherwise exponentiation via an addition chain.
     felm_t tt;
 
+#if defined(SAFEGCD_INVERSION)
+    fpcopy(a, tt);
+    fpcorrection(tt);
+    safegcd_inv(tt, tt, (digit_t*)&PRIME, NWORDS_FIELD);      // tt = (a*R)^(-1) mod p
+    fpmul_mont(tt, (digit_t*)&Montgomery_R2, tt);
+    fpmul_mont(tt, (digit_t*)&Montgomery_R2, a);             // a = a^(-1)*R mod p
+#else
     fpcopy(a, tt);
     fpinv_chain_mont(tt);
     fpsqr_mont(tt, tt);
     fpsqr_mont(tt, tt);
     fpmul_mont(a, tt, a);
+#endif
 }
 
 
@@ -215,7 +224,7 @@ void fp2correction(f2elm_t a)
 
 inline static void mp_addfast(const digit_t* a, const digit_t* b, digit_t* c)
 { // Multiprecision addition, c = a+b.    
-#if (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+#if (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION) || defined(PORTABLE_FAST_IMPLEMENTATION) || (TARGET == TARGET_ARM)
 
     mp_add(a, b, c, NWORDS_FIELD);
     
@@ -280,7 +289,7 @@ inline unsigned int mp_sub(const digit_t* a, const digit_t* b, digit_t* c, const
 
 inline static void mp_subaddfast(const digit_t* a, const digit_t* b, digit_t* c)
 { // Multiprecision subtraction followed by addition with p*2^MAXBITS_FIELD, c = a-b+(p*2^MAXBITS_FIELD) if a-b < 0, otherwise c=a-b. 
-#if (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+#if (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION) || defined(PORTABLE_FAST_IMPLEMENTATION) || (TARGET == TARGET_ARM)
     felm_t t1;
 
     digit_t mask = 0 - (digit_t)mp_sub(a, b, c, 2*NWORDS_FIELD);
@@ -298,7 +307,7 @@ inline static void mp_subaddfast(const digit_t* a, const digit_t* b, digit_t* c)
 
 inline static void mp_dblsubfast(const digit_t* a, const digit_t* b, digit_t* c)
 { // Multiprecision subtraction, c = c-a-b, where lng(a) = lng(b) = 2*NWORDS_FIELD.
-#if (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+#if (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION) || defined(PORTABLE_FAST_IMPLEMENTATION) || (TARGET == TARGET_ARM)
 
     mp_sub(c, a, c, 2*NWORDS_FIELD);
     mp_sub(c, b, c, 2*NWORDS_FIELD);
@@ -763,6 +772,64 @@ void fp2inv_mont(f2elm_t a)
 }
 
 
+static digit_t fp2_is_zero_mask_ct(const f2elm_t a)
+{ // Returns 0xFF...FF if a = 0 in GF(p^2), 0 otherwise. It runs in constant-time.
+    f2elm_t t;
+    digit_t x = 0;
+    unsigned int i;
+
+    fp2copy(a, t);
+    fp2correction(t);
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        x |= t[0][i] | t[1][i];
+    }
+    return (digit_t)0 - (digit_t)is_digit_zero_ct(x);
+}
+
+
+static void fp2_select_ct(const f2elm_t a, const f2elm_t b, f2elm_t c, const digit_t mask)
+{ // Constant-time selection: c = a if mask = 0, c = b if mask = 0xFF...FF.
+    unsigned int i;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        c[0][i] = a[0][i] ^ (mask & (a[0][i] ^ b[0][i]));
+        c[1][i] = a[1][i] ^ (mask & (a[1][i] ^ b[1][i]));
+    }
+}
+
+
+void mont_n_way_inv_ct(const f2elm_t* vec, const int n, f2elm_t* out)
+{ // Constant-time n-way simultaneous inversion using Montgomery's trick.
+  // As with fp2inv_mont(), zero inputs produce zero outputs, and they do not affect the other outputs.
+  // The execution depends on n only. vec and out CANNOT be the same variable!
+    f2elm_t t0, t1, one = {0}, zero = {0};
+    digit_t mask;
+    int i;
+
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    mask = fp2_is_zero_mask_ct(vec[0]);
+    fp2_select_ct(vec[0], one, out[0], mask);     // out[0] = vec[0] (or 1 if vec[0] = 0)
+    for (i = 1; i < n; i++) {
+        mask = fp2_is_zero_mask_ct(vec[i]);
+        fp2_select_ct(vec[i], one, t0, mask);
+        fp2mul_mont(out[i-1], t0, out[i]);        // out[i] = out[i-1]*vec[i]
+    }
+
+    fp2copy(out[n-1], t1);                        // t1 = 1/out[n-1]
+    fp2inv_mont(t1);
+    
+    for (i = n-1; i >= 1; i--) {
+        mask = fp2_is_zero_mask_ct(vec[i]);
+        fp2_select_ct(vec[i], one, t0, mask);
+        fp2mul_mont(out[i-1], t1, out[i]);        // out[i] = t1*out[i-1]
+        fp2_select_ct(out[i], zero, out[i], mask);
+        fp2mul_mont(t1, t0, t1);                  // t1 = t1*vec[i]
+    }
+    mask = fp2_is_zero_mask_ct(vec[0]);
+    fp2_select_ct(t1, zero, out[0], mask);        // out[0] = t1
+}
+
+
 void to_fp2mont(const f2elm_t a, f2elm_t mc)
 { // Conversion of a GF(p^2) element to Montgomery representation,
   // mc_i = a_i*R^2*R^(-1) = a_i*R in GF(p^2). 
@@ -862,12 +929,13 @@ void mul3(unsigned char *a)
 
 unsigned int mod3(digit_t* a) 
 { // Computes the input modulo 3
-  // The input is assumed to be NWORDS_ORDER long 
+  // The input is assumed to be NWORDS_ORDER long. The half-digits are extracted with shifts, since reading the digits through
+  // a hdigit_t pointer breaks the strict-aliasing rules and is miscompiled once the callers are inlined (e.g., with -flto)
     digit_t temp;
-    hdigit_t *val = (hdigit_t*)a, r = 0;
+    hdigit_t r = 0;
 
     for (int i = (2*NWORDS_ORDER-1); i >= 0; i--) {
-        temp = ((digit_t)r << (sizeof(hdigit_t)*8)) | (digit_t)val[i];
+        temp = ((digit_t)r << (sizeof(hdigit_t)*8)) | (digit_t)(hdigit_t)(a[i >> 1] >> ((i & 1)*sizeof(hdigit_t)*8));
         r = temp % 3;
     }
 
@@ -1400,51 +1468,69 @@ void Montgomery_inversion_mod_order_bingcd(const digit_t* a, digit_t* c, const d
 }
 
 
-void inv_mod_orderA(const digit_t* a, digit_t* c)
-{ // Inversion of an odd integer modulo an even integer of the form 2^m.
-  // Algorithm 3: Explicit Quadratic Modular inverse modulo 2^m from Dumas'12: http://arxiv.org/pdf/1209.6626.pdf
-  // If the input is invalid (even), the function outputs c = a.
-    unsigned int i, f, s = 0;
-    digit_t am1[NWORDS_ORDER] = {0};
-    digit_t tmp1[NWORDS_ORDER] = {0};
-    digit_t tmp2[2*NWORDS_ORDER] = {0};
-    digit_t one[NWORDS_ORDER] = {0};
-    digit_t order[NWORDS_ORDER] = {0};
-    digit_t mask = (digit_t)((uint64_t)(-1) >> (NBITS_ORDER - OALICE_BITS));
+void Montgomery_inversion_mod_order_ct(const digit_t* a, digit_t* c, const digit_t* order, const digit_t* Montgomery_rprime, const digit_t* Montgomery_Rprime)
+{// Constant-time Montgomery inversion modulo an odd order, c = a^(-1)*R mod order.
+ // Input: a in [0, order]. If a = 0 or a = order then the output is c = 0.
+#if defined(SAFEGCD_INVERSION)
+    unsigned int i, borrow;
+    digit_t mask, t[NWORDS_ORDER];
 
-    order[NWORDS_ORDER-1] = (digit_t)((uint64_t)1 << (64 - (NBITS_ORDER - OALICE_BITS)));  // Load most significant digit of Alice's order
-    one[0] = 1;
-        
-    mp_sub(a, one, am1, NWORDS_ORDER);                   // am1 = a-1
-
-    if (((a[0] & (digit_t)1) == 0) || (is_zero(am1, NWORDS_ORDER) == true)) {  // Check if the input is even or one 
-        copy_words(a, c, NWORDS_ORDER);
-        c[NWORDS_ORDER-1] &= mask;                       // mod 2^m
-    } else { 
-        mp_sub(order, am1, c, NWORDS_ORDER);
-        mp_add(c, one, c, NWORDS_ORDER);                 // c = 2^m - a + 2
-
-        copy_words(am1, tmp1, NWORDS_ORDER);
-        while ((tmp1[0] & (digit_t)1) == 0) {
-            s += 1;
-            mp_shiftr1(tmp1, NWORDS_ORDER);
-        }
+    borrow = mp_sub(a, order, t, NWORDS_ORDER);                                // If a = order then t = 0, else t = a
+    mask = (digit_t)0 - (digit_t)borrow;
+    for (i = 0; i < NWORDS_ORDER; i++) {
+        t[i] = (a[i] & mask) | (t[i] & ~mask);
+    }
+    safegcd_inv(t, t, order, NWORDS_ORDER);                                    // t = (a*R)^(-1) mod order
+    Montgomery_multiply_mod_order(t, Montgomery_Rprime, t, order, Montgomery_rprime);
+    Montgomery_multiply_mod_order(t, Montgomery_Rprime, c, order, Montgomery_rprime);
+#else
+    // SECURITY NOTE: this fallback does not run in constant time.
+    Montgomery_inversion_mod_order_bingcd(a, c, order, Montgomery_rprime, Montgomery_Rprime);
+#endif
+}
 
-        f = OALICE_BITS / s;
-        for (i = 1; i < f; i <<= 1) {
-            multiply(am1, am1, tmp2, NWORDS_ORDER);            // tmp2 = am1^2  
-            copy_words(tmp2, am1, NWORDS_ORDER);
-            am1[NWORDS_ORDER-1] &= mask;                       // am1 = tmp2 mod 2^m
-            mp_add(am1, one, tmp1, NWORDS_ORDER);              // tmp1 = am1 + 1
-            tmp1[NWORDS_ORDER-1] &= mask;                      // mod 2^m
-            multiply(c, tmp1, tmp2, NWORDS_ORDER);             // c = c*tmp1
-            copy_words(tmp2, c, NWORDS_ORDER);
-            c[NWORDS_ORDER-1] &= mask;                         // mod 2^m
+
+static inline void mod_orderA(digit_t* a)
+{ // Reduction modulo Alice's order, a = a mod 2^m, where m = OALICE_BITS.
+    for (unsigned int i = 0; i < NWORDS_ORDER; i++) {
+        if (i == OALICE_BITS / RADIX) {
+            a[i] &= ((digit_t)1 << (OALICE_BITS % RADIX)) - 1;
+        } else if (i > OALICE_BITS / RADIX) {
+            a[i] = 0;
         }
     }
 }
 
 
+void inv_mod_orderA(const digit_t* a, digit_t* c)
+{ // Constant-time inversion of an odd integer modulo an even integer of the form 2^m, where m = OALICE_BITS.
+  // Uses the Newton iteration x = x*(2 - a*x) mod 2^m, which doubles the number of correct bits at each step,
+  // starting from x = a which is correct modulo 2^3. The number of iterations only depends on m.
+  // If the input is invalid (even), the function outputs c = a mod 2^m.
+    unsigned int i, nbits;
+    digit_t mask, x[NWORDS_ORDER], t[NWORDS_ORDER], two[NWORDS_ORDER] = {0};
+    digit_t tmp[2*NWORDS_ORDER];
+
+    two[0] = 2;
+    copy_words(a, x, NWORDS_ORDER);
+    mod_orderA(x);
+
+    for (nbits = 3; nbits < OALICE_BITS; nbits <<= 1) {
+        multiply(a, x, tmp, NWORDS_ORDER);              // t = 2 - a*x mod 2^m
+        mp_sub(two, tmp, t, NWORDS_ORDER);
+        multiply(x, t, tmp, NWORDS_ORDER);              // x = x*t mod 2^m
+        copy_words(tmp, x, NWORDS_ORDER);
+        mod_orderA(x);
+    }
+
+    mask = (digit_t)0 - (a[0] & 1);                     // If a is even then c = a mod 2^m, else c = x
+    for (i = 0; i < NWORDS_ORDER; i++) {
+        c[i] = (x[i] & mask) | (a[i] & ~mask);
+    }
+    mod_orderA(c);
+}
+
+
 void recover_os(const f2elm_t X1, const f2elm_t Z1, const f2elm_t X2, const f2elm_t Z2, const f2elm_t x, const f2elm_t y, const f2elm_t A, f2elm_t X3, f2elm_t Y3, f2elm_t Z3)
 {
     f2elm_t t0, t1, t2, t3;
@@ -44,6 +44,9 @@ void digit_x_digit(const digit_t a, const digit_t b, digit_t* c);
 // Multiprecision comba multiply, c = a*b, where lng(a) = lng(b) = nwords.
 void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords);
 
+// Multiprecision squaring, c = a^2, where lng(a) = nwords.
+void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords);
+
 /************ Montgomery reduction and conversion functions *************/
 
 // Montgomery reduction, c = a mod p
@@ -64,6 +67,9 @@ void from_fp2mont(const f2elm_t ma, f2elm_t c);
 // n-way Montgomery inversion
 void mont_n_way_inv(const f2elm_t* vec, const int n, f2elm_t* out);
 
+// Constant-time n-way Montgomery inversion
+void mont_n_way_inv_ct(const f2elm_t* vec, const int n, f2elm_t* out);
+
 /************ Elliptic curve and isogeny functions *************/
 
 // Computes the j-invariant of a Montgomery curve with projective constant.
@@ -105,5 +111,14 @@ void inv_3_way(f2elm_t z1, f2elm_t z2, f2elm_t z3);
 // Given the x-coordinates of P, Q, and R, returns the value A corresponding to the Montgomery curve E_A: y^2=x^3+A*x^2+x such that R=Q-P on E_A.
 void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A);
 
+#if defined(X64_CURVE_ASM)
+// C versions of the functions computed by the fused x64 kernels
+void xDBLADD_c(point_proj_t P, point_proj_t Q, const f2elm_t XPQ, const f2elm_t ZPQ, const f2elm_t A24);
+void xDBL_c(const point_proj_t P, point_proj_t Q, const f2elm_t A24plus, const f2elm_t C24);
+void xTPL_c(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2elm_t A24plus);
+void eval_4_isog_c(point_proj_t P, f2elm_t* coeff);
+void eval_3_isog_c(point_proj_t Q, const f2elm_t* coeff);
+#endif
+
 
 #endif
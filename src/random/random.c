@@ -2,7 +2,9 @@
 * Hardware-based random number generation function
 *
 * It uses /dev/urandom in Linux and CNG's BCryptGenRandom function in Windows
-*********************************************************************************************/ 
+* On Unix-like platforms, requests are served by a per-thread SHAKE256-based generator that is seeded
+* from the operating system (getrandom or /dev/urandom) and reseeded periodically and after fork()
+*********************************************************************************************/
 
 #include "random.h"
 #include <stdlib.h>
@@ -10,14 +12,25 @@
     #include <windows.h>
     #include <bcrypt.h>
 #elif defined(__NIX__)
+    #include <stdint.h>
+    #include <string.h>
+    #include <errno.h>
     #include <unistd.h>
     #include <fcntl.h>
-    static int lock = -1;
+    #if defined(__linux__)
+        #include <sys/syscall.h>
+    #endif
+    #if !defined(_NO_DRBG_)
+        #include <pthread.h>
+        #include "../sha3/fips202.h"
+    #endif
 #endif
 
-#define passed 0 
+#define passed 0
 #define failed 1
 
+static unsigned long long syscall_count = 0;    // Number of requests to the operating system's generator
+
 
 static inline void delay(unsigned int count)
 {
@@ -25,37 +38,183 @@ static inline void delay(unsigned int count)
 }
 
 
-int randombytes(unsigned char* random_array, unsigned long long nbytes)
-{ // Generation of "nbytes" of random values
-    
-#if defined(__WINDOWS__)   
+static int os_randombytes(unsigned char* random_array, unsigned long long nbytes)
+{ // Generation of "nbytes" of random values by the operating system
+
+#if defined(__WINDOWS__)
+    syscall_count++;
     if (!BCRYPT_SUCCESS(BCryptGenRandom(NULL, random_array, (unsigned long)nbytes, BCRYPT_USE_SYSTEM_PREFERRED_RNG))) {
         return failed;
     }
 
 #elif defined(__NIX__)
-    int r, n = (int)nbytes, count = 0;
-    
-    if (lock == -1) {
+    unsigned long long count = 0;
+    long r;
+    int fd;
+
+#if defined(SYS_getrandom)
+    while (count < nbytes) {
+        __atomic_add_fetch(&syscall_count, 1, __ATOMIC_RELAXED);
+        r = syscall(SYS_getrandom, random_array+count, (size_t)(nbytes-count), 0);
+        if (r > 0) {
+            count += (unsigned long long)r;
+        } else if (errno == ENOSYS) {
+            break;                        // Kernel without getrandom, use /dev/urandom
+        } else if (errno != EINTR) {
+            delay(0xFFFF);
+        }
+    }
+#endif
+
+    if (count < nbytes) {
         do {
-            lock = open("/dev/urandom", O_RDONLY);
-            if (lock == -1) {
+            __atomic_add_fetch(&syscall_count, 1, __ATOMIC_RELAXED);
+            fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+            if (fd == -1) {
                 delay(0xFFFFF);
             }
-        } while (lock == -1);
-    }
+        } while (fd == -1);
 
-    while (n > 0) {
-        do {
-            r = read(lock, random_array+count, n);
-            if (r == -1) {
+        while (count < nbytes) {
+            __atomic_add_fetch(&syscall_count, 1, __ATOMIC_RELAXED);
+            r = read(fd, random_array+count, (size_t)(nbytes-count));
+            if (r > 0) {
+                count += (unsigned long long)r;
+            } else {
                 delay(0xFFFF);
             }
-        } while (r == -1);
-        count += r;
-        n -= r;
+        }
+        __atomic_add_fetch(&syscall_count, 1, __ATOMIC_RELAXED);
+        close(fd);
     }
 #endif
 
     return passed;
+}
+
+
+#if defined(__NIX__) && !defined(_NO_DRBG_)
+
+#define DRBG_KEY_BYTES         32      // Length of the seeds and of the keys of the generator
+#define DRBG_BUFFER_BLOCKS     4       // SHAKE256 blocks generated per refill
+#define DRBG_RESEED_INTERVAL   4096    // Refills between two reseeds from the operating system (about 2 MB of output)
+
+typedef struct {
+    uint64_t s[25];                                            // SHAKE256 state after absorbing the current key
+    unsigned char buffer[DRBG_BUFFER_BLOCKS*SHAKE256_RATE];    // Output not yet returned is located at the end of the buffer
+    unsigned int available;                                    // Number of bytes of output left in the buffer
+    unsigned int refills;                                      // Number of refills since the last reseed
+    unsigned int fork_generation;                              // Value of fork_generation at the last reseed
+    int seeded;
+} drbg_t;
+
+static __thread drbg_t drbg;                     // One generator per thread, so no locking is needed
+static volatile unsigned int fork_generation = 0;
+
+
+static void drbg_clear(unsigned char* mem, size_t nbytes)
+{ // Erasure of generator material that cannot be optimized away
+    volatile unsigned char *v = mem;
+
+    while (nbytes--) {
+        *v++ = 0;
+    }
+}
+
+
+static void drbg_atfork_child(void)
+{ // The child of a fork() must not repeat the output of its parent, so every generator in it is reseeded before its next use
+    fork_generation++;
+}
+
+
+__attribute__((constructor)) static void drbg_register_atfork(void)
+{
+    pthread_atfork(NULL, NULL, drbg_atfork_child);
+}
+
+
+static void drbg_rekey(const unsigned char* key)
+{ // Keys the generator with DRBG_KEY_BYTES bytes of key material
+
+    for (unsigned int i = 0; i < 25; i++) {
+        drbg.s[i] = 0;
+    }
+    shake256_absorb(drbg.s, key, DRBG_KEY_BYTES);
+}
+
+
+static void drbg_reseed(void)
+{ // Keys the generator with a fresh seed from the operating system and discards any buffered output
+    unsigned char seed[DRBG_KEY_BYTES];
+
+    os_randombytes(seed, DRBG_KEY_BYTES);
+    drbg_rekey(seed);
+    drbg_clear(seed, DRBG_KEY_BYTES);
+    drbg_clear(drbg.buffer, sizeof(drbg.buffer));
+    drbg.available = 0;
+    drbg.refills = 0;
+    drbg.fork_generation = fork_generation;
+    drbg.seeded = 1;
+}
+
+
+static void drbg_refill(void)
+{ // Generates DRBG_BUFFER_BLOCKS blocks of output. The first DRBG_KEY_BYTES bytes become the next key and are erased
+  // (fast key erasure), so that the state of the generator does not reveal output that has already been returned.
+
+    shake256_squeezeblocks(drbg.buffer, DRBG_BUFFER_BLOCKS, drbg.s);
+    drbg_rekey(drbg.buffer);
+    drbg_clear(drbg.buffer, DRBG_KEY_BYTES);
+    drbg.available = sizeof(drbg.buffer) - DRBG_KEY_BYTES;
+    drbg.refills++;
+}
+
+
+int randombytes(unsigned char* random_array, unsigned long long nbytes)
+{ // Generation of "nbytes" of random values
+    unsigned int n, pos;
+
+    if ((drbg.seeded == 0) || (drbg.fork_generation != fork_generation)) {
+        drbg_reseed();
+    }
+
+    while (nbytes > 0) {
+        if (drbg.available == 0) {
+            if (drbg.refills >= DRBG_RESEED_INTERVAL) {
+                drbg_reseed();
+            }
+            drbg_refill();
+        }
+        n = (nbytes < drbg.available) ? (unsigned int)nbytes : drbg.available;
+        pos = sizeof(drbg.buffer) - drbg.available;
+        memcpy(random_array, &drbg.buffer[pos], n);
+        drbg_clear(&drbg.buffer[pos], n);    // Output is returned only once
+        drbg.available -= n;
+        random_array += n;
+        nbytes -= n;
+    }
+
+    return passed;
+}
+
+#else
+
+int randombytes(unsigned char* random_array, unsigned long long nbytes)
+{ // Generation of "nbytes" of random values
+
+    return os_randombytes(random_array, nbytes);
+}
+
+#endif
+
+
+unsigned long long randombytes_syscalls(void)
+{ // Number of requests made to the operating system's generator so far
+
+#if defined(__NIX__)
+    return __atomic_load_n(&syscall_count, __ATOMIC_RELAXED);
+#else
+    return syscall_count;
+#endif
 }
\ No newline at end of file
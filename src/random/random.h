@@ -5,5 +5,8 @@
 // Generate random bytes and output the result to random_array
 int randombytes(unsigned char* random_array, unsigned long long nbytes);
 
+// Number of requests made to the operating system's generator so far, for benchmarking
+unsigned long long randombytes_syscalls(void);
+
 
 #endif
\ No newline at end of file
@@ -0,0 +1,227 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: constant-time modular inversion using the safegcd algorithm
+*
+* This implements the divstep-based inversion from Bernstein-Yang'19, "Fast constant-time gcd
+* computation and modular inversion": https://eprint.iacr.org/2019/266
+* Batches of SAFEGCD_BITS divsteps are computed on the least significant limbs only, and the
+* resulting transition matrix is then applied to the full-length operands.
+*********************************************************************************************/
+
+#if defined(SAFEGCD_INVERSION)
+
+#if (RADIX == 64)
+    #define SAFEGCD_BITS        62
+    typedef int64_t             sg_limb_t;        // Signed limb of SAFEGCD_BITS bits
+    typedef uint64_t            sg_ulimb_t;
+    typedef __int128            sg_dlimb_t;       // Signed double-length limb
+#elif (RADIX == 32)
+    #define SAFEGCD_BITS        30
+    typedef int32_t             sg_limb_t;
+    typedef uint32_t            sg_ulimb_t;
+    typedef int64_t             sg_dlimb_t;
+#endif
+
+#define SAFEGCD_LIMB_BITS       (8*sizeof(sg_limb_t))
+#define SAFEGCD_MASK            ((sg_limb_t)(((sg_ulimb_t)1 << SAFEGCD_BITS) - 1))
+#define SAFEGCD_MAXLIMBS        (NBITS_FIELD/SAFEGCD_BITS + 1)  // Max. number of limbs of signed operands in (-2*modulus, modulus)
+
+typedef struct { sg_limb_t u, v, q, r; } safegcd_matrix_t;      // Transition matrix, scaled by 2^SAFEGCD_BITS
+
+
+static void safegcd_to_limbs(const digit_t* a, sg_limb_t* r, const unsigned int nwords, const unsigned int nlimbs)
+{ // Conversion from an nwords-digit nonnegative integer to nlimbs limbs of SAFEGCD_BITS bits.
+    unsigned int i, w, shift;
+    sg_ulimb_t t;
+
+    for (i = 0; i < nlimbs; i++) {
+        w = (i*SAFEGCD_BITS) / RADIX;
+        shift = (i*SAFEGCD_BITS) % RADIX;
+        t = 0;
+        if (w < nwords) {
+            t = (sg_ulimb_t)a[w] >> shift;
+            if ((shift + SAFEGCD_BITS > RADIX) && (w + 1 < nwords)) {
+                t |= (sg_ulimb_t)a[w+1] << (RADIX - shift);
+            }
+        }
+        r[i] = (sg_limb_t)t & SAFEGCD_MASK;
+    }
+}
+
+
+static void safegcd_from_limbs(const sg_limb_t* a, digit_t* r, const unsigned int nwords, const unsigned int nlimbs)
+{ // Conversion from nlimbs normalized limbs of SAFEGCD_BITS bits to an nwords-digit nonnegative integer.
+    unsigned int i, w, shift;
+
+    for (i = 0; i < nwords; i++) {
+        r[i] = 0;
+    }
+    for (i = 0; i < nlimbs; i++) {
+        w = (i*SAFEGCD_BITS) / RADIX;
+        shift = (i*SAFEGCD_BITS) % RADIX;
+        if (w < nwords) {
+            r[w] |= (digit_t)((sg_ulimb_t)a[i] << shift);
+            if ((shift + SAFEGCD_BITS > RADIX) && (w + 1 < nwords)) {
+                r[w+1] |= (digit_t)((sg_ulimb_t)a[i] >> (RADIX - shift));
+            }
+        }
+    }
+}
+
+
+static sg_limb_t safegcd_divsteps(sg_limb_t delta, const sg_limb_t f0, const sg_limb_t g0, safegcd_matrix_t* t)
+{ // Computes SAFEGCD_BITS divsteps in constant time using the least significant limbs f0 (odd) and g0 of f and g.
+  // Returns the updated delta and the transition matrix t such that 2^SAFEGCD_BITS*(f',g') = t*(f,g).
+    sg_ulimb_t u = 1, v = 0, q = 0, r = 1, f = (sg_ulimb_t)f0, g = (sg_ulimb_t)g0, d = (sg_ulimb_t)delta;
+    sg_ulimb_t c1, c2, x;
+
+    for (unsigned int i = 0; i < SAFEGCD_BITS; i++) {
+        // If delta > 0 and g is odd then (delta, f, g) = (-delta, g, -f)
+        c1 = 0 - ((((0 - d) >> (SAFEGCD_LIMB_BITS-1))) & g & 1);
+        x = (f ^ g) & c1; f ^= x; g ^= x; g = (g ^ c1) - c1;
+        x = (u ^ q) & c1; u ^= x; q ^= x; q = (q ^ c1) - c1;
+        x = (v ^ r) & c1; v ^= x; r ^= x; r = (r ^ c1) - c1;
+        d = (d ^ c1) - c1;
+        // If g is odd then g = g + f, and finally (delta, g) = (1 + delta, g/2)
+        c2 = 0 - (g & 1);
+        g += f & c2; q += u & c2; r += v & c2;
+        g >>= 1; u <<= 1; v <<= 1;
+        d += 1;
+    }
+    t->u = (sg_limb_t)u;
+    t->v = (sg_limb_t)v;
+    t->q = (sg_limb_t)q;
+    t->r = (sg_limb_t)r;
+
+    return (sg_limb_t)d;
+}
+
+
+static void safegcd_update_fg(sg_limb_t* f, sg_limb_t* g, const safegcd_matrix_t* t, const unsigned int nlimbs)
+{ // Computes (f, g) = t*(f, g)/2^SAFEGCD_BITS. The division is exact.
+    sg_dlimb_t cf, cg;
+
+    cf = (sg_dlimb_t)t->u*f[0] + (sg_dlimb_t)t->v*g[0];
+    cg = (sg_dlimb_t)t->q*f[0] + (sg_dlimb_t)t->r*g[0];
+    cf >>= SAFEGCD_BITS;
+    cg >>= SAFEGCD_BITS;
+    for (unsigned int i = 1; i < nlimbs; i++) {
+        cf += (sg_dlimb_t)t->u*f[i] + (sg_dlimb_t)t->v*g[i];
+        cg += (sg_dlimb_t)t->q*f[i] + (sg_dlimb_t)t->r*g[i];
+        f[i-1] = (sg_limb_t)cf & SAFEGCD_MASK;
+        g[i-1] = (sg_limb_t)cg & SAFEGCD_MASK;
+        cf >>= SAFEGCD_BITS;
+        cg >>= SAFEGCD_BITS;
+    }
+    f[nlimbs-1] = (sg_limb_t)cf;
+    g[nlimbs-1] = (sg_limb_t)cg;
+}
+
+
+static void safegcd_update_de(sg_limb_t* d, sg_limb_t* e, const safegcd_matrix_t* t, const sg_limb_t* m, const sg_ulimb_t minv, const unsigned int nlimbs)
+{ // Computes (d, e) = t*(d, e)/2^SAFEGCD_BITS mod m, where minv = m^(-1) mod 2^SAFEGCD_BITS.
+  // Inputs and outputs are in the range (-2*m, m). Multiples of m are added to make the division exact.
+    sg_limb_t sd, se, md, me;
+    sg_dlimb_t cd, ce;
+
+    sd = d[nlimbs-1] >> (SAFEGCD_LIMB_BITS-1);    // sd = -1 if d < 0, else sd = 0
+    se = e[nlimbs-1] >> (SAFEGCD_LIMB_BITS-1);
+    md = (t->u & sd) + (t->v & se);
+    me = (t->q & sd) + (t->r & se);
+    cd = (sg_dlimb_t)t->u*d[0] + (sg_dlimb_t)t->v*e[0];
+    ce = (sg_dlimb_t)t->q*d[0] + (sg_dlimb_t)t->r*e[0];
+    md -= (sg_limb_t)((minv*(sg_ulimb_t)cd + (sg_ulimb_t)md) & (sg_ulimb_t)SAFEGCD_MASK);    // Make the lower limbs divisible by 2^SAFEGCD_BITS
+    me -= (sg_limb_t)((minv*(sg_ulimb_t)ce + (sg_ulimb_t)me) & (sg_ulimb_t)SAFEGCD_MASK);
+    cd += (sg_dlimb_t)m[0]*md;
+    ce += (sg_dlimb_t)m[0]*me;
+    cd >>= SAFEGCD_BITS;
+    ce >>= SAFEGCD_BITS;
+    for (unsigned int i = 1; i < nlimbs; i++) {
+        cd += (sg_dlimb_t)t->u*d[i] + (sg_dlimb_t)t->v*e[i] + (sg_dlimb_t)m[i]*md;
+        ce += (sg_dlimb_t)t->q*d[i] + (sg_dlimb_t)t->r*e[i] + (sg_dlimb_t)m[i]*me;
+        d[i-1] = (sg_limb_t)cd & SAFEGCD_MASK;
+        e[i-1] = (sg_limb_t)ce & SAFEGCD_MASK;
+        cd >>= SAFEGCD_BITS;
+        ce >>= SAFEGCD_BITS;
+    }
+    d[nlimbs-1] = (sg_limb_t)cd;
+    e[nlimbs-1] = (sg_limb_t)ce;
+}
+
+
+static void safegcd_carry(sg_limb_t* a, const unsigned int nlimbs)
+{ // Carry propagation, such that all limbs except the most significant one are in [0, 2^SAFEGCD_BITS-1].
+    for (unsigned int i = 0; i < nlimbs-1; i++) {
+        a[i+1] += a[i] >> SAFEGCD_BITS;
+        a[i] &= SAFEGCD_MASK;
+    }
+}
+
+
+static void safegcd_normalize(sg_limb_t* d, const sg_limb_t sign, const sg_limb_t* m, const unsigned int nlimbs)
+{ // Computes d = sign*d mod m in [0, m-1] for d in the range (-2*m, m), where sign = +1 or -1.
+    unsigned int i;
+    sg_limb_t mask;
+
+    mask = d[nlimbs-1] >> (SAFEGCD_LIMB_BITS-1);  // If d < 0 then d = d + m
+    for (i = 0; i < nlimbs; i++) {
+        d[i] += m[i] & mask;
+    }
+    safegcd_carry(d, nlimbs);
+
+    mask = sign >> (SAFEGCD_LIMB_BITS-1);         // If sign = -1 then d = -d
+    for (i = 0; i < nlimbs; i++) {
+        d[i] = (d[i] ^ mask) - mask;
+    }
+    safegcd_carry(d, nlimbs);
+
+    mask = d[nlimbs-1] >> (SAFEGCD_LIMB_BITS-1);  // If d < 0 then d = d + m
+    for (i = 0; i < nlimbs; i++) {
+        d[i] += m[i] & mask;
+    }
+    safegcd_carry(d, nlimbs);
+}
+
+
+static void safegcd_inv(const digit_t* a, digit_t* c, const digit_t* modulus, const unsigned int nwords)
+{ // Constant-time modular inversion, c = a^(-1) mod modulus, where modulus is odd and up to NBITS_FIELD bits long.
+  // Input: a in [0, modulus-1]. If a = 0 then the output is c = 0.
+  // The number of iterations only depends on the bitlength of the (public) modulus.
+    sg_limb_t f[SAFEGCD_MAXLIMBS], g[SAFEGCD_MAXLIMBS], d[SAFEGCD_MAXLIMBS] = {0}, e[SAFEGCD_MAXLIMBS] = {0}, m[SAFEGCD_MAXLIMBS];
+    sg_limb_t delta = 1;
+    sg_ulimb_t minv;
+    safegcd_matrix_t t;
+    unsigned int i, nbits, nlimbs, nsteps;
+
+    nbits = nwords*RADIX;                   // Bitlength of the modulus
+    while (nbits > 1 && ((modulus[(nbits-1)/RADIX] >> ((nbits-1) % RADIX)) & 1) == 0) {
+        nbits--;
+    }
+    nlimbs = nbits/SAFEGCD_BITS + 1;
+    // Number of divsteps that guarantees g = 0 for inputs up to nbits bits, see Theorem 11.2 in Bernstein-Yang'19
+    nsteps = (nbits < 46) ? (49*nbits + 80)/17 : (49*nbits + 57)/17;
+
+    safegcd_to_limbs(modulus, m, nwords, nlimbs);
+    safegcd_to_limbs(modulus, f, nwords, nlimbs);
+    safegcd_to_limbs(a, g, nwords, nlimbs);
+    e[0] = 1;
+
+    minv = (sg_ulimb_t)m[0];                // minv = m^(-1) mod 2^SAFEGCD_BITS via Newton iterations, 3 correct bits initially
+    for (i = 0; i < 5; i++) {
+        minv *= 2 - (sg_ulimb_t)m[0]*minv;
+    }
+    minv &= (sg_ulimb_t)SAFEGCD_MASK;
+
+    for (i = 0; i < nsteps; i += SAFEGCD_BITS) {
+        delta = safegcd_divsteps(delta, f[0], g[0], &t);
+        safegcd_update_de(d, e, &t, m, minv, nlimbs);
+        safegcd_update_fg(f, g, &t, nlimbs);
+    }
+
+    // At this point f = +-1 and d*a = f mod modulus
+    safegcd_normalize(d, f[nlimbs-1], m, nlimbs);
+    safegcd_from_limbs(d, c, nwords, nlimbs);
+}
+
+#endif
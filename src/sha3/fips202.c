@@ -1,380 +1,680 @@
-/********************************************************************************************
-* SHA3-derived function SHAKE
-*
-* Based on the public domain implementation in crypto_hash/keccakc512/simple/ 
-* from http://bench.cr.yp.to/supercop.html by Ronny Van Keer 
+/********************************************************************************************
+* SHA3-derived function SHAKE
+*
+* Based on the public domain implementation in crypto_hash/keccakc512/simple/ 
+* from http://bench.cr.yp.to/supercop.html by Ronny Van Keer 
 * and the public domain "TweetFips202" implementation from https://twitter.com/tweetfips202 
 * by Gilles Van Assche, Daniel J. Bernstein, and Peter Schwabe
 *
 * See NIST Special Publication 800-185 for more information:
 * http://nvlpubs.nist.gov/nistpubs/SpecialPublications/NIST.SP.800-185.pdf
 *
-*********************************************************************************************/  
-
-#include <stdint.h>
-#include <assert.h>
-#include "fips202.h"
-#include "../config.h"
-
-#define NROUNDS 24
-#define ROL(a, offset) ((a << offset) ^ (a >> (64-offset)))
-
-
-static uint64_t load64(const unsigned char *x)
-{
-  return LETOH_64(*((uint64_t*)x));
-}
-
-
-static void store64(uint8_t *x, uint64_t u)
-{
-  *(uint64_t*)x = HTOLE_64(u);
-}
-
-
-static const uint64_t KeccakF_RoundConstants[NROUNDS] = 
-{
-    (uint64_t)0x0000000000000001ULL,
-    (uint64_t)0x0000000000008082ULL,
-    (uint64_t)0x800000000000808aULL,
-    (uint64_t)0x8000000080008000ULL,
-    (uint64_t)0x000000000000808bULL,
-    (uint64_t)0x0000000080000001ULL,
-    (uint64_t)0x8000000080008081ULL,
-    (uint64_t)0x8000000000008009ULL,
-    (uint64_t)0x000000000000008aULL,
-    (uint64_t)0x0000000000000088ULL,
-    (uint64_t)0x0000000080008009ULL,
-    (uint64_t)0x000000008000000aULL,
-    (uint64_t)0x000000008000808bULL,
-    (uint64_t)0x800000000000008bULL,
-    (uint64_t)0x8000000000008089ULL,
-    (uint64_t)0x8000000000008003ULL,
-    (uint64_t)0x8000000000008002ULL,
-    (uint64_t)0x8000000000000080ULL,
-    (uint64_t)0x000000000000800aULL,
-    (uint64_t)0x800000008000000aULL,
-    (uint64_t)0x8000000080008081ULL,
-    (uint64_t)0x8000000000008080ULL,
-    (uint64_t)0x0000000080000001ULL,
-    (uint64_t)0x8000000080008008ULL
-};
-
-
-void KeccakF1600_StatePermute(uint64_t * state)
-{
-  int round;
-
-        uint64_t Aba, Abe, Abi, Abo, Abu;
-        uint64_t Aga, Age, Agi, Ago, Agu;
-        uint64_t Aka, Ake, Aki, Ako, Aku;
-        uint64_t Ama, Ame, Ami, Amo, Amu;
-        uint64_t Asa, Ase, Asi, Aso, Asu;
-        uint64_t BCa, BCe, BCi, BCo, BCu;
-        uint64_t Da, De, Di, Do, Du;
-        uint64_t Eba, Ebe, Ebi, Ebo, Ebu;
-        uint64_t Ega, Ege, Egi, Ego, Egu;
-        uint64_t Eka, Eke, Eki, Eko, Eku;
-        uint64_t Ema, Eme, Emi, Emo, Emu;
-        uint64_t Esa, Ese, Esi, Eso, Esu;
-
-        //copyFromState(A, state)
-        Aba = state[ 0];
-        Abe = state[ 1];
-        Abi = state[ 2];
-        Abo = state[ 3];
-        Abu = state[ 4];
-        Aga = state[ 5];
-        Age = state[ 6];
-        Agi = state[ 7];
-        Ago = state[ 8];
-        Agu = state[ 9];
-        Aka = state[10];
-        Ake = state[11];
-        Aki = state[12];
-        Ako = state[13];
-        Aku = state[14];
-        Ama = state[15];
-        Ame = state[16];
-        Ami = state[17];
-        Amo = state[18];
-        Amu = state[19];
-        Asa = state[20];
-        Ase = state[21];
-        Asi = state[22];
-        Aso = state[23];
-        Asu = state[24];
-
-        for( round = 0; round < NROUNDS; round += 2 )
-        {
-            //    prepareTheta
-            BCa = Aba^Aga^Aka^Ama^Asa;
-            BCe = Abe^Age^Ake^Ame^Ase;
-            BCi = Abi^Agi^Aki^Ami^Asi;
-            BCo = Abo^Ago^Ako^Amo^Aso;
-            BCu = Abu^Agu^Aku^Amu^Asu;
-
-            //thetaRhoPiChiIotaPrepareTheta(round  , A, E)
-            Da = BCu^ROL(BCe, 1);
-            De = BCa^ROL(BCi, 1);
-            Di = BCe^ROL(BCo, 1);
-            Do = BCi^ROL(BCu, 1);
-            Du = BCo^ROL(BCa, 1);
-
-            Aba ^= Da;
-            BCa = Aba;
-            Age ^= De;
-            BCe = ROL(Age, 44);
-            Aki ^= Di;
-            BCi = ROL(Aki, 43);
-            Amo ^= Do;
-            BCo = ROL(Amo, 21);
-            Asu ^= Du;
-            BCu = ROL(Asu, 14);
-            Eba =   BCa ^((~BCe)&  BCi );
-            Eba ^= (uint64_t)KeccakF_RoundConstants[round];
-            Ebe =   BCe ^((~BCi)&  BCo );
-            Ebi =   BCi ^((~BCo)&  BCu );
-            Ebo =   BCo ^((~BCu)&  BCa );
-            Ebu =   BCu ^((~BCa)&  BCe );
-
-            Abo ^= Do;
-            BCa = ROL(Abo, 28);
-            Agu ^= Du;
-            BCe = ROL(Agu, 20);
-            Aka ^= Da;
-            BCi = ROL(Aka,  3);
-            Ame ^= De;
-            BCo = ROL(Ame, 45);
-            Asi ^= Di;
-            BCu = ROL(Asi, 61);
-            Ega =   BCa ^((~BCe)&  BCi );
-            Ege =   BCe ^((~BCi)&  BCo );
-            Egi =   BCi ^((~BCo)&  BCu );
-            Ego =   BCo ^((~BCu)&  BCa );
-            Egu =   BCu ^((~BCa)&  BCe );
-
-            Abe ^= De;
-            BCa = ROL(Abe,  1);
-            Agi ^= Di;
-            BCe = ROL(Agi,  6);
-            Ako ^= Do;
-            BCi = ROL(Ako, 25);
-            Amu ^= Du;
-            BCo = ROL(Amu,  8);
-            Asa ^= Da;
-            BCu = ROL(Asa, 18);
-            Eka =   BCa ^((~BCe)&  BCi );
-            Eke =   BCe ^((~BCi)&  BCo );
-            Eki =   BCi ^((~BCo)&  BCu );
-            Eko =   BCo ^((~BCu)&  BCa );
-            Eku =   BCu ^((~BCa)&  BCe );
-
-            Abu ^= Du;
-            BCa = ROL(Abu, 27);
-            Aga ^= Da;
-            BCe = ROL(Aga, 36);
-            Ake ^= De;
-            BCi = ROL(Ake, 10);
-            Ami ^= Di;
-            BCo = ROL(Ami, 15);
-            Aso ^= Do;
-            BCu = ROL(Aso, 56);
-            Ema =   BCa ^((~BCe)&  BCi );
-            Eme =   BCe ^((~BCi)&  BCo );
-            Emi =   BCi ^((~BCo)&  BCu );
-            Emo =   BCo ^((~BCu)&  BCa );
-            Emu =   BCu ^((~BCa)&  BCe );
-
-            Abi ^= Di;
-            BCa = ROL(Abi, 62);
-            Ago ^= Do;
-            BCe = ROL(Ago, 55);
-            Aku ^= Du;
-            BCi = ROL(Aku, 39);
-            Ama ^= Da;
-            BCo = ROL(Ama, 41);
-            Ase ^= De;
-            BCu = ROL(Ase,  2);
-            Esa =   BCa ^((~BCe)&  BCi );
-            Ese =   BCe ^((~BCi)&  BCo );
-            Esi =   BCi ^((~BCo)&  BCu );
-            Eso =   BCo ^((~BCu)&  BCa );
-            Esu =   BCu ^((~BCa)&  BCe );
-
-            //    prepareTheta
-            BCa = Eba^Ega^Eka^Ema^Esa;
-            BCe = Ebe^Ege^Eke^Eme^Ese;
-            BCi = Ebi^Egi^Eki^Emi^Esi;
-            BCo = Ebo^Ego^Eko^Emo^Eso;
-            BCu = Ebu^Egu^Eku^Emu^Esu;
-
-            //thetaRhoPiChiIotaPrepareTheta(round+1, E, A)
-            Da = BCu^ROL(BCe, 1);
-            De = BCa^ROL(BCi, 1);
-            Di = BCe^ROL(BCo, 1);
-            Do = BCi^ROL(BCu, 1);
-            Du = BCo^ROL(BCa, 1);
-
-            Eba ^= Da;
-            BCa = Eba;
-            Ege ^= De;
-            BCe = ROL(Ege, 44);
-            Eki ^= Di;
-            BCi = ROL(Eki, 43);
-            Emo ^= Do;
-            BCo = ROL(Emo, 21);
-            Esu ^= Du;
-            BCu = ROL(Esu, 14);
-            Aba =   BCa ^((~BCe)&  BCi );
-            Aba ^= (uint64_t)KeccakF_RoundConstants[round+1];
-            Abe =   BCe ^((~BCi)&  BCo );
-            Abi =   BCi ^((~BCo)&  BCu );
-            Abo =   BCo ^((~BCu)&  BCa );
-            Abu =   BCu ^((~BCa)&  BCe );
-
-            Ebo ^= Do;
-            BCa = ROL(Ebo, 28);
-            Egu ^= Du;
-            BCe = ROL(Egu, 20);
-            Eka ^= Da;
-            BCi = ROL(Eka, 3);
-            Eme ^= De;
-            BCo = ROL(Eme, 45);
-            Esi ^= Di;
-            BCu = ROL(Esi, 61);
-            Aga =   BCa ^((~BCe)&  BCi );
-            Age =   BCe ^((~BCi)&  BCo );
-            Agi =   BCi ^((~BCo)&  BCu );
-            Ago =   BCo ^((~BCu)&  BCa );
-            Agu =   BCu ^((~BCa)&  BCe );
-
-            Ebe ^= De;
-            BCa = ROL(Ebe, 1);
-            Egi ^= Di;
-            BCe = ROL(Egi, 6);
-            Eko ^= Do;
-            BCi = ROL(Eko, 25);
-            Emu ^= Du;
-            BCo = ROL(Emu, 8);
-            Esa ^= Da;
-            BCu = ROL(Esa, 18);
-            Aka =   BCa ^((~BCe)&  BCi );
-            Ake =   BCe ^((~BCi)&  BCo );
-            Aki =   BCi ^((~BCo)&  BCu );
-            Ako =   BCo ^((~BCu)&  BCa );
-            Aku =   BCu ^((~BCa)&  BCe );
-
-            Ebu ^= Du;
-            BCa = ROL(Ebu, 27);
-            Ega ^= Da;
-            BCe = ROL(Ega, 36);
-            Eke ^= De;
-            BCi = ROL(Eke, 10);
-            Emi ^= Di;
-            BCo = ROL(Emi, 15);
-            Eso ^= Do;
-            BCu = ROL(Eso, 56);
-            Ama =   BCa ^((~BCe)&  BCi );
-            Ame =   BCe ^((~BCi)&  BCo );
-            Ami =   BCi ^((~BCo)&  BCu );
-            Amo =   BCo ^((~BCu)&  BCa );
-            Amu =   BCu ^((~BCa)&  BCe );
-
-            Ebi ^= Di;
-            BCa = ROL(Ebi, 62);
-            Ego ^= Do;
-            BCe = ROL(Ego, 55);
-            Eku ^= Du;
-            BCi = ROL(Eku, 39);
-            Ema ^= Da;
-            BCo = ROL(Ema, 41);
-            Ese ^= De;
-            BCu = ROL(Ese, 2);
-            Asa =   BCa ^((~BCe)&  BCi );
-            Ase =   BCe ^((~BCi)&  BCo );
-            Asi =   BCi ^((~BCo)&  BCu );
-            Aso =   BCo ^((~BCu)&  BCa );
-            Asu =   BCu ^((~BCa)&  BCe );
-        }
-
-        //copyToState(state, A)
-        state[ 0] = Aba;
-        state[ 1] = Abe;
-        state[ 2] = Abi;
-        state[ 3] = Abo;
-        state[ 4] = Abu;
-        state[ 5] = Aga;
-        state[ 6] = Age;
-        state[ 7] = Agi;
-        state[ 8] = Ago;
-        state[ 9] = Agu;
-        state[10] = Aka;
-        state[11] = Ake;
-        state[12] = Aki;
-        state[13] = Ako;
-        state[14] = Aku;
-        state[15] = Ama;
-        state[16] = Ame;
-        state[17] = Ami;
-        state[18] = Amo;
-        state[19] = Amu;
-        state[20] = Asa;
-        state[21] = Ase;
-        state[22] = Asi;
-        state[23] = Aso;
-        state[24] = Asu;
-
-        #undef    round
-}
-
-#include <string.h>
-#define MIN(a, b) ((a) < (b) ? (a) : (b))
-
-
-static void keccak_absorb(uint64_t *s, unsigned int r, const unsigned char *m, unsigned long long int mlen, unsigned char p)
-{
-  unsigned long long i;
-  unsigned char t[200];
- 
-  while (mlen >= r) 
-  {
-    for (i = 0; i < r / 8; ++i)
-      s[i] ^= load64(m + 8 * i);
-    
-    KeccakF1600_StatePermute(s);
-    mlen -= r;
-    m += r;
-  }
-
-  for (i = 0; i < r; ++i)
-    t[i] = 0;
-  for (i = 0; i < mlen; ++i)
-    t[i] = m[i];
-  t[i] = p;
-  t[r - 1] |= 128;
-  for (i = 0; i < r / 8; ++i)
-    s[i] ^= load64(t + 8 * i);
-}
-
-
-static void keccak_squeezeblocks(unsigned char *h, unsigned long long int nblocks, uint64_t *s, unsigned int r)
-{
-  unsigned int i;
-
-  while(nblocks > 0) 
-  {
-    KeccakF1600_StatePermute(s);
-    for (i = 0; i < (r>>3); i++)
-    {
-      store64(h+8*i, s[i]);
-    }
-    h += r;
-    nblocks--;
-  }
-}
-
-
+*********************************************************************************************/  
+
+#include <stdint.h>
+#include <assert.h>
+#include "fips202.h"
+#include "../config.h"
+
+#define NROUNDS 24
+#define ROL(a, offset) ((a << offset) ^ (a >> (64-offset)))
+
+
+static uint64_t load64(const unsigned char *x)
+{
+  return LETOH_64(*((uint64_t*)x));
+}
+
+
+static void store64(uint8_t *x, uint64_t u)
+{
+  *(uint64_t*)x = HTOLE_64(u);
+}
+
+
+#if !defined(KECCAK_X64_ASM) || defined(AVX2_KECCAK_X4_IMPLEMENTATION) || defined(_KECCAK_TEST_)
+static const uint64_t KeccakF_RoundConstants[NROUNDS] = 
+{
+    (uint64_t)0x0000000000000001ULL,
+    (uint64_t)0x0000000000008082ULL,
+    (uint64_t)0x800000000000808aULL,
+    (uint64_t)0x8000000080008000ULL,
+    (uint64_t)0x000000000000808bULL,
+    (uint64_t)0x0000000080000001ULL,
+    (uint64_t)0x8000000080008081ULL,
+    (uint64_t)0x8000000000008009ULL,
+    (uint64_t)0x000000000000008aULL,
+    (uint64_t)0x0000000000000088ULL,
+    (uint64_t)0x0000000080008009ULL,
+    (uint64_t)0x000000008000000aULL,
+    (uint64_t)0x000000008000808bULL,
+    (uint64_t)0x800000000000008bULL,
+    (uint64_t)0x8000000000008089ULL,
+    (uint64_t)0x8000000000008003ULL,
+    (uint64_t)0x8000000000008002ULL,
+    (uint64_t)0x8000000000000080ULL,
+    (uint64_t)0x000000000000800aULL,
+    (uint64_t)0x800000008000000aULL,
+    (uint64_t)0x8000000080008081ULL,
+    (uint64_t)0x8000000000008080ULL,
+    (uint64_t)0x0000000080000001ULL,
+    (uint64_t)0x8000000080008008ULL
+};
+#endif
+
+
+// The scalar permutation selected in config.h is used as KeccakF1600_StatePermute. With _KECCAK_TEST_ all of them are compiled,
+// under their own names, so that tests/test_keccak.c can compare them
+
+#if defined(KECCAK_X64_ASM) || defined(_KECCAK_TEST_)
+
+// Lane-complementing implementation in x64 assembly, see src/sha3/AMD64/keccak_x64_asm.S
+void KeccakF1600_StatePermute_x64_asm(uint64_t * state);
+#endif
+
+#if defined(KECCAK_LANE_COMPLEMENTING) || defined(_KECCAK_TEST_)
+
+void KeccakF1600_StatePermute_lc(uint64_t * state)
+{ // Lane-complementing implementation with fully unrolled rounds. The lanes Abe, Abi, Ago, Aki, Ami and Asa are kept 
+  // complemented during the permutation, which replaces most of the NOT operations of chi by ORs (8 per round instead of 25)
+  int round;
+
+        uint64_t Aba, Abe, Abi, Abo, Abu;
+        uint64_t Aga, Age, Agi, Ago, Agu;
+        uint64_t Aka, Ake, Aki, Ako, Aku;
+        uint64_t Ama, Ame, Ami, Amo, Amu;
+        uint64_t Asa, Ase, Asi, Aso, Asu;
+        uint64_t Eba, Ebe, Ebi, Ebo, Ebu;
+        uint64_t Ega, Ege, Egi, Ego, Egu;
+        uint64_t Eka, Eke, Eki, Eko, Eku;
+        uint64_t Ema, Eme, Emi, Emo, Emu;
+        uint64_t Esa, Ese, Esi, Eso, Esu;
+        uint64_t BCa, BCe, BCi, BCo, BCu;
+        uint64_t Da, De, Di, Do, Du;
+
+        //copyFromState(A, state), complementing the lanes
+        Aba = state[ 0];
+        Abe = ~state[ 1];
+        Abi = ~state[ 2];
+        Abo = state[ 3];
+        Abu = state[ 4];
+        Aga = state[ 5];
+        Age = state[ 6];
+        Agi = state[ 7];
+        Ago = ~state[ 8];
+        Agu = state[ 9];
+        Aka = state[10];
+        Ake = state[11];
+        Aki = ~state[12];
+        Ako = state[13];
+        Aku = state[14];
+        Ama = state[15];
+        Ame = state[16];
+        Ami = ~state[17];
+        Amo = state[18];
+        Amu = state[19];
+        Asa = ~state[20];
+        Ase = state[21];
+        Asi = state[22];
+        Aso = state[23];
+        Asu = state[24];
+
+        for( round = 0; round < NROUNDS; round += 2 )
+        {
+            // Theta
+            BCa = Aba^Aga^Aka^Ama^Asa;
+            BCe = Abe^Age^Ake^Ame^Ase;
+            BCi = Abi^Agi^Aki^Ami^Asi;
+            BCo = Abo^Ago^Ako^Amo^Aso;
+            BCu = Abu^Agu^Aku^Amu^Asu;
+            Da = BCu ^ ROL(BCe, 1);
+            De = BCa ^ ROL(BCi, 1);
+            Di = BCe ^ ROL(BCo, 1);
+            Do = BCi ^ ROL(BCu, 1);
+            Du = BCo ^ ROL(BCa, 1);
+
+            // Rho, Pi, Chi and Iota of plane b
+            Aba ^= Da;
+            BCa = Aba;
+            Age ^= De;
+            BCe = ROL(Age, 44);
+            Aki ^= Di;
+            BCi = ROL(Aki, 43);
+            Amo ^= Do;
+            BCo = ROL(Amo, 21);
+            Asu ^= Du;
+            BCu = ROL(Asu, 14);
+            Eba = BCa ^ (BCe | BCi);
+            Ebe = BCe ^ (~BCi | BCo);
+            Ebi = BCi ^ (BCo & BCu);
+            Ebo = BCo ^ (BCu | BCa);
+            Ebu = BCu ^ (BCa & BCe);
+            Eba ^= KeccakF_RoundConstants[round];
+
+            // Rho, Pi, Chi of plane g
+            Abo ^= Do;
+            BCa = ROL(Abo, 28);
+            Agu ^= Du;
+            BCe = ROL(Agu, 20);
+            Aka ^= Da;
+            BCi = ROL(Aka,  3);
+            Ame ^= De;
+            BCo = ROL(Ame, 45);
+            Asi ^= Di;
+            BCu = ROL(Asi, 61);
+            Ega = BCa ^ (BCe | BCi);
+            Ege = BCe ^ (BCi & BCo);
+            Egi = BCi ^ (BCo | ~BCu);
+            Ego = BCo ^ (BCu | BCa);
+            Egu = BCu ^ (BCa & BCe);
+
+            // Rho, Pi, Chi of plane k
+            Abe ^= De;
+            BCa = ROL(Abe,  1);
+            Agi ^= Di;
+            BCe = ROL(Agi,  6);
+            Ako ^= Do;
+            BCi = ROL(Ako, 25);
+            Amu ^= Du;
+            BCo = ROL(Amu,  8);
+            Asa ^= Da;
+            BCu = ROL(Asa, 18);
+            Eka = BCa ^ (BCe | BCi);
+            Eke = BCe ^ (BCi & BCo);
+            Eki = BCi ^ (~BCo & BCu);
+            Eko = (~BCo) ^ (BCu | BCa);
+            Eku = BCu ^ (BCa & BCe);
+
+            // Rho, Pi, Chi of plane m
+            Abu ^= Du;
+            BCa = ROL(Abu, 27);
+            Aga ^= Da;
+            BCe = ROL(Aga, 36);
+            Ake ^= De;
+            BCi = ROL(Ake, 10);
+            Ami ^= Di;
+            BCo = ROL(Ami, 15);
+            Aso ^= Do;
+            BCu = ROL(Aso, 56);
+            Ema = BCa ^ (BCe & BCi);
+            Eme = BCe ^ (BCi | BCo);
+            Emi = BCi ^ (~BCo | BCu);
+            Emo = (~BCo) ^ (BCu & BCa);
+            Emu = BCu ^ (BCa | BCe);
+
+            // Rho, Pi, Chi of plane s
+            Abi ^= Di;
+            BCa = ROL(Abi, 62);
+            Ago ^= Do;
+            BCe = ROL(Ago, 55);
+            Aku ^= Du;
+            BCi = ROL(Aku, 39);
+            Ama ^= Da;
+            BCo = ROL(Ama, 41);
+            Ase ^= De;
+            BCu = ROL(Ase,  2);
+            Esa = BCa ^ (~BCe & BCi);
+            Ese = (~BCe) ^ (BCi | BCo);
+            Esi = BCi ^ (BCo & BCu);
+            Eso = BCo ^ (BCu | BCa);
+            Esu = BCu ^ (BCa & BCe);
+
+            // Theta
+            BCa = Eba^Ega^Eka^Ema^Esa;
+            BCe = Ebe^Ege^Eke^Eme^Ese;
+            BCi = Ebi^Egi^Eki^Emi^Esi;
+            BCo = Ebo^Ego^Eko^Emo^Eso;
+            BCu = Ebu^Egu^Eku^Emu^Esu;
+            Da = BCu ^ ROL(BCe, 1);
+            De = BCa ^ ROL(BCi, 1);
+            Di = BCe ^ ROL(BCo, 1);
+            Do = BCi ^ ROL(BCu, 1);
+            Du = BCo ^ ROL(BCa, 1);
+
+            // Rho, Pi, Chi and Iota of plane b
+            Eba ^= Da;
+            BCa = Eba;
+            Ege ^= De;
+            BCe = ROL(Ege, 44);
+            Eki ^= Di;
+            BCi = ROL(Eki, 43);
+            Emo ^= Do;
+            BCo = ROL(Emo, 21);
+            Esu ^= Du;
+            BCu = ROL(Esu, 14);
+            Aba = BCa ^ (BCe | BCi);
+            Abe = BCe ^ (~BCi | BCo);
+            Abi = BCi ^ (BCo & BCu);
+            Abo = BCo ^ (BCu | BCa);
+            Abu = BCu ^ (BCa & BCe);
+            Aba ^= KeccakF_RoundConstants[round + 1];
+
+            // Rho, Pi, Chi of plane g
+            Ebo ^= Do;
+            BCa = ROL(Ebo, 28);
+            Egu ^= Du;
+            BCe = ROL(Egu, 20);
+            Eka ^= Da;
+            BCi = ROL(Eka,  3);
+            Eme ^= De;
+            BCo = ROL(Eme, 45);
+            Esi ^= Di;
+            BCu = ROL(Esi, 61);
+            Aga = BCa ^ (BCe | BCi);
+            Age = BCe ^ (BCi & BCo);
+            Agi = BCi ^ (BCo | ~BCu);
+            Ago = BCo ^ (BCu | BCa);
+            Agu = BCu ^ (BCa & BCe);
+
+            // Rho, Pi, Chi of plane k
+            Ebe ^= De;
+            BCa = ROL(Ebe,  1);
+            Egi ^= Di;
+            BCe = ROL(Egi,  6);
+            Eko ^= Do;
+            BCi = ROL(Eko, 25);
+            Emu ^= Du;
+            BCo = ROL(Emu,  8);
+            Esa ^= Da;
+            BCu = ROL(Esa, 18);
+            Aka = BCa ^ (BCe | BCi);
+            Ake = BCe ^ (BCi & BCo);
+            Aki = BCi ^ (~BCo & BCu);
+            Ako = (~BCo) ^ (BCu | BCa);
+            Aku = BCu ^ (BCa & BCe);
+
+            // Rho, Pi, Chi of plane m
+            Ebu ^= Du;
+            BCa = ROL(Ebu, 27);
+            Ega ^= Da;
+            BCe = ROL(Ega, 36);
+            Eke ^= De;
+            BCi = ROL(Eke, 10);
+            Emi ^= Di;
+            BCo = ROL(Emi, 15);
+            Eso ^= Do;
+            BCu = ROL(Eso, 56);
+            Ama = BCa ^ (BCe & BCi);
+            Ame = BCe ^ (BCi | BCo);
+            Ami = BCi ^ (~BCo | BCu);
+            Amo = (~BCo) ^ (BCu & BCa);
+            Amu = BCu ^ (BCa | BCe);
+
+            // Rho, Pi, Chi of plane s
+            Ebi ^= Di;
+            BCa = ROL(Ebi, 62);
+            Ego ^= Do;
+            BCe = ROL(Ego, 55);
+            Eku ^= Du;
+            BCi = ROL(Eku, 39);
+            Ema ^= Da;
+            BCo = ROL(Ema, 41);
+            Ese ^= De;
+            BCu = ROL(Ese,  2);
+            Asa = BCa ^ (~BCe & BCi);
+            Ase = (~BCe) ^ (BCi | BCo);
+            Asi = BCi ^ (BCo & BCu);
+            Aso = BCo ^ (BCu | BCa);
+            Asu = BCu ^ (BCa & BCe);
+
+        }
+
+        //copyToState(state, A), undoing the complementing
+        state[ 0] = Aba;
+        state[ 1] = ~Abe;
+        state[ 2] = ~Abi;
+        state[ 3] = Abo;
+        state[ 4] = Abu;
+        state[ 5] = Aga;
+        state[ 6] = Age;
+        state[ 7] = Agi;
+        state[ 8] = ~Ago;
+        state[ 9] = Agu;
+        state[10] = Aka;
+        state[11] = Ake;
+        state[12] = ~Aki;
+        state[13] = Ako;
+        state[14] = Aku;
+        state[15] = Ama;
+        state[16] = Ame;
+        state[17] = ~Ami;
+        state[18] = Amo;
+        state[19] = Amu;
+        state[20] = ~Asa;
+        state[21] = Ase;
+        state[22] = Asi;
+        state[23] = Aso;
+        state[24] = Asu;
+}
+
+#endif
+
+#if (!defined(KECCAK_X64_ASM) && !defined(KECCAK_LANE_COMPLEMENTING)) || defined(_KECCAK_TEST_)
+
+void KeccakF1600_StatePermute_ref(uint64_t * state)
+{
+  int round;
+
+        uint64_t Aba, Abe, Abi, Abo, Abu;
+        uint64_t Aga, Age, Agi, Ago, Agu;
+        uint64_t Aka, Ake, Aki, Ako, Aku;
+        uint64_t Ama, Ame, Ami, Amo, Amu;
+        uint64_t Asa, Ase, Asi, Aso, Asu;
+        uint64_t BCa, BCe, BCi, BCo, BCu;
+        uint64_t Da, De, Di, Do, Du;
+        uint64_t Eba, Ebe, Ebi, Ebo, Ebu;
+        uint64_t Ega, Ege, Egi, Ego, Egu;
+        uint64_t Eka, Eke, Eki, Eko, Eku;
+        uint64_t Ema, Eme, Emi, Emo, Emu;
+        uint64_t Esa, Ese, Esi, Eso, Esu;
+
+        //copyFromState(A, state)
+        Aba = state[ 0];
+        Abe = state[ 1];
+        Abi = state[ 2];
+        Abo = state[ 3];
+        Abu = state[ 4];
+        Aga = state[ 5];
+        Age = state[ 6];
+        Agi = state[ 7];
+        Ago = state[ 8];
+        Agu = state[ 9];
+        Aka = state[10];
+        Ake = state[11];
+        Aki = state[12];
+        Ako = state[13];
+        Aku = state[14];
+        Ama = state[15];
+        Ame = state[16];
+        Ami = state[17];
+        Amo = state[18];
+        Amu = state[19];
+        Asa = state[20];
+        Ase = state[21];
+        Asi = state[22];
+        Aso = state[23];
+        Asu = state[24];
+
+        for( round = 0; round < NROUNDS; round += 2 )
+        {
+            //    prepareTheta
+            BCa = Aba^Aga^Aka^Ama^Asa;
+            BCe = Abe^Age^Ake^Ame^Ase;
+            BCi = Abi^Agi^Aki^Ami^Asi;
+            BCo = Abo^Ago^Ako^Amo^Aso;
+            BCu = Abu^Agu^Aku^Amu^Asu;
+
+            //thetaRhoPiChiIotaPrepareTheta(round  , A, E)
+            Da = BCu^ROL(BCe, 1);
+            De = BCa^ROL(BCi, 1);
+            Di = BCe^ROL(BCo, 1);
+            Do = BCi^ROL(BCu, 1);
+            Du = BCo^ROL(BCa, 1);
+
+            Aba ^= Da;
+            BCa = Aba;
+            Age ^= De;
+            BCe = ROL(Age, 44);
+            Aki ^= Di;
+            BCi = ROL(Aki, 43);
+            Amo ^= Do;
+            BCo = ROL(Amo, 21);
+            Asu ^= Du;
+            BCu = ROL(Asu, 14);
+            Eba =   BCa ^((~BCe)&  BCi );
+            Eba ^= (uint64_t)KeccakF_RoundConstants[round];
+            Ebe =   BCe ^((~BCi)&  BCo );
+            Ebi =   BCi ^((~BCo)&  BCu );
+            Ebo =   BCo ^((~BCu)&  BCa );
+            Ebu =   BCu ^((~BCa)&  BCe );
+
+            Abo ^= Do;
+            BCa = ROL(Abo, 28);
+            Agu ^= Du;
+            BCe = ROL(Agu, 20);
+            Aka ^= Da;
+            BCi = ROL(Aka,  3);
+            Ame ^= De;
+            BCo = ROL(Ame, 45);
+            Asi ^= Di;
+            BCu = ROL(Asi, 61);
+            Ega =   BCa ^((~BCe)&  BCi );
+            Ege =   BCe ^((~BCi)&  BCo );
+            Egi =   BCi ^((~BCo)&  BCu );
+            Ego =   BCo ^((~BCu)&  BCa );
+            Egu =   BCu ^((~BCa)&  BCe );
+
+            Abe ^= De;
+            BCa = ROL(Abe,  1);
+            Agi ^= Di;
+            BCe = ROL(Agi,  6);
+            Ako ^= Do;
+            BCi = ROL(Ako, 25);
+            Amu ^= Du;
+            BCo = ROL(Amu,  8);
+            Asa ^= Da;
+            BCu = ROL(Asa, 18);
+            Eka =   BCa ^((~BCe)&  BCi );
+            Eke =   BCe ^((~BCi)&  BCo );
+            Eki =   BCi ^((~BCo)&  BCu );
+            Eko =   BCo ^((~BCu)&  BCa );
+            Eku =   BCu ^((~BCa)&  BCe );
+
+            Abu ^= Du;
+            BCa = ROL(Abu, 27);
+            Aga ^= Da;
+            BCe = ROL(Aga, 36);
+            Ake ^= De;
+            BCi = ROL(Ake, 10);
+            Ami ^= Di;
+            BCo = ROL(Ami, 15);
+            Aso ^= Do;
+            BCu = ROL(Aso, 56);
+            Ema =   BCa ^((~BCe)&  BCi );
+            Eme =   BCe ^((~BCi)&  BCo );
+            Emi =   BCi ^((~BCo)&  BCu );
+            Emo =   BCo ^((~BCu)&  BCa );
+            Emu =   BCu ^((~BCa)&  BCe );
+
+            Abi ^= Di;
+            BCa = ROL(Abi, 62);
+            Ago ^= Do;
+            BCe = ROL(Ago, 55);
+            Aku ^= Du;
+            BCi = ROL(Aku, 39);
+            Ama ^= Da;
+            BCo = ROL(Ama, 41);
+            Ase ^= De;
+            BCu = ROL(Ase,  2);
+            Esa =   BCa ^((~BCe)&  BCi );
+            Ese =   BCe ^((~BCi)&  BCo );
+            Esi =   BCi ^((~BCo)&  BCu );
+            Eso =   BCo ^((~BCu)&  BCa );
+            Esu =   BCu ^((~BCa)&  BCe );
+
+            //    prepareTheta
+            BCa = Eba^Ega^Eka^Ema^Esa;
+            BCe = Ebe^Ege^Eke^Eme^Ese;
+            BCi = Ebi^Egi^Eki^Emi^Esi;
+            BCo = Ebo^Ego^Eko^Emo^Eso;
+            BCu = Ebu^Egu^Eku^Emu^Esu;
+
+            //thetaRhoPiChiIotaPrepareTheta(round+1, E, A)
+            Da = BCu^ROL(BCe, 1);
+            De = BCa^ROL(BCi, 1);
+            Di = BCe^ROL(BCo, 1);
+            Do = BCi^ROL(BCu, 1);
+            Du = BCo^ROL(BCa, 1);
+
+            Eba ^= Da;
+            BCa = Eba;
+            Ege ^= De;
+            BCe = ROL(Ege, 44);
+            Eki ^= Di;
+            BCi = ROL(Eki, 43);
+            Emo ^= Do;
+            BCo = ROL(Emo, 21);
+            Esu ^= Du;
+            BCu = ROL(Esu, 14);
+            Aba =   BCa ^((~BCe)&  BCi );
+            Aba ^= (uint64_t)KeccakF_RoundConstants[round+1];
+            Abe =   BCe ^((~BCi)&  BCo );
+            Abi =   BCi ^((~BCo)&  BCu );
+            Abo =   BCo ^((~BCu)&  BCa );
+            Abu =   BCu ^((~BCa)&  BCe );
+
+            Ebo ^= Do;
+            BCa = ROL(Ebo, 28);
+            Egu ^= Du;
+            BCe = ROL(Egu, 20);
+            Eka ^= Da;
+            BCi = ROL(Eka, 3);
+            Eme ^= De;
+            BCo = ROL(Eme, 45);
+            Esi ^= Di;
+            BCu = ROL(Esi, 61);
+            Aga =   BCa ^((~BCe)&  BCi );
+            Age =   BCe ^((~BCi)&  BCo );
+            Agi =   BCi ^((~BCo)&  BCu );
+            Ago =   BCo ^((~BCu)&  BCa );
+            Agu =   BCu ^((~BCa)&  BCe );
+
+            Ebe ^= De;
+            BCa = ROL(Ebe, 1);
+            Egi ^= Di;
+            BCe = ROL(Egi, 6);
+            Eko ^= Do;
+            BCi = ROL(Eko, 25);
+            Emu ^= Du;
+            BCo = ROL(Emu, 8);
+            Esa ^= Da;
+            BCu = ROL(Esa, 18);
+            Aka =   BCa ^((~BCe)&  BCi );
+            Ake =   BCe ^((~BCi)&  BCo );
+            Aki =   BCi ^((~BCo)&  BCu );
+            Ako =   BCo ^((~BCu)&  BCa );
+            Aku =   BCu ^((~BCa)&  BCe );
+
+            Ebu ^= Du;
+            BCa = ROL(Ebu, 27);
+            Ega ^= Da;
+            BCe = ROL(Ega, 36);
+            Eke ^= De;
+            BCi = ROL(Eke, 10);
+            Emi ^= Di;
+            BCo = ROL(Emi, 15);
+            Eso ^= Do;
+            BCu = ROL(Eso, 56);
+            Ama =   BCa ^((~BCe)&  BCi );
+            Ame =   BCe ^((~BCi)&  BCo );
+            Ami =   BCi ^((~BCo)&  BCu );
+            Amo =   BCo ^((~BCu)&  BCa );
+            Amu =   BCu ^((~BCa)&  BCe );
+
+            Ebi ^= Di;
+            BCa = ROL(Ebi, 62);
+            Ego ^= Do;
+            BCe = ROL(Ego, 55);
+            Eku ^= Du;
+            BCi = ROL(Eku, 39);
+            Ema ^= Da;
+            BCo = ROL(Ema, 41);
+            Ese ^= De;
+            BCu = ROL(Ese, 2);
+            Asa =   BCa ^((~BCe)&  BCi );
+            Ase =   BCe ^((~BCi)&  BCo );
+            Asi =   BCi ^((~BCo)&  BCu );
+            Aso =   BCo ^((~BCu)&  BCa );
+            Asu =   BCu ^((~BCa)&  BCe );
+        }
+
+        //copyToState(state, A)
+        state[ 0] = Aba;
+        state[ 1] = Abe;
+        state[ 2] = Abi;
+        state[ 3] = Abo;
+        state[ 4] = Abu;
+        state[ 5] = Aga;
+        state[ 6] = Age;
+        state[ 7] = Agi;
+        state[ 8] = Ago;
+        state[ 9] = Agu;
+        state[10] = Aka;
+        state[11] = Ake;
+        state[12] = Aki;
+        state[13] = Ako;
+        state[14] = Aku;
+        state[15] = Ama;
+        state[16] = Ame;
+        state[17] = Ami;
+        state[18] = Amo;
+        state[19] = Amu;
+        state[20] = Asa;
+        state[21] = Ase;
+        state[22] = Asi;
+        state[23] = Aso;
+        state[24] = Asu;
+
+        #undef    round
+}
+
+#endif
+
+#if defined(KECCAK_X64_ASM)
+    #define KeccakF1600_StatePermute KeccakF1600_StatePermute_x64_asm
+#elif defined(KECCAK_LANE_COMPLEMENTING)
+    #define KeccakF1600_StatePermute KeccakF1600_StatePermute_lc
+#else
+    #define KeccakF1600_StatePermute KeccakF1600_StatePermute_ref
+#endif
+
+#include <string.h>
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+
+static void keccak_absorb(uint64_t *s, unsigned int r, const unsigned char *m, unsigned long long int mlen, unsigned char p)
+{
+  unsigned long long i;
+  unsigned char t[200];
+ 
+  while (mlen >= r) 
+  {
+    for (i = 0; i < r / 8; ++i)
+      s[i] ^= load64(m + 8 * i);
+    
+    KeccakF1600_StatePermute(s);
+    mlen -= r;
+    m += r;
+  }
+
+  for (i = 0; i < r; ++i)
+    t[i] = 0;
+  for (i = 0; i < mlen; ++i)
+    t[i] = m[i];
+  t[i] = p;
+  t[r - 1] |= 128;
+  for (i = 0; i < r / 8; ++i)
+    s[i] ^= load64(t + 8 * i);
+}
+
+
+static void keccak_squeezeblocks(unsigned char *h, unsigned long long int nblocks, uint64_t *s, unsigned int r)
+{
+  unsigned int i;
+
+  while(nblocks > 0) 
+  {
+    KeccakF1600_StatePermute(s);
+    for (i = 0; i < (r>>3); i++)
+    {
+      store64(h+8*i, s[i]);
+    }
+    h += r;
+    nblocks--;
+  }
+}
+
+
 /********** SHAKE128 ***********/
 
 void shake128_absorb(uint64_t *s, const unsigned char *input, unsigned int inputByteLen)
@@ -386,35 +686,35 @@ void shake128_absorb(uint64_t *s, const unsigned char *input, unsigned int input
 void shake128_squeezeblocks(unsigned char *output, unsigned long long nblocks, uint64_t *s)
 {
 	keccak_squeezeblocks(output, nblocks, s, SHAKE128_RATE);
-}
-
-
-void shake128(unsigned char *output, unsigned long long outlen, const unsigned char *input,  unsigned long long inlen)
-{
-  uint64_t s[25] = {0};
-  unsigned char t[SHAKE128_RATE];
-  unsigned long long nblocks = outlen/SHAKE128_RATE;
-  size_t i;
-  
-  /* Absorb input */
-  keccak_absorb(s, SHAKE128_RATE, input, inlen, 0x1F);
-
-  /* Squeeze output */
-  keccak_squeezeblocks(output, nblocks, s, SHAKE128_RATE);
-
-  output += nblocks*SHAKE128_RATE;
-  outlen -= nblocks*SHAKE128_RATE;
-
-  if (outlen) 
-  {
-    keccak_squeezeblocks(t, 1, s, SHAKE128_RATE);
-    for (i = 0; i < outlen; i++)
-      output[i] = t[i];
-  }
-}
-
-
-/********** SHAKE256 ***********/
+}
+
+
+void shake128(unsigned char *output, unsigned long long outlen, const unsigned char *input,  unsigned long long inlen)
+{
+  uint64_t s[25] = {0};
+  unsigned char t[SHAKE128_RATE];
+  unsigned long long nblocks = outlen/SHAKE128_RATE;
+  size_t i;
+  
+  /* Absorb input */
+  keccak_absorb(s, SHAKE128_RATE, input, inlen, 0x1F);
+
+  /* Squeeze output */
+  keccak_squeezeblocks(output, nblocks, s, SHAKE128_RATE);
+
+  output += nblocks*SHAKE128_RATE;
+  outlen -= nblocks*SHAKE128_RATE;
+
+  if (outlen) 
+  {
+    keccak_squeezeblocks(t, 1, s, SHAKE128_RATE);
+    for (i = 0; i < outlen; i++)
+      output[i] = t[i];
+  }
+}
+
+
+/********** SHAKE256 ***********/
 
 void shake256_absorb(uint64_t *s, const unsigned char *input, unsigned int inputByteLen)
 {
@@ -425,32 +725,354 @@ void shake256_absorb(uint64_t *s, const unsigned char *input, unsigned int input
 void shake256_squeezeblocks(unsigned char *output, unsigned long long nblocks, uint64_t *s)
 {
 	keccak_squeezeblocks(output, nblocks, s, SHAKE256_RATE);
-}
-
-
-void shake256(unsigned char *output, unsigned long long outlen, const unsigned char *input,  unsigned long long inlen)
-{
-  uint64_t s[25];
-  unsigned char t[SHAKE256_RATE];
-  unsigned long long nblocks = outlen/SHAKE256_RATE;
-  size_t i;
-
-  for (i = 0; i < 25; ++i)
-    s[i] = 0;
-  
-  /* Absorb input */
-  keccak_absorb(s, SHAKE256_RATE, input, inlen, 0x1F);
-
-  /* Squeeze output */
-  keccak_squeezeblocks(output, nblocks, s, SHAKE256_RATE);
-
-  output += nblocks*SHAKE256_RATE;
-  outlen -= nblocks*SHAKE256_RATE;
-
-  if (outlen) 
-  {
-    keccak_squeezeblocks(t, 1, s, SHAKE256_RATE);
-    for (i = 0; i < outlen; i++)
-      output[i] = t[i];
-  }
+}
+
+
+void shake256(unsigned char *output, unsigned long long outlen, const unsigned char *input,  unsigned long long inlen)
+{
+  uint64_t s[25];
+  unsigned char t[SHAKE256_RATE];
+  unsigned long long nblocks = outlen/SHAKE256_RATE;
+  size_t i;
+
+  for (i = 0; i < 25; ++i)
+    s[i] = 0;
+  
+  /* Absorb input */
+  keccak_absorb(s, SHAKE256_RATE, input, inlen, 0x1F);
+
+  /* Squeeze output */
+  keccak_squeezeblocks(output, nblocks, s, SHAKE256_RATE);
+
+  output += nblocks*SHAKE256_RATE;
+  outlen -= nblocks*SHAKE256_RATE;
+
+  if (outlen) 
+  {
+    keccak_squeezeblocks(t, 1, s, SHAKE256_RATE);
+    for (i = 0; i < outlen; i++)
+      output[i] = t[i];
+  }
+}
+
+
+/********** Incremental SHAKE256 ***********/
+
+void shake256_inc_init(shake256_ctx *ctx)
+{
+  size_t i;
+
+  for (i = 0; i < 25; ++i)
+    ctx->s[i] = 0;
+  ctx->pos = 0;
+}
+
+
+void shake256_inc_absorb(shake256_ctx *ctx, const unsigned char *input, unsigned long long inlen)
+{
+  unsigned int pos = ctx->pos;
+
+  while (inlen > 0) 
+  {
+    if (((pos & 7) == 0) && (inlen >= 8)) 
+    { /* Whole lane */
+      ctx->s[pos >> 3] ^= load64(input);
+      input += 8;
+      inlen -= 8;
+      pos += 8;
+    } 
+    else 
+    {
+      ctx->s[pos >> 3] ^= (uint64_t)input[0] << (8*(pos & 7));
+      input++;
+      inlen--;
+      pos++;
+    }
+    if (pos == SHAKE256_RATE) 
+    {
+      KeccakF1600_StatePermute(ctx->s);
+      pos = 0;
+    }
+  }
+  ctx->pos = pos;
+}
+
+
+void shake256_inc_finalize(shake256_ctx *ctx)
+{
+  ctx->s[ctx->pos >> 3] ^= (uint64_t)0x1F << (8*(ctx->pos & 7));
+  ctx->s[(SHAKE256_RATE - 1) >> 3] ^= (uint64_t)128 << (8*((SHAKE256_RATE - 1) & 7));
+  ctx->pos = SHAKE256_RATE;    /* The first squeeze starts with a permutation */
+}
+
+
+void shake256_inc_squeeze(unsigned char *output, unsigned long long outlen, shake256_ctx *ctx)
+{
+  unsigned int pos = ctx->pos;
+
+  while (outlen > 0) 
+  {
+    if (pos == SHAKE256_RATE) 
+    {
+      KeccakF1600_StatePermute(ctx->s);
+      pos = 0;
+    }
+    if (((pos & 7) == 0) && (outlen >= 8)) 
+    { /* Whole lane */
+      store64(output, ctx->s[pos >> 3]);
+      output += 8;
+      outlen -= 8;
+      pos += 8;
+    } 
+    else 
+    {
+      output[0] = (unsigned char)(ctx->s[pos >> 3] >> (8*(pos & 7)));
+      output++;
+      outlen--;
+      pos++;
+    }
+  }
+  ctx->pos = pos;
+}
+
+
+void shake256_concat(unsigned char *output, unsigned long long outlen, const unsigned char *input1, unsigned long long inlen1, const unsigned char *input2, unsigned long long inlen2)
+{
+  shake256_ctx ctx;
+
+  shake256_inc_init(&ctx);
+  shake256_inc_absorb(&ctx, input1, inlen1);
+  shake256_inc_absorb(&ctx, input2, inlen2);
+  shake256_inc_finalize(&ctx);
+  shake256_inc_squeeze(output, outlen, &ctx);
+}
+
+
+/********** 4-way SHAKE256 ***********/
+
+/* Four states are stored lane-interleaved: lane i of the j-th state is located at state[4*i + j] */
+
+#if defined(AVX2_KECCAK_X4_IMPLEMENTATION)
+#include <immintrin.h>
+
+#define XOR4X(a, b)       _mm256_xor_si256(a, b)
+#define ANDNOT4X(a, b)    _mm256_andnot_si256(a, b)    /* (~a) & b */
+#define ROL4X(a, n)       _mm256_or_si256(_mm256_slli_epi64(a, n), _mm256_srli_epi64(a, 64 - (n)))
+#define ROL4X_8(a)        _mm256_shuffle_epi8(a, rol8)
+#define ROL4X_56(a)       _mm256_shuffle_epi8(a, rol56)
+
+
+void KeccakF1600_StatePermute4x(uint64_t *state)
+{ /* Four Keccak-f[1600] permutations, one per 64-bit lane of the AVX2 registers */
+  const __m256i rol8 = _mm256_setr_epi8(7, 0, 1, 2, 3, 4, 5, 6, 15, 8, 9, 10, 11, 12, 13, 14,
+                                        7, 0, 1, 2, 3, 4, 5, 6, 15, 8, 9, 10, 11, 12, 13, 14);
+  const __m256i rol56 = _mm256_setr_epi8(1, 2, 3, 4, 5, 6, 7, 0, 9, 10, 11, 12, 13, 14, 15, 8,
+                                         1, 2, 3, 4, 5, 6, 7, 0, 9, 10, 11, 12, 13, 14, 15, 8);
+  __m256i A[25], B[25];
+  __m256i C0, C1, C2, C3, C4, D0, D1, D2, D3, D4;
+  int i, round;
+
+  for (i = 0; i < 25; i++)
+    A[i] = _mm256_loadu_si256((const __m256i*)&state[4*i]);
+
+  for (round = 0; round < NROUNDS; round++)
+  {
+      // Theta
+      C0 = XOR4X(XOR4X(XOR4X(A[0], A[5]), XOR4X(A[10], A[15])), A[20]);
+      C1 = XOR4X(XOR4X(XOR4X(A[1], A[6]), XOR4X(A[11], A[16])), A[21]);
+      C2 = XOR4X(XOR4X(XOR4X(A[2], A[7]), XOR4X(A[12], A[17])), A[22]);
+      C3 = XOR4X(XOR4X(XOR4X(A[3], A[8]), XOR4X(A[13], A[18])), A[23]);
+      C4 = XOR4X(XOR4X(XOR4X(A[4], A[9]), XOR4X(A[14], A[19])), A[24]);
+      D0 = XOR4X(C4, ROL4X(C1, 1));
+      D1 = XOR4X(C0, ROL4X(C2, 1));
+      D2 = XOR4X(C1, ROL4X(C3, 1));
+      D3 = XOR4X(C2, ROL4X(C4, 1));
+      D4 = XOR4X(C3, ROL4X(C0, 1));
+
+      // Rho and Pi
+      B[ 0] = XOR4X(A[ 0], D0);
+      B[10] = ROL4X(XOR4X(A[ 1], D1), 1);
+      B[20] = ROL4X(XOR4X(A[ 2], D2), 62);
+      B[ 5] = ROL4X(XOR4X(A[ 3], D3), 28);
+      B[15] = ROL4X(XOR4X(A[ 4], D4), 27);
+      B[16] = ROL4X(XOR4X(A[ 5], D0), 36);
+      B[ 1] = ROL4X(XOR4X(A[ 6], D1), 44);
+      B[11] = ROL4X(XOR4X(A[ 7], D2), 6);
+      B[21] = ROL4X(XOR4X(A[ 8], D3), 55);
+      B[ 6] = ROL4X(XOR4X(A[ 9], D4), 20);
+      B[ 7] = ROL4X(XOR4X(A[10], D0), 3);
+      B[17] = ROL4X(XOR4X(A[11], D1), 10);
+      B[ 2] = ROL4X(XOR4X(A[12], D2), 43);
+      B[12] = ROL4X(XOR4X(A[13], D3), 25);
+      B[22] = ROL4X(XOR4X(A[14], D4), 39);
+      B[23] = ROL4X(XOR4X(A[15], D0), 41);
+      B[ 8] = ROL4X(XOR4X(A[16], D1), 45);
+      B[18] = ROL4X(XOR4X(A[17], D2), 15);
+      B[ 3] = ROL4X(XOR4X(A[18], D3), 21);
+      B[13] = ROL4X_8(XOR4X(A[19], D4));
+      B[14] = ROL4X(XOR4X(A[20], D0), 18);
+      B[24] = ROL4X(XOR4X(A[21], D1), 2);
+      B[ 9] = ROL4X(XOR4X(A[22], D2), 61);
+      B[19] = ROL4X_56(XOR4X(A[23], D3));
+      B[ 4] = ROL4X(XOR4X(A[24], D4), 14);
+
+      // Chi and Iota
+      A[ 0] = XOR4X(B[ 0], ANDNOT4X(B[ 1], B[ 2]));
+      A[ 1] = XOR4X(B[ 1], ANDNOT4X(B[ 2], B[ 3]));
+      A[ 2] = XOR4X(B[ 2], ANDNOT4X(B[ 3], B[ 4]));
+      A[ 3] = XOR4X(B[ 3], ANDNOT4X(B[ 4], B[ 0]));
+      A[ 4] = XOR4X(B[ 4], ANDNOT4X(B[ 0], B[ 1]));
+      A[ 5] = XOR4X(B[ 5], ANDNOT4X(B[ 6], B[ 7]));
+      A[ 6] = XOR4X(B[ 6], ANDNOT4X(B[ 7], B[ 8]));
+      A[ 7] = XOR4X(B[ 7], ANDNOT4X(B[ 8], B[ 9]));
+      A[ 8] = XOR4X(B[ 8], ANDNOT4X(B[ 9], B[ 5]));
+      A[ 9] = XOR4X(B[ 9], ANDNOT4X(B[ 5], B[ 6]));
+      A[10] = XOR4X(B[10], ANDNOT4X(B[11], B[12]));
+      A[11] = XOR4X(B[11], ANDNOT4X(B[12], B[13]));
+      A[12] = XOR4X(B[12], ANDNOT4X(B[13], B[14]));
+      A[13] = XOR4X(B[13], ANDNOT4X(B[14], B[10]));
+      A[14] = XOR4X(B[14], ANDNOT4X(B[10], B[11]));
+      A[15] = XOR4X(B[15], ANDNOT4X(B[16], B[17]));
+      A[16] = XOR4X(B[16], ANDNOT4X(B[17], B[18]));
+      A[17] = XOR4X(B[17], ANDNOT4X(B[18], B[19]));
+      A[18] = XOR4X(B[18], ANDNOT4X(B[19], B[15]));
+      A[19] = XOR4X(B[19], ANDNOT4X(B[15], B[16]));
+      A[20] = XOR4X(B[20], ANDNOT4X(B[21], B[22]));
+      A[21] = XOR4X(B[21], ANDNOT4X(B[22], B[23]));
+      A[22] = XOR4X(B[22], ANDNOT4X(B[23], B[24]));
+      A[23] = XOR4X(B[23], ANDNOT4X(B[24], B[20]));
+      A[24] = XOR4X(B[24], ANDNOT4X(B[20], B[21]));
+      A[ 0] = XOR4X(A[ 0], _mm256_set1_epi64x((long long)KeccakF_RoundConstants[round]));
+
+  }
+
+  for (i = 0; i < 25; i++)
+    _mm256_storeu_si256((__m256i*)&state[4*i], A[i]);
+}
+
+#else
+
+void KeccakF1600_StatePermute4x(uint64_t *state)
+{ /* Portable version, four calls to the scalar permutation */
+  uint64_t s[25];
+  unsigned int i, j;
+
+  for (j = 0; j < 4; j++)
+  {
+    for (i = 0; i < 25; i++)
+      s[i] = state[4*i + j];
+    KeccakF1600_StatePermute(s);
+    for (i = 0; i < 25; i++)
+      state[4*i + j] = s[i];
+  }
+}
+
+#endif
+
+
+void shake256x4_inc_init(shake256x4_ctx *ctx)
+{
+  size_t i;
+
+  for (i = 0; i < 4*25; ++i)
+    ctx->s[i] = 0;
+  ctx->pos = 0;
+}
+
+
+void shake256x4_inc_absorb(shake256x4_ctx *ctx, const unsigned char* const* input, unsigned long long inlen)
+{
+  unsigned int pos = ctx->pos, j;
+  unsigned long long k = 0;
+
+  while (k < inlen) 
+  {
+    if (((pos & 7) == 0) && (inlen - k >= 8)) 
+    { /* Whole lanes */
+      for (j = 0; j < 4; j++)
+        ctx->s[4*(pos >> 3) + j] ^= load64(input[j] + k);
+      k += 8;
+      pos += 8;
+    } 
+    else 
+    {
+      for (j = 0; j < 4; j++)
+        ctx->s[4*(pos >> 3) + j] ^= (uint64_t)input[j][k] << (8*(pos & 7));
+      k++;
+      pos++;
+    }
+    if (pos == SHAKE256_RATE) 
+    {
+      KeccakF1600_StatePermute4x(ctx->s);
+      pos = 0;
+    }
+  }
+  ctx->pos = pos;
+}
+
+
+void shake256x4_inc_finalize(shake256x4_ctx *ctx)
+{
+  unsigned int j;
+
+  for (j = 0; j < 4; j++) 
+  {
+    ctx->s[4*(ctx->pos >> 3) + j] ^= (uint64_t)0x1F << (8*(ctx->pos & 7));
+    ctx->s[4*((SHAKE256_RATE - 1) >> 3) + j] ^= (uint64_t)128 << (8*((SHAKE256_RATE - 1) & 7));
+  }
+  ctx->pos = SHAKE256_RATE;    /* The first squeeze starts with a permutation */
+}
+
+
+void shake256x4_inc_squeeze(unsigned char* const* output, unsigned long long outlen, shake256x4_ctx *ctx)
+{
+  unsigned int pos = ctx->pos, j;
+  unsigned long long k = 0;
+
+  while (k < outlen) 
+  {
+    if (pos == SHAKE256_RATE) 
+    {
+      KeccakF1600_StatePermute4x(ctx->s);
+      pos = 0;
+    }
+    if (((pos & 7) == 0) && (outlen - k >= 8)) 
+    { /* Whole lanes */
+      for (j = 0; j < 4; j++)
+        store64(output[j] + k, ctx->s[4*(pos >> 3) + j]);
+      k += 8;
+      pos += 8;
+    } 
+    else 
+    {
+      for (j = 0; j < 4; j++)
+        output[j][k] = (unsigned char)(ctx->s[4*(pos >> 3) + j] >> (8*(pos & 7)));
+      k++;
+      pos++;
+    }
+  }
+  ctx->pos = pos;
+}
+
+
+void shake256x4(unsigned char* const* output, unsigned long long outlen, const unsigned char* const* input, unsigned long long inlen)
+{
+  shake256x4_ctx ctx;
+
+  shake256x4_inc_init(&ctx);
+  shake256x4_inc_absorb(&ctx, input, inlen);
+  shake256x4_inc_finalize(&ctx);
+  shake256x4_inc_squeeze(output, outlen, &ctx);
+}
+
+
+void shake256x4_concat(unsigned char* const* output, unsigned long long outlen, const unsigned char* const* input1, unsigned long long inlen1, const unsigned char* const* input2, unsigned long long inlen2)
+{
+  shake256x4_ctx ctx;
+
+  shake256x4_inc_init(&ctx);
+  shake256x4_inc_absorb(&ctx, input1, inlen1);
+  shake256x4_inc_absorb(&ctx, input2, inlen2);
+  shake256x4_inc_finalize(&ctx);
+  shake256x4_inc_squeeze(output, outlen, &ctx);
 }
\ No newline at end of file
@@ -15,5 +15,35 @@ void shake256_absorb(uint64_t *s, const unsigned char *input, unsigned int input
 void shake256_squeezeblocks(unsigned char *output, unsigned long long nblocks, uint64_t *s);
 void shake256(unsigned char *output, unsigned long long outlen, const unsigned char *input,  unsigned long long inlen);
 
+// Incremental SHAKE256: shake256_inc_init, any number of calls to shake256_inc_absorb, shake256_inc_finalize, 
+// then any number of calls to shake256_inc_squeeze. Inputs and outputs can have any length.
+typedef struct {
+    uint64_t s[25];
+    unsigned int pos;    // Position in the current block of the next byte to absorb or squeeze
+} shake256_ctx;
+
+void shake256_inc_init(shake256_ctx *ctx);
+void shake256_inc_absorb(shake256_ctx *ctx, const unsigned char *input, unsigned long long inlen);
+void shake256_inc_finalize(shake256_ctx *ctx);
+void shake256_inc_squeeze(unsigned char *output, unsigned long long outlen, shake256_ctx *ctx);
+
+// SHAKE256 of the concatenation input1||input2, without copying the inputs
+void shake256_concat(unsigned char *output, unsigned long long outlen, const unsigned char *input1, unsigned long long inlen1, const unsigned char *input2, unsigned long long inlen2);
+
+// 4-way SHAKE256, computing four independent hashes of inputs of the same length in one pass (with AVX2 when available).
+// Inputs and outputs are passed as arrays of four pointers. The state holds four lane-interleaved Keccak states.
+typedef struct {
+    uint64_t s[4*25];
+    unsigned int pos;
+} shake256x4_ctx;
+
+void KeccakF1600_StatePermute4x(uint64_t *state);
+void shake256x4_inc_init(shake256x4_ctx *ctx);
+void shake256x4_inc_absorb(shake256x4_ctx *ctx, const unsigned char* const* input, unsigned long long inlen);
+void shake256x4_inc_finalize(shake256x4_ctx *ctx);
+void shake256x4_inc_squeeze(unsigned char* const* output, unsigned long long outlen, shake256x4_ctx *ctx);
+void shake256x4(unsigned char* const* output, unsigned long long outlen, const unsigned char* const* input, unsigned long long inlen);
+void shake256x4_concat(unsigned char* const* output, unsigned long long outlen, const unsigned char* const* input1, unsigned long long inlen1, const unsigned char* const* input2, unsigned long long inlen2);
+
 
 #endif
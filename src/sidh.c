@@ -37,240 +37,562 @@ void random_mod_order_B(unsigned char* random_digits)
 }
 
 
-int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA)
-{ // Alice's ephemeral public key generation
+static void encode_public_key(point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR, unsigned char* PublicKey)
+{ // Encoding of a public key given the projective images of the basis points, where the Z-coordinates have already been inverted
+  // Input:  points phiP = (X:1/Z), phiQ = (X:1/Z) and phiR = (X:1/Z).
+  // Output: the public key PublicKey consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+
+    fp2mul_mont(phiP->X, phiP->Z, phiP->X);
+    fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
+    fp2mul_mont(phiR->X, phiR->Z, phiR->X);
+                
+    fp2_encode(phiP->X, PublicKey);
+    fp2_encode(phiQ->X, PublicKey + FP2_ENCODED_BYTES);
+    fp2_encode(phiR->X, PublicKey + 2*FP2_ENCODED_BYTES);
+}
+
+
+#define MAX_INT_POINTS ((MAX_INT_POINTS_ALICE > MAX_INT_POINTS_BOB) ? MAX_INT_POINTS_ALICE : MAX_INT_POINTS_BOB)
+
+typedef struct {
+    point_proj_t R, pts[MAX_INT_POINTS], phi[3];
+    f2elm_t coeff[3], A24plus, A24minus, C24;
+    unsigned int pts_index[MAX_INT_POINTS], npts, index, row, ii;
+} isogeny_walk_t;                  // State of a resumable traversal of Alice's or Bob's isogeny tree 
+
+
+static void walk_start(isogeny_walk_t* w, const point_proj_t R)
+{ // Start of a tree traversal from the kernel point R, which continues with walk_step_A or walk_step_B
+
+    fp2copy(R->X, w->R->X);
+    fp2copy(R->Z, w->R->Z);
+    w->index = 0;
+    w->npts = 0;
+    w->ii = 0;
+    w->row = 1;
+}
+
+
+static void walk_step_A(isogeny_walk_t* w, const unsigned int nphi)
+{ // Computes the next step of the traversal of Alice's 4-isogeny tree, which is either one multiplication by the strategy or, once row w->row has reached 
+  // its leaf, the isogeny of that row together with its evaluation at the stored points and at the first nphi points of w->phi.
+  // The traversal is complete when w->row > MAX_Alice. The constants w->A24plus = A+2C and w->C24 = 4C are updated to those of the codomain.
+    unsigned int i, m;
+
+    if ((w->row < MAX_Alice) && (w->index < MAX_Alice-w->row)) {
+        fp2copy(w->R->X, w->pts[w->npts]->X);
+        fp2copy(w->R->Z, w->pts[w->npts]->Z);
+        w->pts_index[w->npts++] = w->index;
+        m = strat_Alice[w->ii++];
+        xDBLe(w->R, w->R, w->A24plus, w->C24, (int)(2*m));
+        w->index += m;
+    } else {
+        get_4_isog(w->R, w->A24plus, w->C24, w->coeff);
+
+        for (i = 0; i < nphi; i++) {
+            eval_4_isog(w->phi[i], w->coeff);
+        }
+        if (w->row < MAX_Alice) {
+            for (i = 0; i < w->npts; i++) {
+                eval_4_isog(w->pts[i], w->coeff);
+            }
+            fp2copy(w->pts[w->npts-1]->X, w->R->X); 
+            fp2copy(w->pts[w->npts-1]->Z, w->R->Z);
+            w->index = w->pts_index[w->npts-1];
+            w->npts -= 1;
+        }
+        w->row++;
+    }
+}
+
+
+static void walk_step_B(isogeny_walk_t* w, const unsigned int nphi)
+{ // Computes the next step of the traversal of Bob's 3-isogeny tree, which is either one multiplication by the strategy or, once row w->row has reached 
+  // its leaf, the isogeny of that row together with its evaluation at the stored points and at the first nphi points of w->phi.
+  // The traversal is complete when w->row > MAX_Bob. The constants w->A24plus = A+2C and w->A24minus = A-2C are updated to those of the codomain.
+    unsigned int i, m;
+
+    if ((w->row < MAX_Bob) && (w->index < MAX_Bob-w->row)) {
+        fp2copy(w->R->X, w->pts[w->npts]->X);
+        fp2copy(w->R->Z, w->pts[w->npts]->Z);
+        w->pts_index[w->npts++] = w->index;
+        m = strat_Bob[w->ii++];
+        xTPLe(w->R, w->R, w->A24minus, w->A24plus, (int)m);
+        w->index += m;
+    } else {
+        get_3_isog(w->R, w->A24minus, w->A24plus, w->coeff);
+
+        for (i = 0; i < nphi; i++) {
+            eval_3_isog(w->phi[i], w->coeff);
+        }
+        if (w->row < MAX_Bob) {
+            for (i = 0; i < w->npts; i++) {
+                eval_3_isog(w->pts[i], w->coeff);
+            }
+            fp2copy(w->pts[w->npts-1]->X, w->R->X); 
+            fp2copy(w->pts[w->npts-1]->Z, w->R->Z);
+            w->index = w->pts_index[w->npts-1];
+            w->npts -= 1;
+        }
+        w->row++;
+    }
+}
+
+
+#if defined(PARALLEL_WALK)
+#include <sched.h>
+#include "threads/threadpool.h"
+
+#define WALK_EVALUATORS     THREADPOOL_THREADS    // Workers of the thread pool that evaluate the isogenies for the walking thread
+#define WALK_RING           16                    // Number of rows whose isogeny can be pending at the evaluators
+#define WALK_UNCLAIMED      0                     // Owners of the work of an evaluator
+#define WALK_WORKER         1
+#define WALK_WALKER         2
+
+typedef struct walk_parallel {
+    isogeny_walk_t* w;
+    unsigned int nphi, AliceOrBob, max;
+    f2elm_t coeff[WALK_RING][3];                  // Isogenies of the last WALK_RING rows published by the walking thread
+    unsigned int nstored[WALK_RING];              // Number of stored points to be evaluated by the evaluators at each of these rows
+    unsigned int rows;                            // Number of rows published by the walking thread
+    unsigned int applied[MAX_INT_POINTS];         // Number of isogenies applied to each stored point
+    unsigned int done[WALK_EVALUATORS];           // Number of rows completed by each evaluator
+    unsigned int owner[WALK_EVALUATORS];          // Thread doing the work of each evaluator
+    threadpool_job_t job[WALK_EVALUATORS];
+    struct walk_evaluator {
+        struct walk_parallel* walk;
+        unsigned int id;
+    } evaluator[WALK_EVALUATORS];          // Arguments of the tasks
+} walk_parallel_t;                 // State of a tree traversal whose isogeny evaluations run on the thread pool
+
+
+static void walk_evaluate_row(walk_parallel_t* p, const unsigned int id, const unsigned int row)
+{ // Work of evaluator id at row: the isogeny of the row is evaluated at the stored points k and at the points w->phi[k] with k = id mod WALK_EVALUATORS.
+  // The stored points are evaluated from the top of the stack down, since the walking thread pops them in that order
+    f2elm_t* coeff = p->coeff[row % WALK_RING];
+    unsigned int k = p->nstored[row % WALK_RING];
+
+    while (k-- > 0) {
+        if (k % WALK_EVALUATORS == id) {
+            if (p->AliceOrBob == ALICE) {
+                eval_4_isog(p->w->pts[k], coeff);
+            } else {
+                eval_3_isog(p->w->pts[k], coeff);
+            }
+            __atomic_store_n(&p->applied[k], row, __ATOMIC_RELEASE);
+        }
+    }
+    for (k = id; k < p->nphi; k += WALK_EVALUATORS) {
+        if (p->AliceOrBob == ALICE) {
+            eval_4_isog(p->w->phi[k], coeff);
+        } else {
+            eval_3_isog(p->w->phi[k], coeff);
+        }
+    }
+    __atomic_store_n(&p->done[id], row, __ATOMIC_RELEASE);
+}
+
+
+static void walk_evaluator_task(void* arg)
+{ // Evaluator run on the thread pool, unless the walking thread has already claimed its work
+    struct walk_evaluator* e = (struct walk_evaluator*)arg;
+    walk_parallel_t* p = e->walk;
+    unsigned int row, owner = WALK_UNCLAIMED;
+
+    if (!__atomic_compare_exchange_n(&p->owner[e->id], &owner, WALK_WORKER, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return;
+    }
+    for (row = 1; row <= p->max; row++) {
+        while (__atomic_load_n(&p->rows, __ATOMIC_ACQUIRE) < row) {
+            sched_yield();
+        }
+        walk_evaluate_row(p, e->id, row);
+    }
+}
+
+
+static void walk_wait(walk_parallel_t* p, const unsigned int id, const unsigned int* counter, const unsigned int target)
+{ // Waits until *counter, which is updated by evaluator id, reaches target. An evaluator that has not started on the thread pool yet is claimed
+  // by the walking thread, which then catches up with its work and does it after each row, so that the traversal never waits for a busy pool
+    unsigned int row, owner = WALK_UNCLAIMED;
+
+    while (__atomic_load_n(counter, __ATOMIC_ACQUIRE) < target) {
+        if (__atomic_load_n(&p->owner[id], __ATOMIC_ACQUIRE) == WALK_UNCLAIMED &&
+            __atomic_compare_exchange_n(&p->owner[id], &owner, WALK_WALKER, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            for (row = p->done[id] + 1; row <= p->rows; row++) {
+                walk_evaluate_row(p, id, row);
+            }
+            return;
+        }
+        owner = WALK_UNCLAIMED;
+        sched_yield();
+    }
+}
+
+
+static void walk_parallel(isogeny_walk_t* w, const unsigned int nphi, const unsigned int AliceOrBob)
+{ // Traversal of Alice's or Bob's tree from its start, see walk_step_A and walk_step_B. The calling thread walks the strategy and computes the isogenies, 
+  // and evaluates each isogeny only at the point that it pops next. The evaluations at the other stored points and at w->phi run on the thread pool, 
+  // and overlap with the next multiplications by the strategy
+    walk_parallel_t p;
+    unsigned int i, k, m, row, max = (AliceOrBob == ALICE) ? MAX_Alice : MAX_Bob;
+
+    p.w = w;
+    p.nphi = nphi;
+    p.AliceOrBob = AliceOrBob;
+    p.max = max;
+    p.rows = 0;
+    for (i = 0; i < WALK_EVALUATORS; i++) {
+        p.done[i] = 0;
+        p.owner[i] = WALK_UNCLAIMED;
+        p.evaluator[i].walk = &p;
+        p.evaluator[i].id = i;
+    }
+    for (i = 0; i < WALK_EVALUATORS; i++) {
+        if (threadpool_try_submit(&p.job[i], walk_evaluator_task, &p.evaluator[i]) == 0) {
+            p.owner[i] = WALK_WALKER;
+        }
+    }
+
+    while (w->row <= max) {
+        if ((w->row < max) && (w->index < max-w->row)) {
+            fp2copy(w->R->X, w->pts[w->npts]->X);
+            fp2copy(w->R->Z, w->pts[w->npts]->Z);
+            p.applied[w->npts] = w->row - 1;
+            w->pts_index[w->npts++] = w->index;
+            if (AliceOrBob == ALICE) {
+                m = strat_Alice[w->ii++];
+                xDBLe(w->R, w->R, w->A24plus, w->C24, (int)(2*m));
+            } else {
+                m = strat_Bob[w->ii++];
+                xTPLe(w->R, w->R, w->A24minus, w->A24plus, (int)m);
+            }
+            w->index += m;
+        } else {
+            row = w->row;
+            for (i = 0; i < WALK_EVALUATORS && row > WALK_RING; i++) {
+                walk_wait(&p, i, &p.done[i], row - WALK_RING);
+            }
+            if (AliceOrBob == ALICE) {
+                get_4_isog(w->R, w->A24plus, w->C24, p.coeff[row % WALK_RING]);
+            } else {
+                get_3_isog(w->R, w->A24minus, w->A24plus, p.coeff[row % WALK_RING]);
+            }
+            p.nstored[row % WALK_RING] = (row < max) ? w->npts - 1 : 0;
+            __atomic_store_n(&p.rows, row, __ATOMIC_RELEASE);
+            for (i = 0; i < WALK_EVALUATORS; i++) {
+                if (__atomic_load_n(&p.owner[i], __ATOMIC_ACQUIRE) == WALK_WALKER) {
+                    walk_evaluate_row(&p, i, row);
+                }
+            }
+
+            if (row < max) {
+                k = w->npts - 1;
+                walk_wait(&p, k % WALK_EVALUATORS, &p.applied[k], row - 1);
+                if (AliceOrBob == ALICE) {
+                    eval_4_isog(w->pts[k], p.coeff[row % WALK_RING]);
+                } else {
+                    eval_3_isog(w->pts[k], p.coeff[row % WALK_RING]);
+                }
+                fp2copy(w->pts[k]->X, w->R->X); 
+                fp2copy(w->pts[k]->Z, w->R->Z);
+                w->index = w->pts_index[k];
+                w->npts -= 1;
+            }
+            w->row++;
+        }
+    }
+
+    for (i = 0; i < WALK_EVALUATORS; i++) {
+        walk_wait(&p, i, &p.done[i], max);
+        threadpool_wait(&p.job[i]);
+    }
+}
+#endif
+
+
+static void walk_run(isogeny_walk_t* w, const unsigned int nphi, const unsigned int AliceOrBob)
+{ // Traversal of Alice's or Bob's tree from its start until the last row, in parallel if PARALLEL_WALK is defined
+
+#if defined(PARALLEL_WALK)
+    walk_parallel(w, nphi, AliceOrBob);
+#else
+    if (AliceOrBob == ALICE) {
+        while (w->row <= MAX_Alice) {
+            walk_step_A(w, nphi);
+        }
+    } else {
+        while (w->row <= MAX_Bob) {
+            walk_step_B(w, nphi);
+        }
+    }
+#endif
+}
+
+
+static void KeyGeneration_A_start(const unsigned char* PrivateKeyA, ladder3pt_t* L, isogeny_walk_t* w)
+{ // Initialization of Alice's ephemeral public key generation
   // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
-  // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
-    point_proj_t R, phiP = {0}, phiQ = {0}, phiR = {0}, pts[MAX_INT_POINTS_ALICE];
-    f2elm_t XPA, XQA, XRA, coeff[3], A24plus = {0}, C24 = {0}, A = {0};
-    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+  // Output: the kernel point ladder L, to be run with LADDER3PT_resume, and the images w->phi of Bob's basis points.
+    f2elm_t XPA, XQA, XRA, A = {0};
     digit_t SecretKeyA[NWORDS_ORDER] = {0};
 
     // Initialize basis points
     init_basis((digit_t*)A_gen, XPA, XQA, XRA);
-    init_basis((digit_t*)B_gen, phiP->X, phiQ->X, phiR->X);
-    fpcopy((digit_t*)&Montgomery_one, (phiP->Z)[0]);
-    fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
-    fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
+    init_basis((digit_t*)B_gen, w->phi[0]->X, w->phi[1]->X, w->phi[2]->X);
+    fp2zero(w->phi[0]->Z);
+    fp2zero(w->phi[1]->Z);
+    fp2zero(w->phi[2]->Z);
+    fpcopy((digit_t*)&Montgomery_one, (w->phi[0]->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (w->phi[1]->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (w->phi[2]->Z)[0]);
 
     // Initialize constants: A24plus = A+2C, C24 = 4C, where A=6, C=1
-    fpcopy((digit_t*)&Montgomery_one, A24plus[0]);
-    mp2_add(A24plus, A24plus, A24plus);
-    mp2_add(A24plus, A24plus, C24);
-    mp2_add(A24plus, C24, A);
-    mp2_add(C24, C24, A24plus);
+    fp2zero(w->A24plus);
+    fp2zero(w->C24);
+    fpcopy((digit_t*)&Montgomery_one, w->A24plus[0]);
+    mp2_add(w->A24plus, w->A24plus, w->A24plus);
+    mp2_add(w->A24plus, w->A24plus, w->C24);
+    mp2_add(w->A24plus, w->C24, A);
+    mp2_add(w->C24, w->C24, w->A24plus);
 
     // Retrieve kernel point
     decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
-    LADDER3PT(XPA, XQA, XRA, SecretKeyA, ALICE, R, A);       
+#if defined(FIXED_BASIS_LADDER)
+    LADDER3PT_fixed_start(L, XPA, XRA, A_ladder_table, SecretKeyA, ALICE);
+#else
+    LADDER3PT_start(L, XPA, XQA, XRA, SecretKeyA, ALICE, A);
+#endif
+}
+
+
+static void KeyGeneration_A_walk_start(const ladder3pt_t* L, isogeny_walk_t* w)
+{ // Start of the traversal of Alice's tree from the kernel point computed by the ladder L, which continues with walk_step_A
+
+    walk_start(w, L->R);
 
 #if (OALICE_BITS % 2 == 1)
     point_proj_t S;
 
-    xDBLe(R, S, A24plus, C24, (int)(OALICE_BITS-1));
-    get_2_isog(S, A24plus, C24); 
-    eval_2_isog(phiP, S); 
-    eval_2_isog(phiQ, S); 
-    eval_2_isog(phiR, S);
-    eval_2_isog(R, S);
+    xDBLe(w->R, S, w->A24plus, w->C24, (int)(OALICE_BITS-1));
+    get_2_isog(S, w->A24plus, w->C24); 
+    eval_2_isog(w->phi[0], S); 
+    eval_2_isog(w->phi[1], S); 
+    eval_2_isog(w->phi[2], S);
+    eval_2_isog(w->R, S);
 #endif
+}
+
+
+static void KeyGeneration_A_proj(const unsigned char* PrivateKeyA, point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR)
+{ // Projective part of Alice's ephemeral public key generation
+  // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
+  // Output: the projective images phiP, phiQ and phiR of Bob's basis points.
+    ladder3pt_t L;
+    isogeny_walk_t w;
+
+    KeyGeneration_A_start(PrivateKeyA, &L, &w);
+    LADDER3PT_resume(&L, L.nbits);
 
     // Traverse tree
-    index = 0;        
-    for (row = 1; row < MAX_Alice; row++) {
-        while (index < MAX_Alice-row) {
-            fp2copy(R->X, pts[npts]->X);
-            fp2copy(R->Z, pts[npts]->Z);
-            pts_index[npts++] = index;
-            m = strat_Alice[ii++];
-            xDBLe(R, R, A24plus, C24, (int)(2*m));
-            index += m;
-        }
-        get_4_isog(R, A24plus, C24, coeff);        
+    KeyGeneration_A_walk_start(&L, &w);
+    walk_run(&w, 3, ALICE);
+
+    fp2copy(w.phi[0]->X, phiP->X);
+    fp2copy(w.phi[0]->Z, phiP->Z);
+    fp2copy(w.phi[1]->X, phiQ->X);
+    fp2copy(w.phi[1]->Z, phiQ->Z);
+    fp2copy(w.phi[2]->X, phiR->X);
+    fp2copy(w.phi[2]->Z, phiR->Z);
+}
 
-        for (i = 0; i < npts; i++) {
-            eval_4_isog(pts[i], coeff);
-        }
-        eval_4_isog(phiP, coeff);
-        eval_4_isog(phiQ, coeff);
-        eval_4_isog(phiR, coeff);
-
-        fp2copy(pts[npts-1]->X, R->X); 
-        fp2copy(pts[npts-1]->Z, R->Z);
-        index = pts_index[npts-1];
-        npts -= 1;
-    }
 
-    get_4_isog(R, A24plus, C24, coeff); 
-    eval_4_isog(phiP, coeff);
-    eval_4_isog(phiQ, coeff);
-    eval_4_isog(phiR, coeff);
+int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA)
+{ // Alice's ephemeral public key generation
+  // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
+  // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    point_proj_t phiP, phiQ, phiR;
 
+    KeyGeneration_A_proj(PrivateKeyA, phiP, phiQ, phiR);
     inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
-    fp2mul_mont(phiP->X, phiP->Z, phiP->X);
-    fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
-    fp2mul_mont(phiR->X, phiR->Z, phiR->X);
-                
-    // Format public key                   
-    fp2_encode(phiP->X, PublicKeyA);
-    fp2_encode(phiQ->X, PublicKeyA + FP2_ENCODED_BYTES);
-    fp2_encode(phiR->X, PublicKeyA + 2*FP2_ENCODED_BYTES);
+
+    // Format public key
+    encode_public_key(phiP, phiQ, phiR, PublicKeyA);
 
     return 0;
 }
 
 
-int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB)
-{ // Bob's ephemeral public key generation
+static void KeyGeneration_B_proj(const unsigned char* PrivateKeyB, point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR)
+{ // Projective part of Bob's ephemeral public key generation
   // Input:  a private key PrivateKeyB in the range [0, 2^Floor(Log(2,oB)) - 1]. 
-  // Output: the public key PublicKeyB consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
-    point_proj_t R, phiP = {0}, phiQ = {0}, phiR = {0}, pts[MAX_INT_POINTS_BOB];
-    f2elm_t XPB, XQB, XRB, coeff[3], A24plus = {0}, A24minus = {0}, A = {0};
-    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
+  // Output: the projective images phiP, phiQ and phiR of Alice's basis points.
+    point_proj_t R;
+    isogeny_walk_t w;
+    f2elm_t XPB, XQB, XRB, A = {0};
     digit_t SecretKeyB[NWORDS_ORDER] = {0};
 
     // Initialize basis points
     init_basis((digit_t*)B_gen, XPB, XQB, XRB);
-    init_basis((digit_t*)A_gen, phiP->X, phiQ->X, phiR->X);
-    fpcopy((digit_t*)&Montgomery_one, (phiP->Z)[0]);
-    fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
-    fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
+    init_basis((digit_t*)A_gen, w.phi[0]->X, w.phi[1]->X, w.phi[2]->X);
+    fp2zero(w.phi[0]->Z);
+    fp2zero(w.phi[1]->Z);
+    fp2zero(w.phi[2]->Z);
+    fpcopy((digit_t*)&Montgomery_one, (w.phi[0]->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (w.phi[1]->Z)[0]);
+    fpcopy((digit_t*)&Montgomery_one, (w.phi[2]->Z)[0]);
 
     // Initialize constants: A24minus = A-2C, A24plus = A+2C, where A=6, C=1
-    fpcopy((digit_t*)&Montgomery_one, A24plus[0]);
-    mp2_add(A24plus, A24plus, A24plus);
-    mp2_add(A24plus, A24plus, A24minus);
-    mp2_add(A24plus, A24minus, A);
-    mp2_add(A24minus, A24minus, A24plus);
+    fp2zero(w.A24plus);
+    fp2zero(w.A24minus);
+    fpcopy((digit_t*)&Montgomery_one, w.A24plus[0]);
+    mp2_add(w.A24plus, w.A24plus, w.A24plus);
+    mp2_add(w.A24plus, w.A24plus, w.A24minus);
+    mp2_add(w.A24plus, w.A24minus, A);
+    mp2_add(w.A24minus, w.A24minus, w.A24plus);
 
     // Retrieve kernel point
     decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
+#if defined(FIXED_BASIS_LADDER)
+    LADDER3PT_fixed(XPB, XRB, B_ladder_table, SecretKeyB, BOB, R);
+#else
     LADDER3PT(XPB, XQB, XRB, SecretKeyB, BOB, R, A);
+#endif
     
     // Traverse tree
-    index = 0;  
-    for (row = 1; row < MAX_Bob; row++) {
-        while (index < MAX_Bob-row) {
-            fp2copy(R->X, pts[npts]->X);
-            fp2copy(R->Z, pts[npts]->Z);
-            pts_index[npts++] = index;
-            m = strat_Bob[ii++];
-            xTPLe(R, R, A24minus, A24plus, (int)m);
-            index += m;
-        } 
-        get_3_isog(R, A24minus, A24plus, coeff);
-
-        for (i = 0; i < npts; i++) {
-            eval_3_isog(pts[i], coeff);
-        }     
-        eval_3_isog(phiP, coeff);
-        eval_3_isog(phiQ, coeff);
-        eval_3_isog(phiR, coeff);
-
-        fp2copy(pts[npts-1]->X, R->X); 
-        fp2copy(pts[npts-1]->Z, R->Z);
-        index = pts_index[npts-1];
-        npts -= 1;
-    }
-    
-    get_3_isog(R, A24minus, A24plus, coeff);
-    eval_3_isog(phiP, coeff);
-    eval_3_isog(phiQ, coeff);
-    eval_3_isog(phiR, coeff);
+    walk_start(&w, R);
+    walk_run(&w, 3, BOB);
+
+    fp2copy(w.phi[0]->X, phiP->X);
+    fp2copy(w.phi[0]->Z, phiP->Z);
+    fp2copy(w.phi[1]->X, phiQ->X);
+    fp2copy(w.phi[1]->Z, phiQ->Z);
+    fp2copy(w.phi[2]->X, phiR->X);
+    fp2copy(w.phi[2]->Z, phiR->Z);
+}
 
+
+int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB)
+{ // Bob's ephemeral public key generation
+  // Input:  a private key PrivateKeyB in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  // Output: the public key PublicKeyB consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    point_proj_t phiP, phiQ, phiR;
+
+    KeyGeneration_B_proj(PrivateKeyB, phiP, phiQ, phiR);
     inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
-    fp2mul_mont(phiP->X, phiP->Z, phiP->X);
-    fp2mul_mont(phiQ->X, phiQ->Z, phiQ->X);
-    fp2mul_mont(phiR->X, phiR->Z, phiR->X);
 
     // Format public key
-    fp2_encode(phiP->X, PublicKeyB);
-    fp2_encode(phiQ->X, PublicKeyB + FP2_ENCODED_BYTES);
-    fp2_encode(phiR->X, PublicKeyB + 2*FP2_ENCODED_BYTES);
+    encode_public_key(phiP, phiQ, phiR, PublicKeyB);
 
     return 0;
 }
 
 
-int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA)
-{ // Alice's ephemeral shared secret computation
-  // It produces a shared secret key SharedSecretA using her secret key PrivateKeyA and Bob's public key PublicKeyB
-  // Inputs: Alice's PrivateKeyA is an integer in the range [0, oA-1]. 
-  //         Bob's PublicKeyB consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
-  // Output: a shared secret SharedSecretA that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
-    point_proj_t R, pts[MAX_INT_POINTS_ALICE];
-    f2elm_t coeff[3], PKB[3], jinv;
-    f2elm_t A24plus = {0}, C24 = {0}, A = {0};
-    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
-    digit_t SecretKeyA[NWORDS_ORDER] = {0};
-      
+static void PublicKeyB_prepare(const unsigned char* PublicKeyB, f2elm_t* curve)
+{ // Decoding of Bob's public key and recovery of its curve constants, i.e., the part of Alice's shared secret computation that only depends on PublicKeyB
+  // Input:  Bob's PublicKeyB consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: curve = {PKB[0], PKB[1], PKB[2], A, A24plus, C24} in Montgomery representation, where A24plus = A+2C and C24 = 4C with C=1.
+
     // Initialize images of Bob's basis
-    fp2_decode(PublicKeyB, PKB[0]);
-    fp2_decode(PublicKeyB + FP2_ENCODED_BYTES, PKB[1]);
-    fp2_decode(PublicKeyB + 2*FP2_ENCODED_BYTES, PKB[2]);
+    fp2_decode(PublicKeyB, curve[0]);
+    fp2_decode(PublicKeyB + FP2_ENCODED_BYTES, curve[1]);
+    fp2_decode(PublicKeyB + 2*FP2_ENCODED_BYTES, curve[2]);
 
     // Initialize constants: A24plus = A+2C, C24 = 4C, where C=1
-    get_A(PKB[0], PKB[1], PKB[2], A);
-    mp_add((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, C24[0], NWORDS_FIELD);
-    mp2_add(A, C24, A24plus);
-    mp_add(C24[0], C24[0], C24[0], NWORDS_FIELD);
+    get_A(curve[0], curve[1], curve[2], curve[3]);
+    fp2zero(curve[5]);
+    mp_add((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, curve[5][0], NWORDS_FIELD);
+    mp2_add(curve[3], curve[5], curve[4]);
+    mp_add(curve[5][0], curve[5][0], curve[5][0], NWORDS_FIELD);
+}
+
+
+static void SecretAgreement_A_prepared_proj(const unsigned char* PrivateKeyA, const f2elm_t* curve, f2elm_t jnum, f2elm_t jden)
+{ // Projective part of Alice's ephemeral shared secret computation, using a public key prepared with PublicKeyB_prepare
+  // Inputs: Alice's PrivateKeyA is an integer in the range [0, oA-1]. 
+  //         curve = {PKB[0], PKB[1], PKB[2], A, A24plus, C24} obtained from Bob's public key, which is not modified.
+  // Output: the shared j-invariant as a fraction jnum/jden.
+    point_proj_t R;
+    isogeny_walk_t w;
+    digit_t SecretKeyA[NWORDS_ORDER] = {0};
+      
+    fp2copy(curve[4], w.A24plus);
+    fp2copy(curve[5], w.C24);
 
     // Retrieve kernel point
     decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
-    LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyA, ALICE, R, A);    
+    LADDER3PT(curve[0], curve[1], curve[2], SecretKeyA, ALICE, R, curve[3]);
 
 #if (OALICE_BITS % 2 == 1)
     point_proj_t S;
 
-    xDBLe(R, S, A24plus, C24, (int)(OALICE_BITS-1));
-    get_2_isog(S, A24plus, C24);
+    xDBLe(R, S, w.A24plus, w.C24, (int)(OALICE_BITS-1));
+    get_2_isog(S, w.A24plus, w.C24);
     eval_2_isog(R, S);
 #endif
 
     // Traverse tree
-    index = 0;        
-    for (row = 1; row < MAX_Alice; row++) {
-        while (index < MAX_Alice-row) {
-            fp2copy(R->X, pts[npts]->X);
-            fp2copy(R->Z, pts[npts]->Z);
-            pts_index[npts++] = index;
-            m = strat_Alice[ii++];
-            xDBLe(R, R, A24plus, C24, (int)(2*m));
-            index += m;
-        }
-        get_4_isog(R, A24plus, C24, coeff);        
+    walk_start(&w, R);
+    walk_run(&w, 0, ALICE);
 
-        for (i = 0; i < npts; i++) {
-            eval_4_isog(pts[i], coeff);
-        }
+    mp2_add(w.A24plus, w.A24plus, w.A24plus);                                                
+    fp2sub(w.A24plus, w.C24, w.A24plus); 
+    fp2add(w.A24plus, w.A24plus, w.A24plus);                    
+    j_inv_proj(w.A24plus, w.C24, jnum, jden);
+}
 
-        fp2copy(pts[npts-1]->X, R->X); 
-        fp2copy(pts[npts-1]->Z, R->Z);
-        index = pts_index[npts-1];
-        npts -= 1;
-    }
 
-    get_4_isog(R, A24plus, C24, coeff); 
-    mp2_add(A24plus, A24plus, A24plus);                                                
-    fp2sub(A24plus, C24, A24plus); 
-    fp2add(A24plus, A24plus, A24plus);                    
-    j_inv(A24plus, C24, jinv);
+static void SecretAgreement_A_proj(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, f2elm_t jnum, f2elm_t jden)
+{ // Projective part of Alice's ephemeral shared secret computation
+  // Inputs: Alice's PrivateKeyA is an integer in the range [0, oA-1]. 
+  //         Bob's PublicKeyB consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: the shared j-invariant as a fraction jnum/jden.
+    f2elm_t curve[6];
+
+    PublicKeyB_prepare(PublicKeyB, curve);
+    SecretAgreement_A_prepared_proj(PrivateKeyA, (const f2elm_t*)curve, jnum, jden);
+}
+
+
+int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned char* PublicKeyB, unsigned char* SharedSecretA)
+{ // Alice's ephemeral shared secret computation
+  // It produces a shared secret key SharedSecretA using her secret key PrivateKeyA and Bob's public key PublicKeyB
+  // Inputs: Alice's PrivateKeyA is an integer in the range [0, oA-1]. 
+  //         Bob's PublicKeyB consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: a shared secret SharedSecretA that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+    f2elm_t jnum, jinv;
+
+    SecretAgreement_A_proj(PrivateKeyA, PublicKeyB, jnum, jinv);
+    fp2inv_mont(jinv);
+    fp2mul_mont(jinv, jnum, jinv);
     fp2_encode(jinv, SharedSecretA);    // Format shared secret
 
     return 0;
 }
 
 
-int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB)
-{ // Bob's ephemeral shared secret computation
-  // It produces a shared secret key SharedSecretB using his secret key PrivateKeyB and Alice's public key PublicKeyA
+static int EphemeralSecretAgreement_A_prepared(const unsigned char* PrivateKeyA, const f2elm_t* curve, unsigned char* SharedSecretA)
+{ // Alice's ephemeral shared secret computation using Bob's public key prepared with PublicKeyB_prepare
+  // Inputs: Alice's PrivateKeyA is an integer in the range [0, oA-1]. 
+  //         curve = {PKB[0], PKB[1], PKB[2], A, A24plus, C24} obtained from Bob's public key.
+  // Output: a shared secret SharedSecretA that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+    f2elm_t jnum, jinv;
+
+    SecretAgreement_A_prepared_proj(PrivateKeyA, curve, jnum, jinv);
+    fp2inv_mont(jinv);
+    fp2mul_mont(jinv, jnum, jinv);
+    fp2_encode(jinv, SharedSecretA);    // Format shared secret
+
+    return 0;
+}
+
+
+static void SecretAgreement_B_start(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, ladder3pt_t* L, isogeny_walk_t* w)
+{ // Initialization of Bob's ephemeral shared secret computation
   // Inputs: Bob's PrivateKeyB is an integer in the range [0, 2^Floor(Log(2,oB)) - 1]. 
   //         Alice's PublicKeyA consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
-  // Output: a shared secret SharedSecretB that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
-    point_proj_t R, pts[MAX_INT_POINTS_BOB];
-    f2elm_t coeff[3], PKB[3], jinv;
-    f2elm_t A24plus = {0}, A24minus = {0}, A = {0};
-    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
+  // Output: the kernel point ladder L, to be run with LADDER3PT_resume, and the constants of Alice's curve in w.
+    f2elm_t PKB[3], A = {0};
     digit_t SecretKeyB[NWORDS_ORDER] = {0};
       
     // Initialize images of Alice's basis
@@ -280,42 +602,57 @@ int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
 
     // Initialize constants: A24plus = A+2C, A24minus = A-2C, where C=1
     get_A(PKB[0], PKB[1], PKB[2], A);
-    mp_add((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, A24minus[0], NWORDS_FIELD);
-    mp2_add(A, A24minus, A24plus);
-    mp2_sub_p2(A, A24minus, A24minus);
+    fp2zero(w->A24minus);
+    mp_add((digit_t*)&Montgomery_one, (digit_t*)&Montgomery_one, w->A24minus[0], NWORDS_FIELD);
+    mp2_add(A, w->A24minus, w->A24plus);
+    mp2_sub_p2(A, w->A24minus, w->A24minus);
 
     // Retrieve kernel point
     decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
-    LADDER3PT(PKB[0], PKB[1], PKB[2], SecretKeyB, BOB, R, A);
+    LADDER3PT_start(L, PKB[0], PKB[1], PKB[2], SecretKeyB, BOB, A);
+}
+
+
+static void SecretAgreement_B_jinv(isogeny_walk_t* w, f2elm_t jnum, f2elm_t jden)
+{ // Shared j-invariant as a fraction jnum/jden, once the traversal of Bob's tree in w has computed the last row
+    f2elm_t A;
+
+    fp2add(w->A24plus, w->A24minus, A);                 
+    fp2add(A, A, A);
+    fp2sub(w->A24plus, w->A24minus, w->A24plus);                   
+    j_inv_proj(A, w->A24plus, jnum, jden);
+}
+
+
+static void SecretAgreement_B_proj(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, f2elm_t jnum, f2elm_t jden)
+{ // Projective part of Bob's ephemeral shared secret computation
+  // Inputs: Bob's PrivateKeyB is an integer in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  //         Alice's PublicKeyA consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: the shared j-invariant as a fraction jnum/jden.
+    ladder3pt_t L;
+    isogeny_walk_t w;
+
+    SecretAgreement_B_start(PrivateKeyB, PublicKeyA, &L, &w);
+    LADDER3PT_resume(&L, L.nbits);
     
     // Traverse tree
-    index = 0;  
-    for (row = 1; row < MAX_Bob; row++) {
-        while (index < MAX_Bob-row) {
-            fp2copy(R->X, pts[npts]->X);
-            fp2copy(R->Z, pts[npts]->Z);
-            pts_index[npts++] = index;
-            m = strat_Bob[ii++];
-            xTPLe(R, R, A24minus, A24plus, (int)m);
-            index += m;
-        }
-        get_3_isog(R, A24minus, A24plus, coeff);
+    walk_start(&w, L.R);
+    walk_run(&w, 0, BOB);
+    SecretAgreement_B_jinv(&w, jnum, jden);
+}
 
-        for (i = 0; i < npts; i++) {
-            eval_3_isog(pts[i], coeff);
-        } 
 
-        fp2copy(pts[npts-1]->X, R->X); 
-        fp2copy(pts[npts-1]->Z, R->Z);
-        index = pts_index[npts-1];
-        npts -= 1;
-    }
-     
-    get_3_isog(R, A24minus, A24plus, coeff);    
-    fp2add(A24plus, A24minus, A);                 
-    fp2add(A, A, A);
-    fp2sub(A24plus, A24minus, A24plus);                   
-    j_inv(A, A24plus, jinv);
+int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB)
+{ // Bob's ephemeral shared secret computation
+  // It produces a shared secret key SharedSecretB using his secret key PrivateKeyB and Alice's public key PublicKeyA
+  // Inputs: Bob's PrivateKeyB is an integer in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  //         Alice's PublicKeyA consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: a shared secret SharedSecretB that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+    f2elm_t jnum, jinv;
+
+    SecretAgreement_B_proj(PrivateKeyB, PublicKeyA, jnum, jinv);
+    fp2inv_mont(jinv);
+    fp2mul_mont(jinv, jnum, jinv);
     fp2_encode(jinv, SharedSecretB);    // Format shared secret
 
     return 0;
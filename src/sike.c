@@ -6,6 +6,7 @@
 
 #include <string.h>
 #include "sha3/fips202.h"
+#include "threads/threadpool.h"
 
 #ifdef DO_VALGRIND_CHECK
 #include <valgrind/memcheck.h>
@@ -45,15 +46,14 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
     unsigned char ephemeralsk[SECRETKEY_A_BYTES];
     unsigned char jinvariant[FP2_ENCODED_BYTES];
     unsigned char h[MSG_BYTES];
-    unsigned char temp[CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
+    unsigned char m[MSG_BYTES];
 
     // Generate ephemeralsk <- G(m||pk) mod oA 
-    randombytes(temp, MSG_BYTES);
+    randombytes(m, MSG_BYTES);
 #ifdef DO_VALGRIND_CHECK
-    VALGRIND_MAKE_MEM_UNDEFINED(temp, MSG_BYTES);
+    VALGRIND_MAKE_MEM_UNDEFINED(m, MSG_BYTES);
 #endif
-    memcpy(&temp[MSG_BYTES], pk, CRYPTO_PUBLICKEYBYTES);
-    shake256(ephemeralsk, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+    shake256_concat(ephemeralsk, SECRETKEY_A_BYTES, m, MSG_BYTES, pk, CRYPTO_PUBLICKEYBYTES);
     ephemeralsk[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
 
     // Encrypt
@@ -61,15 +61,119 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
     EphemeralSecretAgreement_A(ephemeralsk, pk, jinvariant);
     shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);
     for (int i = 0; i < MSG_BYTES; i++) {
-        ct[i + CRYPTO_PUBLICKEYBYTES] = temp[i] ^ h[i];
+        ct[i + CRYPTO_PUBLICKEYBYTES] = m[i] ^ h[i];
     }
 
     // Generate shared secret ss <- H(m||ct)
-    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+    shake256_concat(ss, CRYPTO_BYTES, m, MSG_BYTES, ct, CRYPTO_CIPHERTEXTBYTES);
 
 #ifdef DO_VALGRIND_CHECK
-    VALGRIND_MAKE_MEM_DEFINED(temp, MSG_BYTES);
+    VALGRIND_MAKE_MEM_DEFINED(m, MSG_BYTES);
+#endif
+    return 0;
+}
+
+
+int crypto_kem_pk_prepare(const unsigned char *pk, crypto_kem_prepared_pk *prepared)
+{ // Preparation of a public key for repeated encapsulations
+  // It decodes pk and recovers its curve constants once, so that crypto_kem_enc_prepared can skip this work
+  // Input:   public key pk                (CRYPTO_PUBLICKEYBYTES bytes)
+  // Output:  prepared public key prepared (a copy of pk and 6 elements in GF(p^2) in Montgomery representation)
+
+    memcpy(prepared->pk, pk, CRYPTO_PUBLICKEYBYTES);
+    PublicKeyB_prepare(pk, (f2elm_t*)prepared->curve);
+
+    return 0;
+}
+
+
+int crypto_kem_enc_prepared(unsigned char *ct, unsigned char *ss, const crypto_kem_prepared_pk *prepared)
+{ // SIKE's encapsulation to a prepared public key
+  // Input:   prepared public key prepared, obtained with crypto_kem_pk_prepare
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
+    unsigned char ephemeralsk[SECRETKEY_A_BYTES];
+    unsigned char jinvariant[FP2_ENCODED_BYTES];
+    unsigned char h[MSG_BYTES];
+    unsigned char m[MSG_BYTES];
+
+    // Generate ephemeralsk <- G(m||pk) mod oA 
+    randombytes(m, MSG_BYTES);
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_UNDEFINED(m, MSG_BYTES);
+#endif
+    shake256_concat(ephemeralsk, SECRETKEY_A_BYTES, m, MSG_BYTES, prepared->pk, CRYPTO_PUBLICKEYBYTES);
+    ephemeralsk[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+
+    // Encrypt
+    EphemeralKeyGeneration_A(ephemeralsk, ct);
+    EphemeralSecretAgreement_A_prepared(ephemeralsk, (const f2elm_t*)prepared->curve, jinvariant);
+    shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);
+    for (int i = 0; i < MSG_BYTES; i++) {
+        ct[i + CRYPTO_PUBLICKEYBYTES] = m[i] ^ h[i];
+    }
+
+    // Generate shared secret ss <- H(m||ct)
+    shake256_concat(ss, CRYPTO_BYTES, m, MSG_BYTES, ct, CRYPTO_CIPHERTEXTBYTES);
+
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_DEFINED(m, MSG_BYTES);
+#endif
+    return 0;
+}
+
+
+typedef struct {
+    const unsigned char *ephemeralsk;
+    unsigned char *ct;
+} kem_enc_keygen_t;
+
+
+static void kem_enc_keygen_task(void *arg)
+{ // Ephemeral key generation half of crypto_kem_enc_parallel, run on the thread pool
+    kem_enc_keygen_t *t = (kem_enc_keygen_t*)arg;
+
+    EphemeralKeyGeneration_A(t->ephemeralsk, t->ct);
+}
+
+
+int crypto_kem_enc_parallel(unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation using two threads
+  // The ephemeral key generation runs on the library's thread pool while the calling thread computes the shared secret.
+  // Input:   public key pk         (CRYPTO_PUBLICKEYBYTES bytes)
+  // Outputs: shared secret ss      (CRYPTO_BYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes)
+    unsigned char ephemeralsk[SECRETKEY_A_BYTES];
+    unsigned char jinvariant[FP2_ENCODED_BYTES];
+    unsigned char h[MSG_BYTES];
+    unsigned char m[MSG_BYTES];
+    kem_enc_keygen_t keygen;
+    threadpool_job_t job;
+
+    // Generate ephemeralsk <- G(m||pk) mod oA 
+    randombytes(m, MSG_BYTES);
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_UNDEFINED(m, MSG_BYTES);
+#endif
+    shake256_concat(ephemeralsk, SECRETKEY_A_BYTES, m, MSG_BYTES, pk, CRYPTO_PUBLICKEYBYTES);
+    ephemeralsk[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+
+    // Encrypt, both halves only depend on ephemeralsk
+    keygen.ephemeralsk = ephemeralsk;
+    keygen.ct = ct;
+    threadpool_submit(&job, kem_enc_keygen_task, &keygen);
+    EphemeralSecretAgreement_A(ephemeralsk, pk, jinvariant);
+    threadpool_wait(&job);
+    shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);
+    for (int i = 0; i < MSG_BYTES; i++) {
+        ct[i + CRYPTO_PUBLICKEYBYTES] = m[i] ^ h[i];
+    }
+
+    // Generate shared secret ss <- H(m||ct)
+    shake256_concat(ss, CRYPTO_BYTES, m, MSG_BYTES, ct, CRYPTO_CIPHERTEXTBYTES);
+
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_DEFINED(m, MSG_BYTES);
 #endif
     return 0;
 }
@@ -84,7 +188,7 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
     unsigned char jinvariant_[FP2_ENCODED_BYTES];
     unsigned char h_[MSG_BYTES];
     unsigned char c0_[CRYPTO_PUBLICKEYBYTES];
-    unsigned char temp[CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
+    unsigned char m[MSG_BYTES];
 #ifdef DO_VALGRIND_CHECK
     VALGRIND_MAKE_MEM_UNDEFINED(sk, CRYPTO_SECRETKEYBYTES);
 #endif
@@ -93,22 +197,163 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
     EphemeralSecretAgreement_B(sk + MSG_BYTES, ct, jinvariant_);
     shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);
     for (int i = 0; i < MSG_BYTES; i++) {
-        temp[i] = ct[i + CRYPTO_PUBLICKEYBYTES] ^ h_[i];
+        m[i] = ct[i + CRYPTO_PUBLICKEYBYTES] ^ h_[i];
     }
 
     // Generate ephemeralsk_ <- G(m||pk) mod oA
-    memcpy(&temp[MSG_BYTES], &sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
-    shake256(ephemeralsk_, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+    shake256_concat(ephemeralsk_, SECRETKEY_A_BYTES, m, MSG_BYTES, &sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
     ephemeralsk_[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
     
     // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
     EphemeralKeyGeneration_A(ephemeralsk_, c0_);
     // If selector = 0 then do ss = H(m||ct), else if selector = -1 load s to do ss = H(s||ct)
     int8_t selector = ct_compare(c0_, ct, CRYPTO_PUBLICKEYBYTES);
-    ct_cmov(temp, sk, MSG_BYTES, selector);
-    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+    ct_cmov(m, sk, MSG_BYTES, selector);
+    shake256_concat(ss, CRYPTO_BYTES, m, MSG_BYTES, ct, CRYPTO_CIPHERTEXTBYTES);
     
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_DEFINED(sk, CRYPTO_SECRETKEYBYTES);
+#endif
+    return 0;
+}
+
+
+typedef struct {
+    unsigned int phase;
+    const unsigned char *ct, *sk;
+    ladder3pt_t ladder;
+    isogeny_walk_t walk;
+    unsigned char ephemeralsk_[SECRETKEY_A_BYTES];
+    unsigned char c0_[CRYPTO_PUBLICKEYBYTES];
+    unsigned char m[MSG_BYTES];
+} kem_dec_state_t;
+
+// The public state type crypto_kem_dec_state must be large enough to hold kem_dec_state_t
+typedef char kem_dec_state_size_check[(sizeof(kem_dec_state_t) <= sizeof(crypto_kem_dec_state)) ? 1 : -1];
+
+// Phases of a resumable decapsulation
+#define DEC_PHASE_B_LADDER    0    // Bob's kernel point ladder on the ciphertext's curve
+#define DEC_PHASE_B_WALK      1    // Bob's isogeny tree traversal
+#define DEC_PHASE_REENCRYPT   2    // Shared secret, message recovery and start of the re-encryption 
+#define DEC_PHASE_A_LADDER    3    // Alice's kernel point ladder for the re-encryption
+#define DEC_PHASE_A_WALK      4    // Alice's isogeny tree traversal for the re-encryption
+#define DEC_PHASE_A_ENCODE    5    // Encoding of the re-encrypted public key
+#define DEC_PHASE_DONE        6
+
+
+int crypto_kem_dec_init(crypto_kem_dec_state *state, const unsigned char *ct, const unsigned char *sk)
+{ // Initialization of SIKE's resumable decapsulation, which continues with crypto_kem_dec_step and crypto_kem_dec_finish
+  // Input:   secret key sk         (CRYPTO_SECRETKEYBYTES = MSG_BYTES + SECRETKEY_B_BYTES + CRYPTO_PUBLICKEYBYTES bytes)
+  //          ciphertext message ct (CRYPTO_CIPHERTEXTBYTES = CRYPTO_PUBLICKEYBYTES + MSG_BYTES bytes) 
+  // Output:  decapsulation state, which keeps pointers to sk and ct. These must remain valid until crypto_kem_dec_finish returns.
+    kem_dec_state_t *st = (kem_dec_state_t*)state;
+#ifdef DO_VALGRIND_CHECK
+    VALGRIND_MAKE_MEM_UNDEFINED(sk, CRYPTO_SECRETKEYBYTES);
+#endif
+
+    st->ct = ct;
+    st->sk = sk;
+    SecretAgreement_B_start(sk + MSG_BYTES, ct, &st->ladder, &st->walk);
+    st->phase = DEC_PHASE_B_LADDER;
+
+    return 0;
+}
+
+
+int crypto_kem_dec_step(crypto_kem_dec_state *state, unsigned int budget)
+{ // Runs at most budget steps of a decapsulation initialized with crypto_kem_dec_init
+  // A step is one bit of a three-point ladder, one multiplication by the strategy or one isogeny computation and evaluation in a tree traversal, 
+  // or one of the two steps that recover the message and encode the re-encrypted public key. The sequence of steps does not depend on secret data.
+  // Output:  1 if more steps remain, 0 if the decapsulation is ready for crypto_kem_dec_finish
+    kem_dec_state_t *st = (kem_dec_state_t*)state;
+    unsigned char jinvariant_[FP2_ENCODED_BYTES];
+    unsigned char h_[MSG_BYTES];
+    f2elm_t jnum, jinv;
+    int nsteps;
+
+    while ((budget > 0) && (st->phase != DEC_PHASE_DONE)) {
+        switch (st->phase) {
+        case DEC_PHASE_B_LADDER:
+            nsteps = (budget < (unsigned int)st->ladder.nbits) ? (int)budget : st->ladder.nbits;
+            budget -= (unsigned int)LADDER3PT_resume(&st->ladder, nsteps);
+            if (st->ladder.i == st->ladder.nbits) {
+                walk_start(&st->walk, st->ladder.R);
+                st->phase = DEC_PHASE_B_WALK;
+            }
+            break;
+
+        case DEC_PHASE_B_WALK:
+            walk_step_B(&st->walk, 0);
+            budget--;
+            if (st->walk.row > MAX_Bob) {
+                st->phase = DEC_PHASE_REENCRYPT;
+            }
+            break;
+
+        case DEC_PHASE_REENCRYPT:
+            // Decrypt
+            SecretAgreement_B_jinv(&st->walk, jnum, jinv);
+            fp2inv_mont(jinv);
+            fp2mul_mont(jinv, jnum, jinv);
+            fp2_encode(jinv, jinvariant_);
+            shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);
+            for (int i = 0; i < MSG_BYTES; i++) {
+                st->m[i] = st->ct[i + CRYPTO_PUBLICKEYBYTES] ^ h_[i];
+            }
+
+            // Generate ephemeralsk_ <- G(m||pk) mod oA
+            shake256_concat(st->ephemeralsk_, SECRETKEY_A_BYTES, st->m, MSG_BYTES, &st->sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
+            st->ephemeralsk_[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+            KeyGeneration_A_start(st->ephemeralsk_, &st->ladder, &st->walk);
+            budget--;
+            st->phase = DEC_PHASE_A_LADDER;
+            break;
+
+        case DEC_PHASE_A_LADDER:
+            nsteps = (budget < (unsigned int)st->ladder.nbits) ? (int)budget : st->ladder.nbits;
+            budget -= (unsigned int)LADDER3PT_resume(&st->ladder, nsteps);
+            if (st->ladder.i == st->ladder.nbits) {
+                KeyGeneration_A_walk_start(&st->ladder, &st->walk);
+                st->phase = DEC_PHASE_A_WALK;
+            }
+            break;
+
+        case DEC_PHASE_A_WALK:
+            walk_step_A(&st->walk, 3);
+            budget--;
+            if (st->walk.row > MAX_Alice) {
+                st->phase = DEC_PHASE_A_ENCODE;
+            }
+            break;
+
+        case DEC_PHASE_A_ENCODE:
+            inv_3_way(st->walk.phi[0]->Z, st->walk.phi[1]->Z, st->walk.phi[2]->Z);
+            encode_public_key(st->walk.phi[0], st->walk.phi[1], st->walk.phi[2], st->c0_);
+            budget--;
+            st->phase = DEC_PHASE_DONE;
+            break;
+        }
+    }
+
+    return (st->phase != DEC_PHASE_DONE);
+}
+
+
+int crypto_kem_dec_finish(unsigned char *ss, crypto_kem_dec_state *state)
+{ // Completion of SIKE's resumable decapsulation, running any remaining steps first. The state is cleared.
+  // Output:  shared secret ss      (CRYPTO_BYTES bytes)
+    kem_dec_state_t *st = (kem_dec_state_t*)state;
+    const unsigned char *sk = st->sk;
+
+    crypto_kem_dec_step(state, (unsigned int)-1);
+
+    // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
+    // If selector = 0 then do ss = H(m||ct), else if selector = -1 load s to do ss = H(s||ct)
+    int8_t selector = ct_compare(st->c0_, st->ct, CRYPTO_PUBLICKEYBYTES);
+    ct_cmov(st->m, sk, MSG_BYTES, selector);
+    shake256_concat(ss, CRYPTO_BYTES, st->m, MSG_BYTES, st->ct, CRYPTO_CIPHERTEXTBYTES);
+    clear_words((void*)state, sizeof(crypto_kem_dec_state)/sizeof(digit_t));
+
 #ifdef DO_VALGRIND_CHECK
     VALGRIND_MAKE_MEM_DEFINED(sk, CRYPTO_SECRETKEYBYTES);
 #endif
@@ -0,0 +1,148 @@
+/********************************************************************************************
+* Persistent thread pool used by the parallel functions of the library
+*
+* It uses POSIX threads in Unix-like systems. Elsewhere, or if the threads cannot be created,
+* submitted tasks run in the calling thread. The child of a fork() starts its own workers on
+* its first submission
+*********************************************************************************************/ 
+
+#include "threadpool.h"
+#include <stddef.h>
+#if defined(__NIX__) && !defined(_NO_THREADS_)
+    #include <pthread.h>
+
+    static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+    static pthread_cond_t pool_pending = PTHREAD_COND_INITIALIZER;    // Signaled when a job is queued
+    static pthread_cond_t pool_done = PTHREAD_COND_INITIALIZER;       // Signaled when a job completes
+    static threadpool_job_t *queue_head = NULL, *queue_tail = NULL;
+    static unsigned int pool_threads = 0;
+    static int pool_started = 0;                                      // Set once the workers of this process have been started
+
+
+static void* threadpool_worker(void* unused)
+{ // Worker loop: runs queued jobs in submission order, for the lifetime of the process
+    threadpool_job_t* job;
+    (void)unused;
+
+    pthread_mutex_lock(&pool_lock);
+    while (1) {
+        while (queue_head == NULL) {
+            pthread_cond_wait(&pool_pending, &pool_lock);
+        }
+        job = queue_head;
+        queue_head = job->next;
+        if (queue_head == NULL) {
+            queue_tail = NULL;
+        }
+        pthread_mutex_unlock(&pool_lock);
+
+        job->task(job->arg);
+
+        pthread_mutex_lock(&pool_lock);
+        job->done = 1;
+        pthread_cond_broadcast(&pool_done);
+    }
+    return NULL;
+}
+
+
+static void threadpool_start(void)
+{ // Start the worker threads, with pool_lock held. They are detached and never exit
+    pthread_t thread;
+
+    for (unsigned int i = 0; i < THREADPOOL_THREADS; i++) {
+        if (pthread_create(&thread, NULL, threadpool_worker, NULL) != 0) {
+            break;
+        }
+        pthread_detach(thread);
+        pool_threads++;
+    }
+    pool_started = 1;
+}
+
+
+static void threadpool_atfork_prepare(void)
+{ // No worker may hold pool_lock while the process forks
+    pthread_mutex_lock(&pool_lock);
+}
+
+
+static void threadpool_atfork_parent(void)
+{
+    pthread_mutex_unlock(&pool_lock);
+}
+
+
+static void threadpool_atfork_child(void)
+{ // The workers do not exist in the child of a fork(), so the child empties the queue and starts its own workers on its 
+  // next submission. The condition variables may still count the waiting workers of the parent and are reinitialized
+    queue_head = NULL;
+    queue_tail = NULL;
+    pool_threads = 0;
+    pool_started = 0;
+    pthread_cond_init(&pool_pending, NULL);
+    pthread_cond_init(&pool_done, NULL);
+    pthread_mutex_unlock(&pool_lock);
+}
+
+
+__attribute__((constructor)) static void threadpool_register_atfork(void)
+{
+    pthread_atfork(threadpool_atfork_prepare, threadpool_atfork_parent, threadpool_atfork_child);
+}
+#endif
+
+
+int threadpool_try_submit(threadpool_job_t* job, void (*task)(void* arg), void* arg)
+{ // Run task(arg) on a worker of the thread pool and return 1, or return 0 if the pool is not available
+    job->task = task;
+    job->arg = arg;
+    job->done = 0;
+    job->next = NULL;
+
+#if defined(__NIX__) && !defined(_NO_THREADS_)
+    pthread_mutex_lock(&pool_lock);
+    if (pool_started == 0) {
+        threadpool_start();
+    }
+    if (pool_threads > 0) {
+        if (queue_tail == NULL) {
+            queue_head = job;
+        } else {
+            queue_tail->next = job;
+        }
+        queue_tail = job;
+        pthread_cond_signal(&pool_pending);
+        pthread_mutex_unlock(&pool_lock);
+        return 1;
+    }
+    pthread_mutex_unlock(&pool_lock);
+#endif
+
+    job->done = 1;
+    return 0;
+}
+
+
+void threadpool_submit(threadpool_job_t* job, void (*task)(void* arg), void* arg)
+{ // Run task(arg) on a worker of the thread pool, or in the calling thread if the pool is not available
+
+    if (threadpool_try_submit(job, task, arg) == 0) {
+        task(arg);
+    }
+}
+
+
+void threadpool_wait(threadpool_job_t* job)
+{ // Wait until the task submitted with job has completed
+
+#if defined(__NIX__) && !defined(_NO_THREADS_)
+    pthread_mutex_lock(&pool_lock);
+    while (job->done == 0) {                  // Tasks that ran in the calling thread are already done
+        pthread_cond_wait(&pool_done, &pool_lock);
+    }
+    pthread_mutex_unlock(&pool_lock);
+#else
+    (void)job;
+#endif
+}
@@ -0,0 +1,28 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+
+// Number of persistent worker threads owned by the library
+#define THREADPOOL_THREADS    2
+
+// Task submitted to the thread pool. The structure is owned by the caller and must stay valid until threadpool_wait() returns
+typedef struct threadpool_job {
+    void (*task)(void* arg);
+    void* arg;
+    int done;
+    struct threadpool_job* next;
+} threadpool_job_t;
+
+// Run task(arg) on a worker of the thread pool, which is started on first use
+// If the pool is not available (no thread support or thread creation failed), the task runs in the calling thread
+void threadpool_submit(threadpool_job_t* job, void (*task)(void* arg), void* arg);
+
+// Run task(arg) on a worker of the thread pool, which is started on first use, and return 1
+// If the pool is not available, return 0 without running the task. Used for tasks that must not run in the calling thread
+int threadpool_try_submit(threadpool_job_t* job, void (*task)(void* arg), void* arg);
+
+// Wait until the task submitted with job has completed
+void threadpool_wait(threadpool_job_t* job);
+
+
+#endif
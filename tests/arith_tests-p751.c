@@ -9,6 +9,13 @@
 #include "../src/internal.h"
 #include "test_extras.h"
 #include <stdio.h>
+#ifdef DO_VALGRIND_CHECK
+#include <stdlib.h>
+#include <valgrind/memcheck.h>
+#endif
+
+
+extern const uint64_t p751[NWORDS64_FIELD];
 
 
 // Benchmark and test parameters  
@@ -28,6 +35,7 @@ bool fp_test()
     bool OK = true;
     int n, passed;
     felm_t a, b, c, d, e, f, ma, mb, mc, md, me, mf;
+    dfelm_t aa, bb;
 
     printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
     printf("Testing field arithmetic over GF(p751): \n\n"); 
@@ -160,9 +168,18 @@ bool fp_test()
         fpmul751_mont(ma, ma, mc);                             // c = a*a 
         if (compare_words(mb, mc, NWORDS_FIELD)!=0) { passed=0; break; }
 
+        mp_sqr(ma, aa, NWORDS_FIELD);                          // aa = a^2 as integers
+        mp_mul(ma, ma, bb, NWORDS_FIELD);                      // bb = a*a as integers
+        if (compare_words(aa, bb, 2*NWORDS_FIELD)!=0) { passed=0; break; }
+
         fpzero751(a); to_mont(a, ma);
         fpsqr751_mont(ma, md);                                 // d = 0^2 
         if (compare_words(ma, md, NWORDS_FIELD)!=0) { passed=0; break; }
+
+        mp_add((digit_t*)PRIME, (digit_t*)PRIME, a, NWORDS_FIELD); a[0] -= 1;
+        mp_sqr(a, aa, NWORDS_FIELD);                           // aa = (2p-1)^2 as integers
+        mp_mul(a, a, bb, NWORDS_FIELD);                        // bb = (2p-1)*(2p-1) as integers
+        if (compare_words(aa, bb, 2*NWORDS_FIELD)!=0) { passed=0; break; }
     }
     if (passed==1) printf("  GF(p) squaring tests............................................. PASSED");
     else { printf("  GF(p) squaring tests... FAILED"); printf("\n"); return false; }
@@ -179,6 +196,33 @@ bool fp_test()
         fpinv751_mont(ma);                                
         fpmul751_mont(ma, mb, mc);                             // c = a*a^-1 
         if (compare_words(mc, md, NWORDS_FIELD)!=0) { passed=0; break; }
+
+        fpcopy751(mb, me);                                     // e = a^-1 via exponentiation
+        fpinv751_chain_mont(me);
+        fpsqr751_mont(me, me);
+        fpsqr751_mont(me, me);
+        fpmul751_mont(mb, me, me);
+        fpcorrection751(ma);
+        fpcorrection751(me);
+        if (compare_words(ma, me, NWORDS_FIELD)!=0) { passed=0; break; }
+    }
+    if (passed==1) {
+        fpzero751(ma);                                         // 0^-1 = 0 by convention
+        fpinv751_mont(ma);
+        fpcorrection751(ma);
+        fpzero751(me);
+        if (compare_words(ma, me, NWORDS_FIELD)!=0) passed=0;
+        fpcopy751(md, ma);                                     // 1^-1 = 1
+        fpinv751_mont(ma);
+        fpcorrection751(ma);
+        if (compare_words(ma, md, NWORDS_FIELD)!=0) passed=0;
+        fpzero751(ma);                                         // (-1)^-1 = -1
+        fpsub751(ma, md, ma);
+        fpcopy751(ma, mb);
+        fpinv751_mont(ma);
+        fpcorrection751(ma);
+        fpcorrection751(mb);
+        if (compare_words(ma, mb, NWORDS_FIELD)!=0) passed=0;
     }
     if (passed==1) printf("  GF(p) inversion tests............................................ PASSED");
     else { printf("  GF(p) inversion tests... FAILED"); printf("\n"); return false; }
@@ -394,6 +438,18 @@ bool fp_run()
     printf("  GF(p) multiplication runs in .................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
+    // GF(p) squaring using p751
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        fpsqr751_mont(a, c);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p) squaring runs in .......................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
     // GF(p) reduction using p751
     cycles = 0;
     for (n=0; n<BENCH_LOOPS; n++)
@@ -408,6 +464,30 @@ bool fp_run()
     printf("  GF(p) reduction runs in ......................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
+    // Integer multiplication of field elements (without reduction)
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        mp_mul(a, b, aa, NWORDS_FIELD);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Integer multiplication runs in .................................. %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // Integer squaring of field elements (without reduction)
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        mp_sqr(a, aa, NWORDS_FIELD);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Integer squaring runs in ........................................ %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
     // GF(p) inversion
     cycles = 0;
     for (n=0; n<SMALL_BENCH_LOOPS; n++)
@@ -417,6 +497,22 @@ bool fp_run()
         cycles2 = cpucycles();
         cycles = cycles+(cycles2-cycles1);
     }
+    printf("  GF(p) inversion runs in ......................................... %7lld ", cycles/SMALL_BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // GF(p) inversion via exponentiation using the addition chain
+    cycles = 0;
+    for (n=0; n<SMALL_BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        fpcopy751(a, b);
+        fpinv751_chain_mont(b);
+        fpsqr751_mont(b, b);
+        fpsqr751_mont(b, b);
+        fpmul751_mont(a, b, a);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
     printf("  GF(p) inversion (exponentiation) runs in ........................ %7lld ", cycles/SMALL_BENCH_LOOPS); print_unit;
     printf("\n");
     
@@ -493,7 +589,7 @@ bool fp2_run()
         cycles2 = cpucycles();
         cycles = cycles+(cycles2-cycles1);
     }
-    printf("  GF(p^2) inversion (exponentiation) runs in ...................... %7lld ", cycles/SMALL_BENCH_LOOPS); print_unit;
+    printf("  GF(p^2) inversion runs in ....................................... %7lld ", cycles/SMALL_BENCH_LOOPS); print_unit;
     printf("\n"); 
     
     return OK;
@@ -525,6 +621,20 @@ bool ecisog_run()
     printf("  Point doubling runs in .......................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
+    // Repeated point doubling
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        fp2random751_test((digit_t*)A24); fp2random751_test((digit_t*)C24);
+
+        cycles1 = cpucycles(); 
+        xDBLe(P, Q, A24, C24, 32);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Repeated point doubling (e = 32) runs in ........................ %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
     // 4-isogeny of a projective point
     cycles = 0;
     for (n=0; n<BENCH_LOOPS; n++)
@@ -567,6 +677,20 @@ bool ecisog_run()
     printf("  Point tripling runs in .......................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
+    // Repeated point tripling
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        fp2random751_test((digit_t*)A4); fp2random751_test((digit_t*)C);
+
+        cycles1 = cpucycles(); 
+        xTPLe(P, Q, A4, C, 32);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  Repeated point tripling (e = 32) runs in ........................ %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
     // 3-isogeny of a projective point
     cycles = 0;
     for (n=0; n<BENCH_LOOPS; n++)
@@ -596,11 +720,358 @@ bool ecisog_run()
     return OK;
 }
 
+#if defined(X64_CURVE_ASM)
+bool curve_asm_test()
+{ // Tests that the fused x64 curve and isogeny kernels compute exactly the same values as their C versions
+    bool OK = true;
+    int n, passed;
+    f2elm_t A24, C24, XPQ, ZPQ, coeff[3];
+    point_proj_t P, Q, R, S, P2, Q2;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Testing fused elliptic curve and isogeny kernels over GF(p751^2) against the C versions: \n\n"); 
+
+    passed = 1;
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        fp2random751_test((digit_t*)A24); fp2random751_test((digit_t*)C24); fp2random751_test((digit_t*)XPQ); fp2random751_test((digit_t*)ZPQ);
+        fp2random751_test((digit_t*)coeff[0]); fp2random751_test((digit_t*)coeff[1]); fp2random751_test((digit_t*)coeff[2]);
+        fp2random751_test((digit_t*)P->X); fp2random751_test((digit_t*)P->Z); fp2random751_test((digit_t*)Q->X); fp2random751_test((digit_t*)Q->Z);
+
+        xDBL(P, R, A24, C24); xDBL_c(P, S, A24, C24);
+        if (compare_words((digit_t*)R, (digit_t*)S, 4*NWORDS_FIELD)!=0) { passed=0; break; }
+        copy_words((digit_t*)P, (digit_t*)R, 4*NWORDS_FIELD); copy_words((digit_t*)P, (digit_t*)S, 4*NWORDS_FIELD);
+        xDBL(R, R, A24, C24); xDBL_c(S, S, A24, C24);                                      // In place, as in xDBLe
+        if (compare_words((digit_t*)R, (digit_t*)S, 4*NWORDS_FIELD)!=0) { passed=0; break; }
+
+        xTPL(P, R, A24, C24); xTPL_c(P, S, A24, C24);
+        if (compare_words((digit_t*)R, (digit_t*)S, 4*NWORDS_FIELD)!=0) { passed=0; break; }
+        copy_words((digit_t*)P, (digit_t*)R, 4*NWORDS_FIELD); copy_words((digit_t*)P, (digit_t*)S, 4*NWORDS_FIELD);
+        xTPL(R, R, A24, C24); xTPL_c(S, S, A24, C24);                                      // In place, as in xTPLe
+        if (compare_words((digit_t*)R, (digit_t*)S, 4*NWORDS_FIELD)!=0) { passed=0; break; }
+
+        copy_words((digit_t*)P, (digit_t*)R, 4*NWORDS_FIELD); copy_words((digit_t*)P, (digit_t*)S, 4*NWORDS_FIELD);
+        copy_words((digit_t*)Q, (digit_t*)P2, 4*NWORDS_FIELD); copy_words((digit_t*)Q, (digit_t*)Q2, 4*NWORDS_FIELD);
+        xDBLADD(R, P2, XPQ, ZPQ, A24); xDBLADD_c(S, Q2, XPQ, ZPQ, A24);
+        if (compare_words((digit_t*)R, (digit_t*)S, 4*NWORDS_FIELD)!=0) { passed=0; break; }
+        if (compare_words((digit_t*)P2, (digit_t*)Q2, 4*NWORDS_FIELD)!=0) { passed=0; break; }
+
+        copy_words((digit_t*)P, (digit_t*)R, 4*NWORDS_FIELD); copy_words((digit_t*)P, (digit_t*)S, 4*NWORDS_FIELD);
+        eval_4_isog(R, coeff); eval_4_isog_c(S, coeff);
+        if (compare_words((digit_t*)R, (digit_t*)S, 4*NWORDS_FIELD)!=0) { passed=0; break; }
+
+        copy_words((digit_t*)P, (digit_t*)R, 4*NWORDS_FIELD); copy_words((digit_t*)P, (digit_t*)S, 4*NWORDS_FIELD);
+        eval_3_isog(R, coeff); eval_3_isog_c(S, coeff);
+        if (compare_words((digit_t*)R, (digit_t*)S, 4*NWORDS_FIELD)!=0) { passed=0; break; }
+    }
+    if (passed==1) printf("  Fused kernel agreement tests .................................... PASSED");
+    else { printf("  Fused kernel agreement tests... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    
+    return OK;
+}
+
+
+bool curve_asm_run()
+{ // Benchmarks the fused x64 curve and isogeny kernels against their C versions
+    bool OK = true;
+    int n;
+    unsigned long long cycles_asm = 0, cycles_c = 0, cycles1, cycles2;
+    f2elm_t A24, C24, XPQ, ZPQ, coeff[3];
+    point_proj_t P, Q;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Benchmarking fused elliptic curve and isogeny kernels (fused kernel / C version): \n\n"); 
+
+    fp2random751_test((digit_t*)A24); fp2random751_test((digit_t*)C24); fp2random751_test((digit_t*)XPQ); fp2random751_test((digit_t*)ZPQ);
+    fp2random751_test((digit_t*)coeff[0]); fp2random751_test((digit_t*)coeff[1]); fp2random751_test((digit_t*)coeff[2]);
+    fp2random751_test((digit_t*)P->X); fp2random751_test((digit_t*)P->Z); fp2random751_test((digit_t*)Q->X); fp2random751_test((digit_t*)Q->Z);
+
+    cycles_asm = 0; cycles_c = 0;
+    for (n=0; n<SMALL_BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        xDBLADD(P, Q, XPQ, ZPQ, A24);
+        cycles2 = cpucycles();
+        cycles_asm = cycles_asm+(cycles2-cycles1);
+
+        cycles1 = cpucycles(); 
+        xDBLADD_c(P, Q, XPQ, ZPQ, A24);
+        cycles2 = cpucycles();
+        cycles_c = cycles_c+(cycles2-cycles1);
+    }
+    printf("  Simultaneous doubling and addition (xDBLADD) runs in ............ %7lld / %7lld ", cycles_asm/SMALL_BENCH_LOOPS, cycles_c/SMALL_BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    cycles_asm = 0; cycles_c = 0;
+    for (n=0; n<SMALL_BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        xDBL(P, P, A24, C24);
+        cycles2 = cpucycles();
+        cycles_asm = cycles_asm+(cycles2-cycles1);
+
+        cycles1 = cpucycles(); 
+        xDBL_c(P, P, A24, C24);
+        cycles2 = cpucycles();
+        cycles_c = cycles_c+(cycles2-cycles1);
+    }
+    printf("  Point doubling (xDBL) runs in ................................... %7lld / %7lld ", cycles_asm/SMALL_BENCH_LOOPS, cycles_c/SMALL_BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    cycles_asm = 0; cycles_c = 0;
+    for (n=0; n<SMALL_BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        xTPL(P, P, A24, C24);
+        cycles2 = cpucycles();
+        cycles_asm = cycles_asm+(cycles2-cycles1);
+
+        cycles1 = cpucycles(); 
+        xTPL_c(P, P, A24, C24);
+        cycles2 = cpucycles();
+        cycles_c = cycles_c+(cycles2-cycles1);
+    }
+    printf("  Point tripling (xTPL) runs in ................................... %7lld / %7lld ", cycles_asm/SMALL_BENCH_LOOPS, cycles_c/SMALL_BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    cycles_asm = 0; cycles_c = 0;
+    for (n=0; n<SMALL_BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        eval_4_isog(P, coeff);
+        cycles2 = cpucycles();
+        cycles_asm = cycles_asm+(cycles2-cycles1);
+
+        cycles1 = cpucycles(); 
+        eval_4_isog_c(P, coeff);
+        cycles2 = cpucycles();
+        cycles_c = cycles_c+(cycles2-cycles1);
+    }
+    printf("  4-isogeny evaluation (eval_4_isog) runs in ...................... %7lld / %7lld ", cycles_asm/SMALL_BENCH_LOOPS, cycles_c/SMALL_BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    cycles_asm = 0; cycles_c = 0;
+    for (n=0; n<SMALL_BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        eval_3_isog(P, coeff);
+        cycles2 = cpucycles();
+        cycles_asm = cycles_asm+(cycles2-cycles1);
+
+        cycles1 = cpucycles(); 
+        eval_3_isog_c(P, coeff);
+        cycles2 = cpucycles();
+        cycles_c = cycles_c+(cycles2-cycles1);
+    }
+    printf("  3-isogeny evaluation (eval_3_isog) runs in ...................... %7lld / %7lld ", cycles_asm/SMALL_BENCH_LOOPS, cycles_c/SMALL_BENCH_LOOPS); print_unit;
+    printf("\n");
+    
+    return OK;
+}
+#endif
+
+
+#if defined(X64_DISPATCH_IMPLEMENTATION)
+// BMI2 and BMI2+ADX kernel variants, called directly to measure the cost of the dispatch table
+void fpadd751_asm_mulx(const digit_t* a, const digit_t* b, digit_t* c);
+void fpadd751_asm_adx(const digit_t* a, const digit_t* b, digit_t* c);
+void mul751_asm_mulx(const digit_t* a, const digit_t* b, digit_t* c);
+void mul751_asm_adx(const digit_t* a, const digit_t* b, digit_t* c);
+void rdc751_asm_mulx(digit_t* ma, digit_t* mc);
+void rdc751_asm_adx(digit_t* ma, digit_t* mc);
+
+
+bool dispatch_test()
+{ // Tests that every kernel variant supported by the processor agrees with the baseline variant
+    bool OK = true;
+    int n, passed;
+    unsigned int variant, active = x64_kernels751.variant;
+    felm_t a, b, c[3], d[3], e[3], f[3], g[3];
+    f2elm_t ma, mb, mc[3], md[3];
+    
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Testing run-time kernel dispatch over GF(p751) (active variant: %s): \n\n", (active == X64_KERNELS_ADX) ? "BMI2+ADX" : (active == X64_KERNELS_MULX) ? "BMI2" : "baseline"); 
+
+    passed = 1;
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        fprandom751_test(a); fprandom751_test(b);
+        fp2random751_test((digit_t*)ma); fp2random751_test((digit_t*)mb);
+
+        for (variant = X64_KERNELS_PLAIN; variant <= active; variant++) {
+            if (x64_kernels_select751(variant) == false) { passed=0; break; }
+            fpadd751(a, b, c[variant]); fpcorrection751(c[variant]);
+            fpsub751(a, b, d[variant]); fpcorrection751(d[variant]);
+            mp_sub751_p2(a, b, e[variant]);
+            fpmul751_mont(a, b, f[variant]); fpcorrection751(f[variant]);
+            fpsqr751_mont(a, g[variant]); fpcorrection751(g[variant]);
+            fp2mul751_mont(ma, mb, mc[variant]); fp2correction751(mc[variant]);   // Exercises the x2 subtraction kernels
+            fp2sqr751_mont(ma, md[variant]); fp2correction751(md[variant]);       // Exercises mp_add and the 4p subtraction kernel
+        }
+        x64_kernels_select751(active);
+        if (passed == 0) break;
+
+        for (variant = X64_KERNELS_PLAIN+1; variant <= active; variant++) {
+            if (compare_words(c[0], c[variant], NWORDS_FIELD)!=0) { passed=0; break; }
+            if (compare_words(d[0], d[variant], NWORDS_FIELD)!=0) { passed=0; break; }
+            if (compare_words(e[0], e[variant], NWORDS_FIELD)!=0) { passed=0; break; }
+            if (compare_words(f[0], f[variant], NWORDS_FIELD)!=0) { passed=0; break; }
+            if (compare_words(g[0], g[variant], NWORDS_FIELD)!=0) { passed=0; break; }
+            if (compare_words((digit_t*)mc[0], (digit_t*)mc[variant], 2*NWORDS_FIELD)!=0) { passed=0; break; }
+            if (compare_words((digit_t*)md[0], (digit_t*)md[variant], 2*NWORDS_FIELD)!=0) { passed=0; break; }
+        }
+        if (passed == 0) break;
+    }
+    if (passed==1) printf("  Kernel variant agreement tests .................................. PASSED");
+    else { printf("  Kernel variant agreement tests... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    
+    return OK;
+}
+
+
+bool dispatch_run()
+{ // Benchmarks the kernels called through the dispatch table against direct calls to the same variant
+    bool OK = true;
+    int n;
+    unsigned long long cycles, cycles1, cycles2;
+    unsigned int active = x64_kernels751.variant;
+    felm_t a, b, c;
+    dfelm_t aa;
+        
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Benchmarking run-time kernel dispatch over GF(p751): \n\n"); 
+
+    if (active == X64_KERNELS_PLAIN) {
+        printf("  Processor without BMI2, nothing to compare against\n");
+        return OK;
+    }
+        
+    fprandom751_test(a); fprandom751_test(b); fprandom751_test(c);
+
+    // GF(p) addition through the dispatch table
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        fpadd751_asm(a, b, c);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p) addition, dispatched, runs in ............................. %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // GF(p) addition calling the active variant directly
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        if (active == X64_KERNELS_ADX) fpadd751_asm_adx(a, b, c);
+        else fpadd751_asm_mulx(a, b, c);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p) addition, direct call, runs in ............................ %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // GF(p) multiplication and reduction through the dispatch table
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        mul751_asm(a, b, aa);
+        rdc751_asm(aa, c);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p) mul+reduction, dispatched, runs in ........................ %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // GF(p) multiplication and reduction calling the active variant directly
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        if (active == X64_KERNELS_ADX) { mul751_asm_adx(a, b, aa); rdc751_asm_adx(aa, c); }
+        else { mul751_asm_mulx(a, b, aa); rdc751_asm_mulx(aa, c); }
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p) mul+reduction, direct call, runs in ....................... %7lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+    
+    return OK;
+}
+#endif
+
+
+#if defined(DO_VALGRIND_CHECK)
+bool ct_test()
+{ // Checks that the field inversions run in constant time. The inputs are marked as undefined, so that valgrind
+  // reports any branch or memory access that depends on them
+    bool OK = true;
+    int n, passed;
+    felm_t a, c, d, ma, mb, mc;
+    f2elm_t a2, c2, d2, ma2, mb2, mc2;
+
+    if (!RUNNING_ON_VALGRIND) {
+        fprintf(stderr, "This test can only usefully be run inside valgrind.\n");
+        fprintf(stderr, "valgrind arith_tests-p751\n");
+        exit(1);
+    }
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Testing constant-time inversions over GF(p751) and GF(p751^2) with valgrind: \n\n"); 
+
+    passed = 1;
+    fpzero751(d); d[0]=1;
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        fprandom751_test(a);
+        to_mont(a, ma);
+        fpcopy751(ma, mb);
+        VALGRIND_MAKE_MEM_UNDEFINED(ma, sizeof(felm_t));
+        fpinv751_mont(ma);
+        VALGRIND_MAKE_MEM_DEFINED(ma, sizeof(felm_t));
+        fpmul751_mont(ma, mb, mc);                             // c = a*a^-1 
+        from_mont(mc, c);
+        if (compare_words(c, d, NWORDS_FIELD)!=0) { passed=0; break; }
+    }
+    if (passed==1) printf("  GF(p) constant-time inversion tests.............................. PASSED");
+    else { printf("  GF(p) constant-time inversion tests... FAILED"); printf("\n"); return false; }
+    printf("\n");
+
+    passed = 1;
+    fp2zero751(d2); d2[0][0]=1;
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        fp2random751_test((digit_t*)a2);
+        to_fp2mont(a2, ma2);
+        fp2copy751(ma2, mb2);
+        VALGRIND_MAKE_MEM_UNDEFINED(ma2, sizeof(f2elm_t));
+        fp2inv751_mont(ma2);
+        VALGRIND_MAKE_MEM_DEFINED(ma2, sizeof(f2elm_t));
+        fp2mul751_mont(ma2, mb2, mc2);                         // c = a*a^-1 
+        from_fp2mont(mc2, c2);
+        if (compare_words((digit_t*)c2, (digit_t*)d2, 2*NWORDS_FIELD)!=0) { passed=0; break; }
+    }
+    if (passed==1) printf("  GF(p^2) constant-time inversion tests............................ PASSED");
+    else { printf("  GF(p^2) constant-time inversion tests... FAILED"); printf("\n"); return false; }
+    printf("\n");
+
+    return OK;
+}
+#endif
+
 
 int main()
 {
     bool OK = true;
 
+#if defined(DO_VALGRIND_CHECK)
+    OK = OK && ct_test();          // Test that the inversions run in constant time (inside valgrind)
+#else
     OK = OK && fp_test();          // Test field operations using p751
     OK = OK && fp_run();           // Benchmark field operations using p751
 
@@ -609,5 +1080,16 @@ int main()
     
     OK = OK && ecisog_run();       // Benchmark elliptic curve and isogeny functions
 
+#if defined(X64_CURVE_ASM)
+    OK = OK && curve_asm_test();   // Test the fused curve and isogeny kernels against the C versions
+    OK = OK && curve_asm_run();    // Benchmark the fused curve and isogeny kernels against the C versions
+#endif
+
+#if defined(X64_DISPATCH_IMPLEMENTATION)
+    OK = OK && dispatch_test();    // Test the kernel variants selectable at run time
+    OK = OK && dispatch_run();     // Benchmark the cost of calling the kernels through the dispatch table
+#endif
+#endif
+
     return OK;
 }
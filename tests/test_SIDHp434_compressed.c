@@ -18,5 +18,9 @@
 #define EphemeralKeyGeneration_B      EphemeralKeyGeneration_B_SIDHp434_Compressed
 #define EphemeralSecretAgreement_A    EphemeralSecretAgreement_A_SIDHp434_Compressed
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp434_Compressed
+#define EphemeralKeyGeneration_A_ws   EphemeralKeyGeneration_A_ws_SIDHp434_Compressed
+#define EphemeralKeyGeneration_B_ws   EphemeralKeyGeneration_B_ws_SIDHp434_Compressed
+#define EphemeralSecretAgreement_A_ws EphemeralSecretAgreement_A_ws_SIDHp434_Compressed
+#define EphemeralSecretAgreement_B_ws EphemeralSecretAgreement_B_ws_SIDHp434_Compressed
 
 #include "test_sidh.c"
\ No newline at end of file
@@ -14,6 +14,10 @@
 
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp503_compressed
 #define crypto_kem_enc                crypto_kem_enc_SIKEp503_compressed
+#define crypto_kem_enc_parallel       crypto_kem_enc_parallel_SIKEp503_compressed
 #define crypto_kem_dec                crypto_kem_dec_SIKEp503_compressed
+#define crypto_kem_keypair_ws         crypto_kem_keypair_ws_SIKEp503_compressed
+#define crypto_kem_enc_ws             crypto_kem_enc_ws_SIKEp503_compressed
+#define crypto_kem_dec_ws             crypto_kem_dec_ws_SIKEp503_compressed
 
 #include "test_sike.c"
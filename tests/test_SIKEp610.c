@@ -14,6 +14,19 @@
 
 #define crypto_kem_keypair            crypto_kem_keypair_SIKEp610
 #define crypto_kem_enc                crypto_kem_enc_SIKEp610
+#define crypto_kem_enc_parallel       crypto_kem_enc_parallel_SIKEp610
+#define crypto_kem_pk_prepare         crypto_kem_pk_prepare_SIKEp610
+#define crypto_kem_enc_prepared       crypto_kem_enc_prepared_SIKEp610
+#define crypto_kem_prepared_pk        crypto_kem_prepared_pk_SIKEp610
 #define crypto_kem_dec                crypto_kem_dec_SIKEp610
+#define crypto_kem_dec_init           crypto_kem_dec_init_SIKEp610
+#define crypto_kem_dec_step           crypto_kem_dec_step_SIKEp610
+#define crypto_kem_dec_finish         crypto_kem_dec_finish_SIKEp610
+#define crypto_kem_dec_state          crypto_kem_dec_state_SIKEp610
+#define crypto_kem_enc_batch4         crypto_kem_enc_batch4_SIKEp610
+#define crypto_kem_dec_batch4         crypto_kem_dec_batch4_SIKEp610
+#define crypto_kem_keypair_batch      crypto_kem_keypair_batch_SIKEp610
+#define crypto_kem_enc_batch          crypto_kem_enc_batch_SIKEp610
+#define crypto_kem_dec_batch          crypto_kem_dec_batch_SIKEp610
 
 #include "test_sike.c"
\ No newline at end of file
@@ -0,0 +1,133 @@
+/********************************************************************************************
+* SIDH: an efficient supersingular isogeny cryptography library
+*
+* Abstract: testing the scalar Keccak-f[1600] permutations against the reference implementation
+*********************************************************************************************/
+
+#include "test_extras.h"
+#include <stdio.h>
+#include <string.h>
+
+
+// Benchmark and test parameters
+#define BENCH_LOOPS        100000       // Number of iterations per bench
+#define TEST_LOOPS           1000       // Number of iterations per test
+
+
+// Permutations compiled from src/sha3/fips202.c with _KECCAK_TEST_
+void KeccakF1600_StatePermute_ref(uint64_t * state);
+void KeccakF1600_StatePermute_lc(uint64_t * state);
+#if (TARGET == TARGET_AMD64) && (OS_TARGET == OS_NIX)
+    #define KECCAK_TEST_X64_ASM
+void KeccakF1600_StatePermute_x64_asm(uint64_t * state);
+#endif
+
+typedef struct {
+    const char* name;
+    void (*permute)(uint64_t * state);
+} permutation_t;
+
+static const permutation_t permutations[] = {
+    {"Reference",            KeccakF1600_StatePermute_ref},
+    {"Lane-complementing C", KeccakF1600_StatePermute_lc},
+#if defined(KECCAK_TEST_X64_ASM)
+    {"x64 assembly",         KeccakF1600_StatePermute_x64_asm},
+#endif
+};
+
+#define NPERMUTATIONS    (sizeof(permutations)/sizeof(permutations[0]))
+
+// Keccak-f[1600] applied to the all-zero state
+static const uint64_t zero_state_kat[25] = {
+    0xF1258F7940E1DDE7, 0x84D5CCF933C0478A, 0xD598261EA65AA9EE, 0xBD1547306F80494D,
+    0x8B284E056253D057, 0xFF97A42D7F8E6FD4, 0x90FEE5A0A44647C4, 0x8C5BDA0CD6192E76,
+    0xAD30A6F71B19059C, 0x30935AB7D08FFC64, 0xEB5AA93F2317D635, 0xA9A6E6260D712103,
+    0x81A57C16DBCF555F, 0x43B831CD0347C826, 0x01F22F1A11A5569F, 0x05E5635A21D9AE61,
+    0x64BEFEF28CC970F2, 0x613670957BC46611, 0xB87C5A554FD00ECB, 0x8C3EE88A1CCF32C8,
+    0x940C7922AE3A2614, 0x1841F924A2C509E4, 0x16F53526E70465C2, 0x75F644E97F30A13B,
+    0xEAF1FF7B5CECA249 };
+
+
+static void print_result(const char* name, bool passed)
+{ // Prints "  <name> tests ..... PASSED" aligned with the other test programs
+    char label[96];
+    size_t i;
+
+    snprintf(label, sizeof(label), "  %s tests ", name);
+    for (i = strlen(label); i < 67; i++) {
+        label[i] = '.';
+    }
+    label[i] = '\0';
+    printf("%s %s\n", label, (passed == true) ? "PASSED" : "FAILED");
+}
+
+
+bool keccak_test()
+{ // Tests for the scalar permutations, against the known answer for the zero state and against the reference on chained states
+    bool OK = true, passed;
+    unsigned int i, n;
+    uint64_t state[25], state_ref[25];
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Testing Keccak-f[1600] permutations: \n\n");
+
+    for (i = 0; i < NPERMUTATIONS; i++) {
+        passed = true;
+
+        memset(state, 0, sizeof(state));
+        permutations[i].permute(state);
+        if (memcmp(state, zero_state_kat, sizeof(state)) != 0) passed = false;
+
+        for (n = 0; n < 25; n++) {
+            state[n] = state_ref[n] = (uint64_t)0x0123456789ABCDEF*(n + 1) ^ ((uint64_t)n << 59);
+        }
+        for (n = 0; n < TEST_LOOPS && passed == true; n++) {
+            permutations[i].permute(state);
+            KeccakF1600_StatePermute_ref(state_ref);
+            state[n % 25] ^= (uint64_t)n;
+            state_ref[n % 25] ^= (uint64_t)n;
+            if (memcmp(state, state_ref, sizeof(state)) != 0) passed = false;
+        }
+
+        print_result(permutations[i].name, passed);
+        OK = OK && passed;
+    }
+
+    return OK;
+}
+
+
+bool keccak_run()
+{ // Benchmarking the scalar permutations
+    unsigned int i, n;
+    unsigned long long cycles, cycles1, cycles2;
+    uint64_t state[25] = {0};
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Benchmarking Keccak-f[1600] permutations: \n\n");
+
+    for (i = 0; i < NPERMUTATIONS; i++) {
+        cycles = 0;
+        for (n = 0; n < BENCH_LOOPS; n++) {
+            cycles1 = cpucycles();
+            permutations[i].permute(state);
+            cycles2 = cpucycles();
+            cycles = cycles+(cycles2-cycles1);
+        }
+        printf("  %-22s permutation runs in ............................ %7lld ", permutations[i].name, cycles/BENCH_LOOPS); print_unit;
+        printf("\n");
+    }
+
+    return true;
+}
+
+
+int main()
+{
+    bool OK = true;
+
+    OK = OK && keccak_test();      // Test the permutations against the reference
+    OK = OK && keccak_run();       // Benchmark the permutations
+
+    return (OK == true) ? PASSED : FAILED;
+}
@@ -50,6 +50,51 @@ int cryptotest_kex()
 }
 
 
+#if defined(EphemeralKeyGeneration_A_ws)
+
+int cryptotest_kex_workspace()
+{ // Testing key exchange with a caller-provided workspace against the key exchange
+    unsigned int i;
+    static unsigned long long workspace[SIKE_WORKSPACE_BYTES/sizeof(unsigned long long)];
+    unsigned char PrivateKeyA[SIDH_SECRETKEYBYTES_A], PrivateKeyB[SIDH_SECRETKEYBYTES_B];
+    unsigned char PublicKeyA[SIDH_PUBLICKEYBYTES] = {0}, PublicKeyB[SIDH_PUBLICKEYBYTES] = {0};    // Bob's public key can be shorter than SIDH_PUBLICKEYBYTES
+    unsigned char PublicKeyA_[SIDH_PUBLICKEYBYTES] = {0}, PublicKeyB_[SIDH_PUBLICKEYBYTES] = {0};
+    unsigned char SharedSecretA[SIDH_BYTES], SharedSecretB[SIDH_BYTES];
+    unsigned char SharedSecretA_[SIDH_BYTES], SharedSecretB_[SIDH_BYTES];
+    bool passed = true;
+
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        random_mod_order_A(PrivateKeyA);
+        random_mod_order_B(PrivateKeyB);
+
+        EphemeralKeyGeneration_A(PrivateKeyA, PublicKeyA);
+        EphemeralKeyGeneration_B(PrivateKeyB, PublicKeyB);
+        EphemeralSecretAgreement_A(PrivateKeyA, PublicKeyB, SharedSecretA);
+        EphemeralSecretAgreement_B(PrivateKeyB, PublicKeyA, SharedSecretB);
+        EphemeralKeyGeneration_A_ws(PrivateKeyA, PublicKeyA_, workspace, sizeof(workspace));
+        EphemeralKeyGeneration_B_ws(PrivateKeyB, PublicKeyB_, workspace, sizeof(workspace));
+        EphemeralSecretAgreement_A_ws(PrivateKeyA, PublicKeyB, SharedSecretA_, workspace, sizeof(workspace));
+        EphemeralSecretAgreement_B_ws(PrivateKeyB, PublicKeyA, SharedSecretB_, workspace, sizeof(workspace));
+        
+        if ((memcmp(PublicKeyA, PublicKeyA_, SIDH_PUBLICKEYBYTES) != 0) || (memcmp(PublicKeyB, PublicKeyB_, SIDH_PUBLICKEYBYTES) != 0) ||
+            (memcmp(SharedSecretA, SharedSecretA_, SIDH_BYTES) != 0) || (memcmp(SharedSecretB, SharedSecretB_, SIDH_BYTES) != 0)) {
+            passed = false;
+            break;
+        }
+    }
+    if (EphemeralKeyGeneration_A_ws(PrivateKeyA, PublicKeyA_, workspace, 0) != -1) passed = false;
+
+    if (passed == true) printf("  Key exchange tests with workspace ............................ PASSED");
+    else { printf("  Key exchange tests with workspace ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+#endif
+
+
 int cryptorun_kex()
 { // Benchmarking key exchange
     unsigned int n;
@@ -114,6 +159,14 @@ int main()
         return FAILED;
     }
 
+#if defined(EphemeralKeyGeneration_A_ws)
+    Status = cryptotest_kex_workspace();   // Test key exchange with a caller-provided workspace
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+
     Status = cryptorun_kex();              // Benchmark key exchange
     if (Status != PASSED) {
         printf("\n\n   Error detected: KEX_ERROR_SHARED_KEY \n\n");
@@ -5,6 +5,7 @@
 *********************************************************************************************/ 
 
 #include "../src/random/random.h"
+#include "../src/sha3/fips202.h"
 
 #ifdef DO_VALGRIND_CHECK
 #include <valgrind/memcheck.h>
@@ -134,6 +135,775 @@ int cryptorun_kem()
 }
 
 
+#if defined(crypto_kem_enc_batch4)
+
+int cryptotest_shake256x4()
+{ // Testing 4-way SHAKE256 against SHAKE256, for inputs and outputs spanning several blocks
+    unsigned int i, j, k, inlen, outlen;
+    unsigned char in[4][3*SHAKE256_RATE], out[4][3*SHAKE256_RATE], out1[3*SHAKE256_RATE];
+    const unsigned char *in_ptr[4] = {in[0], in[1], in[2], in[3]};
+    unsigned char *out_ptr[4] = {out[0], out[1], out[2], out[3]};
+    unsigned char bytes[4];
+    bool passed = true;
+
+    for (i = 0; i < 10*TEST_LOOPS && passed; i++) 
+    {
+        randombytes(bytes, 4);
+        inlen = (bytes[0] | (bytes[1] << 8)) % (3*SHAKE256_RATE);
+        outlen = 1 + (bytes[2] | (bytes[3] << 8)) % (3*SHAKE256_RATE);
+        for (j = 0; j < 4; j++) {
+            randombytes(in[j], inlen);
+        }
+        shake256x4(out_ptr, outlen, in_ptr, inlen);
+        for (j = 0; j < 4; j++) {
+            shake256(out1, outlen, in[j], inlen);
+            for (k = 0; k < outlen; k++) {
+                if (out1[k] != out[j][k]) {
+                    passed = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (passed == true) printf("  4-way SHAKE256 tests ......................................... PASSED");
+    else { printf("  4-way SHAKE256 tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptotest_kem_batch4()
+{ // Testing batched KEM against the single-operation KEM
+    unsigned int i, j;
+    unsigned char sk[4][CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[4*CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[4*CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[4*CRYPTO_BYTES] = {0};
+    unsigned char ss_[4*CRYPTO_BYTES] = {0};
+    unsigned char ss1[CRYPTO_BYTES] = {0};
+    unsigned char bytes[4];
+    uint32_t* pos = (uint32_t*)bytes;
+    bool passed = true;
+
+    for (i = 0; i < TEST_LOOPS && passed; i++) 
+    {
+        // Encapsulation to four different public keys, decapsulation of each ciphertext with crypto_kem_dec
+        for (j = 0; j < 4; j++) {
+            crypto_kem_keypair(pk + j*CRYPTO_PUBLICKEYBYTES, sk[j]);
+        }
+        crypto_kem_enc_batch4(ct, ss, pk);
+        for (j = 0; j < 4; j++) {
+            crypto_kem_dec(ss1, ct + j*CRYPTO_CIPHERTEXTBYTES, sk[j]);
+            if (memcmp(ss + j*CRYPTO_BYTES, ss1, CRYPTO_BYTES) != 0) {
+                passed = false;
+                break;
+            }
+        }
+
+        // Encapsulation to the same public key four times, batched decapsulation
+        for (j = 1; j < 4; j++) {
+            memcpy(pk + j*CRYPTO_PUBLICKEYBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+        }
+        crypto_kem_enc_batch4(ct, ss, pk);
+        crypto_kem_dec_batch4(ss_, ct, sk[0]);
+#ifdef DO_VALGRIND_CHECK
+        VALGRIND_MAKE_MEM_DEFINED(ss, 4*CRYPTO_BYTES);
+        VALGRIND_MAKE_MEM_DEFINED(ss_, 4*CRYPTO_BYTES);
+#endif
+        if (memcmp(ss, ss_, 4*CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+
+        // Testing batched decapsulation after changing one bit of the ciphertext in one lane
+        randombytes(bytes, 4);
+        j = bytes[0] % 4;
+        *pos %= CRYPTO_CIPHERTEXTBYTES;
+        ct[j*CRYPTO_CIPHERTEXTBYTES + *pos] ^= 1;
+        crypto_kem_dec_batch4(ss_, ct, sk[0]);
+        crypto_kem_dec(ss1, ct + j*CRYPTO_CIPHERTEXTBYTES, sk[0]);
+#ifdef DO_VALGRIND_CHECK
+        VALGRIND_MAKE_MEM_DEFINED(ss_, 4*CRYPTO_BYTES);
+        VALGRIND_MAKE_MEM_DEFINED(ss1, CRYPTO_BYTES);
+#endif
+        if (memcmp(ss + j*CRYPTO_BYTES, ss_ + j*CRYPTO_BYTES, CRYPTO_BYTES) == 0 || memcmp(ss1, ss_ + j*CRYPTO_BYTES, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+        ct[j*CRYPTO_CIPHERTEXTBYTES + *pos] ^= 1;
+        memcpy(ss_ + j*CRYPTO_BYTES, ss + j*CRYPTO_BYTES, CRYPTO_BYTES);
+        if (memcmp(ss, ss_, 4*CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed == true) printf("  Batched KEM tests (4 operations per call) .................... PASSED");
+    else { printf("  Batched KEM tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptorun_shake256x4()
+{ // Benchmarking 4-way SHAKE256 on inputs of the size hashed by H(m||ct)
+    unsigned int n, j;
+    unsigned char in[4][CRYPTO_BYTES+CRYPTO_CIPHERTEXTBYTES] = {{0}}, out[4][CRYPTO_BYTES];
+    const unsigned char *in_ptr[4] = {in[0], in[1], in[2], in[3]};
+    unsigned char *out_ptr[4] = {out[0], out[1], out[2], out[3]};
+    unsigned long long cycles_1way = 0, cycles_4way = 0, cycles1, cycles2;
+
+    for (n = 0; n < 10*BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        for (j = 0; j < 4; j++) {
+            shake256(out[j], CRYPTO_BYTES, in[j], CRYPTO_BYTES+CRYPTO_CIPHERTEXTBYTES);
+        }
+        cycles2 = cpucycles();
+        cycles_1way = cycles_1way+(cycles2-cycles1);
+
+        cycles1 = cpucycles();
+        shake256x4(out_ptr, CRYPTO_BYTES, in_ptr, CRYPTO_BYTES+CRYPTO_CIPHERTEXTBYTES);
+        cycles2 = cpucycles();
+        cycles_4way = cycles_4way+(cycles2-cycles1);
+    }
+
+    printf("  Hashing of a ciphertext runs in (SHAKE256) ................... %10lld ", cycles_1way/(4*10*BENCH_LOOPS)); print_unit;
+    printf("\n");
+    printf("  Hashing of a ciphertext runs in (4-way SHAKE256, per hash) ... %10lld ", cycles_4way/(4*10*BENCH_LOOPS)); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+
+int cryptorun_kem_batch4()
+{ // Benchmarking batched key encapsulation mechanism
+    unsigned int n, j;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[4*CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[4*CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[4*CRYPTO_BYTES] = {0};
+    unsigned char ss_[4*CRYPTO_BYTES] = {0};
+    unsigned long long cycles_encaps = 0, cycles_decaps = 0, cycles1, cycles2;
+
+    crypto_kem_keypair(pk, sk);
+    for (j = 1; j < 4; j++) {
+        memcpy(pk + j*CRYPTO_PUBLICKEYBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+    }
+
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        // Benchmarking batched encapsulation
+        cycles1 = cpucycles();
+        crypto_kem_enc_batch4(ct, ss, pk);
+        cycles2 = cpucycles();
+        cycles_encaps = cycles_encaps+(cycles2-cycles1);
+
+        // Benchmarking batched decapsulation
+        cycles1 = cpucycles();
+        crypto_kem_dec_batch4(ss_, ct, sk);
+        cycles2 = cpucycles();
+        cycles_decaps = cycles_decaps+(cycles2-cycles1);
+    }
+
+    printf("  Batched encapsulation runs in (per operation) ................ %10lld ", cycles_encaps/(4*BENCH_LOOPS)); print_unit;
+    printf("\n");
+    printf("  Batched decapsulation runs in (per operation) ................ %10lld ", cycles_decaps/(4*BENCH_LOOPS)); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+#endif
+
+
+#if defined(crypto_kem_enc_batch)
+
+#define BATCH_SIZE    11      // Number of operations per batched call in the tests
+
+int cryptotest_kem_batch()
+{ // Testing batched KEM with shared inversions against the single-operation KEM
+    unsigned int i, j;
+    unsigned char sk[BATCH_SIZE*CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[BATCH_SIZE*CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[BATCH_SIZE*CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[BATCH_SIZE*CRYPTO_BYTES] = {0};
+    unsigned char ss_[BATCH_SIZE*CRYPTO_BYTES] = {0};
+    unsigned char ss1[CRYPTO_BYTES] = {0};
+    unsigned char bytes[4];
+    uint32_t* pos = (uint32_t*)bytes;
+    bool passed = true;
+
+    for (i = 0; i < TEST_LOOPS && passed; i++) 
+    {
+        // Batched key generation and encapsulation, decapsulation of each ciphertext with crypto_kem_dec
+        crypto_kem_keypair_batch(BATCH_SIZE, pk, sk);
+        crypto_kem_enc_batch(BATCH_SIZE, ct, ss, pk);
+        for (j = 0; j < BATCH_SIZE; j++) {
+            crypto_kem_dec(ss1, ct + j*CRYPTO_CIPHERTEXTBYTES, sk + j*CRYPTO_SECRETKEYBYTES);
+            if (memcmp(ss + j*CRYPTO_BYTES, ss1, CRYPTO_BYTES) != 0) {
+                passed = false;
+                break;
+            }
+        }
+
+        // Encapsulation to the same public key, batched decapsulation
+        for (j = 1; j < BATCH_SIZE; j++) {
+            memcpy(pk + j*CRYPTO_PUBLICKEYBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+        }
+        crypto_kem_enc_batch(BATCH_SIZE, ct, ss, pk);
+        crypto_kem_dec_batch(BATCH_SIZE, ss_, ct, sk);
+#ifdef DO_VALGRIND_CHECK
+        VALGRIND_MAKE_MEM_DEFINED(ss, BATCH_SIZE*CRYPTO_BYTES);
+        VALGRIND_MAKE_MEM_DEFINED(ss_, BATCH_SIZE*CRYPTO_BYTES);
+#endif
+        if (memcmp(ss, ss_, BATCH_SIZE*CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+
+        // Testing batched decapsulation after changing one bit of a ciphertext and zeroing another one
+        randombytes(bytes, 4);
+        j = bytes[0] % BATCH_SIZE;
+        *pos %= CRYPTO_CIPHERTEXTBYTES;
+        ct[j*CRYPTO_CIPHERTEXTBYTES + *pos] ^= 1;
+        memset(ct + ((j + 1) % BATCH_SIZE)*CRYPTO_CIPHERTEXTBYTES, 0, CRYPTO_CIPHERTEXTBYTES);
+        crypto_kem_dec_batch(BATCH_SIZE, ss_, ct, sk);
+        crypto_kem_dec(ss1, ct + j*CRYPTO_CIPHERTEXTBYTES, sk);
+        if (memcmp(ss + j*CRYPTO_BYTES, ss_ + j*CRYPTO_BYTES, CRYPTO_BYTES) == 0 || memcmp(ss1, ss_ + j*CRYPTO_BYTES, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+        crypto_kem_dec(ss1, ct + ((j + 1) % BATCH_SIZE)*CRYPTO_CIPHERTEXTBYTES, sk);
+        if (memcmp(ss1, ss_ + ((j + 1) % BATCH_SIZE)*CRYPTO_BYTES, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+        memcpy(ss_ + j*CRYPTO_BYTES, ss + j*CRYPTO_BYTES, CRYPTO_BYTES);
+        memcpy(ss_ + ((j + 1) % BATCH_SIZE)*CRYPTO_BYTES, ss + ((j + 1) % BATCH_SIZE)*CRYPTO_BYTES, CRYPTO_BYTES);
+        if (memcmp(ss, ss_, BATCH_SIZE*CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed == true) printf("  Batched KEM tests (shared inversions) ........................ PASSED");
+    else { printf("  Batched KEM tests (shared inversions) ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptorun_kem_batch()
+{ // Benchmarking batched key encapsulation mechanism with shared inversions
+    unsigned int n, j;
+    unsigned char sk[BATCH_SIZE*CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[BATCH_SIZE*CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[BATCH_SIZE*CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[BATCH_SIZE*CRYPTO_BYTES] = {0};
+    unsigned char ss_[BATCH_SIZE*CRYPTO_BYTES] = {0};
+    unsigned long long cycles_keygen = 0, cycles_encaps = 0, cycles_decaps = 0, cycles1, cycles2;
+
+    for (n = 0; n < BENCH_LOOPS/10 + 1; n++)
+    {
+        // Benchmarking batched key generation
+        cycles1 = cpucycles();
+        crypto_kem_keypair_batch(BATCH_SIZE, pk, sk);
+        cycles2 = cpucycles();
+        cycles_keygen = cycles_keygen+(cycles2-cycles1);
+        for (j = 1; j < BATCH_SIZE; j++) {
+            memcpy(pk + j*CRYPTO_PUBLICKEYBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+        }
+
+        // Benchmarking batched encapsulation
+        cycles1 = cpucycles();
+        crypto_kem_enc_batch(BATCH_SIZE, ct, ss, pk);
+        cycles2 = cpucycles();
+        cycles_encaps = cycles_encaps+(cycles2-cycles1);
+
+        // Benchmarking batched decapsulation
+        cycles1 = cpucycles();
+        crypto_kem_dec_batch(BATCH_SIZE, ss_, ct, sk);
+        cycles2 = cpucycles();
+        cycles_decaps = cycles_decaps+(cycles2-cycles1);
+    }
+
+    printf("  Batched key generation runs in (per operation) ............... %10lld ", cycles_keygen/(BATCH_SIZE*(BENCH_LOOPS/10 + 1))); print_unit;
+    printf("\n");
+    printf("  Batched encapsulation runs in (per operation, shared inv.) ... %10lld ", cycles_encaps/(BATCH_SIZE*(BENCH_LOOPS/10 + 1))); print_unit;
+    printf("\n");
+    printf("  Batched decapsulation runs in (per operation, shared inv.) ... %10lld ", cycles_decaps/(BATCH_SIZE*(BENCH_LOOPS/10 + 1))); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+#endif
+
+
+#if defined(crypto_kem_enc_prepared)
+
+int cryptotest_kem_prepared()
+{ // Testing encapsulation to a prepared public key against the decapsulation
+    unsigned int i;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    crypto_kem_prepared_pk prepared;
+    bool passed = true;
+
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        crypto_kem_keypair(pk, sk);
+        crypto_kem_pk_prepare(pk, &prepared);
+        crypto_kem_enc_prepared(ct, ss, &prepared);
+        crypto_kem_dec(ss_, ct, sk);
+        
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+        crypto_kem_enc_prepared(ct, ss, &prepared);   // The prepared public key is reused
+        crypto_kem_dec(ss_, ct, sk);
+        
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed == true) printf("  Prepared-key encapsulation tests ............................. PASSED");
+    else { printf("  Prepared-key encapsulation tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptorun_kem_prepared()
+{ // Benchmarking encapsulation to a prepared public key
+    unsigned int n;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    crypto_kem_prepared_pk prepared;
+    unsigned long long cycles_prepare = 0, cycles_encaps = 0, cycles1, cycles2;
+
+    crypto_kem_keypair(pk, sk);
+
+    // Benchmarking public key preparation
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        crypto_kem_pk_prepare(pk, &prepared);
+        cycles2 = cpucycles();
+        cycles_prepare = cycles_prepare+(cycles2-cycles1);
+    }
+    printf("  Public key preparation runs in ............................... %10lld ", cycles_prepare/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    // Benchmarking encapsulation to the prepared public key
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        crypto_kem_enc_prepared(ct, ss, &prepared);
+        cycles2 = cpucycles();
+        cycles_encaps = cycles_encaps+(cycles2-cycles1);
+    }
+    printf("  Prepared-key encapsulation runs in ........................... %10lld ", cycles_encaps/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+#endif
+
+
+#if defined(crypto_kem_dec_init)
+
+int cryptotest_kem_dec_resumable()
+{ // Testing resumable decapsulation against the decapsulation
+    unsigned int i, budget;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    unsigned char bytes[4];
+    uint32_t* pos = (uint32_t*)&bytes[0];
+    crypto_kem_dec_state state;
+    bool passed = true;
+
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        crypto_kem_keypair(pk, sk);
+        crypto_kem_enc(ct, ss, pk);
+
+        // Budgets of 1, 2, 4, ... steps per call
+        budget = 1 << (i % 8);
+        crypto_kem_dec_init(&state, ct, sk);
+        while (crypto_kem_dec_step(&state, budget) != 0);
+        crypto_kem_dec_finish(ss_, &state);
+        
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+
+        // Testing resumable decapsulation after changing one bit of ct, finishing in a single call
+        randombytes(bytes, 4);
+        *pos %= CRYPTO_CIPHERTEXTBYTES;
+        ct[*pos] ^= 1;
+        crypto_kem_dec(ss, ct, sk);
+        crypto_kem_dec_init(&state, ct, sk);
+        crypto_kem_dec_step(&state, budget);
+        crypto_kem_dec_finish(ss_, &state);
+        
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed == true) printf("  Resumable decapsulation tests ................................ PASSED");
+    else { printf("  Resumable decapsulation tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptorun_kem_dec_resumable()
+{ // Benchmarking resumable decapsulation with a budget of one step per call
+    unsigned int n, nsteps = 0;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    crypto_kem_dec_state state;
+    unsigned long long cycles_decaps = 0, cycles_step = 0, cycles1, cycles2, cycles3;
+    int more;
+
+    crypto_kem_keypair(pk, sk);
+    crypto_kem_enc(ct, ss, pk);
+
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        nsteps = 0;
+        cycles1 = cpucycles();
+        crypto_kem_dec_init(&state, ct, sk);
+        do {
+            cycles2 = cpucycles();
+            more = crypto_kem_dec_step(&state, 1);
+            cycles3 = cpucycles();
+            if ((cycles3-cycles2) > cycles_step) cycles_step = cycles3-cycles2;
+            nsteps++;
+        } while (more != 0);
+        crypto_kem_dec_finish(ss, &state);
+        cycles2 = cpucycles();
+        cycles_decaps = cycles_decaps+(cycles2-cycles1);
+    }
+    printf("  Resumable decapsulation runs in .............................. %10lld ", cycles_decaps/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  Resumable decapsulation steps per operation .................. %10u ", nsteps);
+    printf("\n");
+    printf("  Longest resumable decapsulation step runs in ................. %10lld ", cycles_step); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+#endif
+
+
+#if defined(crypto_kem_keypair_ws)
+
+#if defined(__GNUC__) && !defined(DO_VALGRIND_CHECK)
+#define STACK_PAINT_BYTES    (1024*1024)    // Larger than the stack use of any of the measured functions
+#define STACK_PAINT_MARGIN   256            // Bytes right below the caller's frame that are left untouched
+#define STACK_PAINT_MARK     0xA5
+
+static __attribute__((noinline)) void stack_paint(void)
+{ // Fills the STACK_PAINT_BYTES bytes below the stack frame of the caller with STACK_PAINT_MARK
+    volatile unsigned char* stack = (volatile unsigned char*)__builtin_frame_address(0) - STACK_PAINT_BYTES;
+
+    for (size_t i = 0; i < STACK_PAINT_BYTES - STACK_PAINT_MARGIN; i++) {
+        stack[i] = STACK_PAINT_MARK;
+    }
+}
+
+
+static __attribute__((noinline)) size_t stack_peak(void)
+{ // Returns the peak stack use of the functions called since stack_paint, which must be called from the same stack frame
+    volatile unsigned char* stack = (volatile unsigned char*)__builtin_frame_address(0) - STACK_PAINT_BYTES;
+    size_t i = 0;
+
+    while ((i < STACK_PAINT_BYTES - STACK_PAINT_MARGIN) && (stack[i] == STACK_PAINT_MARK)) {
+        i++;
+    }
+    return STACK_PAINT_BYTES - i;
+}
+#endif
+
+
+int cryptotest_kem_workspace()
+{ // Testing the KEM with a caller-provided workspace against the KEM, and reporting the peak stack use of both
+    unsigned int i;
+    static unsigned long long workspace[SIKE_WORKSPACE_BYTES/sizeof(unsigned long long)];
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    unsigned char bytes[4];
+    uint32_t* pos = (uint32_t*)&bytes[0];
+    bool passed = true;
+
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        if (crypto_kem_keypair_ws(pk, sk, workspace, sizeof(workspace)) != 0) {
+            passed = false;
+            break;
+        }
+        crypto_kem_enc_ws(ct, ss, pk, workspace, sizeof(workspace));
+        crypto_kem_dec(ss_, ct, sk);
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+        crypto_kem_enc(ct, ss, pk);
+        crypto_kem_dec_ws(ss_, ct, sk, workspace, sizeof(workspace));
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+
+        // Testing decapsulation after changing one bit of ct
+        randombytes(bytes, 4);
+        *pos %= CRYPTO_CIPHERTEXTBYTES;
+        ct[*pos] ^= 1;
+        crypto_kem_dec(ss, ct, sk);
+        crypto_kem_dec_ws(ss_, ct, sk, workspace, sizeof(workspace));
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+    }
+
+    // The workspace is cleared on return, and workspaces that are too small or misaligned are rejected
+    for (i = 0; i < sizeof(workspace)/sizeof(unsigned long long); i++) {
+        if (workspace[i] != 0) passed = false;
+    }
+    if (crypto_kem_dec_ws(ss_, ct, sk, workspace, 0) != -1) passed = false;
+    if (crypto_kem_dec_ws(ss_, ct, sk, (unsigned char*)workspace + 1, sizeof(workspace) - 1) != -1) passed = false;
+
+    if (passed == true) printf("  Workspace KEM tests .......................................... PASSED");
+    else { printf("  Workspace KEM tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+#if defined(__GNUC__) && !defined(DO_VALGRIND_CHECK)
+    // The functions are called through volatile pointers so that they are not inlined into this stack frame
+    int (* volatile keypair)(unsigned char*, unsigned char*) = crypto_kem_keypair;
+    int (* volatile keypair_ws)(unsigned char*, unsigned char*, void*, size_t) = crypto_kem_keypair_ws;
+    int (* volatile enc)(unsigned char*, unsigned char*, const unsigned char*) = crypto_kem_enc;
+    int (* volatile enc_ws)(unsigned char*, unsigned char*, const unsigned char*, void*, size_t) = crypto_kem_enc_ws;
+    int (* volatile dec)(unsigned char*, const unsigned char*, const unsigned char*) = crypto_kem_dec;
+    int (* volatile dec_ws)(unsigned char*, const unsigned char*, const unsigned char*, void*, size_t) = crypto_kem_dec_ws;
+    size_t peak[6];
+
+    stack_paint();
+    keypair(pk, sk);
+    peak[0] = stack_peak();
+    stack_paint();
+    keypair_ws(pk, sk, workspace, sizeof(workspace));
+    peak[1] = stack_peak();
+    stack_paint();
+    enc(ct, ss, pk);
+    peak[2] = stack_peak();
+    stack_paint();
+    enc_ws(ct, ss, pk, workspace, sizeof(workspace));
+    peak[3] = stack_peak();
+    stack_paint();
+    dec(ss_, ct, sk);
+    peak[4] = stack_peak();
+    stack_paint();
+    dec_ws(ss_, ct, sk, workspace, sizeof(workspace));
+    peak[5] = stack_peak();
+
+    printf("  Workspace size (SIKE_WORKSPACE_BYTES) ........................ %10u bytes\n", (unsigned int)SIKE_WORKSPACE_BYTES);
+    printf("  Peak stack use of key generation ............................. %10u bytes\n", (unsigned int)peak[0]);
+    printf("  Peak stack use of key generation with workspace .............. %10u bytes\n", (unsigned int)peak[1]);
+    printf("  Peak stack use of encapsulation .............................. %10u bytes\n", (unsigned int)peak[2]);
+    printf("  Peak stack use of encapsulation with workspace ............... %10u bytes\n", (unsigned int)peak[3]);
+    printf("  Peak stack use of decapsulation .............................. %10u bytes\n", (unsigned int)peak[4]);
+    printf("  Peak stack use of decapsulation with workspace ............... %10u bytes\n", (unsigned int)peak[5]);
+#endif
+
+    return PASSED;
+}
+
+#endif
+
+
+#if defined(crypto_kem_enc_parallel)
+#if defined(__NIX__)
+    #include <unistd.h>
+    #include <sys/wait.h>
+#endif
+
+int cryptotest_kem_parallel()
+{ // Testing two-thread encapsulation against the single-thread decapsulation, also in the child of a fork()
+    unsigned int i;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char ss_[CRYPTO_BYTES] = {0};
+    bool passed = true;
+#if defined(__NIX__)
+    pid_t pid;
+    int status;
+#endif
+
+    for (i = 0; i < TEST_LOOPS; i++) 
+    {
+        crypto_kem_keypair(pk, sk);
+        crypto_kem_enc_parallel(ct, ss, pk);
+        crypto_kem_dec(ss_, ct, sk);
+        
+        if (memcmp(ss, ss_, CRYPTO_BYTES) != 0) {
+            passed = false;
+            break;
+        }
+    }
+
+#if defined(__NIX__)
+    // The thread pool has been started above. The child must start its own workers instead of waiting for the parent's
+    fflush(stdout);
+    pid = fork();
+    if (pid == 0) {
+        alarm(600);
+        crypto_kem_enc_parallel(ct, ss, pk);
+        crypto_kem_dec(ss_, ct, sk);
+        _exit(memcmp(ss, ss_, CRYPTO_BYTES) != 0);
+    }
+    if (pid < 0 || waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        passed = false;
+    }
+#endif
+
+    if (passed == true) printf("  Parallel encapsulation tests ................................. PASSED");
+    else { printf("  Parallel encapsulation tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int cryptorun_kem_parallel()
+{ // Benchmarking two-thread encapsulation
+    unsigned int n;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned long long cycles_encaps = 0, cycles1, cycles2;
+
+    crypto_kem_keypair(pk, sk);
+    crypto_kem_enc_parallel(ct, ss, pk);    // Warm-up call, which starts the thread pool
+
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        crypto_kem_enc_parallel(ct, ss, pk);
+        cycles2 = cpucycles();
+        cycles_encaps = cycles_encaps+(cycles2-cycles1);
+    }
+
+    printf("  Parallel encapsulation runs in (wall clock) .................. %10lld ", cycles_encaps/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+#endif
+
+
+int cryptorun_randombytes()
+{ // Benchmarking the system random number generator used by the KEM
+    unsigned int n;
+    unsigned char sk[CRYPTO_SECRETKEYBYTES] = {0};
+    unsigned char pk[CRYPTO_PUBLICKEYBYTES] = {0};
+    unsigned char ct[CRYPTO_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[CRYPTO_BYTES] = {0};
+    unsigned char r[CRYPTO_BYTES];
+    unsigned long long syscalls_keygen = 0, syscalls_encaps = 0, syscalls1, cycles = 0, cycles1, cycles2;
+
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        syscalls1 = randombytes_syscalls();
+        crypto_kem_keypair(pk, sk);
+        syscalls_keygen += randombytes_syscalls() - syscalls1;
+
+        syscalls1 = randombytes_syscalls();
+        crypto_kem_enc(ct, ss, pk);
+        syscalls_encaps += randombytes_syscalls() - syscalls1;
+    }
+
+    for (n = 0; n < 10*BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        randombytes(r, CRYPTO_BYTES);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+
+    printf("  OS random requests per 100 key generations ................... %10lld ", 100*syscalls_keygen/BENCH_LOOPS);
+    printf("\n");
+    printf("  OS random requests per 100 encapsulations .................... %10lld ", 100*syscalls_encaps/BENCH_LOOPS);
+    printf("\n");
+    printf("  Generation of a random message runs in ....................... %10lld ", cycles/(10*BENCH_LOOPS)); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+int cryptorun_shake256()
+{ // Benchmarking SHAKE256 in cycles per byte of input, on a long message and on inputs of the size hashed by H(m||ct)
+    unsigned int n;
+    unsigned char in[4096] = {0}, out[CRYPTO_BYTES];
+    unsigned long long cycles_long = 0, cycles_ct = 0, cycles1, cycles2;
+
+    for (n = 0; n < 10*BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        shake256(out, CRYPTO_BYTES, in, sizeof(in));
+        cycles2 = cpucycles();
+        cycles_long = cycles_long+(cycles2-cycles1);
+
+        cycles1 = cpucycles();
+        shake256(out, CRYPTO_BYTES, in, CRYPTO_BYTES+CRYPTO_CIPHERTEXTBYTES);
+        cycles2 = cpucycles();
+        cycles_ct = cycles_ct+(cycles2-cycles1);
+    }
+
+    printf("  SHAKE256 on 4096 bytes runs in (per byte) .................... %10.1f ", (double)cycles_long/(10*BENCH_LOOPS*sizeof(in))); print_unit;
+    printf("\n");
+    printf("  SHAKE256 on m||ct runs in (per byte) ......................... %10.1f ", (double)cycles_ct/(10*BENCH_LOOPS*(CRYPTO_BYTES+CRYPTO_CIPHERTEXTBYTES))); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+
 int main(int argc, char **argv)
 {
     int Status = PASSED;
@@ -143,6 +913,53 @@ int main(int argc, char **argv)
         printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
         return FAILED;
     }
+#if defined(crypto_kem_enc_prepared)
+    Status = cryptotest_kem_prepared();   // Test encapsulation to a prepared public key
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+#if defined(crypto_kem_dec_init)
+    Status = cryptotest_kem_dec_resumable();   // Test resumable decapsulation
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+#if defined(crypto_kem_keypair_ws)
+    Status = cryptotest_kem_workspace();  // Test KEM with a caller-provided workspace
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+#if defined(crypto_kem_enc_parallel)
+    Status = cryptotest_kem_parallel();   // Test two-thread encapsulation
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+#if defined(crypto_kem_enc_batch4)
+    Status = cryptotest_shake256x4();     // Test 4-way SHAKE256
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+    Status = cryptotest_kem_batch4();     // Test batched key encapsulation mechanism
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
+#if defined(crypto_kem_enc_batch)
+    Status = cryptotest_kem_batch();      // Test batched key encapsulation mechanism with shared inversions
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+#endif
     
     if ((argc > 1) && (strcmp("nobench", argv[1]) == 0)) {}
     else {
@@ -151,6 +968,56 @@ int main(int argc, char **argv)
             printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
             return FAILED;
         }
+        Status = cryptorun_randombytes();  // Benchmark the system random number generator
+        if (Status != PASSED) {
+            printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+            return FAILED;
+        }
+        Status = cryptorun_shake256();  // Benchmark SHAKE256
+        if (Status != PASSED) {
+            printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+            return FAILED;
+        }
+#if defined(crypto_kem_enc_prepared)
+        Status = cryptorun_kem_prepared();  // Benchmark encapsulation to a prepared public key
+        if (Status != PASSED) {
+            printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+            return FAILED;
+        }
+#endif
+#if defined(crypto_kem_dec_init)
+        Status = cryptorun_kem_dec_resumable();  // Benchmark resumable decapsulation
+        if (Status != PASSED) {
+            printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+            return FAILED;
+        }
+#endif
+#if defined(crypto_kem_enc_parallel)
+        Status = cryptorun_kem_parallel();  // Benchmark two-thread encapsulation
+        if (Status != PASSED) {
+            printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+            return FAILED;
+        }
+#endif
+#if defined(crypto_kem_enc_batch4)
+        Status = cryptorun_shake256x4();  // Benchmark 4-way SHAKE256
+        if (Status != PASSED) {
+            printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+            return FAILED;
+        }
+        Status = cryptorun_kem_batch4();  // Benchmark batched key encapsulation mechanism
+        if (Status != PASSED) {
+            printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+            return FAILED;
+        }
+#endif
+#if defined(crypto_kem_enc_batch)
+        Status = cryptorun_kem_batch();   // Benchmark batched key encapsulation mechanism with shared inversions
+        if (Status != PASSED) {
+            printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+            return FAILED;
+        }
+#endif
     }
 
     return Status;
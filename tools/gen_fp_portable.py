@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+#********************************************************************************************
+# SIDH: an efficient supersingular isogeny cryptography library
+#
+# Abstract: generator of the fully unrolled field multiplication, squaring and Montgomery reduction
+#           of OPT_LEVEL=PORTABLE_FAST
+#
+# For each requested prime pXXX, reads the prime from src/PXXX/PXXX.c and the bit length from
+# src/PXXX/PXXX_internal.h, then writes src/PXXX/generic/fp_portable.c with straight-line comba
+# code built from the MUL, ADDC and SUBC macros of config.h. The multiplication uses one level of
+# Karatsuba for 8 words or more. The reduction works on blocks of as many words as the "0" words of
+# pXXX+1, and multiplies by its other words as constants.
+# Usage: python3 tools/gen_fp_portable.py [434 503 610 751]
+#********************************************************************************************
+
+import os
+import sys
+
+from gen_ladder_tables import ROOT, read, define, array, from_words, to_words
+
+KARATSUBA_MIN_WORDS = 8       # Smallest number of words for which one level of Karatsuba beats comba in mp_mul
+
+
+def column_terms(k, n, m, pairs):
+    # Index pairs (i, k-i) of column k of an n x m product, restricted by pairs(i, j)
+    return [(i, k - i) for i in range(max(0, k - m + 1), min(k, n - 1) + 1) if pairs(i, k - i)]
+
+
+def shift_columns(lines, out):
+    # Stores the low word of the column accumulator (t,u,v) and shifts it by one word
+    lines.append("    %s = v; v = u; u = t; t = 0;" % out)
+
+
+def comba(lines, x, y, nx, ny, out):
+    # Straight-line comba product out = x*y of nx and ny words, given as functions from word indices to C expressions
+    lines.append("    t = 0; u = 0; v = 0;")
+    for k in range(nx + ny - 1):
+        for i, j in column_terms(k, nx, ny, lambda i, j: True):
+            lines.append("    MULACC(%s, %s);" % (x(i), y(j)))
+        shift_columns(lines, out(k))
+    lines.append("    %s = v;" % out(nx + ny - 1))
+
+
+def add_chain(lines, dst, src, ndst, nsrc, sub=False):
+    # dst = dst + src (or dst - src), words 0,...,ndst-1, where the words of src beyond nsrc are 0
+    op, c = ("SUBC", "borrow") if sub else ("ADDC", "carry")
+    for k in range(ndst):
+        lines.append("    %s(%s, %s, %s, %s, %s);" % (op, "0" if k == 0 else c, dst(k), src(k) if k < nsrc else "0", c, dst(k)))
+
+
+def gen_mul_karatsuba(n):
+    # One level of Karatsuba: a = a1*2^(64*h) + a0 and b = b1*2^(64*h) + b0, with h = ceil(n/2) words in a0 and b0, and the
+    # middle product (a0+a1)*(b0+b1) - a0*b0 - a1*b1 computed with the carries of a0+a1 and b0+b1 applied through masks
+    h = (n + 1)//2
+    l = n - h
+    lines = ["void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)",
+             "{ // Multiprecision multiply, c = a*b, where lng(a) = lng(b) = NWORDS_FIELD.",
+             "  // One level of Karatsuba on the halves of %d and %d words, with comba products." % (h, l),
+             "    unsigned int carry, borrow, ca, cb;",
+             "    digit_t t, u, v, mask_a, mask_b, ta[%d], tb[%d], tt[%d];" % (h, h, 2*h + 1),
+             "    UNREFERENCED_PARAMETER(nwords);",
+             ""]
+    for x, tx, cx in (("a", "ta", "ca"), ("b", "tb", "cb")):
+        for k in range(h):
+            src2 = "%s[%d]" % (x, h + k) if k < l else "0"
+            lines.append("    ADDC(%s, %s[%d], %s, carry, %s[%d]);" % ("0" if k == 0 else "carry", x, k, src2, tx, k))
+        lines.append("    %s = carry;" % cx)
+    lines.append("    mask_a = 0 - (digit_t)ca;")
+    lines.append("    mask_b = 0 - (digit_t)cb;")
+    lines.append("")
+    lines.append("    // c = a1*b1*2^%d + a0*b0" % (128*h))
+    comba(lines, lambda i: "a[%d]" % i, lambda j: "b[%d]" % j, h, h, lambda k: "c[%d]" % k)
+    comba(lines, lambda i: "a[%d]" % (h + i), lambda j: "b[%d]" % (h + j), l, l, lambda k: "c[%d]" % (2*h + k))
+    lines.append("")
+    lines.append("    // tt = (a0+a1)*(b0+b1) - a0*b0 - a1*b1")
+    comba(lines, lambda i: "ta[%d]" % i, lambda j: "tb[%d]" % j, h, h, lambda k: "tt[%d]" % k)
+    lines.append("    tt[%d] = (digit_t)(ca & cb);" % (2*h))
+    add_chain(lines, lambda k: "tt[%d]" % (h + k), lambda k: "(ta[%d] & mask_b)" % k, h + 1, h)
+    add_chain(lines, lambda k: "tt[%d]" % (h + k), lambda k: "(tb[%d] & mask_a)" % k, h + 1, h)
+    add_chain(lines, lambda k: "tt[%d]" % k, lambda k: "c[%d]" % k, 2*h + 1, 2*h, sub=True)
+    add_chain(lines, lambda k: "tt[%d]" % k, lambda k: "c[%d]" % (2*h + k), 2*h + 1, 2*l, sub=True)
+    lines.append("")
+    lines.append("    // c = c + tt*2^%d" % (64*h))
+    add_chain(lines, lambda k: "c[%d]" % (h + k), lambda k: "tt[%d]" % k, 2*n - h, 2*h + 1)
+    lines.append("}")
+    return lines
+
+
+def gen_mul(n):
+    if n >= KARATSUBA_MIN_WORDS:
+        return gen_mul_karatsuba(n)
+    lines = ["void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)",
+             "{ // Multiprecision comba multiply, c = a*b, where lng(a) = lng(b) = NWORDS_FIELD.",
+             "    digit_t t, u, v;",
+             "    UNREFERENCED_PARAMETER(nwords);",
+             ""]
+    comba(lines, lambda i: "a[%d]" % i, lambda j: "b[%d]" % j, n, n, lambda k: "c[%d]" % k)
+    lines.append("}")
+    return lines
+
+
+def gen_sqr(n):
+    lines = ["void mp_sqr(const digit_t* a, digit_t* c, const unsigned int nwords)",
+             "{ // Multiprecision comba squaring, c = a^2, where lng(a) = NWORDS_FIELD.",
+             "  // The cross products a[i]*a[j], i < j, of each column are accumulated once and doubled.",
+             "    digit_t t = 0, u = 0, v = 0, st, su, sv;",
+             "    UNREFERENCED_PARAMETER(nwords);",
+             ""]
+    for k in range(2*n - 1):
+        cross = column_terms(k, n, n, lambda i, j: i < j)
+        if cross:
+            lines.append("    st = 0; su = 0; sv = 0;")
+            for i, j in cross:
+                lines.append("    MULACC_CROSS(a[%d], a[%d]);" % (i, j))
+            lines.append("    ADD_CROSS_X2();")
+        if k % 2 == 0:
+            lines.append("    MULACC(a[%d], a[%d]);" % (k//2, k//2))
+        shift_columns(lines, "c[%d]" % k)
+    lines.append("    c[%d] = v;" % (2*n - 1))
+    lines.append("}")
+    return lines
+
+
+def gen_rdc(n, pname, p1, z):
+    # Since pXXX+1 = 2^(64*z)*p', where p' = p1[z..n-1], pXXX = -1 mod 2^(64*z). For each block Q of z words of the running
+    # value r, adding Q*(pXXX+1) at the position of Q makes r + Q*pXXX = 0 mod 2^(64*z) without computing a quotient. The
+    # products of one block are independent, so only the blocks are sequential.
+    m = n - z
+    lines = ["void rdc_mont(digit_t* ma, digit_t* mc)",
+             "{ // Montgomery reduction exploiting the special form of the prime %s, mc = ma*R^-1 mod %sx2, where R = 2^%d." % (pname, pname, 64*n),
+             "  // If ma < 2^%d*%s, the output mc is in the range [0, 2*%s-1]." % (64*n, pname, pname),
+             "  // Since %s+1 = 2^%d*p', %s = -1 mod 2^%d: the reduction adds Q*p'*2^%d for each block Q of %d words of ma, from the least" % (pname, 64*z, pname, 64*z, 64*z, z),
+             "  // significant one, which leaves Q in place and clears Q*%s. The words of p' are multiplied as constants." % pname,
+             "    unsigned int i, carry;",
+             "    digit_t t, u, v, r[2*NWORDS_FIELD], s[NWORDS_FIELD];",
+             "",
+             "    for (i = 0; i < 2*NWORDS_FIELD; i++) {",
+             "        r[i] = ma[i];",
+             "    }"]
+    off = 0
+    while off < n:
+        b = min(z, n - off)
+        lines.append("")
+        comba(lines, lambda i: "r[%d]" % (off + i), lambda j: "0x%016XULL" % p1[z + j], b, m, lambda k: "s[%d]" % k)
+        add_chain(lines, lambda k: "r[%d]" % (off + z + k), lambda k: "s[%d]" % k, 2*n - off - z, b + m)
+        off += b
+    lines.append("")
+    lines.append("    for (i = 0; i < NWORDS_FIELD; i++) {")
+    lines.append("        mc[i] = r[NWORDS_FIELD+i];")
+    lines.append("    }")
+    lines.append("}")
+    return lines
+
+
+def generate(prime):
+    pdir = os.path.join(ROOT, "src", "P" + prime)
+    internal = read(os.path.join(pdir, "P%s_internal.h" % prime))
+    n = (define(internal, "NBITS_FIELD") + 63)//64
+    pname = "p" + prime
+    p = from_words(array(read(os.path.join(pdir, "P%s.c" % prime)), pname))
+    p1 = to_words(p + 1, n)
+    zero_words = define(internal, pname + "_ZERO_WORDS")        # The first definition is the one for 64-bit targets
+    assert all(w == 0 for w in p1[:zero_words])
+
+    lines = ["/********************************************************************************************",
+             "* SIDH: an efficient supersingular isogeny cryptography library",
+             "*",
+             "* Abstract: fully unrolled multiplication, squaring and Montgomery reduction for P%s" % prime,
+             "*           (OPT_LEVEL=PORTABLE_FAST), generated by tools/gen_fp_portable.py",
+             "*********************************************************************************************/",
+             "",
+             "#include \"../P%s_internal.h\"" % prime,
+             "#include \"../../internal.h\"",
+             "",
+             "",
+             "// Column accumulation (t,u,v) += a*b",
+             "#define MULACC(a, b)                                                                               \\",
+             "    { digit_t hi, lo; unsigned int cy;                                                             \\",
+             "      MUL((a), (b), &hi, lo);                                                                      \\",
+             "      ADDC(0, lo, v, cy, v);                                                                       \\",
+             "      ADDC(cy, hi, u, cy, u);                                                                      \\",
+             "      ADDC(cy, t, 0, cy, t); }",
+             "",
+             "// Cross product accumulation (st,su,sv) += a*b",
+             "#define MULACC_CROSS(a, b)                                                                         \\",
+             "    { digit_t hi, lo; unsigned int cy;                                                             \\",
+             "      MUL((a), (b), &hi, lo);                                                                      \\",
+             "      ADDC(0, lo, sv, cy, sv);                                                                     \\",
+             "      ADDC(cy, hi, su, cy, su);                                                                    \\",
+             "      ADDC(cy, st, 0, cy, st); }",
+             "",
+             "// Column accumulation (t,u,v) += 2*(st,su,sv)",
+             "#define ADD_CROSS_X2()                                                                             \\",
+             "    { unsigned int cy;                                                                             \\",
+             "      st = (st << 1) | (su >> (RADIX-1));                                                          \\",
+             "      su = (su << 1) | (sv >> (RADIX-1));                                                          \\",
+             "      sv = sv << 1;                                                                                \\",
+             "      ADDC(0, sv, v, cy, v);                                                                       \\",
+             "      ADDC(cy, su, u, cy, u);                                                                      \\",
+             "      ADDC(cy, st, t, cy, t); }",
+             "",
+             ""]
+    lines += gen_mul(n)
+    lines += ["", ""]
+    lines += gen_sqr(n)
+    lines += ["", ""]
+    lines += gen_rdc(n, pname, p1, zero_words)
+
+    path = os.path.join(pdir, "generic", "fp_portable.c")
+    with open(path, "w", newline="") as f:
+        f.write("\r\n".join(lines) + "\r\n")
+
+
+if __name__ == "__main__":
+    for prime in (sys.argv[1:] or ["434", "503", "610", "751"]):
+        generate(prime)
@@ -0,0 +1,948 @@
+#!/usr/bin/env python3
+#********************************************************************************************
+# SIDH: an efficient supersingular isogeny cryptography library
+#
+# Abstract: generator of the x64 assembly field arithmetic
+#
+# For each requested prime pXXX, reads the prime from src/PXXX/PXXX.c and the field size and the number of "0" words
+# of pXXX+1 from src/PXXX/PXXX_internal.h, then writes src/PXXX/AMD64/fp_x64_asm.S with the kernels called from
+# src/PXXX/AMD64/fp_x64.c: fpadd, fpsub, mp_sub_p2, mp_sub_p4, mp_add, mp_subaddx2 and mp_dblsubx2, and the MULX/ADX
+# and MULX versions of mul (one level of Karatsuba on schoolbook halves), sqr and rdc (Montgomery reduction that only
+# multiplies by the nonzero words of pXXX+1). The primes in PLAIN_KERNELS also get versions of mul and rdc for
+# processors without MULX, built with comba products.
+# The kernels only depend on the prime through pXXX and its "0" words, so a new prime of the form 2^eA*3^eB-1 only needs
+# PXXX.c and PXXX_internal.h. Usage: python3 tools/gen_fp_x64_asm.py [434 503 610 751]
+#********************************************************************************************
+
+import os
+import re
+import sys
+
+from gen_ladder_tables import ROOT, read, define, array
+
+PLAIN_KERNELS = ("503", "751")   # Primes whose fp_x64.c uses mul and rdc without MULX (p434 and p610 use the comba C code)
+MASK64 = 0xFFFFFFFFFFFFFFFF
+
+POOL = ["r8", "r9", "r10", "r11", "rcx", "r12", "r13", "r14", "r15", "rbx", "rbp"]   # Caller-saved registers first
+SAVED = ["r12", "r13", "r14", "r15", "rbx", "rbp"]
+KARATSUBA_POOL = ["r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "rbp", "rdx"]
+SCHOOL_POOL = ["r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "rbx", "rbp", "rax"]
+
+
+def ins(lines, op, *args):
+    lines.append(("  %-7s%s" % (op, ", ".join(args))).rstrip())
+
+
+def mem(base, i):
+    # Word i of the operand at base, where base is a register or a stack offset "rsp+d"
+    reg, _, off = base.partition("+")
+    off = int(off or 0) + 8*i
+    return "[%s+%d]" % (reg, off) if off else "[%s]" % reg
+
+
+def const(name, i):
+    return "[rip+fmt(%s)+%d]" % (name, 8*i) if i else "[rip+fmt(%s)]" % name
+
+
+def macro_mem(param, i):
+    # Word i of the memory operand passed to a macro as \param
+    return "%d\\%s" % (8*i, param) if i else "\\" + param
+
+
+def const_operand(name, words, i):
+    # Word i of a constant as a sign-extended 32-bit immediate if possible, otherwise as a memory operand
+    w = words[i]
+    if w < 2**31 or w >= 2**64 - 2**31:
+        return str(w - 2**64 if w >= 2**63 else w)
+    return const(name, i)
+
+
+def chain_op(i, sub=False):
+    return ("sub" if sub else "add") if i == 0 else ("sbb" if sub else "adc")
+
+
+def saved(body):
+    # Callee-saved registers written by the instructions in body
+    text = "\n".join(body)
+    return [r for r in SAVED if re.search(r"\b%s\b" % r, text)]
+
+
+def pushes(lines, used):
+    for r in SAVED:
+        if r in used:
+            ins(lines, "push", r)
+
+
+def pops(lines, used):
+    for r in reversed(SAVED):
+        if r in used:
+            ins(lines, "pop", r)
+
+
+def save_around(body):
+    # Returns body with each callee-saved register pushed just before its first use and popped as soon as it is no
+    # longer used, in reverse order, so that the pushes and pops overlap with the arithmetic. body must not use rsp
+    refs = lambda r: [k for k, line in enumerate(body) if re.search(r"\b%s\b" % r, line)]
+    order = sorted(saved(body), key=lambda r: refs(r)[0])
+    first = {}
+    for r in order:
+        first.setdefault(refs(r)[0], []).append(r)
+    last, at = {}, 0
+    for r in reversed(order):
+        at = max(at, refs(r)[-1])
+        last.setdefault(at, []).append(r)
+    out = []
+    for k, line in enumerate(body):
+        for r in first.get(k, []):
+            ins(out, "push", r)
+        out.append(line)
+        for r in last.get(k, []):
+            ins(out, "pop", r)
+    return out
+
+
+def header(lines, title, operation, notes=()):
+    lines.append("//***********************************************************************")
+    lines.append("//  " + title)
+    lines.append("//  Operation: " + operation)
+    for note in notes:
+        lines.append("//  NOTE: " + note)
+    lines.append("//*********************************************************************** ")
+
+
+def function(lines, name):
+    lines.append(".global kfmt(%s)" % name)
+    lines.append("kfmt(%s):" % name)
+
+
+def masked_correction(lines, cname, cwords, V, n, off, first_reg_store):
+    # Adds (cwords & rax) to the n-word value at [reg_p3+8*off], whose words 0,...,len(V)-1 are in the registers V,
+    # and stores the result. rdi and rsi are free. Words equal to 0xFF...F use the mask itself, and the other distinct
+    # words are masked once into free registers; the upper value registers are stored to memory to make room for them
+    distinct = []
+    for w in cwords[:n]:
+        if w not in (0, MASK64) and w not in distinct:
+            distinct.append(w)
+    k = len(V)
+    while True:
+        free = sorted([r for r in POOL if r not in V[:k]] + ["rdi", "rsi"], key=lambda r: r in SAVED)
+        need = len(distinct) + (1 if k < n else 0)
+        if len(free) >= need:
+            break
+        k -= 1
+    for i in range(k, len(V)):
+        ins(lines, "mov", mem("reg_p3", off + i), V[i])
+    masked = dict(zip(distinct, free))
+    tmp = free[len(distinct)] if k < n else None
+    for w in distinct:
+        ins(lines, "mov", masked[w], const_operand(cname, cwords, cwords.index(w)))
+        ins(lines, "and", masked[w], "rax")
+    lines.append("")
+    for i in range(n):
+        w = cwords[i]
+        src = "rax" if w == MASK64 else ("0" if w == 0 else masked[w])
+        if i < k:
+            ins(lines, chain_op(i), V[i], src)
+        else:
+            ins(lines, "mov", tmp, mem("reg_p3", off + i))
+            ins(lines, chain_op(i), tmp, src)
+            ins(lines, "mov", mem("reg_p3", off + i), tmp)
+    for i in range(k):
+        ins(lines, "mov", mem("reg_p3", off + i), V[i])
+    return set(V[:len(V)]) | set(masked.values()) | ({tmp} if tmp else set())
+
+
+def gen_fpadd(lines, prime, n, x2):
+    name = "p%sx2" % prime
+    header(lines, "Field addition", "c [reg_p3] = a [reg_p1] + b [reg_p2]")
+    function(lines, "fpadd%s_asm" % prime)
+    V = POOL[:min(n, len(POOL))]
+    body = []
+    for i in range(len(V)):
+        ins(body, "mov", V[i], mem("reg_p1", i))
+    for i in range(n):
+        if i < len(V):
+            ins(body, chain_op(i), V[i], mem("reg_p2", i))
+        else:
+            ins(body, "mov", "rax", mem("reg_p1", i))
+            ins(body, "adc", "rax", mem("reg_p2", i))
+            ins(body, "mov", mem("reg_p3", i), "rax")
+    body.append("")
+    for i in range(n):
+        if i < len(V):
+            ins(body, chain_op(i, True), V[i], const_operand(name, x2, i))
+        else:
+            ins(body, "mov", "rax", mem("reg_p3", i))
+            ins(body, "sbb", "rax", const_operand(name, x2, i))
+            ins(body, "mov", mem("reg_p3", i), "rax")
+    ins(body, "mov", "rax", "0")
+    ins(body, "sbb", "rax", "0")
+    body.append("")
+    masked_correction(body, name, x2, V, n, 0, True)
+    used = saved(body)
+    pushes(lines, used)
+    lines.append("")
+    lines += body
+    lines.append("")
+    pops(lines, used)
+    ins(lines, "ret")
+    lines += ["", ""]
+
+
+def gen_fpsub(lines, prime, n, x2):
+    name = "p%sx2" % prime
+    header(lines, "Field subtraction", "c [reg_p3] = a [reg_p1] - b [reg_p2]")
+    function(lines, "fpsub%s_asm" % prime)
+    V = POOL[:min(n, len(POOL))]
+    body = []
+    for i in range(len(V)):
+        ins(body, "mov", V[i], mem("reg_p1", i))
+    for i in range(n):
+        if i < len(V):
+            ins(body, chain_op(i, True), V[i], mem("reg_p2", i))
+        else:
+            ins(body, "mov", "rax", mem("reg_p1", i))
+            ins(body, "sbb", "rax", mem("reg_p2", i))
+            ins(body, "mov", mem("reg_p3", i), "rax")
+    ins(body, "mov", "rax", "0")
+    ins(body, "sbb", "rax", "0")
+    body.append("")
+    masked_correction(body, name, x2, V, n, 0, True)
+    used = saved(body)
+    pushes(lines, used)
+    lines.append("")
+    lines += body
+    lines.append("")
+    pops(lines, used)
+    ins(lines, "ret")
+    lines += ["", ""]
+
+
+def gen_sub_px(lines, prime, n, multiples):
+    # The multiples 2*p and 4*p are added with immediates where the words sign-extend, and otherwise through rdi and rsi,
+    # which are free once the subtraction is done
+    V = (POOL[:5] + ["rax"] + POOL[5:])[:n]
+    for k in (2, 4):
+        name = "p%sx%d" % (prime, k)
+        words = multiples[k]
+        lines.append("//***********************************************************************")
+        lines.append("//  Multiprecision subtraction with correction with %d*p%s" % (k, prime))
+        lines.append("//  Operation: c [reg_p3] = a [reg_p1] - b [reg_p2] + %d*p%s" % (k, prime))
+        lines.append("//*********************************************************************** ")
+        function(lines, "mp_sub%s_p%d_asm" % (prime, k))
+        pushes(lines, V)
+        lines.append("")
+        for i in range(n):
+            ins(lines, "mov", V[i], mem("reg_p1", i))
+        for i in range(n):
+            ins(lines, chain_op(i, True), V[i], mem("reg_p2", i))
+        lines.append("")
+        held = {}
+        for i in range(n):
+            src = const_operand(name, words, i)
+            if src.startswith("["):
+                if words[i] not in held:
+                    reg = ("rdi", "rsi")[i % 2]
+                    held = {w: r for w, r in held.items() if r != reg}
+                    ins(lines, "mov", reg, src)
+                    held[words[i]] = reg
+                src = held[words[i]]
+            ins(lines, chain_op(i), V[i], src)
+        for i in range(n):
+            ins(lines, "mov", mem("reg_p3", i), V[i])
+        lines.append("")
+        pops(lines, V)
+        ins(lines, "ret")
+        lines += ["", ""]
+
+
+def gen_mp_add(lines, prime, n):
+    header(lines, "%s-bit multiprecision addition" % prime, "c [reg_p3] = a [reg_p1] + b [reg_p2]")
+    function(lines, "mp_add%s_asm" % prime)
+    R = ["r8", "r9", "r10", "r11"]
+    for s in range(0, n, 4):
+        words = range(s, min(s + 4, n))
+        for i in words:
+            ins(lines, "mov", R[i - s], mem("reg_p1", i))
+        for i in words:
+            ins(lines, chain_op(i), R[i - s], mem("reg_p2", i))
+        for i in words:
+            ins(lines, "mov", mem("reg_p3", i), R[i - s])
+        if s + 4 < n:
+            lines.append("")
+    ins(lines, "ret")
+    lines += ["", ""]
+
+
+def gen_subaddx2(lines, prime, n, p):
+    lines.append("//***************************************************************************")
+    lines.append("//  2x%s-bit multiprecision subtraction/addition" % prime)
+    lines.append("//  Operation: c [reg_p3] = a [reg_p1] - b [reg_p2]. If c < 0, add p%s*2^%d" % (prime, 64*n))
+    lines.append("//*************************************************************************** ")
+    function(lines, "mp_subadd%sx2_asm" % prime)
+    R = ["r8", "r9", "r10", "r11"]
+    V = POOL[:min(n, len(POOL))]
+    body = []
+    for s in range(0, n, 4):
+        words = range(s, min(s + 4, n))
+        for i in words:
+            ins(body, "mov", R[i - s], mem("reg_p1", i))
+        for i in words:
+            ins(body, chain_op(i, True), R[i - s], mem("reg_p2", i))
+        for i in words:
+            ins(body, "mov", mem("reg_p3", i), R[i - s])
+    body.append("")
+    for i in range(len(V)):
+        ins(body, "mov", V[i], mem("reg_p1", n + i))
+    for i in range(n):
+        if i < len(V):
+            ins(body, "sbb", V[i], mem("reg_p2", n + i))
+        else:
+            ins(body, "mov", "rax", mem("reg_p1", n + i))
+            ins(body, "sbb", "rax", mem("reg_p2", n + i))
+            ins(body, "mov", mem("reg_p3", n + i), "rax")
+    ins(body, "mov", "rax", "0")
+    ins(body, "sbb", "rax", "0")
+    body.append("")
+    body.append("    // Add p%s anded with the mask in rax" % prime)
+    masked_correction(body, "p" + prime, p, V, n, n, True)
+    used = saved(body)
+    pushes(lines, used)
+    lines.append("")
+    lines += body
+    lines.append("")
+    pops(lines, used)
+    ins(lines, "ret")
+    lines += ["", ""]
+
+
+def gen_dblsubx2(lines, prime, n):
+    header(lines, "Double 2x%s-bit multiprecision subtraction" % prime, "c [reg_p3] = c [reg_p3] - a [reg_p1] - b [reg_p2]")
+    function(lines, "mp_dblsub%sx2_asm" % prime)
+    regs = ["r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "rbx", "rbp"]
+    chunks = -(-2*n // len(regs))
+    size = -(-2*n // chunks)
+    R = regs[:size]
+    pushes(lines, R)
+    lines.append("")
+    for s in range(0, 2*n, size):
+        words = range(s, min(s + size, 2*n))
+        last = (s + size >= 2*n)
+        for i in words:
+            ins(lines, "mov", R[i - s], mem("reg_p3", i))
+        if s:
+            ins(lines, "bt", "rax", "0")
+        for i in words:
+            ins(lines, chain_op(i, True), R[i - s], mem("reg_p1", i))
+        if not last:
+            ins(lines, "setc", "al")
+        if s:
+            ins(lines, "bt", "rcx", "0")
+        for i in words:
+            ins(lines, chain_op(i, True), R[i - s], mem("reg_p2", i))
+        if not last:
+            ins(lines, "setc", "cl")
+        for i in words:
+            ins(lines, "mov", mem("reg_p3", i), R[i - s])
+        lines.append("")
+    pops(lines, R)
+    ins(lines, "ret")
+    lines += ["", ""]
+
+
+def school_spills(m):
+    # Stack words used by the MULX (without ADX) rows of an m x m product: the m-1 high halves of a row that do not fit in
+    # the registers left after the accumulator, the top word and the low half (the lowest accumulator word is freed early)
+    return max(0, (m - 1) - (len(SCHOOL_POOL) - m - 2 + 1))
+
+
+def school_macro(lines, variant, m):
+    # m x m schoolbook product C = M0*M1 with MULX and ADX (two carry chains), with MULX only (the high halves of each
+    # row are added in a second pass), or with MUL (comba)
+    # Every variant takes the stack space S when the MULX variant needs it, so that the callers do not depend on the variant
+    name = "MUL%d_SCHOOL" % (64*m)
+    spills = school_spills(m)
+    lines.append("///////////////////////////////////////////////////////////////// MACRO")
+    lines.append("// Schoolbook integer multiplication")
+    lines.append("// Inputs:  memory pointers M0 and M1")
+    lines.append("// Outputs: memory pointer C")
+    if spills and variant == "mulx":
+        lines.append("// Temps:   stack space S for %d 64-bit value%s, regs rax, rdx, r8:r15, rbx and rbp" % (spills, "s" if spills > 1 else ""))
+    else:
+        lines.append("// Temps:   regs rax, rdx, r8:r15, rbx and rbp")
+    lines.append("/////////////////////////////////////////////////////////////////")
+    lines.append(".macro %s M0, M1, C%s" % (name, ", S" if spills else ""))
+    M0 = lambda i: macro_mem("M0", i)
+    M1 = lambda i: macro_mem("M1", i)
+    C = lambda i: macro_mem("C", i)
+
+    if variant == "plain":
+        acc = ["r8", "r9", "r10"]
+        for k in range(2*m - 1):
+            v, u, t = acc
+            if k:
+                ins(lines, "xor", t, t)
+            for i in range(max(0, k - m + 1), min(k, m - 1) + 1):
+                ins(lines, "mov", "rax", M0(i))
+                ins(lines, "mul", "qword ptr " + M1(k - i))
+                if k == 0:
+                    ins(lines, "mov", v, "rax")
+                    ins(lines, "mov", u, "rdx")
+                    ins(lines, "xor", t, t)
+                    continue
+                ins(lines, "add", v, "rax")
+                ins(lines, "adc", u, "rdx")
+                ins(lines, "adc", t, "0")
+            ins(lines, "mov", C(k), v)
+            acc = [u, t, v]
+        ins(lines, "mov", C(2*m - 1), acc[0])
+        lines.append(".endm")
+        lines.append("")
+        return
+
+    pool = list(SCHOOL_POOL[:-1]) if variant == "adx" else list(SCHOOL_POOL)
+    # Row 0: acc <- words 1,...,m of M0[0]*M1
+    acc = [pool.pop(0) for _ in range(m)]
+    lo = pool.pop(0)
+    ins(lines, "mov", "rdx", M0(0))
+    ins(lines, "mulx", acc[0], lo, M1(0))
+    ins(lines, "mov", C(0), lo)
+    for j in range(1, m):
+        ins(lines, "mulx", acc[j], lo, M1(j))
+        ins(lines, chain_op(j - 1), acc[j - 1], lo)
+    ins(lines, "adc", acc[m - 1], "0")
+
+    # Row i: acc (words i,...,i+m-1) += M0[i]*M1, and word i is final
+    for i in range(1, m):
+        lines.append("")
+        top = pool.pop(0)
+        ins(lines, "mov", "rdx", M0(i))
+        if variant == "adx":
+            # The product j+1 is issued before the additions of the product j when there are registers for two of them
+            pairs = [(pool.pop(0), lo)]
+            if len(pool) >= 2:
+                pairs.append((pool.pop(0), pool.pop(0)))
+            ins(lines, "xor", "rax", "rax")
+            prods = [pairs[j % len(pairs)] for j in range(m - 1)] + [(top, pairs[(m - 1) % len(pairs)][1])]
+            ins(lines, "mulx", prods[0][0], prods[0][1], M1(0))
+            for j in range(m):
+                if len(pairs) > 1 and j + 1 < m:
+                    ins(lines, "mulx", prods[j + 1][0], prods[j + 1][1], M1(j + 1))
+                ins(lines, "adcx", acc[j], prods[j][1])
+                if j < m - 1:
+                    ins(lines, "adox", acc[j + 1], prods[j][0])
+                if len(pairs) == 1 and j + 1 < m:
+                    ins(lines, "mulx", prods[j + 1][0], prods[j + 1][1], M1(j + 1))
+            ins(lines, "adcx", top, "rax")
+            ins(lines, "adox", top, "rax")
+            ins(lines, "mov", C(i), acc[0])
+            pool += [r for pair in pairs for r in pair if r != lo] + [acc[0]]
+        else:
+            # Low halves first, then the high halves, which are spilled to S when they run out of registers
+            his = []
+            spilled = 0
+            for j in range(m - 1):
+                if not pool:
+                    reg = his[spilled]
+                    assert spilled < spills
+                    ins(lines, "mov", macro_mem("S", spilled), reg)
+                    his[spilled] = macro_mem("S", spilled)
+                    spilled += 1
+                    pool.append(reg)
+                his.append(pool.pop(0))
+                ins(lines, "mulx", his[j], lo, M1(j))
+                ins(lines, chain_op(j), acc[j], lo)
+                if j == 0:
+                    ins(lines, "mov", C(i), acc[0])
+                    pool.append(acc[0])
+            ins(lines, "mulx", top, lo, M1(m - 1))
+            ins(lines, "adc", acc[m - 1], lo)
+            ins(lines, "adc", top, "0")
+            for j in range(m - 1):
+                ins(lines, chain_op(j), acc[j + 1], his[j])
+            ins(lines, "adc", top, "0")
+            pool += [h for h in his if "\\" not in h]
+        acc = acc[1:] + [top]
+    lines.append("")
+    for j in range(m):
+        ins(lines, "mov", C(m + j), acc[j])
+    lines.append(".endm")
+    lines.append("")
+
+def gen_mul(lines, prime, n, plain):
+    # One level of Karatsuba: a = AH*2^(64*l) + AL and b = BH*2^(64*l) + BL, with l = ceil(n/2) words in AL and BL.
+    # The carries of AH+AL and BH+BL are applied to (AH+AL)*(BH+BL) through masks, and the middle product is computed
+    # modulo 2^(128*l), where AL*BH + AH*BL fits since the inputs are below 4*p
+    l = (n + 1)//2
+    h = n - l
+    sizes = sorted({l, h})
+    spills = max(school_spills(m) for m in sizes)
+    TA, TB, MS, T, HH, S = ("rsp+%d" % (8*w) if w else "rsp" for w in (0, l, 2*l, 3*l, 5*l, 5*l + 2*h))
+    stack = 8*(5*l + 2*h + spills)
+    S_arg = lambda m: (", [%s]" % S) if school_spills(m) else ""
+
+    lines.append("#ifdef _MULX_")
+    lines.append("")
+    lines.append("#ifdef _ADX_")
+    for m in sizes:
+        school_macro(lines, "adx", m)
+    lines.append("#else")
+    lines.append("")
+    for m in sizes:
+        school_macro(lines, "mulx", m)
+    lines.append("#endif")
+    if plain:
+        lines.append("")
+        lines.append("#else")
+        lines.append("")
+        for m in sizes:
+            school_macro(lines, "plain", m)
+    lines.append("")
+    lines.append("#endif")
+    lines += ["", ""]
+    if not plain:
+        lines.append("#ifdef _MULX_")
+        lines.append("")
+    lines.append("//*****************************************************************************")
+    lines.append("//  %s-bit multiplication using Karatsuba (one level), schoolbook (one level)" % prime)
+    lines.append("//  Operation: c [reg_p3] = a [reg_p1] * b [reg_p2]")
+    lines.append("//  NOTE: a=c or b=c are not allowed")
+    lines.append("//***************************************************************************** ")
+    function(lines, "mul%s_asm" % prime)
+    pushes(lines, SAVED)
+    ins(lines, "mov", "rcx", "reg_p3")
+    ins(lines, "sub", "rsp", str(stack))
+    lines.append("")
+    lines.append("    // [rcx] <- AL x BL")
+    lines.append("    MUL%d_SCHOOL  [reg_p1], [reg_p2], [rcx]%s" % (64*l, S_arg(l)))
+    lines.append("")
+    lines.append("    // [%s] <- AH x BH" % HH)
+    lines.append("    MUL%d_SCHOOL  [reg_p1+%d], [reg_p2+%d], [%s]%s" % (64*h, 8*l, 8*l, HH, S_arg(h)))
+    lines.append("")
+
+    R = KARATSUBA_POOL[:l]
+    R2 = KARATSUBA_POOL[l:2*l] if 2*l <= len(KARATSUBA_POOL) else R
+    lines.append("    // [%s] <- AH + AL, rax <- mask" % TA)
+    ins(lines, "xor", "rax", "rax")
+    for i in range(l):
+        ins(lines, "mov", R[i], mem("reg_p1", i))
+    for i in range(l):
+        ins(lines, chain_op(i), R[i], mem("reg_p1", l + i) if i < h else "0")
+    ins(lines, "sbb", "rax", "0")
+    for i in range(l):
+        ins(lines, "mov", mem(TA, i), R[i])
+    lines.append("")
+    lines.append("    // [%s] <- BH + BL, rbx <- mask" % TB)
+    ins(lines, "xor", "rbx", "rbx")
+    for i in range(l):
+        ins(lines, "mov", R2[i], mem("reg_p2", i))
+    for i in range(l):
+        ins(lines, chain_op(i), R2[i], mem("reg_p2", l + i) if i < h else "0")
+    ins(lines, "sbb", "rbx", "0")
+    for i in range(l):
+        ins(lines, "mov", mem(TB, i), R2[i])
+    lines.append("")
+    lines.append("    // [%s] <- masked (BH + BL) + masked (AH + AL)" % MS)
+    if R2 is not R:
+        for i in range(l):
+            ins(lines, "and", R2[i], "rax")
+        for i in range(l):
+            ins(lines, "and", R[i], "rbx")
+        for i in range(l):
+            ins(lines, chain_op(i), R[i], R2[i])
+    else:
+        for i in range(l):
+            ins(lines, "and", R[i], "rax")
+            ins(lines, "mov", mem(MS, i), R[i])
+        for i in range(l):
+            ins(lines, "mov", R[i], mem(TA, i))
+            ins(lines, "and", R[i], "rbx")
+        for i in range(l):
+            ins(lines, chain_op(i), R[i], mem(MS, i))
+    for i in range(l):
+        ins(lines, "mov", mem(MS, i), R[i])
+    lines.append("")
+    lines.append("    // [%s] <- (AH+AL) x (BH+BL), low part" % T)
+    lines.append("    MUL%d_SCHOOL  [%s], [%s], [%s]%s" % (64*l, TA, TB, T, S_arg(l)))
+    lines.append("")
+
+    M = ["r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "rbx", "rbp", "rax", "rdx", "rdi", "rsi"][:2*l]
+    lines.append("    // (AH+AL) x (BH+BL) + masked sums - ALxBL - AHxBH, modulo 2^%d" % (128*l))
+    for i in range(2*l):
+        ins(lines, "mov", M[i], mem(T, i))
+    for i in range(l):
+        ins(lines, chain_op(i), M[l + i], mem(MS, i))
+    for i in range(2*l):
+        ins(lines, chain_op(i, True), M[i], mem("rcx", i))
+    for i in range(2*l):
+        ins(lines, chain_op(i, True), M[i], mem(HH, i) if i < 2*h else "0")
+    lines.append("")
+    lines.append("    // [rcx+%d] <- middle product + ALxBL high part, AHxBH" % (8*l))
+    for i in range(2*l):
+        ins(lines, chain_op(i), M[i], mem("rcx", l + i) if i < l else mem(HH, i - l))
+        ins(lines, "mov", mem("rcx", l + i), M[i])
+    top = range(3*l, 2*n)
+    for k in top:
+        ins(lines, "mov", M[k - 3*l], mem(HH, k - 2*l))
+    for k in top:
+        ins(lines, "adc", M[k - 3*l], "0")
+    for k in top:
+        ins(lines, "mov", mem("rcx", k), M[k - 3*l])
+    lines.append("")
+    ins(lines, "add", "rsp", str(stack))
+    pops(lines, SAVED)
+    ins(lines, "ret")
+    lines.append("")
+    if not plain:
+        lines.append("#elif !defined(_ASM_SUFFIX_)")
+        lines.append("")
+        lines.append("# error \"CONFIGURATION NOT SUPPORTED. TRY USE_MULX=TRUE\"")
+        lines.append("")
+        lines.append("#endif")
+        lines += ["", ""]
+
+
+def gen_sqr(lines, prime, n):
+    # Cross products a[i]*a[j], i < j, accumulated row by row in c, then doubled, and the squares a[i]^2 added
+    lines.append("#ifdef _MULX_")
+    lines.append("")
+    lines.append("//*****************************************************************************")
+    lines.append("//  %s-bit integer squaring using schoolbook, computing each cross product once" % prime)
+    lines.append("//  Operation: c [reg_p2] = a [reg_p1]^2")
+    lines.append("//  NOTE: a=c is not allowed")
+    lines.append("//***************************************************************************** ")
+    function(lines, "sqr%s_asm" % prime)
+    a = lambda i: mem("reg_p1", i)
+    c = lambda i: mem("reg_p2", i)
+    for adx in (True, False):
+        lines.append("#ifdef _ADX_" if adx else "#else")
+        ins(lines, "xor", "rax", "rax") if adx else None
+        lines.append("    // Cross products a0*a[1..%d]" % (n - 1))
+        ins(lines, "mov", "rdx", a(0))
+        ins(lines, "mulx", "r9", "r8", a(1))
+        ins(lines, "mov", c(1), "r8")
+        prev, cur = "r9", "r10"
+        for j in range(2, n):
+            ins(lines, "mulx", cur, "r8", a(j))
+            ins(lines, ("adcx" if adx else chain_op(j - 2)), "r8", prev)
+            ins(lines, "mov", c(j), "r8")
+            prev, cur = cur, prev
+        ins(lines, "adcx" if adx else "adc", prev, "rax" if adx else "0")
+        ins(lines, "mov", c(n), prev)
+        for i in range(1, n - 1):
+            lines.append("")
+            if i < n - 2:
+                lines.append("    // Cross products a%d*a[%d..%d]" % (i, i + 1, n - 1))
+            else:
+                lines.append("    // Cross product a%d*a%d" % (i, i + 1))
+            if adx:
+                ins(lines, "xor", "rax", "rax")
+            ins(lines, "mov", "rdx", a(i))
+            prev, cur = "r9", "r10"
+            for j in range(i + 1, n):
+                if adx:
+                    ins(lines, "mulx", prev if j == i + 1 else cur, "r8", a(j))
+                    if j > i + 1:
+                        ins(lines, "adcx", "r8", prev)
+                        prev, cur = cur, prev
+                    ins(lines, "adox", "r8", c(i + j))
+                    ins(lines, "mov", c(i + j), "r8")
+                elif j == i + 1:
+                    ins(lines, "mulx", prev, "r8", a(j))
+                    ins(lines, "add", c(i + j), "r8")
+                    ins(lines, "adc", prev, "0")
+                else:
+                    ins(lines, "mulx", cur, "r8", a(j))
+                    ins(lines, "add", "r8", prev)
+                    ins(lines, "adc", cur, "0")
+                    ins(lines, "add", c(i + j), "r8")
+                    ins(lines, "adc", cur, "0")
+                    prev, cur = cur, prev
+            if adx:
+                ins(lines, "adcx", prev, "rax")
+                ins(lines, "adox", prev, "rax")
+            ins(lines, "mov", c(i + n), prev)
+        lines.append("")
+        if adx:
+            lines.append("    // Double the cross products and add the squares a[i]^2")
+            ins(lines, "xor", "rax", "rax")
+            ins(lines, "mov", "rdx", a(0))
+            ins(lines, "mulx", "r9", "r8", "rdx")
+            ins(lines, "mov", c(0), "r8")
+            ins(lines, "mov", "r8", c(1))
+            ins(lines, "adcx", "r8", "r8")
+            ins(lines, "adox", "r8", "r9")
+            ins(lines, "mov", c(1), "r8")
+            for i in range(1, n):
+                ins(lines, "mov", "rdx", a(i))
+                ins(lines, "mulx", "r9", "r10", "rdx")
+                ins(lines, "mov", "r8", c(2*i))
+                ins(lines, "adcx", "r8", "r8")
+                ins(lines, "adox", "r8", "r10")
+                ins(lines, "mov", c(2*i), "r8")
+                ins(lines, "mov", "r8", c(2*i + 1) if i < n - 1 else "rax")
+                ins(lines, "adcx", "r8", "r8")
+                ins(lines, "adox", "r8", "r9")
+                ins(lines, "mov", c(2*i + 1), "r8")
+        else:
+            lines.append("    // Double the cross products")
+            for k in range(1, 2*n - 1):
+                ins(lines, "mov", "r8", c(k))
+                ins(lines, "add" if k == 1 else "adc", "r8", "r8")
+                ins(lines, "mov", c(k), "r8")
+            ins(lines, "mov", "r8d", "0")
+            ins(lines, "adc", "r8", "0")
+            ins(lines, "mov", c(2*n - 1), "r8")
+            lines.append("")
+            lines.append("    // Add the squares a[i]^2")
+            ins(lines, "mov", "rdx", a(0))
+            ins(lines, "mulx", "r9", "r8", "rdx")
+            ins(lines, "mov", c(0), "r8")
+            ins(lines, "add", c(1), "r9")
+            for i in range(1, n):
+                ins(lines, "mov", "rdx", a(i))
+                ins(lines, "mulx", "r9", "r8", "rdx")
+                ins(lines, "adc", c(2*i), "r8")
+                ins(lines, "adc", c(2*i + 1), "r9")
+    lines.append("#endif")
+    ins(lines, "ret")
+    lines.append("")
+    lines.append("#endif")
+    lines += ["", ""]
+
+
+def rdc_rows(prime, n, z, adx, kept):
+    # Rows of the MULX reduction (see gen_rdc). Returns the instructions, the number of stack words and the words
+    # q[i] that were read from registers. With kept = None, every q[i] is also stored to c
+    nz = n - z
+    P = lambda j: const("p%sp1" % prime, z + j)
+    ma = lambda i: mem("reg_p1", i)
+    mc = lambda i: mem("reg_p2", i)
+    lines = []
+    free = list(POOL) + ([] if adx else ["rax"])
+    holds = {}
+
+    def take():
+        reg = free.pop(0)
+        holds.pop(reg, None)
+        return reg
+
+    W = [take() for _ in range(nz)]
+    lo = take()
+    ctop = take()
+    hi = take() if adx else None
+    spills = 0 if adx else max(0, nz - len(free))
+    from_regs = set()
+    for j in range(nz):
+        ins(lines, "mov", W[j], ma(z + j))
+    for i in range(n):
+        lines.append("")
+        lines.append("    // Words %d..%d += %s[%d] x p%sp1_nz" % (i + z, i + n, "a" if i < z else "c", i, prime))
+        qreg = [r for r, k in holds.items() if k == i]
+        if qreg:
+            from_regs.add(i)
+        ins(lines, "mov", "rdx", ma(i) if i < z else (qreg[0] if qreg else mc(i)))
+        fresh = take()
+        W = W + [fresh]
+        ins(lines, "mov", fresh, ma(i + n))
+        k = i + z
+        store = not (kept is not None and k in kept)
+
+        def depart():
+            if store:
+                ins(lines, "mov", mc(k) if k < n else mc(k - n), W[0])
+            if k < n:
+                holds[W[0]] = k
+            free.append(W[0])
+
+        if adx:
+            ins(lines, "xor", "rax", "rax")
+            for j in range(nz):
+                ins(lines, "mulx", hi, lo, P(j))
+                ins(lines, "adcx", W[j], lo)
+                ins(lines, "adox", W[j + 1], hi)
+            ins(lines, "adcx", W[nz], "rax" if i == 0 else ctop)
+            if i < n - 1:
+                ins(lines, "mov", ctop, "0")
+                ins(lines, "adcx", ctop, "rax")
+                ins(lines, "adox", ctop, "rax")
+            depart()
+        else:
+            # Low halves first, then the high halves, which are spilled to the stack when they run out of registers
+            his = []
+            spilled = 0
+            for j in range(nz):
+                if not free:
+                    reg = his[spilled]
+                    assert spilled < spills
+                    ins(lines, "mov", mem("rsp", spilled), reg)
+                    his[spilled] = mem("rsp", spilled)
+                    spilled += 1
+                    free.append(reg)
+                his.append(take())
+                ins(lines, "mulx", his[j], lo, P(j))
+                ins(lines, chain_op(j), W[j], lo)
+                if j == 0:
+                    depart()
+            ins(lines, "adc", W[nz], "0" if i == 0 else ctop)
+            if i < n - 1:
+                ins(lines, "mov", ctop, "0")
+                ins(lines, "adc", ctop, "0")
+            for j in range(nz):
+                ins(lines, chain_op(j), W[j + 1], his[j])
+            if i < n - 1:
+                ins(lines, "adc", ctop, "0")
+            free += [r for r in his if not r.startswith("[")]
+        W = W[1:]
+    lines.append("")
+    for j in range(nz):
+        ins(lines, "mov", mc(z + j), W[j])
+    return lines, spills, from_regs
+
+
+def gen_rdc(lines, prime, n, z, plain):
+    # Montgomery reduction with the "0" words of p+1: mc = (ma + q*(p+1))/2^(64*n), where the words q[i] of q are the
+    # words i of ma + q*(p+1) themselves. Row i adds q[i]*(p+1) >> 64*z to the window of words i+z,...,i+n of ma, whose
+    # word i+z is then final and is either q[i+z] (kept in mc until row i+z) or a word of the result. The carry out of
+    # the window is kept in a register and added when the next word of ma enters the window
+    nz = n - z
+    P = lambda j: const("p%sp1" % prime, z + j)
+    ma = lambda i: mem("reg_p1", i)
+    mc = lambda i: mem("reg_p2", i)
+
+    lines.append("#ifdef _MULX_")
+    lines.append("")
+    lines.append("//**************************************************************************************")
+    lines.append("//  Montgomery reduction")
+    lines.append("//  Based on method described in Faz-Hernandez et al. https://eprint.iacr.org/2017/1015")
+    lines.append("//  Operation: c [reg_p2] = a [reg_p1]")
+    lines.append("//  NOTE: a=c is not allowed")
+    lines.append("//************************************************************************************** ")
+    function(lines, "rdc%s_asm" % prime)
+    for adx in (True, False):
+        lines.append("#ifdef _ADX_" if adx else "#else")
+        kept = set()
+        for final in (False, True):
+            # The words q[i], i >= z, are read from the register that computed them if it was not reused since, and
+            # the second pass only stores the other ones
+            body, spills, kept = rdc_rows(prime, n, z, adx, kept if final else None)
+        if not spills:
+            lines += save_around(body)
+            ins(lines, "ret")
+            continue
+        used = saved(body)
+        pushes(lines, used)
+        if spills:
+            ins(lines, "sub", "rsp", str(8*spills))
+        lines.append("")
+        lines += body
+        lines.append("")
+        if spills:
+            ins(lines, "add", "rsp", str(8*spills))
+        pops(lines, used)
+        ins(lines, "ret")
+    lines.append("#endif")
+    lines.append("")
+
+    if plain:
+        lines.append("#else")
+        lines.append("")
+        lines.append("//***********************************************************************")
+        lines.append("//  Montgomery reduction")
+        lines.append("//  Based on comba method")
+        lines.append("//  Operation: c [reg_p2] = a [reg_p1]")
+        lines.append("//  NOTE: a=c is not allowed")
+        lines.append("//*********************************************************************** ")
+        function(lines, "rdc%s_asm" % prime)
+        acc = ["r8", "r9", "r10"]
+        for r in acc:
+            ins(lines, "xor", r, r)
+        for k in range(z, 2*n):
+            v, u, t = acc
+            if k > z:
+                ins(lines, "xor", t, t)
+            for j in range(max(0, k - n + 1), min(n - 1, k - z) + 1):
+                ins(lines, "mov", "rax", P(k - j - z))
+                ins(lines, "mul", "qword ptr " + (ma(j) if j < z else mc(j)))
+                ins(lines, "add", v, "rax")
+                ins(lines, "adc", u, "rdx")
+                ins(lines, "adc", t, "0")
+            ins(lines, "add", v, ma(k))
+            if k < 2*n - 1:
+                ins(lines, "adc", u, "0")
+                ins(lines, "adc", t, "0")
+            ins(lines, "mov", mc(k) if k < n else mc(k - n), v)
+            acc = [u, t, v]
+        ins(lines, "ret")
+        lines.append("")
+    else:
+        lines.append("#elif !defined(_ASM_SUFFIX_)")
+        lines.append("")
+        lines.append("# error \"CONFIGURATION NOT SUPPORTED. TRY USE_MULX=TRUE\"")
+        lines.append("")
+    lines.append("#endif")
+    lines += ["", ""]
+
+
+def generate(prime):
+    pdir = os.path.join(ROOT, "src", "P" + prime)
+    internal = read(os.path.join(pdir, "P%s_internal.h" % prime))
+    n = (define(internal, "NBITS_FIELD") + 63)//64
+    z = define(internal, "p%s_ZERO_WORDS" % prime)
+    unit = read(os.path.join(pdir, "P%s.c" % prime))
+    p = array(unit, "p" + prime)
+    x2 = array(unit, "p%sx2" % prime)
+    plain = prime in PLAIN_KERNELS
+
+    lines = ["//*******************************************************************************************",
+             "// SIDH: an efficient supersingular isogeny cryptography library",
+             "//",
+             "// Abstract: field arithmetic in x64 assembly for P%s on Linux, generated by tools/gen_fp_x64_asm.py" % prime,
+             "//*******************************************************************************************  ",
+             "",
+             ".intel_syntax noprefix ",
+             "",
+             "// Format function and variable names for Mac OS X",
+             "#if defined(__APPLE__)",
+             "    #define fmt(f)    _##f",
+             "#else",
+             "    #define fmt(f)    f",
+             "#endif",
+             "",
+             "// Kernel names carry a variant suffix when the library selects between kernel variants at run time",
+             "#if defined(_ASM_SUFFIX_)",
+             "    #define kfmt_cat(f, s)    fmt(f##s)",
+             "    #define kfmt_sfx(f, s)    kfmt_cat(f, s)",
+             "    #define kfmt(f)           kfmt_sfx(f, _ASM_SUFFIX_)",
+             "#else",
+             "    #define kfmt(f)           fmt(f)",
+             "#endif",
+             "",
+             "// Registers that are used for parameter passing:",
+             "#define reg_p1  rdi",
+             "#define reg_p2  rsi",
+             "#define reg_p3  rdx",
+             "",
+             "",
+             ".text"]
+    gen_fpadd(lines, prime, n, x2)
+    gen_fpsub(lines, prime, n, x2)
+    gen_sub_px(lines, prime, n, {2: x2, 4: array(unit, "p%sx4" % prime)})
+    gen_mul(lines, prime, n, plain)
+    gen_sqr(lines, prime, n)
+    gen_rdc(lines, prime, n, z, plain)
+    gen_mp_add(lines, prime, n)
+    gen_subaddx2(lines, prime, n, p)
+    gen_dblsubx2(lines, prime, n)
+    lines += ["#if defined(__linux__) && defined(__ELF__)",
+              ".section .note.GNU-stack,\"\",@progbits",
+              "#endif"]
+
+    return os.path.join(pdir, "AMD64", "fp_x64_asm.S"), "\r\n".join(lines) + "\r\n"
+
+
+if __name__ == "__main__":
+    for prime in (sys.argv[1:] or ["434", "503", "610", "751"]):
+        path, text = generate(prime)
+        with open(path, "w", newline="") as f:
+            f.write(text)
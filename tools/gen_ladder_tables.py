@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+#********************************************************************************************
+# SIDH: an efficient supersingular isogeny cryptography library
+#
+# Abstract: generator of the precomputed tables of the fixed-basis three-point ladder
+#
+# For each requested prime pXXX, reads the prime and the public generators from src/PXXX/PXXX.c and
+# src/PXXX/PXXX_compressed.c, and the bit lengths from src/PXXX/PXXX_internal.h, then writes
+# src/PXXX/PXXX_ladder_tables.c (Alice's and Bob's tables) and src/PXXX/PXXX_compressed_ladder_tables.c
+# (Alice's table). Usage: python3 tools/gen_ladder_tables.py [434 503 610 751]
+#********************************************************************************************
+
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+CURVE_A = 6                  # Starting curve E: y^2 = x^3 + 6x^2 + x
+
+
+def read(path):
+    with open(path, newline="") as f:
+        return f.read()
+
+
+def define(text, name):
+    return int(re.search(r"#define\s+" + name + r"\s+(\d+)", text).group(1))
+
+
+def array(text, name):
+    # Returns the 64-bit words of "const uint64_t name[...] = { ... };"
+    body = re.search(r"const uint64_t " + name + r"\[[^\]]*\]\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    body = re.sub(r"//[^\n]*", "", body)
+    return [int(w, 16) for w in re.findall(r"0x[0-9A-Fa-f]+", body)]
+
+
+def from_words(words):
+    return sum(w << (64*i) for i, w in enumerate(words))
+
+
+def to_words(a, nwords):
+    return [(a >> (64*i)) & 0xFFFFFFFFFFFFFFFF for i in range(nwords)]
+
+
+class Fp2:
+    # Arithmetic in GF(p^2) = GF(p)(i), i^2 = -1, on pairs (a0, a1) = a0 + a1*i
+
+    def __init__(self, p):
+        self.p = p
+
+    def mul(self, a, b):
+        p = self.p
+        return ((a[0]*b[0] - a[1]*b[1]) % p, (a[0]*b[1] + a[1]*b[0]) % p)
+
+    def add(self, a, b):
+        return ((a[0] + b[0]) % self.p, (a[1] + b[1]) % self.p)
+
+    def scale(self, a, k):
+        return ((a[0]*k) % self.p, (a[1]*k) % self.p)
+
+    def inv(self, a):
+        p = self.p
+        n = pow(a[0]*a[0] + a[1]*a[1], p - 2, p)
+        return ((a[0]*n) % p, (-a[1]*n) % p)
+
+
+def doublings(F, x, count):
+    # Affine x-coordinates x([2^i]Q), i = 0,...,count-1, starting from x = x(Q) on E.
+    # x([2]Q) = (x^2-1)^2/(4x(x^2+Ax+1)), and x = 0 is the point (0,0) of order 2, which is the last one of the 2-power tables
+    one = (1, 0)
+    table = []
+    for _ in range(count):
+        table.append(x)
+        if x == (0, 0):
+            continue
+        xx = F.mul(x, x)
+        num = F.add(xx, F.scale(one, -1))
+        num = F.mul(num, num)
+        den = F.scale(F.mul(x, F.add(F.add(xx, F.scale(x, CURVE_A)), one)), 4)
+        x = F.mul(num, F.inv(den))
+    return table
+
+
+def table_text(F, name, size, who, pname, table, R, nwords):
+    entry_bytes = 2*8*nwords
+    lines = []
+    lines.append("// %s table {x([2^i]Q%s)}, i = 0,...,%d, of affine x-coordinates in GF(%s^2) on the starting curve E: y^2 = x^3 + 6x^2 + x,"
+                 % ("Alice's" if who == "A" else "Bob's", who, len(table) - 1, pname))
+    lines.append("// expressed in Montgomery representation. Each entry is stored as {x0, x1} (%d bytes per entry, %d bytes in total)"
+                 % (entry_bytes, entry_bytes*len(table)))
+    lines.append("const uint64_t %s[%s] = {" % (name, size))
+    words = []
+    for x in table:
+        words += to_words((x[0]*R) % F.p, nwords) + to_words((x[1]*R) % F.p, nwords)
+    rows = ["0x%016X" % w for w in words]
+    for i in range(0, len(rows), 4):
+        last = (i + 4 >= len(rows))
+        lines.append(", ".join(rows[i:i+4]) + (" };" if last else ","))
+    return lines
+
+
+def generate(prime):
+    pdir = os.path.join(ROOT, "src", "P" + prime)
+    internal = read(os.path.join(pdir, "P%s_internal.h" % prime))
+    nwords = (define(internal, "NBITS_FIELD") + 63)//64
+    oalice_bits = define(internal, "OALICE_BITS")
+    obob_bits = define(internal, "OBOB_BITS")
+    pname = "p" + prime
+
+    for variant in ("", "_compressed"):
+        unit = read(os.path.join(pdir, "P%s%s.c" % (prime, variant)))
+        p = from_words(array(unit, pname))
+        F = Fp2(p)
+        R = pow(2, 64*nwords, p)
+        Rinv = pow(R, p - 2, p)
+
+        def xQ(gen):
+            # Second generator value, x(Q) = XQ0 + XQ1*i, out of Montgomery representation
+            w = array(unit, gen)
+            return ((from_words(w[2*nwords:3*nwords])*Rinv) % p, (from_words(w[3*nwords:4*nwords])*Rinv) % p)
+
+        lines = ["/********************************************************************************************",
+                 "* SIDH: an efficient supersingular isogeny cryptography library",
+                 "*",
+                 "* Abstract: precomputed tables for the fixed-basis three-point ladder for P%s%s"
+                 % (prime, " when using compression" if variant == "_compressed" else ""),
+                 "*********************************************************************************************/ ",
+                 ""]
+        lines += table_text(F, "A_ladder_table", "OALICE_BITS*2*NWORDS64_FIELD", "A", pname,
+                            doublings(F, xQ("A_gen"), oalice_bits), R, nwords)
+        if variant == "":
+            # Bob's table is not used by the compressed variant, whose public key depends on the projective kernel point
+            lines.append("")
+            lines += table_text(F, "B_ladder_table", "(OBOB_BITS-1)*2*NWORDS64_FIELD", "B", pname,
+                                doublings(F, xQ("B_gen"), obob_bits - 1), R, nwords)
+
+        path = os.path.join(pdir, "P%s%s_ladder_tables.c" % (prime, variant))
+        with open(path, "w", newline="") as f:
+            f.write("\r\n".join(lines) + "\r\n")
+
+
+if __name__ == "__main__":
+    for prime in (sys.argv[1:] or ["434", "503", "610", "751"]):
+        generate(prime)